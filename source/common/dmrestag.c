@@ -817,9 +817,11 @@ AcpiDmUpdateResourceName (
         }
     }
 
-    /* Change the resource descriptor name */
+    /* Change the resource descriptor name (re-hash if parent is indexed) */
 
+    AcpiNsIndexRemove (ResourceNode->Parent, ResourceNode);
     ResourceNode->Name.Integer = *ACPI_CAST_PTR (UINT32, &Name[0]);
+    AcpiNsIndexInsert (ResourceNode->Parent, ResourceNode);
 }
 
 
@@ -1107,7 +1109,9 @@ AcpiDmAddResourceToNamespace (
 
     /* Set the name to the default, changed later if resource is referenced */
 
+    AcpiNsIndexRemove (Node->Parent, Node);
     Node->Name.Integer = ACPI_DEFAULT_RESNAME;
+    AcpiNsIndexInsert (Node->Parent, Node);
 
     /* Save the offset of the descriptor (within the original buffer) */
 
@@ -1206,6 +1206,7 @@ AcpiDbGenerateGpe (
     UINT32                  BlockNumber = 0;
     UINT32                  GpeNumber;
     ACPI_GPE_EVENT_INFO     *GpeEventInfo;
+    ACPI_CPU_FLAGS          Flags;
 
 
     GpeNumber = strtoul (GpeArg, NULL, 0);
@@ -1223,15 +1224,21 @@ AcpiDbGenerateGpe (
         }
     }
 
+    /* The GPE dispatch state is protected by the GpeLock */
+
+    Flags = AcpiOsAcquireLock (AcpiGbl_GpeLock);
+
     GpeEventInfo = AcpiEvGetGpeEventInfo (
         ACPI_TO_POINTER (BlockNumber), GpeNumber);
     if (!GpeEventInfo)
     {
+        AcpiOsReleaseLock (AcpiGbl_GpeLock, Flags);
         AcpiOsPrintf ("Invalid GPE\n");
         return;
     }
 
     (void) AcpiEvGpeDispatch (NULL, GpeEventInfo, GpeNumber);
+    AcpiOsReleaseLock (AcpiGbl_GpeLock, Flags);
 }
 
 
@@ -1243,7 +1250,8 @@ AcpiDbGenerateGpe (
  *
  * RETURN:      None
  *
- * DESCRIPTION: Simulate an SCI -- just call the SCI dispatch.
+ * DESCRIPTION: Simulate an SCI -- detect and dispatch the active GPEs of
+ *              the SCI interrupt level, then call the SCI dispatch.
  *
  ******************************************************************************/
 
@@ -1251,6 +1259,7 @@ void
 AcpiDbGenerateSci (
     void)
 {
+    (void) AcpiEvGpeDetect (AcpiGbl_GpeXruptListHead);
     AcpiEvSciDispatch ();
 }
 
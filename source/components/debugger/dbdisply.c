@@ -594,10 +594,8 @@ AcpiDbDisplayResults (
     UINT32                  i;
     ACPI_WALK_STATE         *WalkState;
     ACPI_OPERAND_OBJECT     *ObjDesc;
-    UINT32                  ResultCount = 0;
+    UINT32                  ResultCount;
     ACPI_NAMESPACE_NODE     *Node;
-    ACPI_GENERIC_STATE      *Frame;
-    UINT32                  Index; /* Index onto current frame */
 
 
     WalkState = AcpiDsGetCurrentWalkState (AcpiGbl_CurrentWalkList);
@@ -609,32 +607,18 @@ AcpiDbDisplayResults (
 
     Node  = WalkState->MethodNode;
 
-    if (WalkState->Results)
-    {
-        ResultCount = WalkState->ResultCount;
-    }
+    ResultCount = WalkState->ResultCount;
 
     AcpiOsPrintf ("Method [%4.4s] has %X stacked result objects\n",
         AcpiUtGetNodeName (Node), ResultCount);
 
     /* From the top element of result stack */
 
-    Frame = WalkState->Results;
-    Index = (ResultCount - 1) % ACPI_RESULTS_FRAME_OBJ_NUM;
-
     for (i = 0; i < ResultCount; i++)
     {
-        ObjDesc = Frame->Results.ObjDesc[Index];
+        ObjDesc = ACPI_DS_RESULT (WalkState, ResultCount - 1 - i);
         AcpiOsPrintf ("Result%u: ", i);
         AcpiDbDisplayInternalObject (ObjDesc, WalkState);
-
-        if (Index == 0)
-        {
-            Frame = Frame->Results.Next;
-            Index = ACPI_RESULTS_FRAME_OBJ_NUM;
-        }
-
-        Index--;
     }
 }
 
@@ -912,6 +896,11 @@ AcpiDbDisplayGpes (
 
             AcpiOsPrintf ("    EventInfo:    %p\n", GpeBlock->EventInfo);
 
+            AcpiOsPrintf (
+                "    Detection:    %u SCIs, %u register reads, %u GPEs dispatched\n",
+                GpeBlock->DetectCount, GpeBlock->RegisterReads,
+                GpeBlock->DispatchCount);
+
             /* Examine each GPE Register within the block */
 
             for (i = 0; i < GpeBlock->RegisterCount; i++)
@@ -1015,6 +1004,19 @@ AcpiDbDisplayGpes (
                         break;
                     }
 
+                    if (GpeEventInfo->CoalescedCount)
+                    {
+                        AcpiOsPrintf (", Coalesced %u",
+                            GpeEventInfo->CoalescedCount);
+                    }
+
+                    if (GpeEventInfo->StormCount)
+                    {
+                        AcpiOsPrintf (", Storms %u%s",
+                            GpeEventInfo->StormCount,
+                            GpeEventInfo->Polling ? " Polling" : "");
+                    }
+
                     AcpiOsPrintf (")\n");
                 }
             }
@@ -44,6 +44,7 @@
 #include "acpi.h"
 #include "accommon.h"
 #include "acnamesp.h"
+#include "acinterp.h"
 #include "acdebug.h"
 
 
@@ -352,6 +353,7 @@ AcpiDbDisplayInternalObject (
 
                 case ACPI_TYPE_PACKAGE:
 
+                    AcpiExGetElementPointer (ObjDesc);
                     AcpiOsPrintf ("%p", ObjDesc->Reference.Where);
                     if (!ObjDesc->Reference.Where)
                     {
@@ -473,12 +473,52 @@ AcpiDbDisplayStatistics (
             AcpiGbl_PsFindCount);
         AcpiOsPrintf ("%-28s:       %7u\n", "Calls to AcpiNsLookup",
             AcpiGbl_NsLookupCount);
-
-        AcpiOsPrintf ("\nMutex usage:\n\n");
+        AcpiOsPrintf ("%-28s:       %7u\n", "Pathname cache hits",
+            AcpiGbl_NsPathCacheHits);
+        AcpiOsPrintf ("%-28s:       %7u\n", "Pathname cache misses",
+            AcpiGbl_NsPathCacheMisses);
+        AcpiOsPrintf ("%-28s:       %7u\n", "Method name cache hits",
+            AcpiGbl_MethodCacheHits);
+        AcpiOsPrintf ("%-28s:       %7u\n", "Method name cache misses",
+            AcpiGbl_MethodCacheMisses);
+        AcpiOsPrintf ("%-28s:       %7u\n", "Method memo hits",
+            AcpiGbl_MethodMemoHits);
+        AcpiOsPrintf ("%-28s:       %7u\n", "Method memo misses",
+            AcpiGbl_MethodMemoMisses);
+        AcpiOsPrintf ("%-28s:       %7u\n", "JIT compiled methods",
+            AcpiGbl_JitMethodCount);
+        AcpiOsPrintf ("%-28s:       %7u\n", "JIT executions",
+            AcpiGbl_JitExecutions);
+        AcpiOsPrintf ("%-28s:       %7u\n", "JIT bailouts",
+            AcpiGbl_JitBailouts);
+        AcpiOsPrintf ("%-28s:       %7u\n", "Memory mapping hits",
+            AcpiGbl_MemMappingHits);
+        AcpiOsPrintf ("%-28s:       %7u\n", "Memory mapping misses",
+            AcpiGbl_MemMappingMisses);
+        AcpiOsPrintf ("%-28s:       %7u\n", "Memory mapping merges",
+            AcpiGbl_MemMappingMerges);
+        AcpiOsPrintf ("%-28s:       %7u\n", "Memory mapping evictions",
+            AcpiGbl_MemMappingEvictions);
+        AcpiOsPrintf ("%-28s:       %7u\n", "Field block transfers",
+            AcpiGbl_FieldBlockTransfers);
+        AcpiOsPrintf ("%-28s:       %7u\n", "GPE storms",
+            AcpiGpeStormCount);
+        AcpiOsPrintf ("%-28s:       %7u\n", "GPE events polled",
+            AcpiGpePolledCount);
+        AcpiOsPrintf ("%-28s:       %7u\n", "GPE events coalesced",
+            AcpiGpeCoalescedCount);
+        AcpiOsPrintf ("%-28s:       %7u\n", "GPE method reruns",
+            AcpiGpeRerunCount);
+
+        AcpiOsPrintf ("\n%-28s  %10s %10s %10s %10s\n\n", "Mutex usage:",
+            "Exclusive", "Waited", "Shared", "Waited");
         for (i = 0; i < ACPI_NUM_MUTEX; i++)
         {
-            AcpiOsPrintf ("%-28s:       %7u\n",
-                AcpiUtGetMutexName (i), AcpiGbl_MutexInfo[i].UseCount);
+            AcpiOsPrintf ("%-28s: %10u %10u %10u %10u\n",
+                AcpiUtGetMutexName (i), AcpiGbl_MutexInfo[i].UseCount,
+                AcpiGbl_MutexInfo[i].ContentionCount,
+                AcpiGbl_MutexInfo[i].SharedCount,
+                AcpiGbl_MutexInfo[i].SharedContentionCount);
         }
         break;
 
@@ -528,7 +568,6 @@ AcpiDbDisplayStatistics (
         AcpiOsPrintf ("Parse Scope      %3d\n", (UINT32) sizeof (ACPI_PSCOPE_STATE));
         AcpiOsPrintf ("Package State    %3d\n", (UINT32) sizeof (ACPI_PKG_STATE));
         AcpiOsPrintf ("Thread State     %3d\n", (UINT32) sizeof (ACPI_THREAD_STATE));
-        AcpiOsPrintf ("Result Values    %3d\n", (UINT32) sizeof (ACPI_RESULT_VALUES));
         AcpiOsPrintf ("Notify Info      %3d\n", (UINT32) sizeof (ACPI_NOTIFY_INFO));
         break;
 
@@ -47,6 +47,7 @@
 #include "amlcode.h"
 #include "acinterp.h"
 #include "acnamesp.h"
+#include "acdispat.h"
 #include "acdebug.h"
 #include "acconvert.h"
 
@@ -1031,13 +1032,10 @@ AcpiDmDisassembleOneOp (
 
         if ((Op->Common.AmlOpcode == AML_INT_RETURN_VALUE_OP) &&
             (WalkState) &&
-            (WalkState->Results) &&
             (WalkState->ResultCount))
         {
             AcpiDbDecodeInternalObject (
-                WalkState->Results->Results.ObjDesc [
-                    (WalkState->ResultCount - 1) %
-                        ACPI_RESULTS_FRAME_OBJ_NUM]);
+                ACPI_DS_RESULT (WalkState, WalkState->ResultCount - 1));
         }
 #endif
 
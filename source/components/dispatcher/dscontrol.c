@@ -110,12 +110,15 @@ AcpiDsExecBeginControlOp (
          * constructs. We need to manage these as a stack, in order
          * to handle nesting.
          */
-        ControlState = AcpiUtCreateControlState ();
+        ControlState = AcpiUtArenaCreateState (WalkState->ParserState.Arena);
         if (!ControlState)
         {
             Status = AE_NO_MEMORY;
             break;
         }
+
+        ControlState->Common.DescriptorType = ACPI_DESC_TYPE_STATE_CONTROL;
+        ControlState->Common.State = ACPI_CONTROL_CONDITIONAL_EXECUTING;
         /*
          * Save a pointer to the predicate for multiple executions
          * of a loop
@@ -203,7 +206,7 @@ AcpiDsExecEndControlOp (
          * of the IF and free it
          */
         ControlState = AcpiUtPopGenericState (&WalkState->ControlState);
-        AcpiUtDeleteGenericState (ControlState);
+        AcpiUtArenaDeleteState (WalkState->ParserState.Arena, ControlState);
         break;
 
     case AML_ELSE_OP:
@@ -250,7 +253,7 @@ AcpiDsExecEndControlOp (
         /* Pop this control state and free it */
 
         ControlState = AcpiUtPopGenericState (&WalkState->ControlState);
-        AcpiUtDeleteGenericState (ControlState);
+        AcpiUtArenaDeleteState (WalkState->ParserState.Arena, ControlState);
         break;
 
     case AML_RETURN_OP:
@@ -312,22 +315,22 @@ AcpiDsExecEndControlOp (
              * Allow references created by the Index operator to return
              * unchanged.
              */
-            if ((ACPI_GET_DESCRIPTOR_TYPE (WalkState->Results->Results.ObjDesc[0]) ==
+            if ((ACPI_GET_DESCRIPTOR_TYPE (ACPI_DS_RESULT (WalkState, 0)) ==
                     ACPI_DESC_TYPE_OPERAND) &&
-                ((WalkState->Results->Results.ObjDesc [0])->Common.Type ==
+                ((ACPI_DS_RESULT (WalkState, 0))->Common.Type ==
                     ACPI_TYPE_LOCAL_REFERENCE) &&
-                ((WalkState->Results->Results.ObjDesc [0])->Reference.Class !=
+                ((ACPI_DS_RESULT (WalkState, 0))->Reference.Class !=
                     ACPI_REFCLASS_INDEX))
             {
                 Status = AcpiExResolveToValue (
-                    &WalkState->Results->Results.ObjDesc [0], WalkState);
+                    &ACPI_DS_RESULT (WalkState, 0), WalkState);
                 if (ACPI_FAILURE (Status))
                 {
                     return (Status);
                 }
             }
 
-            WalkState->ReturnDesc = WalkState->Results->Results.ObjDesc [0];
+            WalkState->ReturnDesc = ACPI_DS_RESULT (WalkState, 0);
         }
         else
         {
@@ -378,7 +381,7 @@ AcpiDsExecEndControlOp (
                 (WalkState->ControlState->Control.Opcode != AML_WHILE_OP))
         {
             ControlState = AcpiUtPopGenericState (&WalkState->ControlState);
-            AcpiUtDeleteGenericState (ControlState);
+            AcpiUtArenaDeleteState (WalkState->ParserState.Arena, ControlState);
         }
 
         /* No while found? */
@@ -142,6 +142,10 @@ AcpiDsInitOneObject (
             break;
         }
 
+        /* Check for side effects, results of pure methods are remembered */
+
+        AcpiDsMemoAnalyzeMethod (Node, ObjDesc);
+
         /* Ignore if already serialized */
 
         if (ObjDesc->Method.InfoFlags & ACPI_METHOD_SERIALIZED)
@@ -0,0 +1,1778 @@
+/*******************************************************************************
+ *
+ * Module Name: dsjit - Native x86-64 code for hot control methods
+ *
+ ******************************************************************************/
+
+/*
+ * Copyright (C) 2000 - 2023, Intel Corp.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions, and the following disclaimer,
+ *    without modification.
+ * 2. Redistributions in binary form must reproduce at minimum a disclaimer
+ *    substantially similar to the "NO WARRANTY" disclaimer below
+ *    ("Disclaimer") and any redistribution must be conditioned upon
+ *    including a substantially similar Disclaimer requirement for further
+ *    binary redistribution.
+ * 3. Neither the names of the above-listed copyright holders nor the names
+ *    of any contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * Alternatively, this software may be distributed under the terms of the
+ * GNU General Public License ("GPL") version 2 as published by the Free
+ * Software Foundation.
+ *
+ * NO WARRANTY
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGES.
+ */
+
+
+
+#include "acpi.h"
+#include "accommon.h"
+#include "acparser.h"
+#include "amlcode.h"
+#include "acdispat.h"
+#include "acnamesp.h"
+
+
+#define _COMPONENT          ACPI_DISPATCHER
+        ACPI_MODULE_NAME    ("dsjit")
+
+#ifdef ACPI_USE_NATIVE_JIT
+
+/*
+ * Methods that are evaluated over and over (thermal polling, battery status,
+ * EC query handlers) often only compute an Integer from their arguments,
+ * their locals and constant tables. Once such a method has been evaluated
+ * ACPI_JIT_CALL_THRESHOLD times through AcpiNsEvaluate, it is parsed and
+ * translated to x86-64 code, and later evaluations call that code instead
+ * of running the interpreter.
+ *
+ * The translated subset: Integer constants, LocalX, ArgX, Store, Add,
+ * Subtract, Multiply, Divide, Mod, And, Or, Xor, Nand, Nor, Not, ShiftLeft,
+ * ShiftRight, Increment, Decrement, LAnd, LOr, LNot, LEqual, LGreater, LLess,
+ * If/Else, While, Break, Continue, Return, Noop, and DerefOf (Index ()) of a
+ * named Package. Targets must be a Local, an Arg or absent. A method using
+ * anything else is not compiled.
+ *
+ * All values are Integers, so the code keeps them in an ACPI_JIT_FRAME and
+ * never creates operand objects. The only object the code reads is a named
+ * Package, through AcpiDsJitGetElement; the code writes nothing but the
+ * frame. Whenever the code meets a case the interpreter would handle
+ * differently (an uninitialized Local or Arg, a divide by zero, an element
+ * that is not an Integer, a While loop running for a long time) it gives
+ * up and returns ACPI_JIT_BAILOUT. Since nothing outside the frame has
+ * changed, the method is then simply executed by the interpreter from the
+ * start, which reports any error exactly as before.
+ *
+ * Code is generated for the System V x86-64 ABI. The frame pointer is kept
+ * in RBX, expression values in RAX, and the second operand of binary
+ * operators in RCX; pending operands are pushed on the native stack. Every
+ * function starts with a jump to its body, followed by the bailout and exit
+ * sequences at fixed offsets, so that all jumps to them are backwards.
+ *
+ * Compiled code depends on the namespace (the Package nodes) and is thrown
+ * away when AcpiGbl_NsGeneration changes. It is created, executed and freed
+ * with the interpreter locked.
+ */
+
+/* Code layout */
+
+#define ACPI_JIT_BAILOUT_OFFSET     5       /* After the jump to the body */
+#define ACPI_JIT_EXIT_OFFSET        10      /* After "mov eax, ACPI_JIT_BAILOUT" */
+
+#define ACPI_JIT_FRAME_OFFSET(Field) \
+    ((UINT32) ACPI_OFFSET (ACPI_JIT_FRAME, Field))
+
+#define ACPI_JIT_ARG_VALID(Index)   (1 << (8 + (Index)))
+#define ACPI_JIT_LOCAL_VALID(Index) (1 << (Index))
+
+/* Jump kinds for AcpiDsJitEmitJump */
+
+#define ACPI_JIT_JMP                0
+#define ACPI_JIT_JZ                 1
+
+/* Instruction encodings */
+
+#define ACPI_JIT_INSN(Compiler, Insn) \
+    AcpiDsJitEmit ((Compiler), (Insn), sizeof (Insn))
+
+static const UINT8          AcpiJitPrologue[] = {
+    0x55,                               /* push rbp */
+    0x48, 0x89, 0xE5,                   /* mov rbp, rsp */
+    0x53,                               /* push rbx */
+    0x41, 0x54,                         /* push r12 (stack alignment) */
+    0x48, 0x89, 0xFB};                  /* mov rbx, rdi */
+
+static const UINT8          AcpiJitExit[] = {
+    0x48, 0x8D, 0x65, 0xF0,             /* lea rsp, [rbp-16] */
+    0x41, 0x5C,                         /* pop r12 */
+    0x5B,                               /* pop rbx */
+    0x5D,                               /* pop rbp */
+    0xC3};                              /* ret */
+
+static const UINT8          AcpiJitPushRax[] =      {0x50};
+static const UINT8          AcpiJitPopRax[] =       {0x58};
+static const UINT8          AcpiJitMovRcxRax[] =    {0x48, 0x89, 0xC1};
+static const UINT8          AcpiJitMovRaxRdx[] =    {0x48, 0x89, 0xD0};
+static const UINT8          AcpiJitMovRdxRax[] =    {0x48, 0x89, 0xC2};
+static const UINT8          AcpiJitMovRdiRbx[] =    {0x48, 0x89, 0xDF};
+static const UINT8          AcpiJitXorEaxEax[] =    {0x31, 0xC0};
+static const UINT8          AcpiJitXorEdxEdx[] =    {0x31, 0xD2};
+static const UINT8          AcpiJitMovRaxOnes[] =   {0x48, 0xC7, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF};
+static const UINT8          AcpiJitTestRaxRax[] =   {0x48, 0x85, 0xC0};
+static const UINT8          AcpiJitTestRcxRcx[] =   {0x48, 0x85, 0xC9};
+static const UINT8          AcpiJitTestEaxEax[] =   {0x85, 0xC0};
+static const UINT8          AcpiJitCallRax[] =      {0xFF, 0xD0};
+static const UINT8          AcpiJitSubRsp8[] =      {0x48, 0x83, 0xEC, 0x08};
+static const UINT8          AcpiJitAddRsp8[] =      {0x48, 0x83, 0xC4, 0x08};
+
+static const UINT8          AcpiJitAddRaxRcx[] =    {0x48, 0x01, 0xC8};
+static const UINT8          AcpiJitSubRaxRcx[] =    {0x48, 0x29, 0xC8};
+static const UINT8          AcpiJitImulRaxRcx[] =   {0x48, 0x0F, 0xAF, 0xC1};
+static const UINT8          AcpiJitAndRaxRcx[] =    {0x48, 0x21, 0xC8};
+static const UINT8          AcpiJitOrRaxRcx[] =     {0x48, 0x09, 0xC8};
+static const UINT8          AcpiJitXorRaxRcx[] =    {0x48, 0x31, 0xC8};
+static const UINT8          AcpiJitNotRax[] =       {0x48, 0xF7, 0xD0};
+static const UINT8          AcpiJitDivRcx[] =       {0x48, 0xF7, 0xF1};
+static const UINT8          AcpiJitIncRax[] =       {0x48, 0x83, 0xC0, 0x01};
+static const UINT8          AcpiJitDecRax[] =       {0x48, 0x83, 0xE8, 0x01};
+static const UINT8          AcpiJitCmpRaxRcx[] =    {0x48, 0x39, 0xC8};
+
+/* Shift by CL, zero if the count is 64 or more (as AcpiExDoMathOp) */
+
+static const UINT8          AcpiJitShlRaxCl[] = {
+    0x48, 0x83, 0xF9, 0x40,             /* cmp rcx, 64 */
+    0x73, 0x05,                         /* jae zero */
+    0x48, 0xD3, 0xE0,                   /* shl rax, cl */
+    0xEB, 0x02,                         /* jmp done */
+    0x31, 0xC0};                        /* zero: xor eax, eax */
+
+static const UINT8          AcpiJitShrRaxCl[] = {
+    0x48, 0x83, 0xF9, 0x40,             /* cmp rcx, 64 */
+    0x73, 0x05,                         /* jae zero */
+    0x48, 0xD3, 0xE8,                   /* shr rax, cl */
+    0xEB, 0x02,                         /* jmp done */
+    0x31, 0xC0};                        /* zero: xor eax, eax */
+
+/* Logical results: TRUE is Ones, FALSE is Zero */
+
+static const UINT8          AcpiJitSetE[] =     {0x0F, 0x94, 0xC0};
+static const UINT8          AcpiJitSetA[] =     {0x0F, 0x97, 0xC0};
+static const UINT8          AcpiJitSetB[] =     {0x0F, 0x92, 0xC0};
+static const UINT8          AcpiJitSetNe[] =    {0x0F, 0x95, 0xC0};
+static const UINT8          AcpiJitSetNeCl[] =  {0x0F, 0x95, 0xC1};
+static const UINT8          AcpiJitAndAlCl[] =  {0x20, 0xC8};
+static const UINT8          AcpiJitOrAlCl[] =   {0x08, 0xC8};
+
+static const UINT8          AcpiJitLogical[] = {
+    0x0F, 0xB6, 0xC0,                   /* movzx eax, al */
+    0x48, 0xF7, 0xD8};                  /* neg rax */
+
+
+/* State of the translation of one method */
+
+typedef struct acpi_jit_compiler
+{
+    UINT8                   *Code;
+    UINT32                  Length;
+    BOOLEAN                 Overflow;       /* Code exceeds ACPI_JIT_MAX_CODE_SIZE */
+    UINT32                  Depth;          /* Values pushed on the native stack */
+    BOOLEAN                 InLoop;
+    UINT32                  LoopTop;        /* Offset of the innermost While */
+    UINT32                  BreakChain;     /* Break jumps of the innermost While */
+    ACPI_GENERIC_STATE      ScopeInfo;      /* Method scope, for name lookups */
+
+} ACPI_JIT_COMPILER;
+
+
+/* Local prototypes */
+
+static UINT32
+AcpiDsJitGetElement (
+    ACPI_JIT_FRAME          *Frame,
+    ACPI_NAMESPACE_NODE     *Node,
+    UINT64                  Index);
+
+static UINT32
+AcpiDsJitCheckLoop (
+    ACPI_JIT_FRAME          *Frame);
+
+static void
+AcpiDsJitEmit (
+    ACPI_JIT_COMPILER       *Compiler,
+    const UINT8             *Bytes,
+    UINT32                  Length);
+
+static void
+AcpiDsJitEmitImmediate (
+    ACPI_JIT_COMPILER       *Compiler,
+    UINT64                  Value,
+    UINT32                  Length);
+
+static void
+AcpiDsJitEmitFrameOp (
+    ACPI_JIT_COMPILER       *Compiler,
+    UINT8                   Opcode,
+    UINT8                   ModRm,
+    UINT32                  Offset);
+
+static void
+AcpiDsJitEmitJump (
+    ACPI_JIT_COMPILER       *Compiler,
+    UINT32                  Kind,
+    UINT32                  Target);
+
+static UINT32
+AcpiDsJitEmitForwardJump (
+    ACPI_JIT_COMPILER       *Compiler,
+    UINT32                  Kind,
+    UINT32                  Chain);
+
+static void
+AcpiDsJitPatchJumps (
+    ACPI_JIT_COMPILER       *Compiler,
+    UINT32                  Chain);
+
+static void
+AcpiDsJitEmitCall (
+    ACPI_JIT_COMPILER       *Compiler,
+    void                    *Function);
+
+static BOOLEAN
+AcpiDsJitGetVariable (
+    ACPI_PARSE_OBJECT       *Op,
+    UINT32                  *Offset,
+    UINT32                  *ValidBit);
+
+static BOOLEAN
+AcpiDsJitEmitRead (
+    ACPI_JIT_COMPILER       *Compiler,
+    ACPI_PARSE_OBJECT       *Op);
+
+static BOOLEAN
+AcpiDsJitEmitStore (
+    ACPI_JIT_COMPILER       *Compiler,
+    ACPI_PARSE_OBJECT       *Target);
+
+static BOOLEAN
+AcpiDsJitEmitOperands (
+    ACPI_JIT_COMPILER       *Compiler,
+    ACPI_PARSE_OBJECT       *Op);
+
+static BOOLEAN
+AcpiDsJitEmitElement (
+    ACPI_JIT_COMPILER       *Compiler,
+    ACPI_PARSE_OBJECT       *Op);
+
+static BOOLEAN
+AcpiDsJitEmitExpression (
+    ACPI_JIT_COMPILER       *Compiler,
+    ACPI_PARSE_OBJECT       *Op);
+
+static BOOLEAN
+AcpiDsJitEmitIf (
+    ACPI_JIT_COMPILER       *Compiler,
+    ACPI_PARSE_OBJECT       *Op,
+    ACPI_PARSE_OBJECT       *ElseOp);
+
+static BOOLEAN
+AcpiDsJitEmitWhile (
+    ACPI_JIT_COMPILER       *Compiler,
+    ACPI_PARSE_OBJECT       *Op);
+
+static BOOLEAN
+AcpiDsJitEmitTermList (
+    ACPI_JIT_COMPILER       *Compiler,
+    ACPI_PARSE_OBJECT       *Op);
+
+static ACPI_STATUS
+AcpiDsJitBeginOp (
+    ACPI_WALK_STATE         *WalkState,
+    ACPI_PARSE_OBJECT       **OutOp);
+
+static BOOLEAN
+AcpiDsJitCompile (
+    ACPI_NAMESPACE_NODE     *Node,
+    ACPI_OPERAND_OBJECT     *ObjDesc,
+    ACPI_METHOD_JIT         *Jit);
+
+static void
+AcpiDsJitReset (
+    ACPI_METHOD_JIT         *Jit);
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitGetElement
+ *
+ * PARAMETERS:  Frame           - Frame of the running native code
+ *              Node            - Namespace node of a Package
+ *              Index           - Element index
+ *
+ * RETURN:      TRUE if the element is an Integer, its value is returned in
+ *              Frame->Scratch. FALSE if the interpreter must take over.
+ *
+ * DESCRIPTION: DerefOf (Index (Package, Index)), called from native code.
+ *
+ ******************************************************************************/
+
+static UINT32
+AcpiDsJitGetElement (
+    ACPI_JIT_FRAME          *Frame,
+    ACPI_NAMESPACE_NODE     *Node,
+    UINT64                  Index)
+{
+    ACPI_OPERAND_OBJECT     *ObjDesc;
+    ACPI_OPERAND_OBJECT     *Element;
+
+
+    ObjDesc = AcpiNsGetAttachedObject (Node);
+    if (!ObjDesc ||
+        (ObjDesc->Common.Type != ACPI_TYPE_PACKAGE) ||
+        !(ObjDesc->Common.Flags & AOPOBJ_DATA_VALID) ||
+        (Index >= ObjDesc->Package.Count))
+    {
+        return (FALSE);
+    }
+
+    Element = ObjDesc->Package.Elements[Index];
+    if (!Element ||
+        (ACPI_GET_DESCRIPTOR_TYPE (Element) != ACPI_DESC_TYPE_OPERAND) ||
+        (Element->Common.Type != ACPI_TYPE_INTEGER))
+    {
+        return (FALSE);
+    }
+
+    Frame->Scratch = Element->Integer.Value;
+    return (TRUE);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitCheckLoop
+ *
+ * PARAMETERS:  Frame           - Frame of the running native code
+ *
+ * RETURN:      TRUE to continue, FALSE if the loops have run too long
+ *
+ * DESCRIPTION: Called from native code every ACPI_JIT_LOOP_CHECK_INTERVAL
+ *              While iterations. Once AcpiGbl_MaxLoopIterations seconds have
+ *              passed, the interpreter takes over and applies its own While
+ *              timeout.
+ *
+ ******************************************************************************/
+
+static UINT32
+AcpiDsJitCheckLoop (
+    ACPI_JIT_FRAME          *Frame)
+{
+    UINT64                  Now = AcpiOsGetTimer ();
+
+
+    if (!Frame->LoopTimeout)
+    {
+        Frame->LoopTimeout = Now +
+            ((UINT64) AcpiGbl_MaxLoopIterations * ACPI_100NSEC_PER_SEC);
+    }
+    else if (Now >= Frame->LoopTimeout)
+    {
+        return (FALSE);
+    }
+
+    Frame->LoopBudget = ACPI_JIT_LOOP_CHECK_INTERVAL;
+    return (TRUE);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitEmit
+ *
+ * PARAMETERS:  Compiler        - Translation state
+ *              Bytes           - Machine code
+ *              Length          - Number of bytes
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Append machine code to the code buffer.
+ *
+ ******************************************************************************/
+
+static void
+AcpiDsJitEmit (
+    ACPI_JIT_COMPILER       *Compiler,
+    const UINT8             *Bytes,
+    UINT32                  Length)
+{
+
+    if (Compiler->Length + Length > ACPI_JIT_MAX_CODE_SIZE)
+    {
+        Compiler->Overflow = TRUE;
+        return;
+    }
+
+    memcpy (&Compiler->Code[Compiler->Length], Bytes, Length);
+    Compiler->Length += Length;
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitEmitImmediate
+ *
+ * PARAMETERS:  Compiler        - Translation state
+ *              Value           - Immediate value
+ *              Length          - Size of the immediate, 1, 4 or 8 bytes
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Append a little-endian immediate operand.
+ *
+ ******************************************************************************/
+
+static void
+AcpiDsJitEmitImmediate (
+    ACPI_JIT_COMPILER       *Compiler,
+    UINT64                  Value,
+    UINT32                  Length)
+{
+    UINT8                   Bytes[8];
+    UINT32                  i;
+
+
+    for (i = 0; i < Length; i++)
+    {
+        Bytes[i] = (UINT8) (Value >> (i * 8));
+    }
+
+    AcpiDsJitEmit (Compiler, Bytes, Length);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitEmitFrameOp
+ *
+ * PARAMETERS:  Compiler        - Translation state
+ *              Opcode          - Opcode byte
+ *              ModRm           - ModRM byte, with a [RBX + disp32] operand
+ *              Offset          - Offset of the frame field
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Append a 64-bit instruction that accesses a frame field.
+ *
+ ******************************************************************************/
+
+static void
+AcpiDsJitEmitFrameOp (
+    ACPI_JIT_COMPILER       *Compiler,
+    UINT8                   Opcode,
+    UINT8                   ModRm,
+    UINT32                  Offset)
+{
+    UINT8                   Bytes[3];
+
+
+    Bytes[0] = 0x48;                    /* REX.W */
+    Bytes[1] = Opcode;
+    Bytes[2] = ModRm;
+
+    AcpiDsJitEmit (Compiler, Bytes, sizeof (Bytes));
+    AcpiDsJitEmitImmediate (Compiler, Offset, 4);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitEmitJump
+ *
+ * PARAMETERS:  Compiler        - Translation state
+ *              Kind            - ACPI_JIT_JMP or ACPI_JIT_JZ
+ *              Target          - Code offset to jump to
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Append a jump to code that has already been generated.
+ *
+ ******************************************************************************/
+
+static void
+AcpiDsJitEmitJump (
+    ACPI_JIT_COMPILER       *Compiler,
+    UINT32                  Kind,
+    UINT32                  Target)
+{
+    static const UINT8      Jmp[] = {0xE9};
+    static const UINT8      Jz[] = {0x0F, 0x84};
+
+
+    if (Kind == ACPI_JIT_JZ)
+    {
+        ACPI_JIT_INSN (Compiler, Jz);
+    }
+    else
+    {
+        ACPI_JIT_INSN (Compiler, Jmp);
+    }
+
+    AcpiDsJitEmitImmediate (Compiler,
+        (UINT64) (INT64) ((INT32) Target - (INT32) (Compiler->Length + 4)), 4);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitEmitForwardJump
+ *
+ * PARAMETERS:  Compiler        - Translation state
+ *              Kind            - ACPI_JIT_JMP or ACPI_JIT_JZ
+ *              Chain           - Previous jump to the same target, 0 if none
+ *
+ * RETURN:      New head of the chain
+ *
+ * DESCRIPTION: Append a jump to code that has not been generated yet. Until
+ *              AcpiDsJitPatchJumps, the displacement of each jump holds the
+ *              offset of the previous jump to the same target.
+ *
+ ******************************************************************************/
+
+static UINT32
+AcpiDsJitEmitForwardJump (
+    ACPI_JIT_COMPILER       *Compiler,
+    UINT32                  Kind,
+    UINT32                  Chain)
+{
+    static const UINT8      Jmp[] = {0xE9};
+    static const UINT8      Jz[] = {0x0F, 0x84};
+    UINT32                  Displacement;
+
+
+    if (Kind == ACPI_JIT_JZ)
+    {
+        ACPI_JIT_INSN (Compiler, Jz);
+    }
+    else
+    {
+        ACPI_JIT_INSN (Compiler, Jmp);
+    }
+
+    Displacement = Compiler->Length;
+    AcpiDsJitEmitImmediate (Compiler, Chain, 4);
+    return (Displacement);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitPatchJumps
+ *
+ * PARAMETERS:  Compiler        - Translation state
+ *              Chain           - Chain of forward jumps
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Point all jumps of a chain to the current code offset.
+ *
+ ******************************************************************************/
+
+static void
+AcpiDsJitPatchJumps (
+    ACPI_JIT_COMPILER       *Compiler,
+    UINT32                  Chain)
+{
+    UINT8                   *Field;
+    UINT32                  Next;
+    INT32                   Displacement;
+
+
+    if (Compiler->Overflow)
+    {
+        return;
+    }
+
+    while (Chain)
+    {
+        Field = &Compiler->Code[Chain];
+        Next = (UINT32) Field[0] | ((UINT32) Field[1] << 8) |
+            ((UINT32) Field[2] << 16) | ((UINT32) Field[3] << 24);
+
+        Displacement = (INT32) Compiler->Length - (INT32) (Chain + 4);
+        Field[0] = (UINT8) Displacement;
+        Field[1] = (UINT8) (Displacement >> 8);
+        Field[2] = (UINT8) (Displacement >> 16);
+        Field[3] = (UINT8) (Displacement >> 24);
+
+        Chain = Next;
+    }
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitEmitCall
+ *
+ * PARAMETERS:  Compiler        - Translation state
+ *              Function        - C function to call, arguments already in
+ *                                RDI, RSI and RDX
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Append a call to a helper, keeping the stack 16-byte aligned.
+ *              The stack is aligned after the prologue, so it is misaligned
+ *              while an odd number of values is pushed.
+ *
+ ******************************************************************************/
+
+static void
+AcpiDsJitEmitCall (
+    ACPI_JIT_COMPILER       *Compiler,
+    void                    *Function)
+{
+    static const UINT8      MovRax[] = {0x48, 0xB8};
+
+
+    if (Compiler->Depth & 1)
+    {
+        ACPI_JIT_INSN (Compiler, AcpiJitSubRsp8);
+    }
+
+    ACPI_JIT_INSN (Compiler, MovRax);
+    AcpiDsJitEmitImmediate (Compiler, ACPI_PTR_TO_PHYSADDR (Function), 8);
+    ACPI_JIT_INSN (Compiler, AcpiJitCallRax);
+
+    if (Compiler->Depth & 1)
+    {
+        ACPI_JIT_INSN (Compiler, AcpiJitAddRsp8);
+    }
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitGetVariable
+ *
+ * PARAMETERS:  Op              - Parse op
+ *              Offset          - Where the frame offset of the value is
+ *                                returned
+ *              ValidBit        - Where the bit in Frame->Valid is returned
+ *
+ * RETURN:      TRUE if Op is a LocalX or ArgX
+ *
+ * DESCRIPTION: Locate the frame slot of a method local or argument.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiDsJitGetVariable (
+    ACPI_PARSE_OBJECT       *Op,
+    UINT32                  *Offset,
+    UINT32                  *ValidBit)
+{
+    UINT32                  Index;
+
+
+    if (!Op)
+    {
+        return (FALSE);
+    }
+
+    switch (AcpiPsGetOpcodeInfo (Op->Common.AmlOpcode)->Type)
+    {
+    case AML_TYPE_LOCAL_VARIABLE:
+
+        Index = Op->Common.AmlOpcode - AML_FIRST_LOCAL_OP;
+        *Offset = ACPI_JIT_FRAME_OFFSET (Locals[Index]);
+        *ValidBit = ACPI_JIT_LOCAL_VALID (Index);
+        return (TRUE);
+
+    case AML_TYPE_METHOD_ARGUMENT:
+
+        Index = Op->Common.AmlOpcode - AML_FIRST_ARG_OP;
+        *Offset = ACPI_JIT_FRAME_OFFSET (Args[Index]);
+        *ValidBit = ACPI_JIT_ARG_VALID (Index);
+        return (TRUE);
+
+    default:
+
+        return (FALSE);
+    }
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitEmitRead
+ *
+ * PARAMETERS:  Compiler        - Translation state
+ *              Op              - LocalX or ArgX op
+ *
+ * RETURN:      TRUE if the op was translated
+ *
+ * DESCRIPTION: Load a local or argument into RAX. Bails out if it has no
+ *              value yet.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiDsJitEmitRead (
+    ACPI_JIT_COMPILER       *Compiler,
+    ACPI_PARSE_OBJECT       *Op)
+{
+    static const UINT8      TestValid[] = {0xF7, 0x83};
+    UINT32                  Offset;
+    UINT32                  ValidBit;
+
+
+    if (!AcpiDsJitGetVariable (Op, &Offset, &ValidBit))
+    {
+        return (FALSE);
+    }
+
+    /* test dword [rbx + Valid], ValidBit; jz bailout */
+
+    ACPI_JIT_INSN (Compiler, TestValid);
+    AcpiDsJitEmitImmediate (Compiler, ACPI_JIT_FRAME_OFFSET (Valid), 4);
+    AcpiDsJitEmitImmediate (Compiler, ValidBit, 4);
+    AcpiDsJitEmitJump (Compiler, ACPI_JIT_JZ, ACPI_JIT_BAILOUT_OFFSET);
+
+    /* mov rax, [rbx + Offset] */
+
+    AcpiDsJitEmitFrameOp (Compiler, 0x8B, 0x83, Offset);
+    return (TRUE);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitEmitStore
+ *
+ * PARAMETERS:  Compiler        - Translation state
+ *              Target          - Target operand op, may be NULL
+ *
+ * RETURN:      TRUE if the target was translated
+ *
+ * DESCRIPTION: Store RAX to a local or argument. A null target stores
+ *              nothing. RAX is preserved.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiDsJitEmitStore (
+    ACPI_JIT_COMPILER       *Compiler,
+    ACPI_PARSE_OBJECT       *Target)
+{
+    static const UINT8      SetValid[] = {0x81, 0x8B};
+    UINT32                  Offset;
+    UINT32                  ValidBit;
+
+
+    if (!Target ||
+        ((Target->Common.AmlOpcode == AML_INT_NAMEPATH_OP) &&
+        (!Target->Common.Value.Name)))
+    {
+        return (TRUE);
+    }
+
+    if (!AcpiDsJitGetVariable (Target, &Offset, &ValidBit))
+    {
+        return (FALSE);
+    }
+
+    /* mov [rbx + Offset], rax; or dword [rbx + Valid], ValidBit */
+
+    AcpiDsJitEmitFrameOp (Compiler, 0x89, 0x83, Offset);
+
+    ACPI_JIT_INSN (Compiler, SetValid);
+    AcpiDsJitEmitImmediate (Compiler, ACPI_JIT_FRAME_OFFSET (Valid), 4);
+    AcpiDsJitEmitImmediate (Compiler, ValidBit, 4);
+    return (TRUE);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitEmitOperands
+ *
+ * PARAMETERS:  Compiler        - Translation state
+ *              Op              - Op with two Integer operands
+ *
+ * RETURN:      TRUE if both operands were translated
+ *
+ * DESCRIPTION: Evaluate the first two operands of an op, in order, into RAX
+ *              and RCX.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiDsJitEmitOperands (
+    ACPI_JIT_COMPILER       *Compiler,
+    ACPI_PARSE_OBJECT       *Op)
+{
+
+    if (!AcpiDsJitEmitExpression (Compiler, AcpiPsGetArg (Op, 0)))
+    {
+        return (FALSE);
+    }
+
+    /*
+     * The interpreter keeps at most two pending results per nesting level
+     * and fails with AE_STACK_OVERFLOW beyond ACPI_RESULTS_OBJ_NUM_MAX.
+     * Deeper expressions are left to it, so that they fail the same way.
+     */
+    ACPI_JIT_INSN (Compiler, AcpiJitPushRax);
+    if (++Compiler->Depth > (ACPI_RESULTS_OBJ_NUM_MAX / 2))
+    {
+        return (FALSE);
+    }
+
+    if (!AcpiDsJitEmitExpression (Compiler, AcpiPsGetArg (Op, 1)))
+    {
+        return (FALSE);
+    }
+
+    ACPI_JIT_INSN (Compiler, AcpiJitMovRcxRax);
+    ACPI_JIT_INSN (Compiler, AcpiJitPopRax);
+    Compiler->Depth--;
+    return (TRUE);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitEmitElement
+ *
+ * PARAMETERS:  Compiler        - Translation state
+ *              Op              - DerefOf op
+ *
+ * RETURN:      TRUE if the op was translated
+ *
+ * DESCRIPTION: DerefOf (Index (Package, Index)) of a named Package, into
+ *              RAX. The element is read through AcpiDsJitGetElement when
+ *              the code runs, since the Package can be changed by Store.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiDsJitEmitElement (
+    ACPI_JIT_COMPILER       *Compiler,
+    ACPI_PARSE_OBJECT       *Op)
+{
+    static const UINT8      MovRsi[] = {0x48, 0xBE};
+    ACPI_PARSE_OBJECT       *IndexOp = Op->Common.Value.Arg;
+    ACPI_PARSE_OBJECT       *Source;
+    ACPI_PARSE_OBJECT       *Target;
+    ACPI_NAMESPACE_NODE     *Node;
+    ACPI_STATUS             Status;
+
+
+    if (!IndexOp || (IndexOp->Common.AmlOpcode != AML_INDEX_OP))
+    {
+        return (FALSE);
+    }
+
+    Source = AcpiPsGetArg (IndexOp, 0);
+    Target = AcpiPsGetArg (IndexOp, 2);
+    if (!Source ||
+        (Source->Common.AmlOpcode != AML_INT_NAMEPATH_OP) ||
+        (!Source->Common.Value.Name) ||
+        (Target && ((Target->Common.AmlOpcode != AML_INT_NAMEPATH_OP) ||
+            Target->Common.Value.Name)))
+    {
+        return (FALSE);
+    }
+
+    Status = AcpiNsLookup (&Compiler->ScopeInfo, Source->Common.Value.Name,
+        ACPI_TYPE_ANY, ACPI_IMODE_EXECUTE,
+        ACPI_NS_SEARCH_PARENT | ACPI_NS_DONT_OPEN_SCOPE, NULL, &Node);
+    if (ACPI_FAILURE (Status) || (Node->Type != ACPI_TYPE_PACKAGE))
+    {
+        return (FALSE);
+    }
+
+    if (!AcpiDsJitEmitExpression (Compiler, AcpiPsGetArg (IndexOp, 1)))
+    {
+        return (FALSE);
+    }
+
+    /* AcpiDsJitGetElement (Frame, Node, Index) */
+
+    ACPI_JIT_INSN (Compiler, AcpiJitMovRdxRax);
+    ACPI_JIT_INSN (Compiler, MovRsi);
+    AcpiDsJitEmitImmediate (Compiler, ACPI_PTR_TO_PHYSADDR (Node), 8);
+    ACPI_JIT_INSN (Compiler, AcpiJitMovRdiRbx);
+    AcpiDsJitEmitCall (Compiler, ACPI_CAST_PTR (void, AcpiDsJitGetElement));
+
+    ACPI_JIT_INSN (Compiler, AcpiJitTestEaxEax);
+    AcpiDsJitEmitJump (Compiler, ACPI_JIT_JZ, ACPI_JIT_BAILOUT_OFFSET);
+
+    /* mov rax, [rbx + Scratch] */
+
+    AcpiDsJitEmitFrameOp (Compiler, 0x8B, 0x83,
+        ACPI_JIT_FRAME_OFFSET (Scratch));
+    return (TRUE);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitEmitExpression
+ *
+ * PARAMETERS:  Compiler        - Translation state
+ *              Op              - Operand or expression op
+ *
+ * RETURN:      TRUE if the op was translated
+ *
+ * DESCRIPTION: Evaluate an Integer expression into RAX, including the store
+ *              to its target, if any.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiDsJitEmitExpression (
+    ACPI_JIT_COMPILER       *Compiler,
+    ACPI_PARSE_OBJECT       *Op)
+{
+    static const UINT8      MovRax[] = {0x48, 0xB8};
+    static const UINT8      MovEax[] = {0xB8};
+    UINT64                  Value;
+
+
+    if (!Op)
+    {
+        return (FALSE);
+    }
+
+    switch (Op->Common.AmlOpcode)
+    {
+    case AML_ZERO_OP:
+
+        ACPI_JIT_INSN (Compiler, AcpiJitXorEaxEax);
+        return (TRUE);
+
+    case AML_ONES_OP:
+
+        ACPI_JIT_INSN (Compiler, AcpiJitMovRaxOnes);
+        return (TRUE);
+
+    case AML_ONE_OP:
+    case AML_BYTE_OP:
+    case AML_WORD_OP:
+    case AML_DWORD_OP:
+    case AML_QWORD_OP:
+
+        Value = Op->Common.Value.Integer;
+        if (Op->Common.AmlOpcode == AML_ONE_OP)
+        {
+            Value = 1;
+        }
+
+        if (Value <= ACPI_UINT32_MAX)
+        {
+            ACPI_JIT_INSN (Compiler, MovEax);
+            AcpiDsJitEmitImmediate (Compiler, Value, 4);
+        }
+        else
+        {
+            ACPI_JIT_INSN (Compiler, MovRax);
+            AcpiDsJitEmitImmediate (Compiler, Value, 8);
+        }
+        return (TRUE);
+
+    case AML_STORE_OP:
+
+        if (!AcpiDsJitEmitExpression (Compiler, AcpiPsGetArg (Op, 0)) ||
+            !AcpiPsGetArg (Op, 1))
+        {
+            return (FALSE);
+        }
+
+        return (AcpiDsJitEmitStore (Compiler, AcpiPsGetArg (Op, 1)));
+
+    case AML_INCREMENT_OP:
+    case AML_DECREMENT_OP:
+
+        if (!AcpiDsJitEmitRead (Compiler, Op->Common.Value.Arg))
+        {
+            return (FALSE);
+        }
+
+        if (Op->Common.AmlOpcode == AML_INCREMENT_OP)
+        {
+            ACPI_JIT_INSN (Compiler, AcpiJitIncRax);
+        }
+        else
+        {
+            ACPI_JIT_INSN (Compiler, AcpiJitDecRax);
+        }
+
+        return (AcpiDsJitEmitStore (Compiler, Op->Common.Value.Arg));
+
+    case AML_BIT_NOT_OP:
+
+        if (!AcpiDsJitEmitExpression (Compiler, AcpiPsGetArg (Op, 0)))
+        {
+            return (FALSE);
+        }
+
+        ACPI_JIT_INSN (Compiler, AcpiJitNotRax);
+        return (AcpiDsJitEmitStore (Compiler, AcpiPsGetArg (Op, 1)));
+
+    case AML_ADD_OP:
+    case AML_SUBTRACT_OP:
+    case AML_MULTIPLY_OP:
+    case AML_BIT_AND_OP:
+    case AML_BIT_OR_OP:
+    case AML_BIT_XOR_OP:
+    case AML_BIT_NAND_OP:
+    case AML_BIT_NOR_OP:
+    case AML_SHIFT_LEFT_OP:
+    case AML_SHIFT_RIGHT_OP:
+
+        if (!AcpiDsJitEmitOperands (Compiler, Op))
+        {
+            return (FALSE);
+        }
+
+        switch (Op->Common.AmlOpcode)
+        {
+        case AML_ADD_OP:
+
+            ACPI_JIT_INSN (Compiler, AcpiJitAddRaxRcx);
+            break;
+
+        case AML_SUBTRACT_OP:
+
+            ACPI_JIT_INSN (Compiler, AcpiJitSubRaxRcx);
+            break;
+
+        case AML_MULTIPLY_OP:
+
+            ACPI_JIT_INSN (Compiler, AcpiJitImulRaxRcx);
+            break;
+
+        case AML_BIT_AND_OP:
+        case AML_BIT_NAND_OP:
+
+            ACPI_JIT_INSN (Compiler, AcpiJitAndRaxRcx);
+            break;
+
+        case AML_BIT_OR_OP:
+        case AML_BIT_NOR_OP:
+
+            ACPI_JIT_INSN (Compiler, AcpiJitOrRaxRcx);
+            break;
+
+        case AML_BIT_XOR_OP:
+
+            ACPI_JIT_INSN (Compiler, AcpiJitXorRaxRcx);
+            break;
+
+        case AML_SHIFT_LEFT_OP:
+
+            ACPI_JIT_INSN (Compiler, AcpiJitShlRaxCl);
+            break;
+
+        default:
+
+            ACPI_JIT_INSN (Compiler, AcpiJitShrRaxCl);
+            break;
+        }
+
+        if ((Op->Common.AmlOpcode == AML_BIT_NAND_OP) ||
+            (Op->Common.AmlOpcode == AML_BIT_NOR_OP))
+        {
+            ACPI_JIT_INSN (Compiler, AcpiJitNotRax);
+        }
+
+        return (AcpiDsJitEmitStore (Compiler, AcpiPsGetArg (Op, 2)));
+
+    case AML_DIVIDE_OP:
+    case AML_MOD_OP:
+
+        if (!AcpiDsJitEmitOperands (Compiler, Op))
+        {
+            return (FALSE);
+        }
+
+        /* Division by zero is reported by the interpreter */
+
+        ACPI_JIT_INSN (Compiler, AcpiJitTestRcxRcx);
+        AcpiDsJitEmitJump (Compiler, ACPI_JIT_JZ, ACPI_JIT_BAILOUT_OFFSET);
+        ACPI_JIT_INSN (Compiler, AcpiJitXorEdxEdx);
+        ACPI_JIT_INSN (Compiler, AcpiJitDivRcx);
+
+        if (Op->Common.AmlOpcode == AML_MOD_OP)
+        {
+            ACPI_JIT_INSN (Compiler, AcpiJitMovRaxRdx);
+            return (AcpiDsJitEmitStore (Compiler, AcpiPsGetArg (Op, 2)));
+        }
+
+        /* Divide (Dividend, Divisor, Remainder, Result) */
+
+        ACPI_JIT_INSN (Compiler, AcpiJitPushRax);
+        Compiler->Depth++;
+        ACPI_JIT_INSN (Compiler, AcpiJitMovRaxRdx);
+        if (!AcpiDsJitEmitStore (Compiler, AcpiPsGetArg (Op, 2)))
+        {
+            return (FALSE);
+        }
+
+        ACPI_JIT_INSN (Compiler, AcpiJitPopRax);
+        Compiler->Depth--;
+        return (AcpiDsJitEmitStore (Compiler, AcpiPsGetArg (Op, 3)));
+
+    case AML_LOGICAL_EQUAL_OP:
+    case AML_LOGICAL_GREATER_OP:
+    case AML_LOGICAL_LESS_OP:
+
+        if (!AcpiDsJitEmitOperands (Compiler, Op))
+        {
+            return (FALSE);
+        }
+
+        ACPI_JIT_INSN (Compiler, AcpiJitCmpRaxRcx);
+        switch (Op->Common.AmlOpcode)
+        {
+        case AML_LOGICAL_EQUAL_OP:
+
+            ACPI_JIT_INSN (Compiler, AcpiJitSetE);
+            break;
+
+        case AML_LOGICAL_GREATER_OP:
+
+            ACPI_JIT_INSN (Compiler, AcpiJitSetA);
+            break;
+
+        default:
+
+            ACPI_JIT_INSN (Compiler, AcpiJitSetB);
+            break;
+        }
+
+        ACPI_JIT_INSN (Compiler, AcpiJitLogical);
+        return (TRUE);
+
+    case AML_LOGICAL_AND_OP:
+    case AML_LOGICAL_OR_OP:
+
+        if (!AcpiDsJitEmitOperands (Compiler, Op))
+        {
+            return (FALSE);
+        }
+
+        ACPI_JIT_INSN (Compiler, AcpiJitTestRaxRax);
+        ACPI_JIT_INSN (Compiler, AcpiJitSetNe);
+        ACPI_JIT_INSN (Compiler, AcpiJitTestRcxRcx);
+        ACPI_JIT_INSN (Compiler, AcpiJitSetNeCl);
+
+        if (Op->Common.AmlOpcode == AML_LOGICAL_AND_OP)
+        {
+            ACPI_JIT_INSN (Compiler, AcpiJitAndAlCl);
+        }
+        else
+        {
+            ACPI_JIT_INSN (Compiler, AcpiJitOrAlCl);
+        }
+
+        ACPI_JIT_INSN (Compiler, AcpiJitLogical);
+        return (TRUE);
+
+    case AML_LOGICAL_NOT_OP:
+
+        if (!AcpiDsJitEmitExpression (Compiler, Op->Common.Value.Arg))
+        {
+            return (FALSE);
+        }
+
+        ACPI_JIT_INSN (Compiler, AcpiJitTestRaxRax);
+        ACPI_JIT_INSN (Compiler, AcpiJitSetE);
+        ACPI_JIT_INSN (Compiler, AcpiJitLogical);
+        return (TRUE);
+
+    case AML_DEREF_OF_OP:
+
+        return (AcpiDsJitEmitElement (Compiler, Op));
+
+    default:
+
+        break;
+    }
+
+    /* LocalX and ArgX */
+
+    return (AcpiDsJitEmitRead (Compiler, Op));
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitEmitIf
+ *
+ * PARAMETERS:  Compiler        - Translation state
+ *              Op              - If op
+ *              ElseOp          - Else op that follows it, NULL if none
+ *
+ * RETURN:      TRUE if the statement was translated
+ *
+ * DESCRIPTION: Translate If (Predicate) {...} Else {...}.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiDsJitEmitIf (
+    ACPI_JIT_COMPILER       *Compiler,
+    ACPI_PARSE_OBJECT       *Op,
+    ACPI_PARSE_OBJECT       *ElseOp)
+{
+    ACPI_PARSE_OBJECT       *Predicate = Op->Common.Value.Arg;
+    UINT32                  ElseJump;
+    UINT32                  EndJump;
+
+
+    if (!AcpiDsJitEmitExpression (Compiler, Predicate))
+    {
+        return (FALSE);
+    }
+
+    ACPI_JIT_INSN (Compiler, AcpiJitTestRaxRax);
+    ElseJump = AcpiDsJitEmitForwardJump (Compiler, ACPI_JIT_JZ, 0);
+
+    if (!AcpiDsJitEmitTermList (Compiler, Predicate->Common.Next))
+    {
+        return (FALSE);
+    }
+
+    if (!ElseOp)
+    {
+        AcpiDsJitPatchJumps (Compiler, ElseJump);
+        return (TRUE);
+    }
+
+    EndJump = AcpiDsJitEmitForwardJump (Compiler, ACPI_JIT_JMP, 0);
+    AcpiDsJitPatchJumps (Compiler, ElseJump);
+
+    if (!AcpiDsJitEmitTermList (Compiler, ElseOp->Common.Value.Arg))
+    {
+        return (FALSE);
+    }
+
+    AcpiDsJitPatchJumps (Compiler, EndJump);
+    return (TRUE);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitEmitWhile
+ *
+ * PARAMETERS:  Compiler        - Translation state
+ *              Op              - While op
+ *
+ * RETURN:      TRUE if the statement was translated
+ *
+ * DESCRIPTION: Translate While (Predicate) {...}. Each iteration counts down
+ *              Frame->LoopBudget, and calls AcpiDsJitCheckLoop when it runs
+ *              out.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiDsJitEmitWhile (
+    ACPI_JIT_COMPILER       *Compiler,
+    ACPI_PARSE_OBJECT       *Op)
+{
+    static const UINT8      Jnz[] = {0x75, 0x00};
+    ACPI_PARSE_OBJECT       *Predicate = Op->Common.Value.Arg;
+    BOOLEAN                 OuterInLoop = Compiler->InLoop;
+    UINT32                  OuterLoopTop = Compiler->LoopTop;
+    UINT32                  OuterBreakChain = Compiler->BreakChain;
+    UINT32                  Skip;
+    BOOLEAN                 Translated = FALSE;
+
+
+    Compiler->InLoop = TRUE;
+    Compiler->LoopTop = Compiler->Length;
+    Compiler->BreakChain = 0;
+
+    /* dec qword [rbx + LoopBudget]; jnz predicate */
+
+    AcpiDsJitEmitFrameOp (Compiler, 0xFF, 0x8B,
+        ACPI_JIT_FRAME_OFFSET (LoopBudget));
+    ACPI_JIT_INSN (Compiler, Jnz);
+    Skip = Compiler->Length;
+
+    ACPI_JIT_INSN (Compiler, AcpiJitMovRdiRbx);
+    AcpiDsJitEmitCall (Compiler, ACPI_CAST_PTR (void, AcpiDsJitCheckLoop));
+    ACPI_JIT_INSN (Compiler, AcpiJitTestEaxEax);
+    AcpiDsJitEmitJump (Compiler, ACPI_JIT_JZ, ACPI_JIT_BAILOUT_OFFSET);
+
+    if (!Compiler->Overflow)
+    {
+        Compiler->Code[Skip - 1] = (UINT8) (Compiler->Length - Skip);
+    }
+
+    if (AcpiDsJitEmitExpression (Compiler, Predicate))
+    {
+        ACPI_JIT_INSN (Compiler, AcpiJitTestRaxRax);
+        Compiler->BreakChain = AcpiDsJitEmitForwardJump (
+            Compiler, ACPI_JIT_JZ, Compiler->BreakChain);
+
+        if (AcpiDsJitEmitTermList (Compiler, Predicate->Common.Next))
+        {
+            AcpiDsJitEmitJump (Compiler, ACPI_JIT_JMP, Compiler->LoopTop);
+            AcpiDsJitPatchJumps (Compiler, Compiler->BreakChain);
+            Translated = TRUE;
+        }
+    }
+
+    Compiler->InLoop = OuterInLoop;
+    Compiler->LoopTop = OuterLoopTop;
+    Compiler->BreakChain = OuterBreakChain;
+    return (Translated);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitEmitTermList
+ *
+ * PARAMETERS:  Compiler        - Translation state
+ *              Op              - First op of a list of statements
+ *
+ * RETURN:      TRUE if all statements were translated
+ *
+ * DESCRIPTION: Translate the body of a method, If, Else or While.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiDsJitEmitTermList (
+    ACPI_JIT_COMPILER       *Compiler,
+    ACPI_PARSE_OBJECT       *Op)
+{
+    static const UINT8      MovEaxReturned[] = {
+        0xB8, ACPI_JIT_RETURNED, 0x00, 0x00, 0x00};
+    ACPI_PARSE_OBJECT       *ElseOp;
+
+
+    for (; Op; Op = Op->Common.Next)
+    {
+        switch (Op->Common.AmlOpcode)
+        {
+        case AML_IF_OP:
+
+            ElseOp = Op->Common.Next;
+            if (ElseOp && (ElseOp->Common.AmlOpcode != AML_ELSE_OP))
+            {
+                ElseOp = NULL;
+            }
+
+            if (!AcpiDsJitEmitIf (Compiler, Op, ElseOp))
+            {
+                return (FALSE);
+            }
+
+            if (ElseOp)
+            {
+                Op = ElseOp;
+            }
+            break;
+
+        case AML_WHILE_OP:
+
+            if (!AcpiDsJitEmitWhile (Compiler, Op))
+            {
+                return (FALSE);
+            }
+            break;
+
+        case AML_BREAK_OP:
+
+            if (!Compiler->InLoop)
+            {
+                return (FALSE);
+            }
+
+            Compiler->BreakChain = AcpiDsJitEmitForwardJump (
+                Compiler, ACPI_JIT_JMP, Compiler->BreakChain);
+            break;
+
+        case AML_CONTINUE_OP:
+
+            if (!Compiler->InLoop)
+            {
+                return (FALSE);
+            }
+
+            AcpiDsJitEmitJump (Compiler, ACPI_JIT_JMP, Compiler->LoopTop);
+            break;
+
+        case AML_RETURN_OP:
+
+            if (!AcpiDsJitEmitExpression (Compiler, Op->Common.Value.Arg))
+            {
+                return (FALSE);
+            }
+
+            /* mov [rbx + ReturnValue], rax; mov eax, RETURNED; jmp exit */
+
+            AcpiDsJitEmitFrameOp (Compiler, 0x89, 0x83,
+                ACPI_JIT_FRAME_OFFSET (ReturnValue));
+            ACPI_JIT_INSN (Compiler, MovEaxReturned);
+            AcpiDsJitEmitJump (Compiler, ACPI_JIT_JMP, ACPI_JIT_EXIT_OFFSET);
+            break;
+
+        case AML_NOOP_OP:
+
+            break;
+
+        default:
+
+            /* Statement whose only effect is the store to its target */
+
+            if (!AcpiDsJitEmitExpression (Compiler, Op))
+            {
+                return (FALSE);
+            }
+            break;
+        }
+    }
+
+    return (!Compiler->Overflow);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitBeginOp
+ *
+ * PARAMETERS:  WalkState       - Current state of the parse tree walk
+ *              OutOp           - Unused, required for parser interface
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Descending callback for the parse of AcpiDsJitCompile. The
+ *              ops are translated once the complete tree is available.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiDsJitBeginOp (
+    ACPI_WALK_STATE         *WalkState,
+    ACPI_PARSE_OBJECT       **OutOp)
+{
+
+    return (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitCompile
+ *
+ * PARAMETERS:  Node            - Namespace node of the method
+ *              ObjDesc         - Method object attached to node
+ *              Jit             - Where the code is returned
+ *
+ * RETURN:      TRUE if the method was translated
+ *
+ * DESCRIPTION: Parse a control method and translate it to native code. Same
+ *              parse as AcpiDsMemoIsPure.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiDsJitCompile (
+    ACPI_NAMESPACE_NODE     *Node,
+    ACPI_OPERAND_OBJECT     *ObjDesc,
+    ACPI_METHOD_JIT         *Jit)
+{
+    static const UINT8      JmpBody[] = {0xE9, 0x00, 0x00, 0x00, 0x00};
+    static const UINT8      MovEaxBailout[] = {
+        0xB8, ACPI_JIT_BAILOUT, 0x00, 0x00, 0x00};
+    ACPI_JIT_COMPILER       Compiler;
+    ACPI_PARSE_OBJECT       *Root;
+    ACPI_WALK_STATE         *WalkState;
+    ACPI_STATUS             Status;
+    BOOLEAN                 Translated = FALSE;
+
+
+    ACPI_FUNCTION_TRACE_PTR (DsJitCompile, Node);
+
+
+    Root = AcpiPsAllocOp (AML_METHOD_OP, ObjDesc->Method.AmlStart);
+    if (!Root)
+    {
+        return_VALUE (FALSE);
+    }
+
+    AcpiPsSetName (Root, Node->Name.Integer);
+    Root->Common.Node = Node;
+
+    WalkState = AcpiDsCreateWalkState (Node->OwnerId, NULL, NULL, NULL);
+    if (!WalkState)
+    {
+        AcpiPsFreeOp (Root);
+        return_VALUE (FALSE);
+    }
+
+    Status = AcpiDsInitAmlWalk (WalkState, Root, Node,
+        ObjDesc->Method.AmlStart, ObjDesc->Method.AmlLength, NULL, 0);
+    if (ACPI_FAILURE (Status))
+    {
+        AcpiDsDeleteWalkState (WalkState);
+        AcpiPsFreeOp (Root);
+        return_VALUE (FALSE);
+    }
+
+    WalkState->ParseFlags &= ~ACPI_PARSE_DELETE_TREE;
+    WalkState->DescendingCallback = AcpiDsJitBeginOp;
+
+    Status = AcpiPsParseAml (WalkState);
+    if (ACPI_FAILURE (Status))
+    {
+        AcpiPsDeleteParseTree (Root);
+        return_VALUE (FALSE);
+    }
+
+    memset (&Compiler, 0, sizeof (ACPI_JIT_COMPILER));
+    Compiler.ScopeInfo.Scope.Node = Node;
+    Compiler.Code = ACPI_ALLOCATE (ACPI_JIT_MAX_CODE_SIZE);
+    if (!Compiler.Code)
+    {
+        AcpiPsDeleteParseTree (Root);
+        return_VALUE (FALSE);
+    }
+
+    /* Jump to the body, then the bailout and exit sequences */
+
+    ACPI_JIT_INSN (&Compiler, JmpBody);
+    ACPI_JIT_INSN (&Compiler, MovEaxBailout);
+    ACPI_JIT_INSN (&Compiler, AcpiJitExit);
+    Compiler.Code[1] = (UINT8) (Compiler.Length - sizeof (JmpBody));
+
+    ACPI_JIT_INSN (&Compiler, AcpiJitPrologue);
+    if (AcpiDsJitEmitTermList (&Compiler, Root->Common.Value.Arg))
+    {
+        /* End of the method without Return */
+
+        ACPI_JIT_INSN (&Compiler, AcpiJitXorEaxEax);
+        AcpiDsJitEmitJump (&Compiler, ACPI_JIT_JMP, ACPI_JIT_EXIT_OFFSET);
+
+        if (!Compiler.Overflow)
+        {
+            Jit->Entry = ACPI_CAST_PTR (void, AcpiOsCreateExecutable (
+                Compiler.Code, Compiler.Length));
+            Jit->CodeLength = Compiler.Length;
+            Translated = (Jit->Entry != NULL);
+        }
+    }
+
+    ACPI_DEBUG_PRINT ((ACPI_DB_EXEC,
+        "[%4.4s] %s native code, %u bytes\n", Node->Name.Ascii,
+        Translated ? "Created" : "Could not create", Compiler.Length));
+
+    ACPI_FREE (Compiler.Code);
+    AcpiPsDeleteParseTree (Root);
+    return_VALUE (Translated);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitReset
+ *
+ * PARAMETERS:  Jit             - Native code state of a method
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Free the native code of a method and start counting its
+ *              evaluations again.
+ *
+ ******************************************************************************/
+
+static void
+AcpiDsJitReset (
+    ACPI_METHOD_JIT         *Jit)
+{
+
+    if (Jit->Entry)
+    {
+        AcpiOsDeleteExecutable (ACPI_CAST_PTR (void, Jit->Entry),
+            Jit->CodeLength);
+    }
+
+    memset (Jit, 0, sizeof (ACPI_METHOD_JIT));
+    Jit->Generation = AcpiGbl_NsGeneration;
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitExecute
+ *
+ * PARAMETERS:  Info            - Method evaluation info
+ *              Status          - Where the evaluation status is returned
+ *
+ * RETURN:      TRUE if the method was executed by native code, and need
+ *              not be run by the interpreter
+ *
+ * DESCRIPTION: Count an evaluation of a method, compile the method when it
+ *              becomes hot, and run the native code if there is any. On
+ *              success the return value, if any, is in Info->ReturnObject.
+ *
+ ******************************************************************************/
+
+BOOLEAN
+AcpiDsJitExecute (
+    ACPI_EVALUATE_INFO      *Info,
+    ACPI_STATUS             *Status)
+{
+    ACPI_OPERAND_OBJECT     *ObjDesc = Info->ObjDesc;
+    ACPI_METHOD_JIT         *Jit = ObjDesc->Method.Jit;
+    ACPI_JIT_FRAME          Frame;
+    UINT32                  Result;
+    UINT32                  i;
+
+
+    if (!AcpiGbl_EnableJit ||
+        !ObjDesc->Method.AmlStart ||
+        (ObjDesc->Method.InfoFlags &
+            (ACPI_METHOD_MODULE_LEVEL | ACPI_METHOD_INTERNAL_ONLY |
+             ACPI_METHOD_SERIALIZED)) ||
+        (AcpiGbl_IntegerByteWidth != 8) ||
+        AcpiGbl_EnableInterpreterSlack ||
+        AcpiGbl_CmSingleStep ||
+        (Info->ParamCount > ACPI_METHOD_NUM_ARGS))
+    {
+        return (FALSE);
+    }
+
+    if (!Jit)
+    {
+        Jit = ACPI_ALLOCATE_ZEROED (sizeof (ACPI_METHOD_JIT));
+        if (!Jit)
+        {
+            return (FALSE);
+        }
+
+        Jit->Generation = AcpiGbl_NsGeneration;
+        ObjDesc->Method.Jit = Jit;
+    }
+
+    /* The code may refer to Package nodes that no longer exist */
+
+    if (Jit->Generation != AcpiGbl_NsGeneration)
+    {
+        AcpiDsJitReset (Jit);
+    }
+
+    if (!Jit->Entry)
+    {
+        if (Jit->Rejected ||
+            (++Jit->CallCount < ACPI_JIT_CALL_THRESHOLD))
+        {
+            return (FALSE);
+        }
+
+        if (!AcpiDsJitCompile (Info->Node, ObjDesc, Jit))
+        {
+            Jit->Rejected = TRUE;
+            return (FALSE);
+        }
+
+        AcpiGbl_JitMethodCount++;
+    }
+
+    /* Arguments must all be Integers */
+
+    memset (&Frame, 0, sizeof (ACPI_JIT_FRAME));
+    for (i = 0; i < Info->ParamCount; i++)
+    {
+        if (Info->Parameters[i]->Common.Type != ACPI_TYPE_INTEGER)
+        {
+            return (FALSE);
+        }
+
+        Frame.Args[i] = Info->Parameters[i]->Integer.Value;
+        Frame.Valid |= ACPI_JIT_ARG_VALID (i);
+    }
+
+    Frame.LoopBudget = ACPI_JIT_LOOP_CHECK_INTERVAL;
+
+    Result = Jit->Entry (&Frame);
+    if (Result == ACPI_JIT_BAILOUT)
+    {
+        AcpiGbl_JitBailouts++;
+        return (FALSE);
+    }
+
+    AcpiGbl_JitExecutions++;
+    *Status = AE_OK;
+
+    if (Result == ACPI_JIT_RETURNED)
+    {
+        Info->ReturnObject = AcpiUtCreateIntegerObject (Frame.ReturnValue);
+        if (!Info->ReturnObject)
+        {
+            *Status = AE_NO_MEMORY;
+        }
+        else
+        {
+            *Status = AE_CTRL_RETURN_VALUE;
+        }
+    }
+
+    return (TRUE);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsJitDelete
+ *
+ * PARAMETERS:  MethodDesc      - Method object
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Free the native code of a method.
+ *
+ ******************************************************************************/
+
+void
+AcpiDsJitDelete (
+    ACPI_OPERAND_OBJECT     *MethodDesc)
+{
+    ACPI_METHOD_JIT         *Jit = MethodDesc->Method.Jit;
+
+
+    if (!Jit)
+    {
+        return;
+    }
+
+    AcpiDsJitReset (Jit);
+    ACPI_FREE (Jit);
+    MethodDesc->Method.Jit = NULL;
+}
+
+#endif /* ACPI_USE_NATIVE_JIT */
@@ -0,0 +1,456 @@
+/*******************************************************************************
+ *
+ * Module Name: dsmcache - Control method name cache
+ *
+ ******************************************************************************/
+
+/*
+ * Copyright (C) 2000 - 2023, Intel Corp.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions, and the following disclaimer,
+ *    without modification.
+ * 2. Redistributions in binary form must reproduce at minimum a disclaimer
+ *    substantially similar to the "NO WARRANTY" disclaimer below
+ *    ("Disclaimer") and any redistribution must be conditioned upon
+ *    including a substantially similar Disclaimer requirement for further
+ *    binary redistribution.
+ * 3. Neither the names of the above-listed copyright holders nor the names
+ *    of any contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * Alternatively, this software may be distributed under the terms of the
+ * GNU General Public License ("GPL") version 2 as published by the Free
+ * Software Foundation.
+ *
+ * NO WARRANTY
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGES.
+ */
+
+#include "acpi.h"
+#include "accommon.h"
+#include "acparser.h"
+#include "acdispat.h"
+#include "acnamesp.h"
+#include "acinterp.h"
+
+
+#define _COMPONENT          ACPI_DISPATCHER
+        ACPI_MODULE_NAME    ("dsmcache")
+
+/*
+ * Every time a control method runs, each name in its AML is decoded and
+ * looked up in the namespace, usually twice: once by the parser to find
+ * method invocations (AcpiPsGetNextNamepath), and once by the dispatcher
+ * to create the operand (AcpiDsCreateOperand), which also allocates a copy
+ * of the name. The same names resolve to the same nodes on every call.
+ *
+ * This module gives each method a cache that maps the AML offset of a name
+ * to the node that it resolved to and the length of the name string. The
+ * cache is created on the first execution of the method and freed with the
+ * method object, so it goes away when the owning table is unloaded.
+ *
+ * Only names looked up in the scope of the method itself are cached, and
+ * only when they resolve to a node that is not a temporary node of a
+ * method. Whenever any other node is added to or deleted from the
+ * namespace, AcpiGbl_NsGeneration changes and all caches are invalidated.
+ * A temporary node that a method creates in its own scope can hide an
+ * outer node with the same name from a single-segment name in the method,
+ * so such cached names are purged when the temporary node is created.
+ *
+ * The cache is only used while the interpreter is locked, which also holds
+ * the namespace mutex exclusively.
+ */
+
+/* Local prototypes */
+
+static BOOLEAN
+AcpiDsMethodCacheUsable (
+    ACPI_WALK_STATE         *WalkState,
+    UINT8                   *Aml);
+
+static ACPI_METHOD_CACHE *
+AcpiDsMethodCacheCreate (
+    UINT32                  Size);
+
+static ACPI_METHOD_CACHE_ENTRY *
+AcpiDsMethodCacheFind (
+    ACPI_METHOD_CACHE       *Cache,
+    UINT32                  Offset);
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMethodCacheUsable
+ *
+ * PARAMETERS:  WalkState       - Current walk state
+ *              Aml             - Start of a name string in the AML
+ *
+ * RETURN:      TRUE if the name can be cached for the current method
+ *
+ * DESCRIPTION: Check that a name is being looked up during the execution of
+ *              a control method, from within the method scope and the AML
+ *              of the method.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiDsMethodCacheUsable (
+    ACPI_WALK_STATE         *WalkState,
+    UINT8                   *Aml)
+{
+    ACPI_OPERAND_OBJECT     *MethodDesc = WalkState->MethodDesc;
+
+
+    if (!AcpiGbl_EnableMethodCache ||
+        !MethodDesc ||
+        !WalkState->ScopeInfo ||
+        ((WalkState->ParseFlags & ACPI_PARSE_MODE_MASK) != ACPI_PARSE_EXECUTE) ||
+        (MethodDesc->Method.InfoFlags & ACPI_METHOD_MODULE_LEVEL) ||
+        (WalkState->ScopeInfo->Scope.Node != WalkState->MethodNode))
+    {
+        return (FALSE);
+    }
+
+    if ((Aml < MethodDesc->Method.AmlStart) ||
+        (Aml >= MethodDesc->Method.AmlStart + MethodDesc->Method.AmlLength))
+    {
+        return (FALSE);
+    }
+
+    return (TRUE);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMethodCacheCreate
+ *
+ * PARAMETERS:  Size            - Number of slots, power of 2
+ *
+ * RETURN:      New empty cache, NULL if no memory
+ *
+ * DESCRIPTION: Allocate a method name cache.
+ *
+ ******************************************************************************/
+
+static ACPI_METHOD_CACHE *
+AcpiDsMethodCacheCreate (
+    UINT32                  Size)
+{
+    ACPI_METHOD_CACHE       *Cache;
+
+
+    Cache = ACPI_ALLOCATE_ZEROED (sizeof (ACPI_METHOD_CACHE) +
+        ((ACPI_SIZE) Size - 1) * sizeof (ACPI_METHOD_CACHE_ENTRY));
+    if (!Cache)
+    {
+        return (NULL);
+    }
+
+    Cache->Generation = AcpiGbl_NsGeneration;
+    Cache->Size = Size;
+    return (Cache);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMethodCacheFind
+ *
+ * PARAMETERS:  Cache           - Method name cache
+ *              Offset          - AML offset of the name, plus one
+ *
+ * RETURN:      The entry for the offset, or the free slot where it belongs
+ *
+ * DESCRIPTION: Probe the cache for an offset. The cache is never full, so
+ *              a free slot is always found.
+ *
+ ******************************************************************************/
+
+static ACPI_METHOD_CACHE_ENTRY *
+AcpiDsMethodCacheFind (
+    ACPI_METHOD_CACHE       *Cache,
+    UINT32                  Offset)
+{
+    UINT32                  Mask = Cache->Size - 1;
+    UINT32                  i;
+
+
+    i = (Offset * 2654435761U) & Mask;
+    while (Cache->Entries[i].Offset &&
+          (Cache->Entries[i].Offset != Offset))
+    {
+        i = (i + 1) & Mask;
+    }
+
+    return (&Cache->Entries[i]);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMethodCacheLookup
+ *
+ * PARAMETERS:  WalkState       - Current walk state
+ *              Aml             - Start of a name string in the AML
+ *              Length          - Where the length of the name string is
+ *                                returned. Optional.
+ *
+ * RETURN:      The node that the name resolved to, NULL if not cached
+ *
+ * DESCRIPTION: Look up a name of the executing method in its name cache.
+ *              Updates the hit/miss counters returned by AcpiGetStatistics.
+ *
+ ******************************************************************************/
+
+ACPI_NAMESPACE_NODE *
+AcpiDsMethodCacheLookup (
+    ACPI_WALK_STATE         *WalkState,
+    UINT8                   *Aml,
+    UINT32                  *Length)
+{
+    ACPI_METHOD_CACHE       *Cache;
+    ACPI_METHOD_CACHE_ENTRY *Entry;
+    UINT32                  Offset;
+
+
+    AcpiExCheckInterpreter (WalkState);
+    if (!AcpiDsMethodCacheUsable (WalkState, Aml))
+    {
+        return (NULL);
+    }
+
+    Cache = WalkState->MethodDesc->Method.NameCache;
+    if (Cache && (Cache->Generation == AcpiGbl_NsGeneration))
+    {
+        Offset = (UINT32) ACPI_PTR_DIFF (Aml,
+            WalkState->MethodDesc->Method.AmlStart) + 1;
+
+        Entry = AcpiDsMethodCacheFind (Cache, Offset);
+        if (Entry->Offset)
+        {
+            AcpiGbl_MethodCacheHits++;
+            if (Length)
+            {
+                *Length = Entry->Length;
+            }
+
+            return (Entry->Node);
+        }
+    }
+
+    AcpiGbl_MethodCacheMisses++;
+    return (NULL);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMethodCacheInsert
+ *
+ * PARAMETERS:  WalkState       - Current walk state
+ *              Aml             - Start of a name string in the AML
+ *              Length          - Length of the name string
+ *              Node            - Node that the name resolved to
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Enter the result of a successful lookup into the name cache
+ *              of the executing method. The cache is created on first use,
+ *              emptied if it is out of date, and doubled in size when it is
+ *              half full, up to ACPI_DS_METHOD_CACHE_MAX_SIZE slots.
+ *
+ ******************************************************************************/
+
+void
+AcpiDsMethodCacheInsert (
+    ACPI_WALK_STATE         *WalkState,
+    UINT8                   *Aml,
+    UINT32                  Length,
+    ACPI_NAMESPACE_NODE     *Node)
+{
+    ACPI_OPERAND_OBJECT     *MethodDesc = WalkState->MethodDesc;
+    ACPI_METHOD_CACHE       *Cache;
+    ACPI_METHOD_CACHE       *NewCache;
+    ACPI_METHOD_CACHE_ENTRY *Entry;
+    UINT32                  Offset;
+    UINT32                  i;
+
+
+    AcpiExCheckInterpreter (WalkState);
+    if (!AcpiDsMethodCacheUsable (WalkState, Aml) ||
+        (Length > ACPI_UINT16_MAX) ||
+        AcpiNsIsMethodLocal (Node))
+    {
+        return;
+    }
+
+    Cache = MethodDesc->Method.NameCache;
+    if (!Cache)
+    {
+        /*
+         * A method declared inside another method is itself temporary, and
+         * the names it uses can be hidden by temporary nodes of the outer
+         * method. Do not cache for such methods.
+         */
+        if (AcpiNsIsMethodLocal (WalkState->MethodNode))
+        {
+            return;
+        }
+
+        Cache = AcpiDsMethodCacheCreate (ACPI_DS_METHOD_CACHE_MIN_SIZE);
+        if (!Cache)
+        {
+            return;
+        }
+
+        MethodDesc->Method.NameCache = Cache;
+    }
+    else if (Cache->Generation != AcpiGbl_NsGeneration)
+    {
+        /* The namespace has changed, all entries are out of date */
+
+        memset (Cache->Entries, 0,
+            (ACPI_SIZE) Cache->Size * sizeof (ACPI_METHOD_CACHE_ENTRY));
+        Cache->Generation = AcpiGbl_NsGeneration;
+        Cache->Count = 0;
+    }
+
+    /* Keep the cache at most half full */
+
+    if ((Cache->Count + 1) * 2 > Cache->Size)
+    {
+        if (Cache->Size >= ACPI_DS_METHOD_CACHE_MAX_SIZE)
+        {
+            return;
+        }
+
+        NewCache = AcpiDsMethodCacheCreate (Cache->Size * 2);
+        if (!NewCache)
+        {
+            return;
+        }
+
+        for (i = 0; i < Cache->Size; i++)
+        {
+            if (Cache->Entries[i].Offset)
+            {
+                Entry = AcpiDsMethodCacheFind (NewCache,
+                    Cache->Entries[i].Offset);
+                *Entry = Cache->Entries[i];
+            }
+        }
+
+        NewCache->Count = Cache->Count;
+        ACPI_FREE (Cache);
+        Cache = NewCache;
+        MethodDesc->Method.NameCache = Cache;
+    }
+
+    Offset = (UINT32) ACPI_PTR_DIFF (Aml, MethodDesc->Method.AmlStart) + 1;
+    Entry = AcpiDsMethodCacheFind (Cache, Offset);
+    if (!Entry->Offset)
+    {
+        Cache->Count++;
+    }
+
+    Entry->Node = Node;
+    Entry->Offset = Offset;
+    Entry->Length = (UINT16) Length;
+
+    /* A lone NameSeg is searched for in the method scope first */
+
+    Entry->Name = 0;
+    if (Length == ACPI_NAMESEG_SIZE)
+    {
+        ACPI_MOVE_32_TO_32 (&Entry->Name, Aml);
+    }
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMethodCachePurgeName
+ *
+ * PARAMETERS:  MethodNode      - Method that created a temporary node in its
+ *                                own scope
+ *              Name            - Name of the new node
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Empty the name cache of a method if it holds a single-segment
+ *              name that the new node hides.
+ *
+ ******************************************************************************/
+
+void
+AcpiDsMethodCachePurgeName (
+    ACPI_NAMESPACE_NODE     *MethodNode,
+    UINT32                  Name)
+{
+    ACPI_OPERAND_OBJECT     *MethodDesc;
+    ACPI_METHOD_CACHE       *Cache;
+    UINT32                  i;
+
+
+    MethodDesc = AcpiNsGetAttachedObject (MethodNode);
+    if (!MethodDesc ||
+        (MethodDesc->Common.Type != ACPI_TYPE_METHOD) ||
+        !MethodDesc->Method.NameCache)
+    {
+        return;
+    }
+
+    Cache = MethodDesc->Method.NameCache;
+    for (i = 0; i < Cache->Size; i++)
+    {
+        if (Cache->Entries[i].Offset &&
+           (Cache->Entries[i].Name == Name))
+        {
+            memset (Cache->Entries, 0,
+                (ACPI_SIZE) Cache->Size * sizeof (ACPI_METHOD_CACHE_ENTRY));
+            Cache->Count = 0;
+            return;
+        }
+    }
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMethodCacheDelete
+ *
+ * PARAMETERS:  MethodDesc      - Method object being deleted
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Free the name cache of a method.
+ *
+ ******************************************************************************/
+
+void
+AcpiDsMethodCacheDelete (
+    ACPI_OPERAND_OBJECT     *MethodDesc)
+{
+
+    if (MethodDesc->Method.NameCache)
+    {
+        ACPI_FREE (MethodDesc->Method.NameCache);
+        MethodDesc->Method.NameCache = NULL;
+    }
+}
@@ -0,0 +1,913 @@
+/*******************************************************************************
+ *
+ * Module Name: dsmemo - Result memoization for side-effect-free methods
+ *
+ ******************************************************************************/
+
+/*
+ * Copyright (C) 2000 - 2023, Intel Corp.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions, and the following disclaimer,
+ *    without modification.
+ * 2. Redistributions in binary form must reproduce at minimum a disclaimer
+ *    substantially similar to the "NO WARRANTY" disclaimer below
+ *    ("Disclaimer") and any redistribution must be conditioned upon
+ *    including a substantially similar Disclaimer requirement for further
+ *    binary redistribution.
+ * 3. Neither the names of the above-listed copyright holders nor the names
+ *    of any contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * Alternatively, this software may be distributed under the terms of the
+ * GNU General Public License ("GPL") version 2 as published by the Free
+ * Software Foundation.
+ *
+ * NO WARRANTY
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGES.
+ */
+
+
+#include "acpi.h"
+#include "accommon.h"
+#include "acparser.h"
+#include "amlcode.h"
+#include "acdispat.h"
+#include "acnamesp.h"
+
+
+#define _COMPONENT          ACPI_DISPATCHER
+        ACPI_MODULE_NAME    ("dsmemo")
+
+/*
+ * Many methods that are evaluated again and again (_STA, _HID, _ADR, _UID,
+ * _CRS of fixed devices, and so on) compute their result only from their
+ * arguments and from named data objects. Such a method returns the same
+ * result for the same arguments until one of those objects changes.
+ *
+ * When a table is loaded, each method is parsed once more and checked for
+ * operators that can have side effects or read data that is not a plain
+ * named data object: creation of named objects, stores to named objects,
+ * method invocations, references other than DerefOf (Index ()), Notify,
+ * Sleep, Stall, mutexes, events, table operations, and any name that
+ * resolves to a field, region or other non-data object. A method that
+ * passes gets a small memo of argument sets and the results that were
+ * returned for them.
+ *
+ * Evaluations through AcpiNsEvaluate consult the memo and return a copy of
+ * a remembered result instead of executing the method. An entry is only
+ * valid for the AcpiGbl_NsGeneration and AcpiGbl_NsDataGeneration it was
+ * filled with: the former changes when nodes are added to or removed from
+ * the namespace (table load and unload), the latter whenever a value is
+ * attached to a node or stored to a named object, buffer field or field.
+ * When the namespace has changed, the method is analyzed again since its
+ * names may now resolve to different objects.
+ *
+ * The memo is only used while the interpreter is locked.
+ */
+
+/* Local prototypes */
+
+static BOOLEAN
+AcpiDsMemoIsTarget (
+    ACPI_PARSE_OBJECT       *Op);
+
+static BOOLEAN
+AcpiDsMemoIsNullTarget (
+    ACPI_PARSE_OBJECT       *Op);
+
+static BOOLEAN
+AcpiDsMemoCheckOp (
+    ACPI_GENERIC_STATE      *ScopeInfo,
+    ACPI_PARSE_OBJECT       *Op);
+
+static ACPI_STATUS
+AcpiDsMemoBeginOp (
+    ACPI_WALK_STATE         *WalkState,
+    ACPI_PARSE_OBJECT       **OutOp);
+
+static BOOLEAN
+AcpiDsMemoIsPure (
+    ACPI_NAMESPACE_NODE     *Node,
+    ACPI_OPERAND_OBJECT     *ObjDesc);
+
+static BOOLEAN
+AcpiDsMemoArgsUsable (
+    ACPI_EVALUATE_INFO      *Info);
+
+static BOOLEAN
+AcpiDsMemoMatch (
+    ACPI_METHOD_MEMO_ENTRY  *Entry,
+    ACPI_EVALUATE_INFO      *Info);
+
+static void
+AcpiDsMemoClearEntry (
+    ACPI_METHOD_MEMO_ENTRY  *Entry);
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMemoIsTarget
+ *
+ * PARAMETERS:  Op              - Argument op of a method parse tree
+ *
+ * RETURN:      TRUE if the operator that owns Op writes to it
+ *
+ * DESCRIPTION: Determine whether an argument is the destination of a store,
+ *              using the parser argument list of the owning operator.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiDsMemoIsTarget (
+    ACPI_PARSE_OBJECT       *Op)
+{
+    ACPI_PARSE_OBJECT       *Parent = Op->Common.Parent;
+    ACPI_PARSE_OBJECT       *Arg;
+    UINT32                  ArgTypes;
+    UINT32                  ArgType;
+
+
+    /* Statements of the method body itself are not operands */
+
+    if (!Parent || !Parent->Common.Parent)
+    {
+        return (FALSE);
+    }
+
+    ArgTypes = AcpiPsGetOpcodeInfo (Parent->Common.AmlOpcode)->ParseArgs;
+    Arg = Parent->Common.Value.Arg;
+
+    while (Arg && (ArgType = GET_CURRENT_ARG_TYPE (ArgTypes)))
+    {
+        if (ArgType == ARGP_PKGLENGTH)
+        {
+            INCREMENT_ARG_LIST (ArgTypes);
+            continue;
+        }
+
+        if (Arg == Op)
+        {
+            switch (ArgType)
+            {
+            case ARGP_TARGET:
+
+                return (TRUE);
+
+            case ARGP_SUPERNAME:
+            case ARGP_SIMPLENAME:
+
+                /* These operators only look at the object */
+
+                switch (Parent->Common.AmlOpcode)
+                {
+                case AML_DEREF_OF_OP:
+                case AML_SIZE_OF_OP:
+                case AML_OBJECT_TYPE_OP:
+                case AML_CONDITIONAL_REF_OF_OP:
+
+                    return (FALSE);
+
+                default:
+
+                    return (TRUE);
+                }
+
+            default:
+
+                return (FALSE);
+            }
+        }
+
+        /* List arguments consume all remaining ops */
+
+        switch (ArgType)
+        {
+        case ARGP_BYTELIST:
+        case ARGP_DATAOBJLIST:
+        case ARGP_FIELDLIST:
+        case ARGP_OBJLIST:
+        case ARGP_TERMLIST:
+
+            break;
+
+        default:
+
+            INCREMENT_ARG_LIST (ArgTypes);
+            break;
+        }
+
+        Arg = Arg->Common.Next;
+    }
+
+    return (FALSE);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMemoIsNullTarget
+ *
+ * PARAMETERS:  Op              - Target argument op, may be NULL
+ *
+ * RETURN:      TRUE if the target is absent or the null name
+ *
+ * DESCRIPTION: Check the optional target operand of an operator.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiDsMemoIsNullTarget (
+    ACPI_PARSE_OBJECT       *Op)
+{
+
+    return ((!Op) ||
+        ((Op->Common.AmlOpcode == AML_INT_NAMEPATH_OP) &&
+        (!Op->Common.Value.Name)));
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMemoCheckOp
+ *
+ * PARAMETERS:  ScopeInfo       - Scope of the method, for name lookups
+ *              Op              - Op of the method parse tree
+ *
+ * RETURN:      TRUE if the op cannot have side effects
+ *
+ * DESCRIPTION: Check one op of a method for the rules described at the top
+ *              of this module.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiDsMemoCheckOp (
+    ACPI_GENERIC_STATE      *ScopeInfo,
+    ACPI_PARSE_OBJECT       *Op)
+{
+    const ACPI_OPCODE_INFO  *OpInfo;
+    ACPI_PARSE_OBJECT       *Parent = Op->Common.Parent;
+    ACPI_PARSE_OBJECT       *Arg;
+    ACPI_NAMESPACE_NODE     *Node;
+    ACPI_STATUS             Status;
+
+
+    OpInfo = AcpiPsGetOpcodeInfo (Op->Common.AmlOpcode);
+    if (OpInfo->Flags & (AML_NAMED | AML_CREATE | AML_FIELD))
+    {
+        return (FALSE);
+    }
+
+    switch (Op->Common.AmlOpcode)
+    {
+    case AML_INT_METHODCALL_OP:
+    case AML_REF_OF_OP:
+    case AML_NOTIFY_OP:
+    case AML_SLEEP_OP:
+    case AML_STALL_OP:
+    case AML_ACQUIRE_OP:
+    case AML_RELEASE_OP:
+    case AML_SIGNAL_OP:
+    case AML_WAIT_OP:
+    case AML_RESET_OP:
+    case AML_LOAD_OP:
+    case AML_LOAD_TABLE_OP:
+    case AML_UNLOAD_OP:
+    case AML_FATAL_OP:
+    case AML_TIMER_OP:
+    case AML_BREAKPOINT_OP:
+    case AML_DEBUG_OP:
+
+        return (FALSE);
+
+    case AML_INDEX_OP:
+
+        /* An element reference may only be dereferenced */
+
+        if (!AcpiDsMemoIsNullTarget (AcpiPsGetArg (Op, 2)) ||
+            !Parent || (Parent->Common.AmlOpcode != AML_DEREF_OF_OP))
+        {
+            return (FALSE);
+        }
+        break;
+
+    case AML_DEREF_OF_OP:
+
+        /* Only DerefOf (Index (...)), any other operand may be a reference */
+
+        Arg = Op->Common.Value.Arg;
+        if (!Arg || (Arg->Common.AmlOpcode != AML_INDEX_OP))
+        {
+            return (FALSE);
+        }
+        break;
+
+    case AML_CONDITIONAL_REF_OF_OP:
+
+        if (!AcpiDsMemoIsNullTarget (AcpiPsGetArg (Op, 1)))
+        {
+            return (FALSE);
+        }
+        break;
+
+    case AML_INT_NAMEPATH_OP:
+
+        if (!Op->Common.Value.Name)
+        {
+            return (TRUE);
+        }
+
+        if (AcpiDsMemoIsTarget (Op))
+        {
+            return (FALSE);
+        }
+
+        Status = AcpiNsLookup (ScopeInfo, Op->Common.Value.Name,
+            ACPI_TYPE_ANY, ACPI_IMODE_EXECUTE,
+            ACPI_NS_SEARCH_PARENT | ACPI_NS_DONT_OPEN_SCOPE, NULL, &Node);
+
+        switch (Parent ? Parent->Common.AmlOpcode : 0)
+        {
+        case AML_CONDITIONAL_REF_OF_OP:
+
+            return (TRUE);
+
+        case AML_OBJECT_TYPE_OP:
+        case AML_PACKAGE_OP:
+        case AML_VARIABLE_PACKAGE_OP:
+
+            /* Only the node itself is used, not its value */
+
+            return (ACPI_SUCCESS (Status));
+
+        default:
+
+            break;
+        }
+
+        if (ACPI_FAILURE (Status))
+        {
+            return (FALSE);
+        }
+
+        switch (Node->Type)
+        {
+        case ACPI_TYPE_INTEGER:
+        case ACPI_TYPE_STRING:
+        case ACPI_TYPE_BUFFER:
+        case ACPI_TYPE_PACKAGE:
+
+            return (TRUE);
+
+        default:
+
+            return (FALSE);
+        }
+
+    default:
+
+        break;
+    }
+
+    /* Anything else that is written to must be a Local or an Arg */
+
+    if (AcpiDsMemoIsTarget (Op) &&
+        (OpInfo->Type != AML_TYPE_LOCAL_VARIABLE) &&
+        (OpInfo->Type != AML_TYPE_METHOD_ARGUMENT))
+    {
+        return (FALSE);
+    }
+
+    return (TRUE);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMemoBeginOp
+ *
+ * PARAMETERS:  WalkState       - Current state of the parse tree walk
+ *              OutOp           - Unused, required for parser interface
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Descending callback for the parse of AcpiDsMemoIsPure. The
+ *              ops are checked once the complete tree is available.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiDsMemoBeginOp (
+    ACPI_WALK_STATE         *WalkState,
+    ACPI_PARSE_OBJECT       **OutOp)
+{
+
+    return (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMemoIsPure
+ *
+ * PARAMETERS:  Node            - Namespace node of the method
+ *              ObjDesc         - Method object attached to node
+ *
+ * RETURN:      TRUE if the method has no side effects
+ *
+ * DESCRIPTION: Parse a control method and check all of its ops. Same parse
+ *              as AcpiDsAutoSerializeMethod, except that the parse tree is
+ *              kept until it has been checked.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiDsMemoIsPure (
+    ACPI_NAMESPACE_NODE     *Node,
+    ACPI_OPERAND_OBJECT     *ObjDesc)
+{
+    ACPI_GENERIC_STATE      ScopeInfo;
+    ACPI_PARSE_OBJECT       *Root;
+    ACPI_PARSE_OBJECT       *Op;
+    ACPI_WALK_STATE         *WalkState;
+    ACPI_STATUS             Status;
+    BOOLEAN                 Pure = FALSE;
+
+
+    ACPI_FUNCTION_TRACE_PTR (DsMemoIsPure, Node);
+
+
+    Root = AcpiPsAllocOp (AML_METHOD_OP, ObjDesc->Method.AmlStart);
+    if (!Root)
+    {
+        return_VALUE (FALSE);
+    }
+
+    AcpiPsSetName (Root, Node->Name.Integer);
+    Root->Common.Node = Node;
+
+    WalkState = AcpiDsCreateWalkState (Node->OwnerId, NULL, NULL, NULL);
+    if (!WalkState)
+    {
+        AcpiPsFreeOp (Root);
+        return_VALUE (FALSE);
+    }
+
+    Status = AcpiDsInitAmlWalk (WalkState, Root, Node,
+        ObjDesc->Method.AmlStart, ObjDesc->Method.AmlLength, NULL, 0);
+    if (ACPI_FAILURE (Status))
+    {
+        AcpiDsDeleteWalkState (WalkState);
+        AcpiPsFreeOp (Root);
+        return_VALUE (FALSE);
+    }
+
+    WalkState->ParseFlags &= ~ACPI_PARSE_DELETE_TREE;
+    WalkState->DescendingCallback = AcpiDsMemoBeginOp;
+
+    Status = AcpiPsParseAml (WalkState);
+    if (ACPI_SUCCESS (Status))
+    {
+        ScopeInfo.Scope.Node = Node;
+
+        Pure = TRUE;
+        Op = AcpiPsGetDepthNext (Root, Root);
+        while (Op && Pure)
+        {
+            Pure = AcpiDsMemoCheckOp (&ScopeInfo, Op);
+            Op = AcpiPsGetDepthNext (Root, Op);
+        }
+    }
+
+    AcpiPsDeleteParseTree (Root);
+    return_VALUE (Pure);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMemoAnalyzeMethod
+ *
+ * PARAMETERS:  Node            - Namespace node of the method
+ *              ObjDesc         - Method object attached to node
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Give the method an empty memo if it has no side effects,
+ *              otherwise remove any memo it has. Called when the table of
+ *              the method is loaded and after namespace changes.
+ *
+ ******************************************************************************/
+
+void
+AcpiDsMemoAnalyzeMethod (
+    ACPI_NAMESPACE_NODE     *Node,
+    ACPI_OPERAND_OBJECT     *ObjDesc)
+{
+    ACPI_METHOD_MEMO        *Memo;
+
+
+    AcpiDsMemoDelete (ObjDesc);
+
+    if (!AcpiGbl_EnableMethodMemo ||
+        !ObjDesc->Method.AmlStart ||
+        (ObjDesc->Method.InfoFlags &
+            (ACPI_METHOD_MODULE_LEVEL | ACPI_METHOD_INTERNAL_ONLY)) ||
+        AcpiNsIsMethodLocal (Node))
+    {
+        return;
+    }
+
+    if (!AcpiDsMemoIsPure (Node, ObjDesc))
+    {
+        return;
+    }
+
+    Memo = ACPI_ALLOCATE_ZEROED (sizeof (ACPI_METHOD_MEMO));
+    if (Memo)
+    {
+        Memo->Generation = AcpiGbl_NsGeneration;
+        ObjDesc->Method.Memo = Memo;
+    }
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMemoArgsUsable
+ *
+ * PARAMETERS:  Info            - Method evaluation info
+ *
+ * RETURN:      TRUE if all arguments can be part of a memo key
+ *
+ * DESCRIPTION: Only Integers, Strings and Buffers are compared by value.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiDsMemoArgsUsable (
+    ACPI_EVALUATE_INFO      *Info)
+{
+    UINT32                  i;
+
+
+    if (Info->ParamCount > ACPI_METHOD_NUM_ARGS)
+    {
+        return (FALSE);
+    }
+
+    for (i = 0; i < Info->ParamCount; i++)
+    {
+        switch (Info->Parameters[i]->Common.Type)
+        {
+        case ACPI_TYPE_INTEGER:
+        case ACPI_TYPE_STRING:
+        case ACPI_TYPE_BUFFER:
+
+            break;
+
+        default:
+
+            return (FALSE);
+        }
+    }
+
+    return (TRUE);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMemoMatch
+ *
+ * PARAMETERS:  Entry           - Memo entry
+ *              Info            - Method evaluation info
+ *
+ * RETURN:      TRUE if the entry holds the result for this evaluation
+ *
+ * DESCRIPTION: Compare the generations and the arguments of an entry.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiDsMemoMatch (
+    ACPI_METHOD_MEMO_ENTRY  *Entry,
+    ACPI_EVALUATE_INFO      *Info)
+{
+    ACPI_OPERAND_OBJECT     *Arg;
+    ACPI_OPERAND_OBJECT     *Param;
+    UINT32                  i;
+
+
+    if (!Entry->Valid ||
+        (Entry->ArgCount != Info->ParamCount) ||
+        (Entry->NsGeneration != AcpiGbl_NsGeneration) ||
+        (Entry->DataGeneration != AcpiGbl_NsDataGeneration))
+    {
+        return (FALSE);
+    }
+
+    for (i = 0; i < Entry->ArgCount; i++)
+    {
+        Arg = Entry->Args[i];
+        Param = Info->Parameters[i];
+
+        if (Arg->Common.Type != Param->Common.Type)
+        {
+            return (FALSE);
+        }
+
+        switch (Arg->Common.Type)
+        {
+        case ACPI_TYPE_INTEGER:
+
+            if (Arg->Integer.Value != Param->Integer.Value)
+            {
+                return (FALSE);
+            }
+            break;
+
+        case ACPI_TYPE_STRING:
+
+            if ((Arg->String.Length != Param->String.Length) ||
+                memcmp (Arg->String.Pointer, Param->String.Pointer,
+                    Arg->String.Length))
+            {
+                return (FALSE);
+            }
+            break;
+
+        default:
+
+            if ((Arg->Buffer.Length != Param->Buffer.Length) ||
+                memcmp (Arg->Buffer.Pointer, Param->Buffer.Pointer,
+                    Arg->Buffer.Length))
+            {
+                return (FALSE);
+            }
+            break;
+        }
+    }
+
+    return (TRUE);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMemoLookup
+ *
+ * PARAMETERS:  Info            - Method evaluation info
+ *              Status          - Where the evaluation status is returned
+ *
+ * RETURN:      TRUE if the result was found, and the method need not run
+ *
+ * DESCRIPTION: Look up the result of a method evaluation in the memo of the
+ *              method. On a hit, a copy of the result is returned in
+ *              Info->ReturnObject. Updates the hit/miss counters returned by
+ *              AcpiGetStatistics.
+ *
+ ******************************************************************************/
+
+BOOLEAN
+AcpiDsMemoLookup (
+    ACPI_EVALUATE_INFO      *Info,
+    ACPI_STATUS             *Status)
+{
+    ACPI_OPERAND_OBJECT     *ObjDesc = Info->ObjDesc;
+    ACPI_METHOD_MEMO        *Memo = ObjDesc->Method.Memo;
+    ACPI_METHOD_MEMO_ENTRY  *Entry;
+    UINT32                  i;
+
+
+    Info->MemoNsGeneration = AcpiGbl_NsGeneration;
+    Info->MemoDataGeneration = AcpiGbl_NsDataGeneration;
+
+    if (!AcpiGbl_EnableMethodMemo || !Memo)
+    {
+        return (FALSE);
+    }
+
+    /* Names in the method may now resolve to other objects */
+
+    if (Memo->Generation != AcpiGbl_NsGeneration)
+    {
+        AcpiDsMemoAnalyzeMethod (Info->Node, ObjDesc);
+        return (FALSE);
+    }
+
+    if (!AcpiDsMemoArgsUsable (Info))
+    {
+        return (FALSE);
+    }
+
+    for (i = 0; i < ACPI_DS_METHOD_MEMO_ENTRIES; i++)
+    {
+        Entry = &Memo->Entries[i];
+        if (!AcpiDsMemoMatch (Entry, Info))
+        {
+            continue;
+        }
+
+        if (Entry->Result)
+        {
+            if (ACPI_FAILURE (AcpiUtCopyIobjectToIobject (Entry->Result,
+                &Info->ReturnObject, NULL)))
+            {
+                return (FALSE);
+            }
+
+            *Status = AE_CTRL_RETURN_VALUE;
+        }
+        else
+        {
+            *Status = AE_OK;
+        }
+
+        AcpiGbl_MethodMemoHits++;
+        return (TRUE);
+    }
+
+    AcpiGbl_MethodMemoMisses++;
+    return (FALSE);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMemoInsert
+ *
+ * PARAMETERS:  Info            - Method evaluation info, after AcpiDsMemoLookup
+ *                                and the execution of the method
+ *              Status          - Status of the method execution
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Remember the arguments and result of a successful method
+ *              execution, replacing the oldest entry of the memo. Nothing
+ *              is remembered if the namespace or named data changed while
+ *              the method ran, since another thread may have made the
+ *              change between reads of the method.
+ *
+ ******************************************************************************/
+
+void
+AcpiDsMemoInsert (
+    ACPI_EVALUATE_INFO      *Info,
+    ACPI_STATUS             Status)
+{
+    ACPI_METHOD_MEMO        *Memo = Info->ObjDesc->Method.Memo;
+    ACPI_METHOD_MEMO_ENTRY  *Entry;
+    UINT32                  i;
+
+
+    if (!AcpiGbl_EnableMethodMemo || !Memo ||
+        (Info->MemoNsGeneration != AcpiGbl_NsGeneration) ||
+        (Info->MemoDataGeneration != AcpiGbl_NsDataGeneration) ||
+        (Memo->Generation != AcpiGbl_NsGeneration) ||
+        !AcpiDsMemoArgsUsable (Info))
+    {
+        return;
+    }
+
+    if (Status == AE_CTRL_RETURN_VALUE)
+    {
+        if (!Info->ReturnObject)
+        {
+            return;
+        }
+
+        switch (Info->ReturnObject->Common.Type)
+        {
+        case ACPI_TYPE_INTEGER:
+        case ACPI_TYPE_STRING:
+        case ACPI_TYPE_BUFFER:
+        case ACPI_TYPE_PACKAGE:
+
+            break;
+
+        default:
+
+            return;
+        }
+    }
+    else if (Status != AE_OK)
+    {
+        return;
+    }
+
+    Entry = &Memo->Entries[Memo->Next];
+    Memo->Next = (Memo->Next + 1) % ACPI_DS_METHOD_MEMO_ENTRIES;
+    AcpiDsMemoClearEntry (Entry);
+
+    for (i = 0; i < Info->ParamCount; i++)
+    {
+        if (ACPI_FAILURE (AcpiUtCopyIobjectToIobject (Info->Parameters[i],
+            &Entry->Args[i], NULL)))
+        {
+            AcpiDsMemoClearEntry (Entry);
+            return;
+        }
+    }
+
+    if ((Status == AE_CTRL_RETURN_VALUE) &&
+        ACPI_FAILURE (AcpiUtCopyIobjectToIobject (Info->ReturnObject,
+            &Entry->Result, NULL)))
+    {
+        AcpiDsMemoClearEntry (Entry);
+        return;
+    }
+
+    Entry->ArgCount = (UINT8) Info->ParamCount;
+    Entry->NsGeneration = AcpiGbl_NsGeneration;
+    Entry->DataGeneration = AcpiGbl_NsDataGeneration;
+    Entry->Valid = TRUE;
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMemoClearEntry
+ *
+ * PARAMETERS:  Entry           - Memo entry
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Release the objects held by a memo entry.
+ *
+ ******************************************************************************/
+
+static void
+AcpiDsMemoClearEntry (
+    ACPI_METHOD_MEMO_ENTRY  *Entry)
+{
+    UINT32                  i;
+
+
+    for (i = 0; i < ACPI_METHOD_NUM_ARGS; i++)
+    {
+        if (Entry->Args[i])
+        {
+            AcpiUtRemoveReference (Entry->Args[i]);
+            Entry->Args[i] = NULL;
+        }
+    }
+
+    if (Entry->Result)
+    {
+        AcpiUtRemoveReference (Entry->Result);
+        Entry->Result = NULL;
+    }
+
+    Entry->Valid = FALSE;
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsMemoDelete
+ *
+ * PARAMETERS:  MethodDesc      - Method object
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Free the memo of a method and the results it holds.
+ *
+ ******************************************************************************/
+
+void
+AcpiDsMemoDelete (
+    ACPI_OPERAND_OBJECT     *MethodDesc)
+{
+    ACPI_METHOD_MEMO        *Memo = MethodDesc->Method.Memo;
+    UINT32                  i;
+
+
+    if (!Memo)
+    {
+        return;
+    }
+
+    for (i = 0; i < ACPI_DS_METHOD_MEMO_ENTRIES; i++)
+    {
+        AcpiDsMemoClearEntry (&Memo->Entries[i]);
+    }
+
+    ACPI_FREE (Memo);
+    MethodDesc->Method.Memo = NULL;
+}
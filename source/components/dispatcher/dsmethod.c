@@ -239,6 +239,10 @@ AcpiDsMethodError (
         return (Status);
     }
 
+    /* The method may be running without the interpreter (parallel mode) */
+
+    AcpiExResumeInterpreter (WalkState);
+
     /* Invoke the global exception handler */
 
     if (AcpiGbl_ExceptionHandler)
@@ -547,6 +551,8 @@ AcpiDsCallControlMethod (
         "Calling method %p, currentstate=%p\n",
         ThisWalkState->PrevOp, ThisWalkState));
 
+    AcpiExCheckInterpreter (ThisWalkState);
+
     /*
      * Get the namespace entry for the control method we are about to call
      */
@@ -632,7 +638,8 @@ AcpiDsCallControlMethod (
         "**** Begin nested execution of [%4.4s] **** WalkState=%p\n",
         MethodNode->Name.Ascii, NextWalkState));
 
-    ThisWalkState->MethodPathname = AcpiNsGetNormalizedPathname (MethodNode, TRUE);
+    ThisWalkState->MethodPathname = AcpiNsGetCachedPathname (MethodNode,
+        &ThisWalkState->MethodPathnameCached);
     ThisWalkState->MethodIsNested = TRUE;
 
     /* Optional object evaluation log */
@@ -705,9 +712,9 @@ AcpiDsRestartControlMethod (
         WalkState->MethodCallOp, ReturnDesc));
 
     ACPI_DEBUG_PRINT ((ACPI_DB_DISPATCH,
-        "    ReturnFromThisMethodUsed?=%X ResStack %p Walk %p\n",
+        "    ReturnFromThisMethodUsed?=%X ResCount %X Walk %p\n",
         WalkState->ReturnUsed,
-        WalkState->Results, WalkState));
+        WalkState->ResultCount, WalkState));
 
     /* Did the called method return a value? */
 
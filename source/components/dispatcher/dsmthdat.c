@@ -626,10 +626,20 @@ AcpiDsStoreObjectToLocal (
      * take a copy of the object before we store. A reference count
      * of exactly 1 means that the object was just created during the
      * evaluation of an expression, and we can safely use it since it
-     * is not used anywhere else.
+     * is not used anywhere else. Integer copies stay in the walk arena.
      */
     NewObjDesc = ObjDesc;
-    if (ObjDesc->Common.ReferenceCount > 1)
+    if ((ObjDesc->Common.ReferenceCount > 1) &&
+        (ObjDesc->Common.Type == ACPI_TYPE_INTEGER))
+    {
+        NewObjDesc = AcpiUtArenaCreateInteger (
+            WalkState->ParserState.Arena, ObjDesc->Integer.Value);
+        if (!NewObjDesc)
+        {
+            return_ACPI_STATUS (AE_NO_MEMORY);
+        }
+    }
+    else if (ObjDesc->Common.ReferenceCount > 1)
     {
         Status = AcpiUtCopyIobjectToIobject (
             ObjDesc, &NewObjDesc, WalkState);
@@ -440,7 +440,7 @@ AcpiDsInitObjectFromOp (
              * as expected (noop). ZeroOp is used as a placeholder for optional
              * target operands.
              */
-            ObjDesc->Common.Flags = AOPOBJ_AML_CONSTANT;
+            ObjDesc->Common.Flags |= AOPOBJ_AML_CONSTANT;
 
             switch (Opcode)
             {
@@ -222,7 +222,7 @@ AcpiDsBuildInternalPackageObj (
 
                 /* Cleanup the return object, it is not needed */
 
-                AcpiUtRemoveReference (WalkState->Results->Results.ObjDesc[0]);
+                AcpiUtRemoveReference (ACPI_DS_RESULT (WalkState, 0));
                 return_ACPI_STATUS (AE_SUPPORT);
             }
 
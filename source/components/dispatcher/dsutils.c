@@ -520,6 +520,19 @@ AcpiDsCreateOperand (
     {
         ACPI_DEBUG_PRINT ((ACPI_DB_DISPATCH, "Getting a name: Arg=%p\n", Arg));
 
+        /*
+         * The parser has resolved the name already. If the method name
+         * cache has the result, use it (names that create a namespace
+         * object are never entered into the cache).
+         */
+        ObjDesc = ACPI_CAST_PTR (ACPI_OPERAND_OBJECT,
+            AcpiDsMethodCacheLookup (WalkState, Arg->Common.Value.Buffer,
+                NULL));
+        if (ObjDesc)
+        {
+            goto PushObject;
+        }
+
         /* Get the entire name string from the AML stream */
 
         Status = AcpiExGetNameString (ACPI_TYPE_ANY,
@@ -638,6 +651,7 @@ AcpiDsCreateOperand (
             return_ACPI_STATUS (Status);
         }
 
+PushObject:
         /* Put the resulting object onto the current object stack */
 
         Status = AcpiDsObjStackPush (ObjDesc, WalkState);
@@ -700,9 +714,19 @@ AcpiDsCreateOperand (
         }
         else
         {
-            /* Create an ACPI_INTERNAL_OBJECT for the argument */
-
-            ObjDesc = AcpiUtCreateInternalObject (OpInfo->ObjectType);
+            /*
+             * Create an ACPI_INTERNAL_OBJECT for the argument. Integer
+             * constants are intermediates, create them in the walk arena
+             */
+            if (OpInfo->ObjectType == ACPI_TYPE_INTEGER)
+            {
+                ObjDesc = AcpiUtArenaCreateInteger (
+                    WalkState->ParserState.Arena, 0);
+            }
+            else
+            {
+                ObjDesc = AcpiUtCreateInternalObject (OpInfo->ObjectType);
+            }
             if (!ObjDesc)
             {
                 return_ACPI_STATUS (AE_NO_MEMORY);
@@ -57,6 +57,11 @@
 #define _COMPONENT          ACPI_DISPATCHER
         ACPI_MODULE_NAME    ("dswexec")
 
+#if defined (ACPI_USE_THREADED_DISPATCH) && !defined (__GNUC__)
+#error "ACPI_USE_THREADED_DISPATCH requires the labels-as-values extension"
+#endif
+
+#ifndef ACPI_USE_THREADED_DISPATCH
 /*
  * Dispatch table for opcode classes
  */
@@ -75,6 +80,7 @@ static ACPI_EXECUTE_OP      AcpiGbl_OpTypeDispatch [] =
     AcpiExOpcode_3A_1T_1R,
     AcpiExOpcode_6A_0T_1R
 };
+#endif
 
 
 /*****************************************************************************
@@ -246,6 +252,7 @@ AcpiDsExecBeginOp (
     Op = WalkState->Op;
     if (!Op)
     {
+        AcpiExResumeInterpreter (WalkState);
         Status = AcpiDsLoad2BeginOp (WalkState, OutOp);
         if (ACPI_FAILURE (Status))
         {
@@ -326,6 +333,8 @@ AcpiDsExecBeginOp (
 
         if (WalkState->WalkType & ACPI_WALK_METHOD)
         {
+            AcpiExResumeInterpreter (WalkState);
+
             /*
              * Found a named object declaration during method execution;
              * we must enter this object into the namespace. The created
@@ -374,6 +383,509 @@ ErrorExit:
 }
 
 
+/*****************************************************************************
+ *
+ * FUNCTION:    AcpiDsExecOperandError
+ *
+ * PARAMETERS:  WalkState       - Current state of the parse tree walk
+ *              Status          - Failure from AcpiExResolveOperands
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Handle a failure to resolve the operands of an executable
+ *              opcode. Constructs of the form "Store(LocalX,LocalX)" are
+ *              treated as noops when the Local is uninitialized.
+ *
+ ****************************************************************************/
+
+static ACPI_STATUS
+AcpiDsExecOperandError (
+    ACPI_WALK_STATE         *WalkState,
+    ACPI_STATUS             Status)
+{
+
+    if  ((Status == AE_AML_UNINITIALIZED_LOCAL) &&
+        (WalkState->Opcode == AML_STORE_OP) &&
+        (WalkState->Operands[0]->Common.Type == ACPI_TYPE_LOCAL_REFERENCE) &&
+        (WalkState->Operands[1]->Common.Type == ACPI_TYPE_LOCAL_REFERENCE) &&
+        (WalkState->Operands[0]->Reference.Class ==
+         WalkState->Operands[1]->Reference.Class) &&
+        (WalkState->Operands[0]->Reference.Value ==
+         WalkState->Operands[1]->Reference.Value))
+    {
+        return (AE_OK);
+    }
+
+    ACPI_EXCEPTION ((AE_INFO, Status,
+        "While resolving operands for [%s]",
+        AcpiPsGetOpcodeName (WalkState->Opcode)));
+    return (Status);
+}
+
+
+/*****************************************************************************
+ *
+ * FUNCTION:    AcpiDsExecMethodCall
+ *
+ * PARAMETERS:  WalkState       - Current state of the parse tree walk
+ *              Op              - The method call op
+ *
+ * RETURN:      AE_CTRL_TRANSFER to invoke the method, AE_OK if the op is
+ *              only a reference to the method, otherwise a failure
+ *
+ * DESCRIPTION: Prepare the arguments of a control method invocation.
+ *
+ ****************************************************************************/
+
+static ACPI_STATUS
+AcpiDsExecMethodCall (
+    ACPI_WALK_STATE         *WalkState,
+    ACPI_PARSE_OBJECT       *Op)
+{
+    ACPI_STATUS             Status;
+    ACPI_PARSE_OBJECT       *NextOp;
+
+
+    /*
+     * If the method is referenced from within a package
+     * declaration, it is not a invocation of the method, just
+     * a reference to it.
+     */
+    if ((Op->Asl.Parent) &&
+       ((Op->Asl.Parent->Asl.AmlOpcode == AML_PACKAGE_OP) ||
+        (Op->Asl.Parent->Asl.AmlOpcode == AML_VARIABLE_PACKAGE_OP)))
+    {
+        ACPI_DEBUG_PRINT ((ACPI_DB_DISPATCH,
+            "Method Reference in a Package, Op=%p\n", Op));
+
+        Op->Common.Node = (ACPI_NAMESPACE_NODE *)
+            Op->Asl.Value.Arg->Asl.Node;
+        AcpiUtAddReference (Op->Asl.Value.Arg->Asl.Node->Object);
+        return (AE_OK);
+    }
+
+    ACPI_DEBUG_PRINT ((ACPI_DB_DISPATCH,
+        "Method invocation, Op=%p\n", Op));
+
+    /*
+     * (AML_METHODCALL) Op->Asl.Value.Arg->Asl.Node contains
+     * the method Node pointer
+     */
+    /* NextOp points to the op that holds the method name */
+
+    NextOp = Op->Common.Value.Arg;
+
+    /* NextOp points to first argument op */
+
+    NextOp = NextOp->Common.Next;
+
+    /*
+     * Get the method's arguments and put them on the operand stack
+     */
+    Status = AcpiDsCreateOperands (WalkState, NextOp);
+    if (ACPI_FAILURE (Status))
+    {
+        return (Status);
+    }
+
+    /*
+     * Since the operands will be passed to another control method,
+     * we must resolve all local references here (Local variables,
+     * arguments to *this* method, etc.)
+     */
+    Status = AcpiDsResolveOperands (WalkState);
+    if (ACPI_FAILURE (Status))
+    {
+        /* On error, clear all resolved operands */
+
+        AcpiDsClearOperands (WalkState);
+        return (Status);
+    }
+
+    /*
+     * Tell the walk loop to preempt this running method and
+     * execute the new method
+     */
+    return (AE_CTRL_TRANSFER);
+}
+
+
+/*****************************************************************************
+ *
+ * FUNCTION:    AcpiDsExecCreateField
+ *
+ * PARAMETERS:  WalkState       - Current state of the parse tree walk
+ *              Op              - The CreateXxxField op
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Create a buffer field during method execution.
+ *
+ ****************************************************************************/
+
+static ACPI_STATUS
+AcpiDsExecCreateField (
+    ACPI_WALK_STATE         *WalkState,
+    ACPI_PARSE_OBJECT       *Op)
+{
+    ACPI_STATUS             Status;
+#ifdef ACPI_EXEC_APP
+    char                    *Namepath;
+    ACPI_OPERAND_OBJECT     *ObjDesc;
+#endif
+
+
+    ACPI_DEBUG_PRINT ((ACPI_DB_EXEC,
+        "Executing CreateField Buffer/Index Op=%p\n", Op));
+
+    Status = AcpiDsLoad2EndOp (WalkState);
+    if (ACPI_FAILURE (Status))
+    {
+        return (Status);
+    }
+
+    Status = AcpiDsEvalBufferFieldOperands (WalkState, Op);
+    if (ACPI_FAILURE (Status))
+    {
+        return (Status);
+    }
+
+#ifdef ACPI_EXEC_APP
+    /*
+     * AcpiExec support for namespace initialization file (initialize
+     * BufferFields in this code.)
+     */
+    Namepath = AcpiNsGetExternalPathname (Op->Common.Node);
+    Status = AeLookupInitFileEntry (Namepath, &ObjDesc);
+    if (ACPI_SUCCESS (Status))
+    {
+        Status = AcpiExWriteDataToField (ObjDesc, Op->Common.Node->Object, NULL);
+        if (ACPI_FAILURE (Status))
+        {
+            ACPI_EXCEPTION ((AE_INFO, Status, "While writing to buffer field"));
+        }
+    }
+    ACPI_FREE (Namepath);
+    Status = AE_OK;
+#endif
+    return (Status);
+}
+
+
+/*****************************************************************************
+ *
+ * FUNCTION:    AcpiDsExecCreateObject
+ *
+ * PARAMETERS:  WalkState       - Current state of the parse tree walk
+ *              Op              - The Buffer or Package op
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Evaluate a Buffer or Package during method execution and
+ *              push the result object, if any.
+ *
+ ****************************************************************************/
+
+static ACPI_STATUS
+AcpiDsExecCreateObject (
+    ACPI_WALK_STATE         *WalkState,
+    ACPI_PARSE_OBJECT       *Op)
+{
+    ACPI_STATUS             Status;
+
+
+    ACPI_DEBUG_PRINT ((ACPI_DB_EXEC,
+        "Executing CreateObject (Buffer/Package) Op=%p Child=%p ParentOpcode=%4.4X\n",
+        Op, Op->Named.Value.Arg, Op->Common.Parent->Common.AmlOpcode));
+
+    switch (Op->Common.Parent->Common.AmlOpcode)
+    {
+    case AML_NAME_OP:
+        /*
+         * Put the Node on the object stack (Contains the ACPI Name
+         * of this object)
+         */
+        WalkState->Operands[0] = (void *)
+            Op->Common.Parent->Common.Node;
+        WalkState->NumOperands = 1;
+
+        Status = AcpiDsCreateNode (WalkState,
+            Op->Common.Parent->Common.Node, Op->Common.Parent);
+        if (ACPI_FAILURE (Status))
+        {
+            break;
+        }
+
+        ACPI_FALLTHROUGH;
+
+    case AML_INT_EVAL_SUBTREE_OP:
+
+        Status = AcpiDsEvalDataObjectOperands (WalkState, Op,
+            AcpiNsGetAttachedObject (Op->Common.Parent->Common.Node));
+        break;
+
+    default:
+
+        Status = AcpiDsEvalDataObjectOperands (WalkState, Op, NULL);
+        break;
+    }
+
+    /*
+     * If a result object was returned from above, push it on the
+     * current result stack
+     */
+    if (WalkState->ResultObj)
+    {
+        Status = AcpiDsResultPush (WalkState->ResultObj, WalkState);
+    }
+
+    return (Status);
+}
+
+
+/*****************************************************************************
+ *
+ * FUNCTION:    AcpiDsExecNamedObject
+ *
+ * PARAMETERS:  WalkState       - Current state of the parse tree walk
+ *              Op              - The named object op
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Complete a named object declared during method execution,
+ *              evaluating the operands of regions and bank fields.
+ *
+ ****************************************************************************/
+
+static ACPI_STATUS
+AcpiDsExecNamedObject (
+    ACPI_WALK_STATE         *WalkState,
+    ACPI_PARSE_OBJECT       *Op)
+{
+    ACPI_STATUS             Status;
+
+
+    Status = AcpiDsLoad2EndOp (WalkState);
+    if (ACPI_FAILURE (Status))
+    {
+        return (Status);
+    }
+
+    if (Op->Common.AmlOpcode == AML_REGION_OP)
+    {
+        ACPI_DEBUG_PRINT ((ACPI_DB_EXEC,
+            "Executing OpRegion Address/Length Op=%p\n", Op));
+
+        Status = AcpiDsEvalRegionOperands (WalkState, Op);
+    }
+    else if (Op->Common.AmlOpcode == AML_DATA_REGION_OP)
+    {
+        ACPI_DEBUG_PRINT ((ACPI_DB_EXEC,
+            "Executing DataTableRegion Strings Op=%p\n", Op));
+
+        Status = AcpiDsEvalTableRegionOperands (WalkState, Op);
+    }
+    else if (Op->Common.AmlOpcode == AML_BANK_FIELD_OP)
+    {
+        ACPI_DEBUG_PRINT ((ACPI_DB_EXEC,
+            "Executing BankField Op=%p\n", Op));
+
+        Status = AcpiDsEvalBankFieldOperands (WalkState, Op);
+    }
+
+    return (Status);
+}
+
+
+/*****************************************************************************
+ *
+ * FUNCTION:    AcpiDsOpIsPrivate
+ *
+ * PARAMETERS:  WalkState       - Current state of the parse tree walk
+ *              Op              - The op about to be completed
+ *
+ * RETURN:      TRUE if the op can be completed without the interpreter
+ *
+ * DESCRIPTION: First half of the parallel execution check. Identifies ops
+ *              that cannot touch the namespace or any other shared state
+ *              by their opcode alone: literals, flow control, and the
+ *              executable operators that are not namespace or
+ *              synchronization operators and have no named arguments.
+ *              Executable ops must still pass AcpiDsCheckPrivateOperands.
+ *
+ ****************************************************************************/
+
+static BOOLEAN
+AcpiDsOpIsPrivate (
+    ACPI_WALK_STATE         *WalkState,
+    ACPI_PARSE_OBJECT       *Op)
+{
+    ACPI_PARSE_OBJECT       *Arg;
+
+
+    if (!AcpiGbl_ParallelExecution ||
+        !WalkState->Thread ||
+        !WalkState->MethodDesc ||
+        (WalkState->ParseFlags & ACPI_PARSE_MODULE_LEVEL))
+    {
+        return (FALSE);
+    }
+
+    /* The debugger expects to own the interpreter while stepping */
+
+    if (AcpiGbl_CmSingleStep ||
+        WalkState->MethodBreakpoint ||
+        WalkState->UserBreakpoint)
+    {
+        return (FALSE);
+    }
+
+    switch (WalkState->OpInfo->Class)
+    {
+    case AML_CLASS_ARGUMENT:
+
+        return (Op->Common.AmlOpcode != AML_INT_NAMEPATH_OP);
+
+    case AML_CLASS_CONTROL:
+
+        return (Op->Common.AmlOpcode != AML_RETURN_OP &&
+                Op->Common.AmlOpcode != AML_BREAKPOINT_OP);
+
+    case AML_CLASS_EXECUTE:
+
+        break;
+
+    default:
+
+        return (FALSE);
+    }
+
+    switch (Op->Common.AmlOpcode)
+    {
+    case AML_LOAD_OP:
+    case AML_LOAD_TABLE_OP:
+    case AML_UNLOAD_OP:
+    case AML_SLEEP_OP:
+    case AML_ACQUIRE_OP:
+    case AML_RELEASE_OP:
+    case AML_SIGNAL_OP:
+    case AML_WAIT_OP:
+    case AML_RESET_OP:
+    case AML_NOTIFY_OP:
+    case AML_FATAL_OP:
+    case AML_REF_OF_OP:
+    case AML_CONDITIONAL_REF_OF_OP:
+    case AML_DEREF_OF_OP:
+
+        return (FALSE);
+
+    default:
+
+        break;
+    }
+
+    /* Named arguments are resolved through the namespace */
+
+    Arg = Op->Common.Value.Arg;
+    while (Arg)
+    {
+        if ((Arg->Common.AmlOpcode == AML_INT_NAMEPATH_OP) &&
+            (Arg->Common.Value.String))
+        {
+            return (FALSE);
+        }
+
+        Arg = Arg->Common.Next;
+    }
+
+    return (TRUE);
+}
+
+
+/*****************************************************************************
+ *
+ * FUNCTION:    AcpiDsCheckPrivateOperands
+ *
+ * PARAMETERS:  WalkState       - Current state of the parse tree walk
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Second half of the parallel execution check, made once the
+ *              operand stack has been built. The interpreter is yielded if
+ *              every operand is an Integer, String or Buffer (directly or
+ *              held in a Local or Arg) that no other object references.
+ *              Otherwise the interpreter is reacquired.
+ *
+ ****************************************************************************/
+
+static void
+AcpiDsCheckPrivateOperands (
+    ACPI_WALK_STATE         *WalkState)
+{
+    ACPI_OPERAND_OBJECT     *ObjDesc;
+    UINT32                  i;
+
+
+    for (i = 0; i < WalkState->NumOperands; i++)
+    {
+        ObjDesc = WalkState->Operands[i];
+        if (!ObjDesc ||
+            ACPI_GET_DESCRIPTOR_TYPE (ObjDesc) != ACPI_DESC_TYPE_OPERAND)
+        {
+            goto NotPrivate;
+        }
+
+        if (ObjDesc->Common.Type == ACPI_TYPE_LOCAL_REFERENCE)
+        {
+            if ((ObjDesc->Reference.Class != ACPI_REFCLASS_LOCAL) &&
+                (ObjDesc->Reference.Class != ACPI_REFCLASS_ARG))
+            {
+                goto NotPrivate;
+            }
+
+            ObjDesc = AcpiNsGetAttachedObject (ObjDesc->Reference.Object);
+            if (!ObjDesc)
+            {
+                continue;
+            }
+        }
+
+        if (ObjDesc->Common.ReferenceCount != 1)
+        {
+            goto NotPrivate;
+        }
+
+        switch (ObjDesc->Common.Type)
+        {
+        case ACPI_TYPE_INTEGER:
+        case ACPI_TYPE_STRING:
+
+            break;
+
+        case ACPI_TYPE_BUFFER:
+
+            /* Data shared copy-on-write is referenced by other objects */
+
+            if (ObjDesc->Buffer.Share)
+            {
+                goto NotPrivate;
+            }
+            break;
+
+        default:
+
+            goto NotPrivate;
+        }
+    }
+
+    AcpiExYieldInterpreter (WalkState);
+    return;
+
+NotPrivate:
+    AcpiExResumeInterpreter (WalkState);
+}
+
+
 /*****************************************************************************
  *
  * FUNCTION:    AcpiDsExecEndOp
@@ -396,12 +908,9 @@ AcpiDsExecEndOp (
     ACPI_STATUS             Status = AE_OK;
     UINT32                  OpType;
     UINT32                  OpClass;
-    ACPI_PARSE_OBJECT       *NextOp;
     ACPI_PARSE_OBJECT       *FirstArg;
-#ifdef ACPI_EXEC_APP
-    char                    *Namepath;
-    ACPI_OPERAND_OBJECT     *ObjDesc;
-#endif
+    BOOLEAN                 Private;
+
 
     ACPI_FUNCTION_TRACE_PTR (DsExecEndOp, WalkState);
 
@@ -425,6 +934,14 @@ AcpiDsExecEndOp (
     WalkState->ReturnDesc = NULL;
     WalkState->ResultObj = NULL;
 
+    /* Ops that may touch shared state run with the interpreter held */
+
+    Private = AcpiDsOpIsPrivate (WalkState, Op);
+    if (!Private)
+    {
+        AcpiExResumeInterpreter (WalkState);
+    }
+
     /* Call debugger for single step support (DEBUG build only) */
 
     Status = AcpiDbSingleStep (WalkState, Op, OpClass);
@@ -435,6 +952,214 @@ AcpiDsExecEndOp (
 
     /* Decode the Opcode Class */
 
+#ifdef ACPI_USE_THREADED_DISPATCH
+    /*
+     * Threaded dispatch: the opcode type alone identifies the handler
+     * (every type belongs to a single class), so a single indirect jump
+     * replaces the class and type switches. Executable opcodes jump a
+     * second time, straight to the call of their AcpiExOpcode handler.
+     */
+    {
+        static const void       *TypeTargets[AML_TYPE_BOGUS + 1] =
+        {
+            &&ExecuteOp,        /* AML_TYPE_EXEC_0A_0T_1R */
+            &&ExecuteOp,        /* AML_TYPE_EXEC_1A_0T_0R */
+            &&ExecuteOp,        /* AML_TYPE_EXEC_1A_0T_1R */
+            &&ExecuteOp,        /* AML_TYPE_EXEC_1A_1T_0R */
+            &&ExecuteOp,        /* AML_TYPE_EXEC_1A_1T_1R */
+            &&ExecuteOp,        /* AML_TYPE_EXEC_2A_0T_0R */
+            &&ExecuteOp,        /* AML_TYPE_EXEC_2A_0T_1R */
+            &&ExecuteOp,        /* AML_TYPE_EXEC_2A_1T_1R */
+            &&ExecuteOp,        /* AML_TYPE_EXEC_2A_2T_1R */
+            &&ExecuteOp,        /* AML_TYPE_EXEC_3A_0T_0R */
+            &&ExecuteOp,        /* AML_TYPE_EXEC_3A_1T_1R */
+            &&ExecuteOp,        /* AML_TYPE_EXEC_6A_0T_1R */
+            &&ArgumentOp,       /* AML_TYPE_LITERAL */
+            &&ArgumentOp,       /* AML_TYPE_CONSTANT */
+            &&ArgumentOp,       /* AML_TYPE_METHOD_ARGUMENT */
+            &&ArgumentOp,       /* AML_TYPE_LOCAL_VARIABLE */
+            &&UnimplementedOp,  /* AML_TYPE_DATA_TERM */
+            &&MethodCallOp,     /* AML_TYPE_METHOD_CALL */
+            &&CreateFieldOp,    /* AML_TYPE_CREATE_FIELD */
+            &&CreateObjectOp,   /* AML_TYPE_CREATE_OBJECT */
+            &&ControlOp,        /* AML_TYPE_CONTROL */
+            &&NamedObjectOp,    /* AML_TYPE_NAMED_NO_OBJ */
+            &&NamedObjectOp,    /* AML_TYPE_NAMED_FIELD */
+            &&NamedObjectOp,    /* AML_TYPE_NAMED_SIMPLE */
+            &&NamedObjectOp,    /* AML_TYPE_NAMED_COMPLEX */
+            &&UnimplementedOp,  /* AML_TYPE_RETURN */
+            &&UndefinedOp,      /* AML_TYPE_UNDEFINED */
+            &&BogusOp           /* AML_TYPE_BOGUS */
+        };
+
+        static const void       *ExecTargets[AML_TYPE_EXEC_6A_0T_1R + 1] =
+        {
+            &&Exec_0A_0T_1R,
+            &&Exec_1A_0T_0R,
+            &&Exec_1A_0T_1R,
+            &&UnimplementedOp,  /* Was: AcpiExOpcode_1A_0T_0R (Load operator) */
+            &&Exec_1A_1T_1R,
+            &&Exec_2A_0T_0R,
+            &&Exec_2A_0T_1R,
+            &&Exec_2A_1T_1R,
+            &&Exec_2A_2T_1R,
+            &&Exec_3A_0T_0R,
+            &&Exec_3A_1T_1R,
+            &&Exec_6A_0T_1R
+        };
+
+
+        goto *TypeTargets[OpType];
+
+    ArgumentOp:                 /* Constants, literals, etc. */
+
+        if (WalkState->Opcode == AML_INT_NAMEPATH_OP)
+        {
+            Status = AcpiDsEvaluateNamePath (WalkState);
+            if (ACPI_FAILURE (Status))
+            {
+                goto Cleanup;
+            }
+        }
+        goto DispatchDone;
+
+    ExecuteOp:                  /* Most operators with arguments */
+
+        Status = AcpiDsCreateOperands (WalkState, FirstArg);
+        if (ACPI_FAILURE (Status))
+        {
+            goto Cleanup;
+        }
+
+        if (Private)
+        {
+            AcpiDsCheckPrivateOperands (WalkState);
+        }
+
+        if (!(WalkState->OpInfo->Flags & AML_NO_OPERAND_RESOLVE) &&
+            (WalkState->OpInfo->Flags & AML_HAS_ARGS))
+        {
+            Status = AcpiExResolveOperands (WalkState->Opcode,
+                &(WalkState->Operands [WalkState->NumOperands -1]),
+                WalkState);
+            if (ACPI_FAILURE (Status))
+            {
+                Status = AcpiDsExecOperandError (WalkState, Status);
+                goto ExecuteDone;
+            }
+        }
+        goto *ExecTargets[OpType];
+
+    Exec_0A_0T_1R:
+        Status = AcpiExOpcode_0A_0T_1R (WalkState);
+        goto ExecuteDone;
+
+    Exec_1A_0T_0R:
+        Status = AcpiExOpcode_1A_0T_0R (WalkState);
+        goto ExecuteDone;
+
+    Exec_1A_0T_1R:
+        Status = AcpiExOpcode_1A_0T_1R (WalkState);
+        goto ExecuteDone;
+
+    Exec_1A_1T_1R:
+        Status = AcpiExOpcode_1A_1T_1R (WalkState);
+        goto ExecuteDone;
+
+    Exec_2A_0T_0R:
+        Status = AcpiExOpcode_2A_0T_0R (WalkState);
+        goto ExecuteDone;
+
+    Exec_2A_0T_1R:
+        Status = AcpiExOpcode_2A_0T_1R (WalkState);
+        goto ExecuteDone;
+
+    Exec_2A_1T_1R:
+        Status = AcpiExOpcode_2A_1T_1R (WalkState);
+        goto ExecuteDone;
+
+    Exec_2A_2T_1R:
+        Status = AcpiExOpcode_2A_2T_1R (WalkState);
+        goto ExecuteDone;
+
+    Exec_3A_0T_0R:
+        Status = AcpiExOpcode_3A_0T_0R (WalkState);
+        goto ExecuteDone;
+
+    Exec_3A_1T_1R:
+        Status = AcpiExOpcode_3A_1T_1R (WalkState);
+        goto ExecuteDone;
+
+    Exec_6A_0T_1R:
+        Status = AcpiExOpcode_6A_0T_1R (WalkState);
+
+    ExecuteDone:
+
+        AcpiDsClearOperands (WalkState);
+        if (ACPI_SUCCESS (Status) &&
+            WalkState->ResultObj)
+        {
+            Status = AcpiDsResultPush (WalkState->ResultObj, WalkState);
+        }
+        goto DispatchDone;
+
+    ControlOp:                  /* Type 1 opcode, IF/ELSE/WHILE/NOOP */
+
+        Status = AcpiDsExecEndControlOp (WalkState, Op);
+        goto DispatchDone;
+
+    MethodCallOp:
+
+        Status = AcpiDsExecMethodCall (WalkState, Op);
+        if (Status == AE_OK || Status == AE_CTRL_TRANSFER)
+        {
+            return_ACPI_STATUS (Status);
+        }
+        goto DispatchDone;
+
+    CreateFieldOp:
+
+        Status = AcpiDsExecCreateField (WalkState, Op);
+        goto DispatchDone;
+
+    CreateObjectOp:
+
+        Status = AcpiDsExecCreateObject (WalkState, Op);
+        goto DispatchDone;
+
+    NamedObjectOp:
+
+        Status = AcpiDsExecNamedObject (WalkState, Op);
+        goto DispatchDone;
+
+    UndefinedOp:
+
+        ACPI_ERROR ((AE_INFO,
+            "Undefined opcode type Op=%p", Op));
+        return_ACPI_STATUS (AE_NOT_IMPLEMENTED);
+
+    BogusOp:
+
+        ACPI_DEBUG_PRINT ((ACPI_DB_DISPATCH,
+            "Internal opcode=%X type Op=%p\n",
+            WalkState->Opcode, Op));
+        goto DispatchDone;
+
+    UnimplementedOp:
+
+        ACPI_ERROR ((AE_INFO,
+            "Unimplemented opcode, class=0x%X "
+            "type=0x%X Opcode=0x%X Op=%p",
+            OpClass, OpType, Op->Common.AmlOpcode, Op));
+
+        Status = AE_NOT_IMPLEMENTED;
+
+    DispatchDone:
+        ;
+    }
+
+#else
+
     switch (OpClass)
     {
     case AML_CLASS_ARGUMENT:    /* Constants, literals, etc. */
@@ -459,6 +1184,13 @@ AcpiDsExecEndOp (
             goto Cleanup;
         }
 
+        /* Yield the interpreter if the operands are private to the walk */
+
+        if (Private)
+        {
+            AcpiDsCheckPrivateOperands (WalkState);
+        }
+
         /*
          * All opcodes require operand resolution, with the only exceptions
          * being the ObjectType and SizeOf operators as well as opcodes that
@@ -485,27 +1217,7 @@ AcpiDsExecEndOp (
         }
         else
         {
-            /*
-             * Treat constructs of the form "Store(LocalX,LocalX)" as noops when the
-             * Local is uninitialized.
-             */
-            if  ((Status == AE_AML_UNINITIALIZED_LOCAL) &&
-                (WalkState->Opcode == AML_STORE_OP) &&
-                (WalkState->Operands[0]->Common.Type == ACPI_TYPE_LOCAL_REFERENCE) &&
-                (WalkState->Operands[1]->Common.Type == ACPI_TYPE_LOCAL_REFERENCE) &&
-                (WalkState->Operands[0]->Reference.Class ==
-                 WalkState->Operands[1]->Reference.Class) &&
-                (WalkState->Operands[0]->Reference.Value ==
-                 WalkState->Operands[1]->Reference.Value))
-            {
-                Status = AE_OK;
-            }
-            else
-            {
-                ACPI_EXCEPTION ((AE_INFO, Status,
-                    "While resolving operands for [%s]",
-                    AcpiPsGetOpcodeName (WalkState->Opcode)));
-            }
+            Status = AcpiDsExecOperandError (WalkState, Status);
         }
 
         /* Always delete the argument objects and clear the operand stack */
@@ -536,158 +1248,26 @@ AcpiDsExecEndOp (
             break;
 
         case AML_TYPE_METHOD_CALL:
-            /*
-             * If the method is referenced from within a package
-             * declaration, it is not a invocation of the method, just
-             * a reference to it.
-             */
-            if ((Op->Asl.Parent) &&
-               ((Op->Asl.Parent->Asl.AmlOpcode == AML_PACKAGE_OP) ||
-                (Op->Asl.Parent->Asl.AmlOpcode == AML_VARIABLE_PACKAGE_OP)))
-            {
-                ACPI_DEBUG_PRINT ((ACPI_DB_DISPATCH,
-                    "Method Reference in a Package, Op=%p\n", Op));
 
-                Op->Common.Node = (ACPI_NAMESPACE_NODE *)
-                    Op->Asl.Value.Arg->Asl.Node;
-                AcpiUtAddReference (Op->Asl.Value.Arg->Asl.Node->Object);
-                return_ACPI_STATUS (AE_OK);
-            }
-
-            ACPI_DEBUG_PRINT ((ACPI_DB_DISPATCH,
-                "Method invocation, Op=%p\n", Op));
-
-            /*
-             * (AML_METHODCALL) Op->Asl.Value.Arg->Asl.Node contains
-             * the method Node pointer
-             */
-            /* NextOp points to the op that holds the method name */
-
-            NextOp = FirstArg;
-
-            /* NextOp points to first argument op */
-
-            NextOp = NextOp->Common.Next;
-
-            /*
-             * Get the method's arguments and put them on the operand stack
-             */
-            Status = AcpiDsCreateOperands (WalkState, NextOp);
-            if (ACPI_FAILURE (Status))
-            {
-                break;
-            }
-
-            /*
-             * Since the operands will be passed to another control method,
-             * we must resolve all local references here (Local variables,
-             * arguments to *this* method, etc.)
-             */
-            Status = AcpiDsResolveOperands (WalkState);
-            if (ACPI_FAILURE (Status))
+            Status = AcpiDsExecMethodCall (WalkState, Op);
+            if (Status == AE_OK || Status == AE_CTRL_TRANSFER)
             {
-                /* On error, clear all resolved operands */
-
-                AcpiDsClearOperands (WalkState);
-                break;
+                /*
+                 * Return now; we don't want to disturb anything,
+                 * especially the operand count!
+                 */
+                return_ACPI_STATUS (Status);
             }
-
-            /*
-             * Tell the walk loop to preempt this running method and
-             * execute the new method
-             */
-            Status = AE_CTRL_TRANSFER;
-
-            /*
-             * Return now; we don't want to disturb anything,
-             * especially the operand count!
-             */
-            return_ACPI_STATUS (Status);
+            break;
 
         case AML_TYPE_CREATE_FIELD:
 
-            ACPI_DEBUG_PRINT ((ACPI_DB_EXEC,
-                "Executing CreateField Buffer/Index Op=%p\n", Op));
-
-            Status = AcpiDsLoad2EndOp (WalkState);
-            if (ACPI_FAILURE (Status))
-            {
-                break;
-            }
-
-            Status = AcpiDsEvalBufferFieldOperands (WalkState, Op);
-            if (ACPI_FAILURE (Status))
-            {
-                break;
-            }
-
-#ifdef ACPI_EXEC_APP
-            /*
-             * AcpiExec support for namespace initialization file (initialize
-             * BufferFields in this code.)
-             */
-            Namepath = AcpiNsGetExternalPathname (Op->Common.Node);
-            Status = AeLookupInitFileEntry (Namepath, &ObjDesc);
-            if (ACPI_SUCCESS (Status))
-            {
-                Status = AcpiExWriteDataToField (ObjDesc, Op->Common.Node->Object, NULL);
-                if (ACPI_FAILURE (Status))
-                {
-                    ACPI_EXCEPTION ((AE_INFO, Status, "While writing to buffer field"));
-                }
-            }
-            ACPI_FREE (Namepath);
-            Status = AE_OK;
-#endif
+            Status = AcpiDsExecCreateField (WalkState, Op);
             break;
 
-
         case AML_TYPE_CREATE_OBJECT:
 
-            ACPI_DEBUG_PRINT ((ACPI_DB_EXEC,
-                "Executing CreateObject (Buffer/Package) Op=%p Child=%p ParentOpcode=%4.4X\n",
-                Op, Op->Named.Value.Arg, Op->Common.Parent->Common.AmlOpcode));
-
-            switch (Op->Common.Parent->Common.AmlOpcode)
-            {
-            case AML_NAME_OP:
-                /*
-                 * Put the Node on the object stack (Contains the ACPI Name
-                 * of this object)
-                 */
-                WalkState->Operands[0] = (void *)
-                    Op->Common.Parent->Common.Node;
-                WalkState->NumOperands = 1;
-
-                Status = AcpiDsCreateNode (WalkState,
-                    Op->Common.Parent->Common.Node, Op->Common.Parent);
-                if (ACPI_FAILURE (Status))
-                {
-                    break;
-                }
-
-                ACPI_FALLTHROUGH;
-
-            case AML_INT_EVAL_SUBTREE_OP:
-
-                Status = AcpiDsEvalDataObjectOperands (WalkState, Op,
-                    AcpiNsGetAttachedObject (Op->Common.Parent->Common.Node));
-                break;
-
-            default:
-
-                Status = AcpiDsEvalDataObjectOperands (WalkState, Op, NULL);
-                break;
-            }
-
-            /*
-             * If a result object was returned from above, push it on the
-             * current result stack
-             */
-            if (WalkState->ResultObj)
-            {
-                Status = AcpiDsResultPush (WalkState->ResultObj, WalkState);
-            }
+            Status = AcpiDsExecCreateObject (WalkState, Op);
             break;
 
         case AML_TYPE_NAMED_FIELD:
@@ -695,45 +1275,7 @@ AcpiDsExecEndOp (
         case AML_TYPE_NAMED_SIMPLE:
         case AML_TYPE_NAMED_NO_OBJ:
 
-            Status = AcpiDsLoad2EndOp (WalkState);
-            if (ACPI_FAILURE (Status))
-            {
-                break;
-            }
-
-            if (Op->Common.AmlOpcode == AML_REGION_OP)
-            {
-                ACPI_DEBUG_PRINT ((ACPI_DB_EXEC,
-                    "Executing OpRegion Address/Length Op=%p\n", Op));
-
-                Status = AcpiDsEvalRegionOperands (WalkState, Op);
-                if (ACPI_FAILURE (Status))
-                {
-                    break;
-                }
-            }
-            else if (Op->Common.AmlOpcode == AML_DATA_REGION_OP)
-            {
-                ACPI_DEBUG_PRINT ((ACPI_DB_EXEC,
-                    "Executing DataTableRegion Strings Op=%p\n", Op));
-
-                Status = AcpiDsEvalTableRegionOperands (WalkState, Op);
-                if (ACPI_FAILURE (Status))
-                {
-                    break;
-                }
-            }
-            else if (Op->Common.AmlOpcode == AML_BANK_FIELD_OP)
-            {
-                ACPI_DEBUG_PRINT ((ACPI_DB_EXEC,
-                    "Executing BankField Op=%p\n", Op));
-
-                Status = AcpiDsEvalBankFieldOperands (WalkState, Op);
-                if (ACPI_FAILURE (Status))
-                {
-                    break;
-                }
-            }
+            Status = AcpiDsExecNamedObject (WalkState, Op);
             break;
 
         case AML_TYPE_UNDEFINED:
@@ -760,6 +1302,7 @@ AcpiDsExecEndOp (
             break;
         }
     }
+#endif
 
     /*
      * ACPI 2.0 support for 64-bit integers: Truncate numeric
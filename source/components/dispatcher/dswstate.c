@@ -53,14 +53,26 @@
 /* Local prototypes */
 
 static ACPI_STATUS
-AcpiDsResultStackPush (
-    ACPI_WALK_STATE         *WalkState);
+AcpiDsResultStackGrow (
+    ACPI_VALUE_STACK        *Stack,
+    ACPI_WALK_ARENA         *Arena);
 
-static ACPI_STATUS
-AcpiDsResultStackPop (
+static void
+AcpiDsResultStackDiscard (
     ACPI_WALK_STATE         *WalkState);
 
 
+/*
+ * The result stack is one contiguous array per thread, shared by all of the
+ * walk states of the thread. Walks in a thread are strictly nested, so each
+ * walk simply owns the elements between ResultBase (the top of the stack at
+ * the time of its first push) and ResultBase + ResultCount. Walk states
+ * without a thread (compiler constant folding) use a private stack embedded
+ * in the walk state. The array only grows, so pushing and popping results
+ * does not allocate once the stack is as deep as the deepest expression
+ * evaluated by the thread so far.
+ */
+
 /*******************************************************************************
  *
  * FUNCTION:    AcpiDsResultPop
@@ -79,44 +91,36 @@ AcpiDsResultPop (
     ACPI_OPERAND_OBJECT     **Object,
     ACPI_WALK_STATE         *WalkState)
 {
-    UINT32                  Index;
-    ACPI_GENERIC_STATE      *State;
-    ACPI_STATUS             Status;
+    ACPI_VALUE_STACK        *Stack;
 
 
     ACPI_FUNCTION_NAME (DsResultPop);
 
 
-    State = WalkState->Results;
-
-    /* Incorrect state of result stack */
-
-    if (State && !WalkState->ResultCount)
-    {
-        ACPI_ERROR ((AE_INFO, "No results on result stack"));
-        return (AE_AML_INTERNAL);
-    }
+    /* Empty result stack */
 
-    if (!State && WalkState->ResultCount)
+    if (!WalkState->ResultCount)
     {
-        ACPI_ERROR ((AE_INFO, "No result state for result stack"));
-        return (AE_AML_INTERNAL);
+        ACPI_ERROR ((AE_INFO, "Result stack is empty! State=%p", WalkState));
+        return (AE_AML_NO_RETURN_VALUE);
     }
 
-    /* Empty result stack */
+    /* Incorrect state of result stack */
 
-    if (!State)
+    Stack = WalkState->ResultStack;
+    if (!Stack ||
+        (Stack->Top != WalkState->ResultBase + WalkState->ResultCount))
     {
-        ACPI_ERROR ((AE_INFO, "Result stack is empty! State=%p", WalkState));
-        return (AE_AML_NO_RETURN_VALUE);
+        ACPI_ERROR ((AE_INFO, "Result stack out of sync, State=%p", WalkState));
+        return (AE_AML_INTERNAL);
     }
 
-    /* Return object of the top element and clean that top element result stack */
+    /* Return object of the top element */
 
     WalkState->ResultCount--;
-    Index = (UINT32) WalkState->ResultCount % ACPI_RESULTS_FRAME_OBJ_NUM;
+    Stack->Top--;
 
-    *Object = State->Results.ObjDesc [Index];
+    *Object = Stack->Objects [Stack->Top];
     if (!*Object)
     {
         ACPI_ERROR ((AE_INFO, "No result objects on result stack, State=%p",
@@ -124,20 +128,10 @@ AcpiDsResultPop (
         return (AE_AML_NO_RETURN_VALUE);
     }
 
-    State->Results.ObjDesc [Index] = NULL;
-    if (Index == 0)
-    {
-        Status = AcpiDsResultStackPop (WalkState);
-        if (ACPI_FAILURE (Status))
-        {
-            return (Status);
-        }
-    }
-
     ACPI_DEBUG_PRINT ((ACPI_DB_EXEC,
         "Obj=%p [%s] Index=%X State=%p Num=%X\n", *Object,
         AcpiUtGetObjectTypeName (*Object),
-        Index, WalkState, WalkState->ResultCount));
+        Stack->Top, WalkState, WalkState->ResultCount));
 
     return (AE_OK);
 }
@@ -161,56 +155,63 @@ AcpiDsResultPush (
     ACPI_OPERAND_OBJECT     *Object,
     ACPI_WALK_STATE         *WalkState)
 {
-    ACPI_GENERIC_STATE      *State;
+    ACPI_VALUE_STACK        *Stack;
     ACPI_STATUS             Status;
-    UINT32                  Index;
 
 
     ACPI_FUNCTION_NAME (DsResultPush);
 
 
-    if (WalkState->ResultCount > WalkState->ResultSize)
+    if (!Object)
     {
-        ACPI_ERROR ((AE_INFO, "Result stack is full"));
-        return (AE_AML_INTERNAL);
+        ACPI_ERROR ((AE_INFO,
+            "Null Object! Obj=%p State=%p Num=%u",
+            Object, WalkState, WalkState->ResultCount));
+        return (AE_BAD_PARAMETER);
     }
-    else if (WalkState->ResultCount == WalkState->ResultSize)
-    {
-        /* Extend the result stack */
 
-        Status = AcpiDsResultStackPush (WalkState);
-        if (ACPI_FAILURE (Status))
-        {
-            ACPI_ERROR ((AE_INFO, "Failed to extend the result stack"));
-            return (Status);
-        }
-    }
+    /* Check for stack overflow */
 
-    if (!(WalkState->ResultCount < WalkState->ResultSize))
+    if (WalkState->ResultCount >= ACPI_RESULTS_OBJ_NUM_MAX)
     {
-        ACPI_ERROR ((AE_INFO, "No free elements in result stack"));
-        return (AE_AML_INTERNAL);
+        ACPI_ERROR ((AE_INFO, "Result stack overflow: State=%p Num=%u",
+            WalkState, WalkState->ResultCount));
+        return (AE_STACK_OVERFLOW);
     }
 
-    State = WalkState->Results;
-    if (!State)
+    /* The first result of a walk starts at the current top of the stack */
+
+    if (!WalkState->ResultCount)
     {
-        ACPI_ERROR ((AE_INFO, "No result stack frame during push"));
-        return (AE_AML_INTERNAL);
+        if (WalkState->Thread)
+        {
+            WalkState->ResultStack = &WalkState->Thread->ResultStack;
+        }
+        else
+        {
+            WalkState->ResultStack = &WalkState->PrivateResults;
+        }
+
+        WalkState->ResultBase = WalkState->ResultStack->Top;
     }
 
-    if (!Object)
+    Stack = WalkState->ResultStack;
+    if (Stack->Top >= Stack->Size)
     {
-        ACPI_ERROR ((AE_INFO,
-            "Null Object! Obj=%p State=%p Num=%u",
-            Object, WalkState, WalkState->ResultCount));
-        return (AE_BAD_PARAMETER);
+        /* Extend the result stack */
+
+        Status = AcpiDsResultStackGrow (Stack, WalkState->ParserState.Arena);
+        if (ACPI_FAILURE (Status))
+        {
+            ACPI_ERROR ((AE_INFO, "Failed to extend the result stack"));
+            return (Status);
+        }
     }
 
     /* Assign the address of object to the top free element of result stack */
 
-    Index = (UINT32) WalkState->ResultCount % ACPI_RESULTS_FRAME_OBJ_NUM;
-    State->Results.ObjDesc [Index] = Object;
+    Stack->Objects [Stack->Top] = Object;
+    Stack->Top++;
     WalkState->ResultCount++;
 
     ACPI_DEBUG_PRINT ((ACPI_DB_EXEC, "Obj=%p [%s] State=%p Num=%X Cur=%X\n",
@@ -223,51 +224,70 @@ AcpiDsResultPush (
 
 /*******************************************************************************
  *
- * FUNCTION:    AcpiDsResultStackPush
+ * FUNCTION:    AcpiDsResultStackGrow
  *
- * PARAMETERS:  WalkState           - Current Walk state
+ * PARAMETERS:  Stack               - Result stack to extend
+ *              Arena               - Walk arena of the thread, NULL if none
  *
  * RETURN:      Status
  *
- * DESCRIPTION: Push an object onto the WalkState result stack
+ * DESCRIPTION: Double the capacity of a result stack. The new array comes
+ *              from the walk arena if possible, else from the heap.
  *
  ******************************************************************************/
 
 static ACPI_STATUS
-AcpiDsResultStackPush (
-    ACPI_WALK_STATE         *WalkState)
+AcpiDsResultStackGrow (
+    ACPI_VALUE_STACK        *Stack,
+    ACPI_WALK_ARENA         *Arena)
 {
-    ACPI_GENERIC_STATE      *State;
+    ACPI_OPERAND_OBJECT     **Objects;
+    UINT32                  Size;
+    BOOLEAN                 Allocated = FALSE;
 
 
-    ACPI_FUNCTION_NAME (DsResultStackPush);
+    ACPI_FUNCTION_NAME (DsResultStackGrow);
 
 
-    /* Check for stack overflow */
+    Size = ACPI_RESULTS_STACK_INITIAL_SIZE;
+    if (Stack->Size)
+    {
+        Size = Stack->Size * 2;
+    }
 
-    if (((UINT32) WalkState->ResultSize + ACPI_RESULTS_FRAME_OBJ_NUM) >
-        ACPI_RESULTS_OBJ_NUM_MAX)
+    Objects = AcpiUtArenaAllocateArray (Arena,
+        (ACPI_SIZE) Size * sizeof (ACPI_OPERAND_OBJECT *));
+    if (!Objects)
     {
-        ACPI_ERROR ((AE_INFO, "Result stack overflow: State=%p Num=%u",
-            WalkState, WalkState->ResultSize));
-        return (AE_STACK_OVERFLOW);
+        Objects = ACPI_ALLOCATE ((ACPI_SIZE) Size *
+            sizeof (ACPI_OPERAND_OBJECT *));
+        if (!Objects)
+        {
+            return (AE_NO_MEMORY);
+        }
+
+        Allocated = TRUE;
     }
 
-    State = AcpiUtCreateGenericState ();
-    if (!State)
+    if (Stack->Top)
     {
-        return (AE_NO_MEMORY);
+        memcpy (Objects, Stack->Objects,
+            (ACPI_SIZE) Stack->Top * sizeof (ACPI_OPERAND_OBJECT *));
     }
 
-    State->Common.DescriptorType = ACPI_DESC_TYPE_STATE_RESULT;
-    AcpiUtPushGenericState (&WalkState->Results, State);
+    /* Arena blocks are reclaimed with the arena */
 
-    /* Increase the length of the result stack by the length of frame */
+    if (Stack->Allocated)
+    {
+        ACPI_FREE (Stack->Objects);
+    }
 
-    WalkState->ResultSize += ACPI_RESULTS_FRAME_OBJ_NUM;
+    Stack->Objects = Objects;
+    Stack->Size = Size;
+    Stack->Allocated = Allocated;
 
-    ACPI_DEBUG_PRINT ((ACPI_DB_EXEC, "Results=%p State=%p\n",
-        State, WalkState));
+    ACPI_DEBUG_PRINT ((ACPI_DB_EXEC, "Result stack %p extended to %u\n",
+        Stack, Size));
 
     return (AE_OK);
 }
@@ -275,53 +295,60 @@ AcpiDsResultStackPush (
 
 /*******************************************************************************
  *
- * FUNCTION:    AcpiDsResultStackPop
+ * FUNCTION:    AcpiDsResultStackDiscard
  *
- * PARAMETERS:  WalkState           - Current Walk state
+ * PARAMETERS:  WalkState           - Walk state that is going away
  *
- * RETURN:      Status
+ * RETURN:      None
  *
- * DESCRIPTION: Pop an object off of the WalkState result stack
+ * DESCRIPTION: Drop the elements of the result stack still owned by a walk,
+ *              so that they are reused by the parent walk. The objects are
+ *              not deleted; a result left on the stack is either referenced
+ *              by the walk (ReturnDesc) or is owned by the parse tree.
  *
  ******************************************************************************/
 
-static ACPI_STATUS
-AcpiDsResultStackPop (
+static void
+AcpiDsResultStackDiscard (
     ACPI_WALK_STATE         *WalkState)
 {
-    ACPI_GENERIC_STATE      *State;
-
+    ACPI_FUNCTION_ENTRY ();
 
-    ACPI_FUNCTION_NAME (DsResultStackPop);
 
-
-    /* Check for stack underflow */
-
-    if (WalkState->Results == NULL)
+    if (WalkState->ResultCount)
     {
-        ACPI_DEBUG_PRINT ((ACPI_DB_EXEC,
-            "Result stack underflow - State=%p\n", WalkState));
-        return (AE_AML_NO_OPERAND);
+        WalkState->ResultStack->Top = WalkState->ResultBase;
+        WalkState->ResultCount = 0;
     }
+}
 
-    if (WalkState->ResultSize < ACPI_RESULTS_FRAME_OBJ_NUM)
-    {
-        ACPI_ERROR ((AE_INFO, "Insufficient result stack size"));
-        return (AE_AML_INTERNAL);
-    }
 
-    State = AcpiUtPopGenericState (&WalkState->Results);
-    AcpiUtDeleteGenericState (State);
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiDsResultStackRelease
+ *
+ * PARAMETERS:  Stack               - Result stack
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Free the element array of a result stack. Called when the
+ *              owning thread state or walk state is deleted.
+ *
+ ******************************************************************************/
 
-    /* Decrease the length of result stack by the length of frame */
+void
+AcpiDsResultStackRelease (
+    ACPI_VALUE_STACK        *Stack)
+{
+    ACPI_FUNCTION_ENTRY ();
 
-    WalkState->ResultSize -= ACPI_RESULTS_FRAME_OBJ_NUM;
 
-    ACPI_DEBUG_PRINT ((ACPI_DB_EXEC,
-        "Result=%p RemainingResults=%X State=%p\n",
-        State, WalkState->ResultCount, WalkState));
+    if (Stack->Allocated)
+    {
+        ACPI_FREE (Stack->Objects);
+    }
 
-    return (AE_OK);
+    memset (Stack, 0, sizeof (ACPI_VALUE_STACK));
 }
 
 
@@ -569,6 +596,10 @@ AcpiDsPopWalkState (
 
         Thread->WalkStateList = WalkState->Next;
 
+        /* Results of this walk are no longer reachable by the parent */
+
+        AcpiDsResultStackDiscard (WalkState);
+
         /*
          * Don't clear the NEXT field, this serves as an indicator
          * that there is a parent WALK STATE
@@ -609,10 +640,21 @@ AcpiDsCreateWalkState (
     ACPI_FUNCTION_TRACE (DsCreateWalkState);
 
 
-    WalkState = ACPI_ALLOCATE_ZEROED (sizeof (ACPI_WALK_STATE));
+    /* The walk states of nested method calls come from the invocation arena */
+
+    WalkState = NULL;
+    if (Thread)
+    {
+        WalkState = AcpiUtArenaCreateWalkState (&Thread->Arena);
+    }
+
     if (!WalkState)
     {
-        return_PTR (NULL);
+        WalkState = ACPI_ALLOCATE_ZEROED (sizeof (ACPI_WALK_STATE));
+        if (!WalkState)
+        {
+            return_PTR (NULL);
+        }
     }
 
     WalkState->DescriptorType = ACPI_DESC_TYPE_WALK;
@@ -622,6 +664,10 @@ AcpiDsCreateWalkState (
     WalkState->Thread = Thread;
 
     WalkState->ParserState.StartOp = Origin;
+    if (Thread)
+    {
+        WalkState->ParserState.Arena = &Thread->Arena;
+    }
 
     /* Init the method args/local */
 
@@ -819,7 +865,7 @@ AcpiDsDeleteWalkState (
         State = WalkState->ControlState;
         WalkState->ControlState = State->Common.Next;
 
-        AcpiUtDeleteGenericState (State);
+        AcpiUtArenaDeleteState (WalkState->ParserState.Arena, State);
     }
 
     /* Always must free any linked parse states */
@@ -829,19 +875,22 @@ AcpiDsDeleteWalkState (
         State = WalkState->ScopeInfo;
         WalkState->ScopeInfo = State->Common.Next;
 
-        AcpiUtDeleteGenericState (State);
+        AcpiUtArenaDeleteState (WalkState->ParserState.Arena, State);
     }
 
-    /* Always must free any stacked result states */
+    /* Always must drop any stacked results */
 
-    while (WalkState->Results)
-    {
-        State = WalkState->Results;
-        WalkState->Results = State->Common.Next;
+    AcpiDsResultStackDiscard (WalkState);
+    AcpiDsResultStackRelease (&WalkState->PrivateResults);
 
-        AcpiUtDeleteGenericState (State);
+    if (WalkState->WalkArena)
+    {
+        AcpiUtArenaDeleteWalkState (WalkState);
+    }
+    else
+    {
+        ACPI_FREE (WalkState);
     }
 
-    ACPI_FREE (WalkState);
     return_VOID;
 }
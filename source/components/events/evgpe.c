@@ -61,6 +61,13 @@ static void ACPI_SYSTEM_XFACE
 AcpiEvAsynchEnableGpe (
     void                    *Context);
 
+static UINT32
+AcpiEvDispatchActiveGpe (
+    ACPI_NAMESPACE_NODE     *GpeDevice,
+    ACPI_GPE_EVENT_INFO     *GpeEventInfo,
+    UINT32                  GpeNumber,
+    ACPI_CPU_FLAGS          *Flags);
+
 
 /*******************************************************************************
  *
@@ -427,6 +434,11 @@ AcpiEvGetGpeEventInfo (
  * DESCRIPTION: Detect if any GP events have occurred. This function is
  *              executed at interrupt level.
  *
+ *              The status and enable registers of each register pair are
+ *              read once, and only the GPEs that are both enabled and active
+ *              are dispatched. A raw handler runs without the GPE lock, so
+ *              the pair is read again after one has been called.
+ *
  ******************************************************************************/
 
 UINT32
@@ -440,6 +452,11 @@ AcpiEvGpeDetect (
     UINT32                  GpeNumber;
     UINT32                  IntStatus = ACPI_INTERRUPT_NOT_HANDLED;
     ACPI_CPU_FLAGS          Flags;
+    UINT64                  StatusReg;
+    UINT64                  EnableReg;
+    UINT8                   ActiveMask;
+    UINT8                   DoneMask;
+    ACPI_STATUS             Status;
     UINT32                  i;
     UINT32                  j;
 
@@ -466,6 +483,7 @@ AcpiEvGpeDetect (
     while (GpeBlock)
     {
         GpeDevice = GpeBlock->Node;
+        GpeBlock->DetectCount++;
 
         /*
          * Read all of the 8-bit GPE status and enable registers in this GPE
@@ -488,26 +506,77 @@ AcpiEvGpeDetect (
                     "Ignore disabled registers for GPE %02X-%02X: "
                     "RunEnable=%02X, WakeEnable=%02X\n",
                     GpeRegisterInfo->BaseGpeNumber,
-                    GpeRegisterInfo->BaseGpeNumber + (ACPI_GPE_REGISTER_WIDTH - 1),
+                    GpeRegisterInfo->BaseGpeNumber +
+                        (ACPI_GPE_REGISTER_WIDTH - 1),
                     GpeRegisterInfo->EnableForRun,
                     GpeRegisterInfo->EnableForWake));
                 continue;
             }
 
-            /* Now look at the individual GPEs in this byte register */
-
-            for (j = 0; j < ACPI_GPE_REGISTER_WIDTH; j++)
+            DoneMask = 0;
+            do
             {
-                /* Detect and dispatch one GPE bit */
-
-                GpeEventInfo = &GpeBlock->EventInfo[((ACPI_SIZE) i *
-                    ACPI_GPE_REGISTER_WIDTH) + j];
-                GpeNumber = j + GpeRegisterInfo->BaseGpeNumber;
-                AcpiOsReleaseLock (AcpiGbl_GpeLock, Flags);
-                IntStatus |= AcpiEvDetectGpe (
-                    GpeDevice, GpeEventInfo, GpeNumber);
-                Flags = AcpiOsAcquireLock (AcpiGbl_GpeLock);
-            }
+                /* Read the status/enable pair, find the active GPEs */
+
+                GpeBlock->RegisterReads += 2;
+                Status = AcpiHwRead (&EnableReg,
+                    &GpeRegisterInfo->EnableAddress);
+                if (ACPI_FAILURE (Status))
+                {
+                    break;
+                }
+
+                Status = AcpiHwRead (&StatusReg,
+                    &GpeRegisterInfo->StatusAddress);
+                if (ACPI_FAILURE (Status))
+                {
+                    break;
+                }
+
+                ACPI_DEBUG_PRINT ((ACPI_DB_INTERRUPTS,
+                    "Read registers for GPE %02X-%02X: Status=%02X, "
+                    "Enable=%02X, RunEnable=%02X, WakeEnable=%02X\n",
+                    GpeRegisterInfo->BaseGpeNumber,
+                    GpeRegisterInfo->BaseGpeNumber +
+                        (ACPI_GPE_REGISTER_WIDTH - 1),
+                    (UINT32) StatusReg, (UINT32) EnableReg,
+                    GpeRegisterInfo->EnableForRun,
+                    GpeRegisterInfo->EnableForWake));
+
+                ActiveMask = (UINT8) (StatusReg & EnableReg) & ~DoneMask;
+                if (!ActiveMask)
+                {
+                    break;
+                }
+
+                /* Dispatch each active GPE in this byte register */
+
+                for (j = 0; j < ACPI_GPE_REGISTER_WIDTH; j++)
+                {
+                    if (!(ActiveMask & (1 << j)))
+                    {
+                        continue;
+                    }
+
+                    DoneMask |= (1 << j);
+                    GpeEventInfo = &GpeBlock->EventInfo[((ACPI_SIZE) i *
+                        ACPI_GPE_REGISTER_WIDTH) + j];
+                    GpeNumber = j + GpeRegisterInfo->BaseGpeNumber;
+
+                    GpeBlock->DispatchCount++;
+                    IntStatus |= AcpiEvDispatchActiveGpe (
+                        GpeDevice, GpeEventInfo, GpeNumber, &Flags);
+
+                    /* The registers may have changed while the lock was free */
+
+                    if (ACPI_GPE_DISPATCH_TYPE (GpeEventInfo->Flags) ==
+                        ACPI_GPE_DISPATCH_RAW_HANDLER)
+                    {
+                        break;
+                    }
+                }
+
+            } while (j < ACPI_GPE_REGISTER_WIDTH);
         }
 
         GpeBlock = GpeBlock->Next;
@@ -633,7 +702,9 @@ ErrorExit:
  * RETURN:      None
  *
  * DESCRIPTION: Asynchronous clear/enable for GPE. This allows the GPE to
- *              complete (i.e., finish execution of Notify)
+ *              complete (i.e., finish execution of Notify). If the GPE was
+ *              dispatched again during the execution, the method is queued
+ *              once more instead and the GPE stays disabled until it is done.
  *
  ******************************************************************************/
 
@@ -643,9 +714,25 @@ AcpiEvAsynchEnableGpe (
 {
     ACPI_GPE_EVENT_INFO     *GpeEventInfo = Context;
     ACPI_CPU_FLAGS          Flags;
+    ACPI_STATUS             Status;
 
 
     Flags = AcpiOsAcquireLock (AcpiGbl_GpeLock);
+
+    if (GpeEventInfo->MethodState == ACPI_GPE_METHOD_RERUN)
+    {
+        GpeEventInfo->MethodState = ACPI_GPE_METHOD_QUEUED;
+        Status = AcpiOsExecute (OSL_GPE_HANDLER,
+            AcpiEvAsynchExecuteGpeMethod, GpeEventInfo);
+        if (ACPI_SUCCESS (Status))
+        {
+            AcpiGpeRerunCount++;
+            AcpiOsReleaseLock (AcpiGbl_GpeLock, Flags);
+            return;
+        }
+    }
+
+    GpeEventInfo->MethodState = ACPI_GPE_METHOD_IDLE;
     (void) AcpiEvFinishGpe (GpeEventInfo);
     AcpiOsReleaseLock (AcpiGbl_GpeLock, Flags);
 
@@ -730,7 +817,6 @@ AcpiEvDetectGpe (
     UINT64                  EnableReg;
     UINT32                  RegisterBit;
     ACPI_GPE_REGISTER_INFO  *GpeRegisterInfo;
-    ACPI_GPE_HANDLER_INFO   *GpeHandlerInfo;
     ACPI_CPU_FLAGS          Flags;
     ACPI_STATUS             Status;
 
@@ -790,6 +876,43 @@ AcpiEvDetectGpe (
         goto ErrorExit;
     }
 
+    IntStatus = AcpiEvDispatchActiveGpe (GpeDevice,
+        GpeEventInfo, GpeNumber, &Flags);
+
+ErrorExit:
+    AcpiOsReleaseLock (AcpiGbl_GpeLock, Flags);
+    return (IntStatus);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiEvDispatchActiveGpe
+ *
+ * PARAMETERS:  GpeDevice           - Device node. NULL for GPE0/GPE1
+ *              GpeEventInfo        - Info for this GPE
+ *              GpeNumber           - Number relative to the parent GPE block
+ *              Flags               - Flags of the held GpeLock
+ *
+ * RETURN:      INTERRUPT_HANDLED or INTERRUPT_NOT_HANDLED
+ *
+ * DESCRIPTION: Dispatch a GPE whose status and enable bits are both set.
+ *              Called with the GpeLock held. A raw handler is called with
+ *              the lock released; the lock is held again on return.
+ *
+ ******************************************************************************/
+
+static UINT32
+AcpiEvDispatchActiveGpe (
+    ACPI_NAMESPACE_NODE     *GpeDevice,
+    ACPI_GPE_EVENT_INFO     *GpeEventInfo,
+    UINT32                  GpeNumber,
+    ACPI_CPU_FLAGS          *Flags)
+{
+    UINT32                  IntStatus;
+    ACPI_GPE_HANDLER_INFO   *GpeHandlerInfo;
+
+
     /* Invoke global event handler if present */
 
     AcpiGpeCount++;
@@ -819,21 +942,19 @@ AcpiEvDetectGpe (
          *    AcpiOsWaitEventsComplete() before the
          *    destruction.
          */
-        AcpiOsReleaseLock (AcpiGbl_GpeLock, Flags);
-        IntStatus |= GpeHandlerInfo->Address (
+        AcpiOsReleaseLock (AcpiGbl_GpeLock, *Flags);
+        IntStatus = GpeHandlerInfo->Address (
             GpeDevice, GpeNumber, GpeHandlerInfo->Context);
-        Flags = AcpiOsAcquireLock (AcpiGbl_GpeLock);
+        *Flags = AcpiOsAcquireLock (AcpiGbl_GpeLock);
     }
     else
     {
         /* Dispatch the event to a standard handler or method. */
 
-        IntStatus |= AcpiEvGpeDispatch (GpeDevice,
+        IntStatus = AcpiEvGpeDispatch (GpeDevice,
             GpeEventInfo, GpeNumber);
     }
 
-ErrorExit:
-    AcpiOsReleaseLock (AcpiGbl_GpeLock, Flags);
     return (IntStatus);
 }
 
@@ -866,6 +987,10 @@ AcpiEvGpeDispatch (
     ACPI_FUNCTION_TRACE (EvGpeDispatch);
 
 
+    /* A GPE that fires too often is masked and handed over to the poller */
+
+    AcpiEvCheckGpeStorm (GpeEventInfo, GpeNumber);
+
     /*
      * Always disable the GPE so that it does not keep firing before
      * any asynchronous activity completes (either from the execution
@@ -930,14 +1055,29 @@ AcpiEvGpeDispatch (
 
     case ACPI_GPE_DISPATCH_METHOD:
     case ACPI_GPE_DISPATCH_NOTIFY:
+        /*
+         * If the method is already queued or running, do not queue it
+         * again. It is run once more after the current execution instead,
+         * however many events arrive in the meantime.
+         */
+        if (GpeEventInfo->MethodState != ACPI_GPE_METHOD_IDLE)
+        {
+            GpeEventInfo->MethodState = ACPI_GPE_METHOD_RERUN;
+            GpeEventInfo->CoalescedCount++;
+            AcpiGpeCoalescedCount++;
+            break;
+        }
+
         /*
          * Execute the method associated with the GPE
          * NOTE: Level-triggered GPEs are cleared after the method completes.
          */
+        GpeEventInfo->MethodState = ACPI_GPE_METHOD_QUEUED;
         Status = AcpiOsExecute (OSL_GPE_HANDLER,
             AcpiEvAsynchExecuteGpeMethod, GpeEventInfo);
         if (ACPI_FAILURE (Status))
         {
+            GpeEventInfo->MethodState = ACPI_GPE_METHOD_IDLE;
             ACPI_EXCEPTION ((AE_INFO, Status,
                 "Unable to queue handler for GPE %02X - event disabled",
                 GpeNumber));
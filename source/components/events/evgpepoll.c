@@ -0,0 +1,407 @@
+/******************************************************************************
+ *
+ * Module Name: evgpepoll - GPE storm detection and polling
+ *
+ *****************************************************************************/
+
+/*
+ * Copyright (C) 2000 - 2023, Intel Corp.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions, and the following disclaimer,
+ *    without modification.
+ * 2. Redistributions in binary form must reproduce at minimum a disclaimer
+ *    substantially similar to the "NO WARRANTY" disclaimer below
+ *    ("Disclaimer") and any redistribution must be conditioned upon
+ *    including a substantially similar Disclaimer requirement for further
+ *    binary redistribution.
+ * 3. Neither the names of the above-listed copyright holders nor the names
+ *    of any contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * Alternatively, this software may be distributed under the terms of the
+ * GNU General Public License ("GPL") version 2 as published by the Free
+ * Software Foundation.
+ *
+ * NO WARRANTY
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGES.
+ */
+
+#include "acpi.h"
+#include "accommon.h"
+#include "acevents.h"
+
+#define _COMPONENT          ACPI_EVENTS
+        ACPI_MODULE_NAME    ("evgpepoll")
+
+
+#if (!ACPI_REDUCED_HARDWARE) /* Entire module */
+
+/*
+ * A GPE that keeps firing (a level GPE whose source is never quieted, or
+ * an edge GPE toggling at a high rate) can keep a CPU busy dispatching it.
+ * Each dispatch is counted in a rate window; when the count exceeds
+ * AcpiGbl_GpeStormThreshold, the GPE is masked and a poller examines its
+ * status every AcpiGbl_GpePollInterval milliseconds instead, dispatching
+ * it as usual when the status is set. At the end of each window, a GPE
+ * that was found active in no more than half of the polls is unmasked.
+ *
+ * The poller is started with AcpiOsExecute on the first storm and exits
+ * when no GPE is polled anymore. Storm state is updated under the GpeLock.
+ */
+
+/* Local prototypes */
+
+static UINT32
+AcpiEvGetMilliseconds (
+    void);
+
+static BOOLEAN
+AcpiEvPollGpe (
+    ACPI_GPE_BLOCK_INFO     *GpeBlock,
+    ACPI_GPE_EVENT_INFO     *GpeEventInfo,
+    UINT32                  Now);
+
+static void ACPI_SYSTEM_XFACE
+AcpiEvGpePoller (
+    void                    *Context);
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiEvGetMilliseconds
+ *
+ * PARAMETERS:  None
+ *
+ * RETURN:      Current timer value in milliseconds, modulo 2^32
+ *
+ * DESCRIPTION: Time base of the rate windows. Elapsed times are computed with
+ *              unsigned subtraction, so the wraparound is harmless.
+ *
+ ******************************************************************************/
+
+static UINT32
+AcpiEvGetMilliseconds (
+    void)
+{
+
+    return ((UINT32) (AcpiOsGetTimer () / ACPI_100NSEC_PER_MSEC));
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiEvCheckGpeStorm
+ *
+ * PARAMETERS:  GpeEventInfo        - GPE that is being dispatched
+ *              GpeNumber           - Number relative to the parent GPE block
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Account for one dispatch of a GPE. If the GPE was dispatched
+ *              more than AcpiGbl_GpeStormThreshold times within the current
+ *              rate window, mask it and hand it over to the poller. Called
+ *              with the GpeLock held, at interrupt level.
+ *
+ ******************************************************************************/
+
+void
+AcpiEvCheckGpeStorm (
+    ACPI_GPE_EVENT_INFO     *GpeEventInfo,
+    UINT32                  GpeNumber)
+{
+    ACPI_STATUS             Status;
+    UINT32                  Now;
+
+
+    ACPI_FUNCTION_NAME (EvCheckGpeStorm);
+
+
+    if (!AcpiGbl_GpeStormThreshold || GpeEventInfo->Polling)
+    {
+        return;
+    }
+
+    Now = AcpiEvGetMilliseconds ();
+    if ((Now - GpeEventInfo->RateWindowStart) >= AcpiGbl_GpeStormWindow)
+    {
+        GpeEventInfo->RateWindowStart = Now;
+        GpeEventInfo->RateCount = 0;
+    }
+
+    GpeEventInfo->RateCount++;
+    if ((GpeEventInfo->RateCount <= AcpiGbl_GpeStormThreshold) ||
+        AcpiGbl_GpePollerStop)
+    {
+        return;
+    }
+
+    /*
+     * Storm detected. A GPE that is already masked (by AcpiMaskGpe) is
+     * left alone, its owner is in charge of it.
+     */
+    Status = AcpiEvMaskGpe (GpeEventInfo, TRUE);
+    if (ACPI_FAILURE (Status))
+    {
+        return;
+    }
+
+    if (!AcpiGbl_GpePollerRunning)
+    {
+        Status = AcpiOsExecute (OSL_NOTIFY_HANDLER, AcpiEvGpePoller, NULL);
+        if (ACPI_FAILURE (Status))
+        {
+            ACPI_EXCEPTION ((AE_INFO, Status,
+                "Unable to start poller for GPE %02X storm", GpeNumber));
+
+            (void) AcpiEvMaskGpe (GpeEventInfo, FALSE);
+            GpeEventInfo->RateWindowStart = Now;
+            GpeEventInfo->RateCount = 0;
+            return;
+        }
+
+        AcpiGbl_GpePollerRunning = TRUE;
+    }
+
+    GpeEventInfo->Polling = TRUE;
+    GpeEventInfo->StormCount++;
+    GpeEventInfo->RateWindowStart = Now;
+    GpeEventInfo->RateCount = 0;
+    GpeEventInfo->PollCount = 0;
+    AcpiGpeStormCount++;
+
+    ACPI_WARNING ((AE_INFO,
+        "GPE %02X storm (more than %u events in %u ms), "
+        "polling every %u ms", GpeNumber, AcpiGbl_GpeStormThreshold,
+        AcpiGbl_GpeStormWindow, AcpiGbl_GpePollInterval));
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiEvPollGpe
+ *
+ * PARAMETERS:  GpeBlock            - Block that contains the GPE
+ *              GpeEventInfo        - A GPE in polling mode
+ *              Now                 - Current time in milliseconds
+ *
+ * RETURN:      TRUE if the GPE is still polled
+ *
+ * DESCRIPTION: Poll the status of a stormed GPE once and dispatch it if the
+ *              status is set. At the end of each rate window, unmask the GPE
+ *              if the storm has subsided. A GPE whose last reference was
+ *              removed, or any GPE once storm detection has been disabled,
+ *              is unmasked right away. Called with the GpeLock held.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiEvPollGpe (
+    ACPI_GPE_BLOCK_INFO     *GpeBlock,
+    ACPI_GPE_EVENT_INFO     *GpeEventInfo,
+    UINT32                  Now)
+{
+    ACPI_EVENT_STATUS       EventStatus;
+    ACPI_STATUS             Status;
+
+
+    ACPI_FUNCTION_NAME (EvPollGpe);
+
+
+    if (GpeEventInfo->RuntimeCount && AcpiGbl_GpeStormThreshold)
+    {
+        GpeEventInfo->PollCount++;
+        Status = AcpiHwGetGpeStatus (GpeEventInfo, &EventStatus);
+        if (ACPI_SUCCESS (Status) &&
+            (EventStatus & ACPI_EVENT_FLAG_STATUS_SET))
+        {
+            GpeEventInfo->RateCount++;
+
+            /* A method still running for the last event is not queued again */
+
+            if (!GpeEventInfo->DisableForDispatch)
+            {
+                GpeEventInfo->PolledEvents++;
+                AcpiGpePolledCount++;
+
+                (void) AcpiEvGpeDispatch (GpeBlock->Node, GpeEventInfo,
+                    GpeEventInfo->GpeNumber);
+            }
+        }
+
+        if ((Now - GpeEventInfo->RateWindowStart) < AcpiGbl_GpeStormWindow)
+        {
+            return (TRUE);
+        }
+
+        if ((GpeEventInfo->RateCount * 2) > GpeEventInfo->PollCount)
+        {
+            /* Still storming, keep polling for another window */
+
+            GpeEventInfo->RateWindowStart = Now;
+            GpeEventInfo->RateCount = 0;
+            GpeEventInfo->PollCount = 0;
+            return (TRUE);
+        }
+    }
+
+    /* Back to interrupts */
+
+    (void) AcpiEvMaskGpe (GpeEventInfo, FALSE);
+    GpeEventInfo->Polling = FALSE;
+    GpeEventInfo->RateWindowStart = Now;
+    GpeEventInfo->RateCount = 0;
+    GpeEventInfo->PollCount = 0;
+
+    ACPI_INFO (("GPE %02X storm has subsided, polling stopped",
+        GpeEventInfo->GpeNumber));
+    return (FALSE);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiEvGpePoller
+ *
+ * PARAMETERS:  Context             - Not used
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Entry point of the poller started with AcpiOsExecute. Polls
+ *              all stormed GPEs every AcpiGbl_GpePollInterval milliseconds,
+ *              and exits once none is left or the subsystem terminates.
+ *
+ ******************************************************************************/
+
+static void ACPI_SYSTEM_XFACE
+AcpiEvGpePoller (
+    void                    *Context)
+{
+    ACPI_GPE_XRUPT_INFO     *GpeXruptInfo;
+    ACPI_GPE_BLOCK_INFO     *GpeBlock;
+    ACPI_GPE_EVENT_INFO     *GpeEventInfo;
+    ACPI_CPU_FLAGS          Flags;
+    UINT32                  PollingCount;
+    UINT32                  Interval;
+    UINT32                  Now;
+    UINT32                  i;
+
+
+    ACPI_FUNCTION_TRACE (EvGpePoller);
+
+
+    while (1)
+    {
+        /* Sleep for one interval, or until AcpiEvStopGpePoller signals */
+
+        Interval = ACPI_MAX (AcpiGbl_GpePollInterval, 1);
+        Interval = ACPI_MIN (Interval, ACPI_WAIT_FOREVER - 1);
+        (void) AcpiOsWaitSemaphore (AcpiGbl_GpePollSemaphore, 1,
+            (UINT16) Interval);
+
+        Flags = AcpiOsAcquireLock (AcpiGbl_GpeLock);
+
+        PollingCount = 0;
+        if (!AcpiGbl_GpePollerStop)
+        {
+            Now = AcpiEvGetMilliseconds ();
+
+            GpeXruptInfo = AcpiGbl_GpeXruptListHead;
+            while (GpeXruptInfo)
+            {
+                GpeBlock = GpeXruptInfo->GpeBlockListHead;
+                while (GpeBlock)
+                {
+                    for (i = 0; i < GpeBlock->GpeCount; i++)
+                    {
+                        GpeEventInfo = &GpeBlock->EventInfo[i];
+                        if (GpeEventInfo->Polling &&
+                            AcpiEvPollGpe (GpeBlock, GpeEventInfo, Now))
+                        {
+                            PollingCount++;
+                        }
+                    }
+
+                    GpeBlock = GpeBlock->Next;
+                }
+
+                GpeXruptInfo = GpeXruptInfo->Next;
+            }
+        }
+
+        /* Decided under the lock, so a new storm starts a new poller */
+
+        if (!PollingCount)
+        {
+            AcpiGbl_GpePollerRunning = FALSE;
+            AcpiOsReleaseLock (AcpiGbl_GpeLock, Flags);
+            return_VOID;
+        }
+
+        AcpiOsReleaseLock (AcpiGbl_GpeLock, Flags);
+    }
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiEvStopGpePoller
+ *
+ * PARAMETERS:  None
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Stop the poller of stormed GPEs and wait for it to exit. No
+ *              new poller is started afterwards. Stormed GPEs are left
+ *              masked. Called when the subsystem terminates.
+ *
+ ******************************************************************************/
+
+void
+AcpiEvStopGpePoller (
+    void)
+{
+    ACPI_CPU_FLAGS          Flags;
+    BOOLEAN                 Running;
+
+
+    ACPI_FUNCTION_TRACE (EvStopGpePoller);
+
+
+    Flags = AcpiOsAcquireLock (AcpiGbl_GpeLock);
+    AcpiGbl_GpePollerStop = TRUE;
+    Running = AcpiGbl_GpePollerRunning;
+    AcpiOsReleaseLock (AcpiGbl_GpeLock, Flags);
+
+    if (Running)
+    {
+        (void) AcpiOsSignalSemaphore (AcpiGbl_GpePollSemaphore, 1);
+    }
+
+    while (Running)
+    {
+        AcpiOsSleep (1);
+
+        Flags = AcpiOsAcquireLock (AcpiGbl_GpeLock);
+        Running = AcpiGbl_GpePollerRunning;
+        AcpiOsReleaseLock (AcpiGbl_GpeLock, Flags);
+    }
+
+    return_VOID;
+}
+
+#endif /* !ACPI_REDUCED_HARDWARE */
@@ -123,6 +123,7 @@ UnlockAndExit:
  *
  * DESCRIPTION: Matches the input GPE index (0-CurrentGpeCount) with a GPE
  *              block device. NULL if the GPE is one of the FADT-defined GPEs.
+ *              Optionally returns the counters of the GPE block.
  *
  ******************************************************************************/
 
@@ -150,6 +151,20 @@ AcpiEvGetGpeDevice (
             Info->GpeDevice = GpeBlock->Node;
         }
 
+        /* Copy the counters while the GPE lock is held */
+
+        if (Info->Statistics)
+        {
+            Info->Statistics->GpeDevice = Info->GpeDevice;
+            Info->Statistics->BlockBaseIndex =
+                Info->NextBlockBaseIndex - GpeBlock->GpeCount;
+            Info->Statistics->BlockBaseNumber = GpeBlock->BlockBaseNumber;
+            Info->Statistics->GpeCount = GpeBlock->GpeCount;
+            Info->Statistics->DetectCount = GpeBlock->DetectCount;
+            Info->Statistics->RegisterReads = GpeBlock->RegisterReads;
+            Info->Statistics->DispatchCount = GpeBlock->DispatchCount;
+        }
+
         Info->Status = AE_OK;
         return (AE_CTRL_END);
     }
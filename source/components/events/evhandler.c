@@ -124,7 +124,7 @@ AcpiEvInstallRegionHandlers (
     {
         Status = AcpiEvInstallSpaceHandler (AcpiGbl_RootNode,
             AcpiGbl_DefaultAddressSpaces[i],
-            ACPI_DEFAULT_HANDLER, NULL, NULL);
+            ACPI_DEFAULT_HANDLER, NULL, NULL, 0);
         switch (Status)
         {
         case AE_OK:
@@ -377,6 +377,7 @@ AcpiEvFindRegionHandler (
  *              Handler         - Address of the handler
  *              Setup           - Address of the setup function
  *              Context         - Value passed to the handler on each access
+ *              HandlerFlags    - ACPI_ADR_HANDLER_* capabilities of Handler
  *
  * RETURN:      Status
  *
@@ -391,7 +392,8 @@ AcpiEvInstallSpaceHandler (
     ACPI_ADR_SPACE_TYPE     SpaceId,
     ACPI_ADR_SPACE_HANDLER  Handler,
     ACPI_ADR_SPACE_SETUP    Setup,
-    void                    *Context)
+    void                    *Context,
+    UINT32                  HandlerFlags)
 {
     ACPI_OPERAND_OBJECT     *ObjDesc;
     ACPI_OPERAND_OBJECT     *HandlerObj;
@@ -426,6 +428,7 @@ AcpiEvInstallSpaceHandler (
 
             Handler = AcpiExSystemMemorySpaceHandler;
             Setup   = AcpiEvSystemMemoryRegionSetup;
+            Flags  |= ACPI_ADDR_HANDLER_BLOCK_IO;
             break;
 
         case ACPI_ADR_SPACE_SYSTEM_IO:
@@ -464,6 +467,10 @@ AcpiEvInstallSpaceHandler (
             goto UnlockAndExit;
         }
     }
+    else if (HandlerFlags & ACPI_ADR_HANDLER_BLOCK_IO)
+    {
+        Flags = ACPI_ADDR_HANDLER_BLOCK_IO;
+    }
 
     /* If the caller hasn't specified a setup routine, use the default */
 
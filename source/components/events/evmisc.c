@@ -129,6 +129,17 @@ AcpiEvQueueNotifyRequest (
         return (AE_TYPE);
     }
 
+    /*
+     * A Bus Check or Device Check may mean that devices (and their
+     * hardware IDs) have changed. Rebuild the device ID index on its
+     * next use.
+     */
+    if ((NotifyValue == ACPI_NOTIFY_BUS_CHECK) ||
+        (NotifyValue == ACPI_NOTIFY_DEVICE_CHECK))
+    {
+        AcpiNsInvalidateDeviceIds ();
+    }
+
     /* Get the correct notify list type (System or Device) */
 
     if (NotifyValue <= ACPI_MAX_SYS_NOTIFY)
@@ -277,6 +288,10 @@ AcpiEvTerminate (
          * print a message but obviously we don't abort.
          */
 
+        /* Stop polling GPEs that were masked after a storm */
+
+        AcpiEvStopGpePoller ();
+
         /* Disable all fixed events */
 
         for (i = 0; i < ACPI_NUM_FIXED_EVENTS; i++)
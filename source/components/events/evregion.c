@@ -127,11 +127,14 @@ AcpiEvInitializeOpRegions (
  *
  * PARAMETERS:  RegionObj           - Internal region object
  *              FieldObj            - Corresponding field. Can be NULL.
- *              Function            - Read or Write operation
+ *              Function            - Read or Write operation, plus
+ *                                    ACPI_BLOCK_IO and the datum count for
+ *                                    block transfers
  *              RegionOffset        - Where in the region to read or write
  *              BitWidth            - Field width in bits (8, 16, 32, or 64)
  *              Value               - Pointer to in or out value, must be
- *                                    a full 64-bit integer
+ *                                    a full 64-bit integer (or the data
+ *                                    buffer of a block transfer)
  *
  * RETURN:      Status
  *
@@ -75,7 +75,6 @@ AcpiEvSystemMemoryRegionSetup (
 {
     ACPI_OPERAND_OBJECT     *RegionDesc = (ACPI_OPERAND_OBJECT *) Handle;
     ACPI_MEM_SPACE_CONTEXT  *LocalRegionContext;
-    ACPI_MEM_MAPPING        *Mm;
 
 
     ACPI_FUNCTION_TRACE (EvSystemMemoryRegionSetup);
@@ -89,13 +88,7 @@ AcpiEvSystemMemoryRegionSetup (
 
             /* Delete memory mappings if present */
 
-            while (LocalRegionContext->FirstMm)
-            {
-                Mm = LocalRegionContext->FirstMm;
-                LocalRegionContext->FirstMm = Mm->NextMm;
-                AcpiOsUnmapMemory(Mm->LogicalAddress, Mm->Length);
-                ACPI_FREE(Mm);
-            }
+            AcpiExDeleteMemMappings (LocalRegionContext);
             ACPI_FREE (LocalRegionContext);
             *RegionContext = NULL;
         }
@@ -353,6 +353,18 @@ AcpiMaskGpe (
         goto UnlockAndExit;
     }
 
+    /* The caller takes over a GPE that was masked after a storm */
+
+    if (GpeEventInfo->Polling)
+    {
+        GpeEventInfo->Polling = FALSE;
+        if (IsMasked)
+        {
+            Status = AE_OK;
+            goto UnlockAndExit;
+        }
+    }
+
     Status = AcpiEvMaskGpe (GpeEventInfo, IsMasked);
 
 UnlockAndExit:
@@ -1231,6 +1243,7 @@ AcpiGetGpeDevice (
     Info.Status = AE_NOT_EXIST;
     Info.GpeDevice = NULL;
     Info.NextBlockBaseIndex = 0;
+    Info.Statistics = NULL;
 
     Status = AcpiEvWalkGpeList (AcpiEvGetGpeDevice, &Info);
     if (ACPI_FAILURE (Status))
@@ -1244,4 +1257,121 @@ AcpiGetGpeDevice (
 
 ACPI_EXPORT_SYMBOL (AcpiGetGpeDevice)
 
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiGetGpeBlockStatistics
+ *
+ * PARAMETERS:  Index               - System GPE index (0-CurrentGpeCount)
+ *              Statistics          - Where the counters are returned
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Obtain the SCI-time counters of the GPE block that contains
+ *              the input index: how often the block was examined, how many
+ *              status and enable registers were read, and how many GPEs
+ *              were dispatched. The next block starts at index
+ *              Statistics->BlockBaseIndex + Statistics->GpeCount.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiGetGpeBlockStatistics (
+    UINT32                  Index,
+    ACPI_GPE_BLOCK_STATISTICS *Statistics)
+{
+    ACPI_GPE_DEVICE_INFO    Info;
+    ACPI_STATUS             Status;
+
+
+    ACPI_FUNCTION_TRACE (AcpiGetGpeBlockStatistics);
+
+
+    if (!Statistics)
+    {
+        return_ACPI_STATUS (AE_BAD_PARAMETER);
+    }
+
+    if (Index >= AcpiCurrentGpeCount)
+    {
+        return_ACPI_STATUS (AE_NOT_EXIST);
+    }
+
+    /* Setup and walk the GPE list */
+
+    Info.Index = Index;
+    Info.Status = AE_NOT_EXIST;
+    Info.GpeDevice = NULL;
+    Info.NextBlockBaseIndex = 0;
+    Info.Statistics = Statistics;
+
+    Status = AcpiEvWalkGpeList (AcpiEvGetGpeDevice, &Info);
+    if (ACPI_FAILURE (Status))
+    {
+        return_ACPI_STATUS (Status);
+    }
+
+    return_ACPI_STATUS (Info.Status);
+}
+
+ACPI_EXPORT_SYMBOL (AcpiGetGpeBlockStatistics)
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiGetGpeStormInfo
+ *
+ * PARAMETERS:  GpeDevice           - Parent GPE Device. NULL for GPE0/GPE1
+ *              GpeNumber           - GPE level within the GPE block
+ *              StormInfo           - Where the storm state is returned
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Obtain the storm detection state of a GPE: how often it was
+ *              switched to polling, how many events the poller dispatched,
+ *              and whether it is being polled now.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiGetGpeStormInfo (
+    ACPI_HANDLE             GpeDevice,
+    UINT32                  GpeNumber,
+    ACPI_GPE_STORM_INFO     *StormInfo)
+{
+    ACPI_GPE_EVENT_INFO     *GpeEventInfo;
+    ACPI_STATUS             Status = AE_OK;
+    ACPI_CPU_FLAGS          Flags;
+
+
+    ACPI_FUNCTION_TRACE (AcpiGetGpeStormInfo);
+
+
+    if (!StormInfo)
+    {
+        return_ACPI_STATUS (AE_BAD_PARAMETER);
+    }
+
+    Flags = AcpiOsAcquireLock (AcpiGbl_GpeLock);
+
+    /* Ensure that we have a valid GPE number */
+
+    GpeEventInfo = AcpiEvGetGpeEventInfo (GpeDevice, GpeNumber);
+    if (!GpeEventInfo)
+    {
+        Status = AE_BAD_PARAMETER;
+        goto UnlockAndExit;
+    }
+
+    StormInfo->StormCount = GpeEventInfo->StormCount;
+    StormInfo->PolledEvents = GpeEventInfo->PolledEvents;
+    StormInfo->Polling = GpeEventInfo->Polling;
+
+UnlockAndExit:
+    AcpiOsReleaseLock (AcpiGbl_GpeLock, Flags);
+    return_ACPI_STATUS (Status);
+}
+
+ACPI_EXPORT_SYMBOL (AcpiGetGpeStormInfo)
+
 #endif /* !ACPI_REDUCED_HARDWARE */
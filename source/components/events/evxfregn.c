@@ -63,6 +63,7 @@
  *              Setup           - Address of the setup function
  *              Context         - Value passed to the handler on each access
  *              Run_Reg         - Run _REG methods for this address space?
+ *              Flags           - ACPI_ADR_HANDLER_* capabilities of Handler
  *
  * RETURN:      Status
  *
@@ -85,7 +86,8 @@ AcpiInstallAddressSpaceHandlerInternal (
     ACPI_ADR_SPACE_HANDLER  Handler,
     ACPI_ADR_SPACE_SETUP    Setup,
     void                    *Context,
-    BOOLEAN                 Run_Reg)
+    BOOLEAN                 Run_Reg,
+    UINT32                  Flags)
 {
     ACPI_NAMESPACE_NODE     *Node;
     ACPI_STATUS             Status;
@@ -119,7 +121,7 @@ AcpiInstallAddressSpaceHandlerInternal (
     /* Install the handler for all Regions for this Space ID */
 
     Status = AcpiEvInstallSpaceHandler (
-        Node, SpaceId, Handler, Setup, Context);
+        Node, SpaceId, Handler, Setup, Context, Flags);
     if (ACPI_FAILURE (Status))
     {
         goto UnlockAndExit;
@@ -145,7 +147,7 @@ AcpiInstallAddressSpaceHandler (
     ACPI_ADR_SPACE_SETUP    Setup,
     void                    *Context)
 {
-    return AcpiInstallAddressSpaceHandlerInternal (Device, SpaceId, Handler, Setup, Context, TRUE);
+    return AcpiInstallAddressSpaceHandlerInternal (Device, SpaceId, Handler, Setup, Context, TRUE, 0);
 }
 
 ACPI_EXPORT_SYMBOL (AcpiInstallAddressSpaceHandler)
@@ -158,12 +160,47 @@ AcpiInstallAddressSpaceHandlerNo_Reg (
     ACPI_ADR_SPACE_SETUP    Setup,
     void                    *Context)
 {
-    return AcpiInstallAddressSpaceHandlerInternal (Device, SpaceId, Handler, Setup, Context, FALSE);
+    return AcpiInstallAddressSpaceHandlerInternal (Device, SpaceId, Handler, Setup, Context, FALSE, 0);
 }
 
 ACPI_EXPORT_SYMBOL (AcpiInstallAddressSpaceHandlerNo_Reg)
 
 
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiInstallAddressSpaceHandlerEx
+ *
+ * PARAMETERS:  Device          - Handle for the device
+ *              SpaceId         - The address space ID
+ *              Handler         - Address of the handler
+ *              Setup           - Address of the setup function
+ *              Context         - Value passed to the handler on each access
+ *              Flags           - ACPI_ADR_HANDLER_* capabilities of Handler
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Same as AcpiInstallAddressSpaceHandler, for handlers that
+ *              implement optional requests. With ACPI_ADR_HANDLER_BLOCK_IO,
+ *              field reads and writes that cover whole datums are passed to
+ *              the handler in one ACPI_BLOCK_IO request.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiInstallAddressSpaceHandlerEx (
+    ACPI_HANDLE             Device,
+    ACPI_ADR_SPACE_TYPE     SpaceId,
+    ACPI_ADR_SPACE_HANDLER  Handler,
+    ACPI_ADR_SPACE_SETUP    Setup,
+    void                    *Context,
+    UINT32                  Flags)
+{
+    return AcpiInstallAddressSpaceHandlerInternal (Device, SpaceId, Handler, Setup, Context, TRUE, Flags);
+}
+
+ACPI_EXPORT_SYMBOL (AcpiInstallAddressSpaceHandlerEx)
+
+
 /*******************************************************************************
  *
  * FUNCTION:    AcpiRemoveAddressSpaceHandler
@@ -307,20 +307,20 @@ AcpiExDoDebugObject (
                 case ACPI_TYPE_BUFFER:
 
                     AcpiOsPrintf ("Buffer[%u] = 0x%2.2X\n",
-                        Value, *SourceDesc->Reference.IndexPointer);
+                        Value, ObjectDesc->Buffer.Pointer[Value]);
                     break;
 
                 case ACPI_TYPE_STRING:
 
                     AcpiOsPrintf ("String[%u] = \"%c\" (0x%2.2X)\n",
-                        Value, *SourceDesc->Reference.IndexPointer,
-                        *SourceDesc->Reference.IndexPointer);
+                        Value, ObjectDesc->String.Pointer[Value],
+                        ObjectDesc->String.Pointer[Value]);
                     break;
 
                 case ACPI_TYPE_PACKAGE:
 
                     AcpiOsPrintf ("Package[%u] = ", Value);
-                    if (!(*SourceDesc->Reference.Where))
+                    if (!(*AcpiExGetElementPointer (SourceDesc)))
                     {
                         AcpiOsPrintf ("[Uninitialized Package Element]\n");
                     }
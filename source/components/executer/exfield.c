@@ -230,7 +230,8 @@ AcpiExReadDataFromField (
     {
         /* Field will fit within an Integer (normal case) */
 
-        BufferDesc = AcpiUtCreateIntegerObject ((UINT64) 0);
+        BufferDesc = AcpiUtArenaCreateInteger (
+            WalkState ? WalkState->ParserState.Arena : NULL, 0);
         if (!BufferDesc)
         {
             return_ACPI_STATUS (AE_NO_MEMORY);
@@ -328,6 +329,10 @@ AcpiExWriteDataToField (
     ACPI_FUNCTION_TRACE_PTR (ExWriteDataToField, ObjDesc);
 
 
+    /* A BufferField changes its Buffer, see dsmemo.c */
+
+    AcpiGbl_NsDataGeneration++;
+
     /* Parameter validation */
 
     if (!SourceDesc || !ObjDesc)
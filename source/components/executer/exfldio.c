@@ -71,6 +71,16 @@ AcpiExSetupRegion (
     ACPI_OPERAND_OBJECT     *ObjDesc,
     UINT32                  FieldDatumByteOffset);
 
+static BOOLEAN
+AcpiExIsBlockField (
+    ACPI_OPERAND_OBJECT     *ObjDesc);
+
+static ACPI_STATUS
+AcpiExBlockFieldIo (
+    ACPI_OPERAND_OBJECT     *ObjDesc,
+    void                    *Buffer,
+    UINT32                  ReadWrite);
+
 
 /*******************************************************************************
  *
@@ -328,6 +338,151 @@ AcpiExAccessRegion (
 }
 
 
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiExIsBlockField
+ *
+ * PARAMETERS:  ObjDesc                 - Field to be read or written
+ *
+ * RETURN:      TRUE if the whole field can be moved with one block transfer
+ *
+ * DESCRIPTION: A block transfer is used for RegionFields that start on a
+ *              datum boundary and consist of more than one whole datum, so
+ *              that no datum needs the update rule, when the region handler
+ *              was installed with ACPI_ADR_HANDLER_BLOCK_IO.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiExIsBlockField (
+    ACPI_OPERAND_OBJECT     *ObjDesc)
+{
+    ACPI_OPERAND_OBJECT     *RgnDesc;
+    UINT32                  AccessBitWidth;
+
+
+    if (ObjDesc->Common.Type != ACPI_TYPE_LOCAL_REGION_FIELD)
+    {
+        return (FALSE);
+    }
+
+    AccessBitWidth = ACPI_MUL_8 (ObjDesc->CommonField.AccessByteWidth);
+    if (ObjDesc->CommonField.StartFieldBitOffset ||
+        (ObjDesc->CommonField.BitLength <= AccessBitWidth) ||
+        (ObjDesc->CommonField.BitLength % AccessBitWidth))
+    {
+        return (FALSE);
+    }
+
+    RgnDesc = ObjDesc->CommonField.RegionObj;
+    if ((RgnDesc->Common.Type != ACPI_TYPE_REGION) ||
+        !RgnDesc->Region.Handler ||
+        !(RgnDesc->Region.Handler->AddressSpace.HandlerFlags &
+            ACPI_ADDR_HANDLER_BLOCK_IO))
+    {
+        return (FALSE);
+    }
+
+    /* Spaces with a non-linear address pass extra data with each datum */
+
+    switch (RgnDesc->Region.SpaceId)
+    {
+    case ACPI_ADR_SPACE_SMBUS:
+    case ACPI_ADR_SPACE_IPMI:
+    case ACPI_ADR_SPACE_GPIO:
+    case ACPI_ADR_SPACE_GSBUS:
+    case ACPI_ADR_SPACE_PLATFORM_COMM:
+    case ACPI_ADR_SPACE_PLATFORM_RT:
+    case ACPI_ADR_SPACE_FIXED_HARDWARE:
+
+        return (FALSE);
+
+    default:
+
+        return (TRUE);
+    }
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiExBlockFieldIo
+ *
+ * PARAMETERS:  ObjDesc                 - Field to be read or written
+ *              Buffer                  - Field data, at least as long as the
+ *                                        field
+ *              ReadWrite               - ACPI_READ or ACPI_WRITE
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Read or write all datums of a field with ACPI_BLOCK_IO
+ *              requests instead of one handler call per datum. The field
+ *              must pass AcpiExIsBlockField.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiExBlockFieldIo (
+    ACPI_OPERAND_OBJECT     *ObjDesc,
+    void                    *Buffer,
+    UINT32                  ReadWrite)
+{
+    ACPI_STATUS             Status;
+    ACPI_OPERAND_OBJECT     *RgnDesc;
+    UINT32                  AccessByteWidth;
+    UINT32                  DatumCount;
+    UINT32                  Count;
+    UINT32                  FieldOffset = 0;
+
+
+    ACPI_FUNCTION_TRACE (ExBlockFieldIo);
+
+
+    AccessByteWidth = ObjDesc->CommonField.AccessByteWidth;
+    DatumCount = ObjDesc->CommonField.BitLength /
+        ACPI_MUL_8 (AccessByteWidth);
+
+    /* The last datum of the field must fit within the region */
+
+    Status = AcpiExSetupRegion (ObjDesc,
+        (DatumCount - 1) * AccessByteWidth);
+    if (ACPI_FAILURE (Status))
+    {
+        return_ACPI_STATUS (Status);
+    }
+
+    RgnDesc = ObjDesc->CommonField.RegionObj;
+
+    ACPI_DEBUG_PRINT ((ACPI_DB_BFIELD,
+        "[%s] Block Region [%s:%X], Width %X, ByteBase %X, Count %X\n",
+        (ReadWrite == ACPI_READ) ? "READ" : "WRITE",
+        AcpiUtGetRegionName (RgnDesc->Region.SpaceId),
+        RgnDesc->Region.SpaceId, AccessByteWidth,
+        ObjDesc->CommonField.BaseByteOffset, DatumCount));
+
+    while (DatumCount)
+    {
+        Count = ACPI_MIN (DatumCount, ACPI_BLOCK_IO_MAX_COUNT);
+
+        Status = AcpiEvAddressSpaceDispatch (RgnDesc, ObjDesc,
+            ReadWrite | ACPI_BLOCK_IO | (Count << 16),
+            ObjDesc->CommonField.BaseByteOffset + FieldOffset,
+            ACPI_MUL_8 (AccessByteWidth),
+            ACPI_CAST_PTR (UINT64, ACPI_ADD_PTR (UINT8, Buffer, FieldOffset)));
+        if (ACPI_FAILURE (Status))
+        {
+            return_ACPI_STATUS (Status);
+        }
+
+        FieldOffset += Count * AccessByteWidth;
+        DatumCount -= Count;
+    }
+
+    AcpiGbl_FieldBlockTransfers++;
+    return_ACPI_STATUS (AE_OK);
+}
+
+
 /*******************************************************************************
  *
  * FUNCTION:    AcpiExRegisterOverflow
@@ -467,6 +622,14 @@ AcpiExFieldDatumIo (
         }
         else
         {
+            /* The target buffer may be shared copy-on-write */
+
+            Status = AcpiUtUnshareObject (ObjDesc->BufferField.BufferObj);
+            if (ACPI_FAILURE (Status))
+            {
+                return_ACPI_STATUS (Status);
+            }
+
             /*
              * Copy the data to the target buffer.
              * Length is the field width in bytes.
@@ -785,6 +948,14 @@ AcpiExExtractFromField (
         AccessBitWidth = sizeof (UINT64) * 8;
     }
 
+    /* Read whole-datum fields with one request if the handler allows it */
+
+    if (AcpiExIsBlockField (ObjDesc))
+    {
+        Status = AcpiExBlockFieldIo (ObjDesc, Buffer, ACPI_READ);
+        return_ACPI_STATUS (Status);
+    }
+
     /* Compute the number of datums (access width data items) */
 
     DatumCount = ACPI_ROUND_UP_TO (
@@ -944,6 +1115,14 @@ AcpiExInsertIntoField (
         ObjDesc->CommonField.AccessByteWidth = sizeof (UINT64);
     }
 
+    /* Write whole-datum fields with one request if the handler allows it */
+
+    if (AcpiExIsBlockField (ObjDesc))
+    {
+        Status = AcpiExBlockFieldIo (ObjDesc, Buffer, ACPI_WRITE);
+        goto Exit;
+    }
+
     AccessBitWidth = ACPI_MUL_8 (ObjDesc->CommonField.AccessByteWidth);
 
     /* Create the bitmasks used for bit insertion */
@@ -108,7 +108,8 @@ AcpiExOpcode_0A_0T_1R (
 
         /* Create a return object of type Integer */
 
-        ReturnDesc = AcpiUtCreateIntegerObject (AcpiOsGetTimer ());
+        ReturnDesc = AcpiUtArenaCreateInteger (
+            WalkState->ParserState.Arena, AcpiOsGetTimer ());
         if (!ReturnDesc)
         {
             Status = AE_NO_MEMORY;
@@ -190,7 +191,15 @@ AcpiExOpcode_1A_0T_0R (
 
     case AML_SLEEP_OP:      /*  Sleep (MsecTime) */
 
-        Status = AcpiExSystemDoSleep (Operand[0]->Integer.Value);
+        if (WalkState->Thread && WalkState->Thread->Coroutine)
+        {
+            Status = AcpiExSystemSuspend (WalkState,
+                Operand[0]->Integer.Value);
+        }
+        else
+        {
+            Status = AcpiExSystemDoSleep (Operand[0]->Integer.Value);
+        }
         break;
 
     case AML_STALL_OP:      /*  Stall (UsecTime) */
@@ -314,7 +323,8 @@ AcpiExOpcode_1A_1T_1R (
 
         /* Create a return object of type Integer for these opcodes */
 
-        ReturnDesc = AcpiUtCreateInternalObject (ACPI_TYPE_INTEGER);
+        ReturnDesc = AcpiUtArenaCreateInteger (
+            WalkState->ParserState.Arena, 0);
         if (!ReturnDesc)
         {
             Status = AE_NO_MEMORY;
@@ -660,7 +670,8 @@ AcpiExOpcode_1A_0T_1R (
     {
     case AML_LOGICAL_NOT_OP:        /* LNot (Operand) */
 
-        ReturnDesc = AcpiUtCreateIntegerObject ((UINT64) 0);
+        ReturnDesc = AcpiUtArenaCreateInteger (
+            WalkState->ParserState.Arena, 0);
         if (!ReturnDesc)
         {
             Status = AE_NO_MEMORY;
@@ -683,7 +694,8 @@ AcpiExOpcode_1A_0T_1R (
          * Create a new integer. Can't just get the base integer and
          * increment it because it may be an Arg or Field.
          */
-        ReturnDesc = AcpiUtCreateInternalObject (ACPI_TYPE_INTEGER);
+        ReturnDesc = AcpiUtArenaCreateInteger (
+            WalkState->ParserState.Arena, 0);
         if (!ReturnDesc)
         {
             Status = AE_NO_MEMORY;
@@ -762,7 +774,8 @@ AcpiExOpcode_1A_0T_1R (
 
         /* Allocate a descriptor to hold the type. */
 
-        ReturnDesc = AcpiUtCreateIntegerObject ((UINT64) Type);
+        ReturnDesc = AcpiUtArenaCreateInteger (
+            WalkState->ParserState.Arena, (UINT64) Type);
         if (!ReturnDesc)
         {
             Status = AE_NO_MEMORY;
@@ -842,7 +855,8 @@ AcpiExOpcode_1A_0T_1R (
          * Now that we have the size of the object, create a result
          * object to hold the value
          */
-        ReturnDesc = AcpiUtCreateIntegerObject (Value);
+        ReturnDesc = AcpiUtArenaCreateInteger (
+            WalkState->ParserState.Arena, Value);
         if (!ReturnDesc)
         {
             Status = AE_NO_MEMORY;
@@ -1035,7 +1049,8 @@ AcpiExOpcode_1A_0T_1R (
                      * indexed location, we don't need to add an additional
                      * reference to the buffer itself.
                      */
-                    ReturnDesc = AcpiUtCreateIntegerObject ((UINT64)
+                    ReturnDesc = AcpiUtArenaCreateInteger (
+                        WalkState->ParserState.Arena, (UINT64)
                         TempDesc->Buffer.Pointer[Operand[0]->Reference.Value]);
                     if (!ReturnDesc)
                     {
@@ -1049,7 +1064,13 @@ AcpiExOpcode_1A_0T_1R (
                      * Return the referenced element of the package. We must
                      * add another reference to the referenced object, however.
                      */
-                    ReturnDesc = *(Operand[0]->Reference.Where);
+                    Status = AcpiExGetPackageElement (Operand[0],
+                        &ReturnDesc);
+                    if (ACPI_FAILURE (Status))
+                    {
+                        goto Cleanup;
+                    }
+
                     if (!ReturnDesc)
                     {
                         /*
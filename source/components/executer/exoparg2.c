@@ -187,14 +187,16 @@ AcpiExOpcode_2A_2T_1R (
 
         /* Divide (Dividend, Divisor, RemainderResult QuotientResult) */
 
-        ReturnDesc1 = AcpiUtCreateInternalObject (ACPI_TYPE_INTEGER);
+        ReturnDesc1 = AcpiUtArenaCreateInteger (
+            WalkState->ParserState.Arena, 0);
         if (!ReturnDesc1)
         {
             Status = AE_NO_MEMORY;
             goto Cleanup;
         }
 
-        ReturnDesc2 = AcpiUtCreateInternalObject (ACPI_TYPE_INTEGER);
+        ReturnDesc2 = AcpiUtArenaCreateInteger (
+            WalkState->ParserState.Arena, 0);
         if (!ReturnDesc2)
         {
             Status = AE_NO_MEMORY;
@@ -296,7 +298,8 @@ AcpiExOpcode_2A_1T_1R (
     {
         /* All simple math opcodes (add, etc.) */
 
-        ReturnDesc = AcpiUtCreateInternalObject (ACPI_TYPE_INTEGER);
+        ReturnDesc = AcpiUtArenaCreateInteger (
+            WalkState->ParserState.Arena, 0);
         if (!ReturnDesc)
         {
             Status = AE_NO_MEMORY;
@@ -314,7 +317,8 @@ AcpiExOpcode_2A_1T_1R (
     {
     case AML_MOD_OP: /* Mod (Dividend, Divisor, RemainderResult (ACPI 2.0) */
 
-        ReturnDesc = AcpiUtCreateInternalObject (ACPI_TYPE_INTEGER);
+        ReturnDesc = AcpiUtArenaCreateInteger (
+            WalkState->ParserState.Arena, 0);
         if (!ReturnDesc)
         {
             Status = AE_NO_MEMORY;
@@ -552,7 +556,7 @@ AcpiExOpcode_2A_0T_1R (
 
     /* Create the internal return object */
 
-    ReturnDesc = AcpiUtCreateInternalObject (ACPI_TYPE_INTEGER);
+    ReturnDesc = AcpiUtArenaCreateInteger (WalkState->ParserState.Arena, 0);
     if (!ReturnDesc)
     {
         Status = AE_NO_MEMORY;
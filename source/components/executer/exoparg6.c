@@ -265,7 +265,8 @@ AcpiExOpcode_6A_0T_1R (
         /* Create an integer for the return value */
         /* Default return value is ACPI_UINT64_MAX if no match found */
 
-        ReturnDesc = AcpiUtCreateIntegerObject (ACPI_UINT64_MAX);
+        ReturnDesc = AcpiUtArenaCreateInteger (
+            WalkState->ParserState.Arena, ACPI_UINT64_MAX);
         if (!ReturnDesc)
         {
             Status = AE_NO_MEMORY;
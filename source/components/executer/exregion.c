@@ -49,12 +49,341 @@
 #define _COMPONENT          ACPI_EXECUTER
         ACPI_MODULE_NAME    ("exregion")
 
+/* Local prototypes */
+
+static UINT32
+AcpiExFindMemMapping (
+    ACPI_MEM_SPACE_CONTEXT  *MemInfo,
+    ACPI_PHYSICAL_ADDRESS   Address);
+
+static void
+AcpiExRemoveMemMapping (
+    ACPI_MEM_SPACE_CONTEXT  *MemInfo,
+    UINT32                  Index);
+
+static ACPI_STATUS
+AcpiExGetMemMapping (
+    ACPI_MEM_SPACE_CONTEXT  *MemInfo,
+    ACPI_PHYSICAL_ADDRESS   Address,
+    UINT32                  Length,
+    ACPI_MEM_MAPPING        **ReturnMm);
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiExFindMemMapping
+ *
+ * PARAMETERS:  MemInfo             - SystemMemory region context
+ *              Address             - Physical address to look up
+ *
+ * RETURN:      Number of cached mappings that start at or below Address.
+ *              This is also the index at which a mapping starting at
+ *              Address is inserted.
+ *
+ * DESCRIPTION: Binary search of the mapping array, which is kept sorted by
+ *              physical address.
+ *
+ ******************************************************************************/
+
+static UINT32
+AcpiExFindMemMapping (
+    ACPI_MEM_SPACE_CONTEXT  *MemInfo,
+    ACPI_PHYSICAL_ADDRESS   Address)
+{
+    UINT32                  Low = 0;
+    UINT32                  High = MemInfo->MappingCount;
+    UINT32                  Middle;
+
+
+    while (Low < High)
+    {
+        Middle = Low + ((High - Low) / 2);
+        if (MemInfo->Mappings[Middle]->PhysicalAddress <= Address)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    return (Low);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiExRemoveMemMapping
+ *
+ * PARAMETERS:  MemInfo             - SystemMemory region context
+ *              Index               - Mapping to remove
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Unmap one cached mapping and remove it from the array.
+ *
+ ******************************************************************************/
+
+static void
+AcpiExRemoveMemMapping (
+    ACPI_MEM_SPACE_CONTEXT  *MemInfo,
+    UINT32                  Index)
+{
+    ACPI_MEM_MAPPING        *Mm = MemInfo->Mappings[Index];
+
+
+    if (MemInfo->CurMm == Mm)
+    {
+        MemInfo->CurMm = NULL;
+    }
+
+    AcpiOsUnmapMemory (Mm->LogicalAddress, Mm->Length);
+    ACPI_FREE (Mm);
+
+    MemInfo->MappingCount--;
+    memmove (&MemInfo->Mappings[Index], &MemInfo->Mappings[Index + 1],
+        (MemInfo->MappingCount - Index) * sizeof (ACPI_MEM_MAPPING *));
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiExDeleteMemMappings
+ *
+ * PARAMETERS:  MemInfo             - SystemMemory region context
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Unmap all memory mappings cached by a SystemMemory region.
+ *              Called when the region is deactivated.
+ *
+ ******************************************************************************/
+
+void
+AcpiExDeleteMemMappings (
+    ACPI_MEM_SPACE_CONTEXT  *MemInfo)
+{
+
+    while (MemInfo->MappingCount)
+    {
+        AcpiExRemoveMemMapping (MemInfo, MemInfo->MappingCount - 1);
+    }
+
+    if (MemInfo->Mappings)
+    {
+        ACPI_FREE (MemInfo->Mappings);
+        MemInfo->Mappings = NULL;
+    }
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiExGetMemMapping
+ *
+ * PARAMETERS:  MemInfo             - SystemMemory region context
+ *              Address             - Physical address of the access
+ *              Length              - Length of the access in bytes
+ *              ReturnMm            - Where the mapping is returned
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Find the cached mapping that covers an access, or create one.
+ *              A new mapping covers the page of the access, clipped to the
+ *              region, and is merged with a cached mapping that ends where
+ *              it starts or starts where it ends, up to
+ *              ACPI_MEM_MAPPING_MAX_LENGTH. When the cache is full, the least
+ *              recently used mapping is unmapped.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiExGetMemMapping (
+    ACPI_MEM_SPACE_CONTEXT  *MemInfo,
+    ACPI_PHYSICAL_ADDRESS   Address,
+    UINT32                  Length,
+    ACPI_MEM_MAPPING        **ReturnMm)
+{
+    ACPI_MEM_MAPPING        *Mm;
+    ACPI_MEM_MAPPING        *Prev = NULL;
+    ACPI_MEM_MAPPING        *Next = NULL;
+    ACPI_PHYSICAL_ADDRESS   Start;
+    ACPI_PHYSICAL_ADDRESS   End;
+    ACPI_PHYSICAL_ADDRESS   RegionEnd;
+    void                    *LogicalAddrPtr;
+    UINT32                  Index;
+    UINT32                  Victim;
+    UINT32                  i;
+
+
+    ACPI_FUNCTION_TRACE (ExGetMemMapping);
+
+
+    /* Look for a cached mapping covering the address range at hand */
+
+    Index = AcpiExFindMemMapping (MemInfo, Address);
+    if (Index)
+    {
+        Mm = MemInfo->Mappings[Index - 1];
+        if ((UINT64) Address + Length <=
+            (UINT64) Mm->PhysicalAddress + Mm->Length)
+        {
+            AcpiGbl_MemMappingHits++;
+            *ReturnMm = Mm;
+            return_ACPI_STATUS (AE_OK);
+        }
+
+        Prev = Mm;
+    }
+
+    if (Index < MemInfo->MappingCount)
+    {
+        Next = MemInfo->Mappings[Index];
+    }
+
+    AcpiGbl_MemMappingMisses++;
+
+    /* The mapping array is allocated on the first miss */
+
+    if (!MemInfo->Mappings)
+    {
+        MemInfo->MaxMappings = ACPI_MAX (AcpiGbl_MemMappingCacheSize, 1);
+        MemInfo->Mappings = ACPI_ALLOCATE_ZEROED (
+            (ACPI_SIZE) MemInfo->MaxMappings * sizeof (ACPI_MEM_MAPPING *));
+        if (!MemInfo->Mappings)
+        {
+            return_ACPI_STATUS (AE_NO_MEMORY);
+        }
+    }
+
+    /*
+     * Map the page of the access, but nothing outside of the region: on
+     * some systems, mapping a range that spans pages with different
+     * attributes causes warnings. An access that crosses the end of the
+     * page extends the mapping to its last byte.
+     */
+    Start = Address & ~((ACPI_PHYSICAL_ADDRESS) ACPI_DEFAULT_PAGE_SIZE - 1);
+    End = Start + ACPI_DEFAULT_PAGE_SIZE;
+    RegionEnd = MemInfo->Address + MemInfo->Length;
+
+    if (Start < MemInfo->Address)
+    {
+        Start = MemInfo->Address;
+    }
+    if (Start > Address)
+    {
+        Start = Address;
+    }
+    if (End > RegionEnd)
+    {
+        End = RegionEnd;
+    }
+    if (End < Address + Length)
+    {
+        End = Address + Length;
+    }
+
+    /*
+     * Merge with the neighbors when they are adjacent within the region.
+     * The pages are contiguous in the region, so the attribute concern
+     * above does not apply.
+     */
+    if (Prev &&
+        ((Prev->PhysicalAddress + Prev->Length) != Start ||
+        (End - Prev->PhysicalAddress) > ACPI_MEM_MAPPING_MAX_LENGTH))
+    {
+        Prev = NULL;
+    }
+    if (Prev)
+    {
+        Start = Prev->PhysicalAddress;
+    }
+
+    if (Next &&
+        (Next->PhysicalAddress != End ||
+        (End + Next->Length - Start) > ACPI_MEM_MAPPING_MAX_LENGTH))
+    {
+        Next = NULL;
+    }
+    if (Next)
+    {
+        End += Next->Length;
+    }
+
+    Mm = ACPI_ALLOCATE_ZEROED (sizeof (*Mm));
+    if (!Mm)
+    {
+        ACPI_ERROR ((AE_INFO,
+            "Unable to save memory mapping at 0x%8.8X%8.8X, size %u",
+            ACPI_FORMAT_UINT64 (Address), Length));
+        return_ACPI_STATUS (AE_NO_MEMORY);
+    }
+
+    LogicalAddrPtr = AcpiOsMapMemory (Start, (ACPI_SIZE) (End - Start));
+    if (!LogicalAddrPtr)
+    {
+        ACPI_ERROR ((AE_INFO,
+            "Could not map memory at 0x%8.8X%8.8X, size %u",
+            ACPI_FORMAT_UINT64 (Start), (UINT32) (End - Start)));
+        ACPI_FREE (Mm);
+        return_ACPI_STATUS (AE_NO_MEMORY);
+    }
+
+    Mm->LogicalAddress = LogicalAddrPtr;
+    Mm->PhysicalAddress = Start;
+    Mm->Length = (ACPI_SIZE) (End - Start);
+
+    /* The new mapping replaces the neighbors it was merged with */
+
+    if (Next)
+    {
+        AcpiExRemoveMemMapping (MemInfo, Index);
+        AcpiGbl_MemMappingMerges++;
+    }
+    if (Prev)
+    {
+        AcpiExRemoveMemMapping (MemInfo, Index - 1);
+        AcpiGbl_MemMappingMerges++;
+    }
+
+    /* Make room by unmapping the least recently used mapping */
+
+    if (MemInfo->MappingCount >= MemInfo->MaxMappings)
+    {
+        Victim = 0;
+        for (i = 1; i < MemInfo->MappingCount; i++)
+        {
+            if (MemInfo->Mappings[i]->LastUse <
+                MemInfo->Mappings[Victim]->LastUse)
+            {
+                Victim = i;
+            }
+        }
+
+        AcpiExRemoveMemMapping (MemInfo, Victim);
+        AcpiGbl_MemMappingEvictions++;
+    }
+
+    /* Insert after any mapping with the same start, so lookups find it */
+
+    Index = AcpiExFindMemMapping (MemInfo, Start);
+    memmove (&MemInfo->Mappings[Index + 1], &MemInfo->Mappings[Index],
+        (MemInfo->MappingCount - Index) * sizeof (ACPI_MEM_MAPPING *));
+    MemInfo->Mappings[Index] = Mm;
+    MemInfo->MappingCount++;
+
+    *ReturnMm = Mm;
+    return_ACPI_STATUS (AE_OK);
+}
+
 
 /*******************************************************************************
  *
  * FUNCTION:    AcpiExSystemMemorySpaceHandler
  *
- * PARAMETERS:  Function            - Read or Write operation
+ * PARAMETERS:  Function            - Read or Write operation, optionally
+ *                                    an ACPI_BLOCK_IO transfer
  *              Address             - Where in the space to read or write
  *              BitWidth            - Field width in bits (8, 16, or 32)
  *              Value               - Pointer to in or out value
@@ -81,9 +410,11 @@ AcpiExSystemMemorySpaceHandler (
     void                    *LogicalAddrPtr = NULL;
     ACPI_MEM_SPACE_CONTEXT  *MemInfo = RegionContext;
     ACPI_MEM_MAPPING        *Mm = MemInfo->CurMm;
+    UINT8                   *Buffer = NULL;
+    UINT64                  Datum;
+    UINT32                  Count = 1;
     UINT32                  Length;
-    ACPI_SIZE               MapLength;
-    ACPI_SIZE               PageBoundaryMapLength;
+    UINT32                  i;
 #ifdef ACPI_MISALIGNMENT_NOT_SUPPORTED
     UINT32                  Remainder;
 #endif
@@ -123,6 +454,23 @@ AcpiExSystemMemorySpaceHandler (
         return_ACPI_STATUS (AE_AML_OPERAND_VALUE);
     }
 
+    /*
+     * A block transfer moves Count datums between the buffer at Value and
+     * consecutive addresses, each with the access width of the field
+     */
+    if (Function & ACPI_BLOCK_IO)
+    {
+        Count = ACPI_BLOCK_IO_COUNT (Function);
+        Buffer = ACPI_CAST_PTR (UINT8, Value);
+        Value = &Datum;
+        Function &= ACPI_IO_MASK;
+
+        if (!Count)
+        {
+            return_ACPI_STATUS (AE_OK);
+        }
+    }
+
 #ifdef ACPI_MISALIGNMENT_NOT_SUPPORTED
     /*
      * Hardware does not support non-aligned data transfers, we must verify
@@ -136,111 +484,28 @@ AcpiExSystemMemorySpaceHandler (
 #endif
 
     /*
-     * Does the request fit into the cached memory mapping?
-     * Is 1) Address below the current mapping? OR
-     *    2) Address beyond the current mapping?
+     * Does the request fit into the current memory mapping? If not, look
+     * for it among the cached mappings, or create a new one.
      */
     if (!Mm || (Address < Mm->PhysicalAddress) ||
-        ((UINT64) Address + Length > (UINT64) Mm->PhysicalAddress + Mm->Length))
+        ((UINT64) Address + ((UINT64) Length * Count) >
+            (UINT64) Mm->PhysicalAddress + Mm->Length))
     {
-        /*
-         * The request cannot be resolved by the current memory mapping.
-         *
-         * Look for an existing saved mapping covering the address range
-         * at hand. If found, save it as the current one and carry out
-         * the access.
-         */
-        for (Mm = MemInfo->FirstMm; Mm; Mm = Mm->NextMm)
-        {
-            if (Mm == MemInfo->CurMm)
-            {
-                continue;
-            }
-
-            if (Address < Mm->PhysicalAddress)
-            {
-                continue;
-            }
-
-            if ((UINT64) Address + Length > (UINT64) Mm->PhysicalAddress + Mm->Length)
-            {
-                continue;
-            }
-
-            MemInfo->CurMm = Mm;
-            goto access;
-        }
-
-        /* Create a new mappings list entry */
-
-        Mm = ACPI_ALLOCATE_ZEROED(sizeof(*Mm));
-        if (!Mm)
-        {
-            ACPI_ERROR((AE_INFO,
-                "Unable to save memory mapping at 0x%8.8X%8.8X, size %u",
-                ACPI_FORMAT_UINT64(Address), Length));
-            return_ACPI_STATUS(AE_NO_MEMORY);
-        }
-
-        /*
-         * October 2009: Attempt to map from the requested address to the
-         * end of the region. However, we will never map more than one
-         * page, nor will we cross a page boundary.
-         */
-        MapLength = (ACPI_SIZE)
-            ((MemInfo->Address + MemInfo->Length) - Address);
-
-        /*
-         * If mapping the entire remaining portion of the region will cross
-         * a page boundary, just map up to the page boundary, do not cross.
-         * On some systems, crossing a page boundary while mapping regions
-         * can cause warnings if the pages have different attributes
-         * due to resource management.
-         *
-         * This has the added benefit of constraining a single mapping to
-         * one page, which is similar to the original code that used a 4k
-         * maximum window.
-         */
-        PageBoundaryMapLength = (ACPI_SIZE)
-            (ACPI_ROUND_UP (Address, ACPI_DEFAULT_PAGE_SIZE) - Address);
-        if (PageBoundaryMapLength == 0)
+        Status = AcpiExGetMemMapping (MemInfo, Address, Length * Count, &Mm);
+        if (ACPI_FAILURE (Status))
         {
-            PageBoundaryMapLength = ACPI_DEFAULT_PAGE_SIZE;
+            return_ACPI_STATUS (Status);
         }
 
-        if (MapLength > PageBoundaryMapLength)
-        {
-            MapLength = PageBoundaryMapLength;
-        }
-
-        /* Create a new mapping starting at the address given */
-
-        LogicalAddrPtr = AcpiOsMapMemory(Address, MapLength);
-        if (!LogicalAddrPtr)
-        {
-            ACPI_ERROR ((AE_INFO,
-                "Could not map memory at 0x%8.8X%8.8X, size %u",
-                ACPI_FORMAT_UINT64 (Address), (UINT32) MapLength));
-            ACPI_FREE(Mm);
-            return_ACPI_STATUS (AE_NO_MEMORY);
-        }
-
-        /* Save the physical address and mapping size */
-
-        Mm->LogicalAddress = LogicalAddrPtr;
-        Mm->PhysicalAddress = Address;
-        Mm->Length = MapLength;
-
-        /*
-         * Add the new entry to the mappigs list and save it as the
-         * current mapping.
-         */
-        Mm->NextMm = MemInfo->FirstMm;
-        MemInfo->FirstMm = Mm;
         MemInfo->CurMm = Mm;
     }
+    else
+    {
+        AcpiGbl_MemMappingHits++;
+    }
+
+    Mm->LastUse = ++MemInfo->UseCount;
 
-access:
     /*
      * Generate a logical pointer corresponding to the address we want to
      * access
@@ -260,77 +525,93 @@ access:
      * transfer up into smaller (byte-size) chunks because the AML specifically
      * asked for a transfer width that the hardware may require.
      */
-    switch (Function)
+    for (i = 0; (i < Count) && ACPI_SUCCESS (Status); i++)
     {
-    case ACPI_READ:
+        if (Buffer && (Function == ACPI_WRITE))
+        {
+            Datum = 0;
+            memcpy (&Datum, Buffer + ((ACPI_SIZE) i * Length), Length);
+        }
 
-        *Value = 0;
-        switch (BitWidth)
+        switch (Function)
         {
-        case 8:
+        case ACPI_READ:
 
-            *Value = (UINT64) ACPI_GET8 (LogicalAddrPtr);
-            break;
+            *Value = 0;
+            switch (BitWidth)
+            {
+            case 8:
 
-        case 16:
+                *Value = (UINT64) ACPI_GET8 (LogicalAddrPtr);
+                break;
 
-            *Value = (UINT64) ACPI_GET16 (LogicalAddrPtr);
-            break;
+            case 16:
 
-        case 32:
+                *Value = (UINT64) ACPI_GET16 (LogicalAddrPtr);
+                break;
 
-            *Value = (UINT64) ACPI_GET32 (LogicalAddrPtr);
-            break;
+            case 32:
 
-        case 64:
+                *Value = (UINT64) ACPI_GET32 (LogicalAddrPtr);
+                break;
 
-            *Value = (UINT64) ACPI_GET64 (LogicalAddrPtr);
-            break;
+            case 64:
 
-        default:
+                *Value = (UINT64) ACPI_GET64 (LogicalAddrPtr);
+                break;
+
+            default:
 
-            /* BitWidth was already validated */
+                /* BitWidth was already validated */
 
+                break;
+            }
             break;
-        }
-        break;
 
-    case ACPI_WRITE:
+        case ACPI_WRITE:
 
-        switch (BitWidth)
-        {
-        case 8:
+            switch (BitWidth)
+            {
+            case 8:
 
-            ACPI_SET8 (LogicalAddrPtr, *Value);
-            break;
+                ACPI_SET8 (LogicalAddrPtr, *Value);
+                break;
 
-        case 16:
+            case 16:
 
-            ACPI_SET16 (LogicalAddrPtr, *Value);
-            break;
+                ACPI_SET16 (LogicalAddrPtr, *Value);
+                break;
 
-        case 32:
+            case 32:
 
-            ACPI_SET32 (LogicalAddrPtr, *Value);
-            break;
+                ACPI_SET32 (LogicalAddrPtr, *Value);
+                break;
+
+            case 64:
+
+                ACPI_SET64 (LogicalAddrPtr, *Value);
+                break;
 
-        case 64:
+            default:
 
-            ACPI_SET64 (LogicalAddrPtr, *Value);
+                /* BitWidth was already validated */
+
+                break;
+            }
             break;
 
         default:
 
-            /* BitWidth was already validated */
-
+            Status = AE_BAD_PARAMETER;
             break;
         }
-        break;
 
-    default:
+        if (Buffer && (Function == ACPI_READ))
+        {
+            memcpy (Buffer + ((ACPI_SIZE) i * Length), &Datum, Length);
+        }
 
-        Status = AE_BAD_PARAMETER;
-        break;
+        LogicalAddrPtr = ACPI_ADD_PTR (void, LogicalAddrPtr, Length);
     }
 
     return_ACPI_STATUS (Status);
@@ -217,7 +217,12 @@ AcpiExResolveObjectToValue (
 
                 /* Otherwise, dereference the PackageIndex to a package element */
 
-                ObjDesc = *StackDesc->Reference.Where;
+                Status = AcpiExGetPackageElement (StackDesc, &ObjDesc);
+                if (ACPI_FAILURE (Status))
+                {
+                    return_ACPI_STATUS (Status);
+                }
+
                 if (ObjDesc)
                 {
                     /*
@@ -489,7 +494,7 @@ AcpiExResolveMultiple (
              *
              * This could of course in turn be another reference object.
              */
-            ObjDesc = *(ObjDesc->Reference.Where);
+            ObjDesc = *(AcpiExGetElementPointer (ObjDesc));
             if (!ObjDesc)
             {
                 /* NULL package elements are allowed */
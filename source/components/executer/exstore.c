@@ -244,6 +244,12 @@ AcpiExStoreObjectToIndex (
     ACPI_FUNCTION_TRACE (ExStoreObjectToIndex);
 
 
+    AcpiExCheckInterpreter (WalkState);
+
+    /* Named data may change, see dsmemo.c */
+
+    AcpiGbl_NsDataGeneration++;
+
     /*
      * Destination must be a reference pointer, and
      * must point to either a buffer or a package
@@ -260,8 +266,6 @@ AcpiExStoreObjectToIndex (
          * element within the package that is to be modified.
          * The parent package object is at IndexDesc->Reference.Object
          */
-        ObjDesc = *(IndexDesc->Reference.Where);
-
         if (SourceDesc->Common.Type == ACPI_TYPE_LOCAL_REFERENCE &&
             SourceDesc->Reference.Class == ACPI_REFCLASS_TABLE)
         {
@@ -282,6 +286,20 @@ AcpiExStoreObjectToIndex (
             }
         }
 
+        /*
+         * The package may share its elements copy-on-write, give it
+         * a private element array before replacing the element. This
+         * is done after the copy, since the source may be the package
+         * itself or one of its elements.
+         */
+        Status = AcpiUtUnshareObject (IndexDesc->Reference.Object);
+        if (ACPI_FAILURE (Status))
+        {
+            AcpiUtRemoveReference (NewDesc);
+            return_ACPI_STATUS (Status);
+        }
+
+        ObjDesc = *(AcpiExGetElementPointer (IndexDesc));
         if (ObjDesc)
         {
             /* Decrement reference count by the ref count of the parent package */
@@ -362,7 +380,13 @@ AcpiExStoreObjectToIndex (
             return_ACPI_STATUS (AE_AML_OPERAND_TYPE);
         }
 
-        /* Store the source value into the target buffer byte */
+        /* Store the source value into a private copy of the target */
+
+        Status = AcpiUtUnshareObject (ObjDesc);
+        if (ACPI_FAILURE (Status))
+        {
+            return_ACPI_STATUS (Status);
+        }
 
         ObjDesc->Buffer.Pointer[IndexDesc->Reference.Value] = Value;
         break;
@@ -424,6 +448,12 @@ AcpiExStoreObjectToNode (
     ACPI_FUNCTION_TRACE_PTR (ExStoreObjectToNode, SourceDesc);
 
 
+    AcpiExCheckInterpreter (WalkState);
+
+    /* Named data changes, see dsmemo.c */
+
+    AcpiGbl_NsDataGeneration++;
+
     /* Get current type of the node, and object attached to Node */
 
     TargetType = AcpiNsGetType (Node);
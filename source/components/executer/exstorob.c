@@ -70,6 +70,7 @@ AcpiExStoreBufferToBuffer (
 {
     UINT32                  Length;
     UINT8                   *Buffer;
+    ACPI_STATUS             Status;
 
 
     ACPI_FUNCTION_TRACE_PTR (ExStoreBufferToBuffer, SourceDesc);
@@ -82,6 +83,14 @@ AcpiExStoreBufferToBuffer (
         return_ACPI_STATUS (AE_OK);
     }
 
+    /* The target is written in place, it must not share its data */
+
+    Status = AcpiUtUnshareObject (TargetDesc);
+    if (ACPI_FAILURE (Status))
+    {
+        return_ACPI_STATUS (Status);
+    }
+
     /* We know that SourceDesc is a buffer by now */
 
     Buffer = ACPI_CAST_PTR (UINT8, SourceDesc->Buffer.Pointer);
@@ -248,6 +248,65 @@ AcpiExSystemDoSleep (
 }
 
 
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiExSystemSuspend
+ *
+ * PARAMETERS:  WalkState       - Current walk state
+ *              HowLongMs       - The amount of time to sleep,
+ *                                in milliseconds
+ *
+ * RETURN:      AE_CTRL_SUSPEND, or status of AcpiExSystemDoSleep
+ *
+ * DESCRIPTION: Sleep without blocking the running thread. Used instead of
+ *              AcpiExSystemDoSleep for an evaluation started by
+ *              AcpiEvaluateObjectAsync: the wake time is recorded and the
+ *              walk unwinds to the scheduler, which resumes it later.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiExSystemSuspend (
+    ACPI_WALK_STATE         *WalkState,
+    UINT64                  HowLongMs)
+{
+    ACPI_THREAD_STATE       *Thread = WalkState->Thread;
+    ACPI_WALK_STATE         *Walk;
+
+
+    ACPI_FUNCTION_ENTRY ();
+
+
+    /*
+     * AML mutexes and the mutexes of Serialized methods must be released
+     * on the OS thread that acquired them. A walk that holds one sleeps in
+     * place instead of moving to another worker.
+     */
+    if (Thread->AcquiredMutexList)
+    {
+        return (AcpiExSystemDoSleep (HowLongMs));
+    }
+
+    for (Walk = Thread->WalkStateList; Walk; Walk = Walk->Next)
+    {
+        if (Walk->MethodDesc &&
+            (Walk->MethodDesc->Method.InfoFlags & ACPI_METHOD_SERIALIZED))
+        {
+            return (AcpiExSystemDoSleep (HowLongMs));
+        }
+    }
+
+    if (HowLongMs > ACPI_MAX_SLEEP)
+    {
+        HowLongMs = ACPI_MAX_SLEEP;
+    }
+
+    Thread->Coroutine->WakeTime =
+        AcpiOsGetTimer () + HowLongMs * ACPI_100NSEC_PER_MSEC;
+    return (AE_CTRL_SUSPEND);
+}
+
+
 /*******************************************************************************
  *
  * FUNCTION:    AcpiExSystemSignalEvent
@@ -160,6 +160,123 @@ AcpiExExitInterpreter (
 }
 
 
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiExYieldInterpreter
+ *
+ * PARAMETERS:  WalkState           - Current state of the method walk
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Parallel execution: release the interpreter before executing
+ *              an operator that only touches objects private to the walk.
+ *              The walk keeps running without the interpreter until it next
+ *              needs it and calls AcpiExResumeInterpreter.
+ *
+ *              While the interpreter is yielded, the walk may only touch:
+ *              - Its own walk state, operand and result stacks, Locals and
+ *                Args, and Integer/String/Buffer objects that nothing else
+ *                references (AcpiDsCheckPrivateOperands)
+ *              - The parse tree and AML of the running method, with the
+ *                same lifetime rules as a method blocked in Sleep
+ *              - The object caches and the allocator, which have their
+ *                own locks (ACPI_MTX_CACHES, ACPI_MTX_MEMORY); the debug
+ *                allocation statistics are updated under those locks
+ *              - WalkState->MethodPathname and Info->FullPathname, which
+ *                hold a reference on the cached pathname and so stay valid
+ *                if another thread deletes the node
+ *
+ *              No global counter is updated while yielded. The lookup,
+ *              method cache, memo, JIT and NsDataGeneration counters are
+ *              only updated on paths that resume the interpreter first;
+ *              those paths call AcpiExCheckInterpreter to catch a missing
+ *              resume.
+ *
+ ******************************************************************************/
+
+void
+AcpiExYieldInterpreter (
+    ACPI_WALK_STATE         *WalkState)
+{
+    ACPI_THREAD_STATE       *Thread = WalkState->Thread;
+
+
+    if (!AcpiGbl_ParallelExecution || !Thread ||
+        Thread->InterpreterYielded)
+    {
+        return;
+    }
+
+    Thread->InterpreterYielded = TRUE;
+    AcpiExExitInterpreter ();
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiExResumeInterpreter
+ *
+ * PARAMETERS:  WalkState           - Current state of the method walk
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Reacquire the interpreter if the walk yielded it. Called
+ *              before anything that reads or changes shared interpreter
+ *              state: name lookups, method calls, namespace objects, errors.
+ *
+ ******************************************************************************/
+
+void
+AcpiExResumeInterpreter (
+    ACPI_WALK_STATE         *WalkState)
+{
+    ACPI_THREAD_STATE       *Thread = WalkState->Thread;
+
+
+    if (!Thread || !Thread->InterpreterYielded)
+    {
+        return;
+    }
+
+    AcpiExEnterInterpreter ();
+    Thread->InterpreterYielded = FALSE;
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiExCheckInterpreter
+ *
+ * PARAMETERS:  WalkState           - Current state of the method walk, or
+ *                                    NULL
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Called on entry to code that touches shared interpreter
+ *              state on behalf of a method walk (name lookups, the method
+ *              cache, method calls, stores to named objects). Reports a
+ *              walk that still has the interpreter yielded, which means a
+ *              missing AcpiExResumeInterpreter, and reacquires it.
+ *
+ ******************************************************************************/
+
+void
+AcpiExCheckInterpreter (
+    ACPI_WALK_STATE         *WalkState)
+{
+
+    if (!WalkState || !WalkState->Thread ||
+        !WalkState->Thread->InterpreterYielded)
+    {
+        return;
+    }
+
+    ACPI_ERROR ((AE_INFO,
+        "Shared state accessed with the interpreter yielded"));
+    AcpiExResumeInterpreter (WalkState);
+}
+
+
 /*******************************************************************************
  *
  * FUNCTION:    AcpiExTruncateFor32bitTable
@@ -505,3 +622,80 @@ AcpiIsValidSpaceId (
 
     return (TRUE);
 }
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiExGetElementPointer
+ *
+ * PARAMETERS:  IndexDesc           - Index reference to a package element
+ *
+ * RETURN:      Pointer to the package element slot
+ *
+ * DESCRIPTION: Get the element slot of a package Index reference. The
+ *              element array of a copy-on-write package is replaced when the
+ *              package is first modified, so the slot is recomputed from the
+ *              parent package and the index instead of trusting the Where
+ *              pointer saved when the reference was created.
+ *
+ ******************************************************************************/
+
+ACPI_OPERAND_OBJECT **
+AcpiExGetElementPointer (
+    ACPI_OPERAND_OBJECT     *IndexDesc)
+{
+    ACPI_OPERAND_OBJECT     *PackageDesc = IndexDesc->Reference.Object;
+
+
+    IndexDesc->Reference.Where =
+        &PackageDesc->Package.Elements[IndexDesc->Reference.Value];
+    return (IndexDesc->Reference.Where);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiExGetPackageElement
+ *
+ * PARAMETERS:  IndexDesc           - Index reference to a package element
+ *              ElementDesc         - Where the element is returned
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Get the package element referenced by an Index reference, for
+ *              use as an operand. A String, Buffer or Package element can be
+ *              modified in place through the returned object, so the parent
+ *              package is given private elements first if it is shared
+ *              copy-on-write. No reference is added to the element.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiExGetPackageElement (
+    ACPI_OPERAND_OBJECT     *IndexDesc,
+    ACPI_OPERAND_OBJECT     **ElementDesc)
+{
+    ACPI_OPERAND_OBJECT     *PackageDesc = IndexDesc->Reference.Object;
+    ACPI_OPERAND_OBJECT     *Element;
+    ACPI_STATUS             Status;
+
+
+    Element = *AcpiExGetElementPointer (IndexDesc);
+    if (Element &&
+        PackageDesc->Package.Share &&
+        ((Element->Common.Type == ACPI_TYPE_STRING) ||
+         (Element->Common.Type == ACPI_TYPE_BUFFER) ||
+         (Element->Common.Type == ACPI_TYPE_PACKAGE)))
+    {
+        Status = AcpiUtUnshareObject (PackageDesc);
+        if (ACPI_FAILURE (Status))
+        {
+            return (Status);
+        }
+
+        Element = *AcpiExGetElementPointer (IndexDesc);
+    }
+
+    *ElementDesc = Element;
+    return (AE_OK);
+}
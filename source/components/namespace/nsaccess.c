@@ -46,6 +46,7 @@
 #include "amlcode.h"
 #include "acnamesp.h"
 #include "acdispat.h"
+#include "acinterp.h"
 
 #ifdef ACPI_ASL_COMPILER
     #include "acdisasm.h"
@@ -143,7 +144,8 @@ AcpiNsRootInitialize (
          * predefined names are at the root level. It is much easier to
          * just create and link the new node(s) here.
          */
-        NewNode = AcpiNsCreateNode (*ACPI_CAST_PTR (UINT32, InitVal->Name));
+        NewNode = AcpiNsCreateNode (
+            *ACPI_CAST_PTR (UINT32, InitVal->Name), 0);
         if (!NewNode)
         {
             Status = AE_NO_MEMORY;
@@ -358,6 +360,8 @@ AcpiNsLookup (
         return_ACPI_STATUS (AE_BAD_PARAMETER);
     }
 
+    AcpiExCheckInterpreter (WalkState);
+
     LocalFlags = Flags &
         ~(ACPI_NS_ERROR_IF_FOUND | ACPI_NS_OVERRIDE_IF_FOUND |
           ACPI_NS_SEARCH_PARENT);
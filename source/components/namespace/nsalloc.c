@@ -44,27 +44,43 @@
 #include "acpi.h"
 #include "accommon.h"
 #include "acnamesp.h"
+#include "acdispat.h"
 
 
 #define _COMPONENT          ACPI_NAMESPACE
         ACPI_MODULE_NAME    ("nsalloc")
 
+/* Local prototypes */
+
+static void
+AcpiNsUnlinkOwnerNode (
+    ACPI_NAMESPACE_NODE     *Node);
+
+static void
+AcpiNsDeleteSubtreeNodes (
+    ACPI_NAMESPACE_NODE     *ParentNode);
+
 
 /*******************************************************************************
  *
  * FUNCTION:    AcpiNsCreateNode
  *
  * PARAMETERS:  Name            - Name of the new node (4 char ACPI name)
+ *              OwnerId         - Owner that will install the node, used to
+ *                                select an open node arena (nsarena.c)
  *
  * RETURN:      New namespace node (Null on failure)
  *
- * DESCRIPTION: Create a namespace node
+ * DESCRIPTION: Create a namespace node. The node is carved from the owner's
+ *              arena if one is open, otherwise it comes from the namespace
+ *              object cache.
  *
  ******************************************************************************/
 
 ACPI_NAMESPACE_NODE *
 AcpiNsCreateNode (
-    UINT32                  Name)
+    UINT32                  Name,
+    ACPI_OWNER_ID           OwnerId)
 {
     ACPI_NAMESPACE_NODE     *Node;
 #ifdef ACPI_DBG_TRACK_ALLOCATIONS
@@ -75,10 +91,14 @@ AcpiNsCreateNode (
     ACPI_FUNCTION_TRACE (NsCreateNode);
 
 
-    Node = AcpiOsAcquireObject (AcpiGbl_NamespaceCache);
+    Node = AcpiNsArenaAllocate (OwnerId);
     if (!Node)
     {
-        return_PTR (NULL);
+        Node = AcpiOsAcquireObject (AcpiGbl_NamespaceCache);
+        if (!Node)
+        {
+            return_PTR (NULL);
+        }
     }
 
     ACPI_MEM_TRACKING (AcpiGbl_NsNodeList->TotalAllocated++);
@@ -129,9 +149,34 @@ AcpiNsDeleteNode (
         return_VOID;
     }
 
+    /* A device is going away, the device ID index is out of date */
+
+    if (Node->Type == ACPI_TYPE_DEVICE)
+    {
+        AcpiNsInvalidateDeviceIds ();
+    }
+
     /* Detach an object if there is one */
 
     AcpiNsDetachObject (Node);
+    AcpiNsIndexDelete (Node);
+
+    /* Drop any pathname lookup cache entries for this node */
+
+    if (Node->Flags & ANOBJ_PATH_CACHED)
+    {
+        AcpiNsPathCacheDeleteNode (Node);
+    }
+
+    AcpiNsDeleteCachedPathname (Node);
+    AcpiNsUnlinkOwnerNode (Node);
+
+    /* Cached name resolutions may refer to this node */
+
+    if (!AcpiNsIsMethodLocal (Node))
+    {
+        AcpiGbl_NsGeneration++;
+    }
 
     /*
      * Delete an attached data object list if present (objects that were
@@ -164,7 +209,14 @@ AcpiNsDeleteNode (
 
     /* Now we can delete the node */
 
-    (void) AcpiOsReleaseObject (AcpiGbl_NamespaceCache, Node);
+    if (Node->Slab)
+    {
+        AcpiNsArenaFree (Node);
+    }
+    else
+    {
+        (void) AcpiOsReleaseObject (AcpiGbl_NamespaceCache, Node);
+    }
 
     ACPI_MEM_TRACKING (AcpiGbl_NsNodeList->TotalFreed++);
     ACPI_DEBUG_PRINT ((ACPI_DB_ALLOCATIONS, "Node %p, Remaining %X\n",
@@ -224,6 +276,17 @@ AcpiNsRemoveNode (
         ParentNode->Child = Node->Peer;
     }
 
+    /* Keep the parent's child index (if any) in sync */
+
+    if (ParentNode->ChildIndex)
+    {
+        AcpiNsIndexRemove (ParentNode, Node);
+        if (ParentNode->ChildIndex->Tail == Node)
+        {
+            ParentNode->ChildIndex->Tail = PrevNode;
+        }
+    }
+
     /* Delete the node and any attached objects */
 
     AcpiNsDeleteNode (Node);
@@ -245,9 +308,10 @@ AcpiNsRemoveNode (
  * DESCRIPTION: Initialize a new namespace node and install it amongst
  *              its peers.
  *
- *              Note: Current namespace lookup is linear search. This appears
- *              to be sufficient as namespace searches consume only a small
- *              fraction of the execution time of the ACPI subsystem.
+ *              Note: Namespace lookup is a linear search of the peer list,
+ *              except in scopes with at least AcpiGbl_NamespaceIndexThreshold
+ *              children. Those get a hashed child index (nsindex.c), which
+ *              is kept in sync here and in AcpiNsRemoveNode.
  *
  ******************************************************************************/
 
@@ -260,6 +324,7 @@ AcpiNsInstallNode (
 {
     ACPI_OWNER_ID           OwnerId = 0;
     ACPI_NAMESPACE_NODE     *ChildNode;
+    UINT32                  ChildCount = 1;
 
 
     ACPI_FUNCTION_TRACE (NsInstallNode);
@@ -293,7 +358,26 @@ AcpiNsInstallNode (
     Node->Parent = ParentNode;
     ChildNode = ParentNode->Child;
 
-    if (!ChildNode)
+    if (ParentNode->ChildIndex)
+    {
+        /* Indexed scope: append at the tail and enter into the index */
+
+        if (ChildNode)
+        {
+            ParentNode->ChildIndex->Tail->Peer = Node;
+        }
+        else
+        {
+            ParentNode->Child = Node;
+        }
+
+        AcpiNsIndexInsert (ParentNode, Node);
+        if (ParentNode->ChildIndex)
+        {
+            ParentNode->ChildIndex->Tail = Node;
+        }
+    }
+    else if (!ChildNode)
     {
         ParentNode->Child = Node;
     }
@@ -301,19 +385,42 @@ AcpiNsInstallNode (
     {
         /* Add node to the end of the peer list */
 
+        ChildCount++;
         while (ChildNode->Peer)
         {
+            ChildCount++;
             ChildNode = ChildNode->Peer;
         }
 
         ChildNode->Peer = Node;
+
+        /* Index this scope once it has become large */
+
+        if (AcpiGbl_NamespaceIndexThreshold &&
+            (ChildCount >= AcpiGbl_NamespaceIndexThreshold))
+        {
+            AcpiNsIndexBuild (ParentNode, ChildCount);
+        }
     }
 
     /* Init the new entry */
 
-    Node->OwnerId = OwnerId;
+    AcpiNsSetNodeOwner (Node, OwnerId);
     Node->Type = (UINT8) Type;
 
+    /*
+     * The new node may change what cached names resolve to. A temporary
+     * node of a running method can only hide a name used by that method.
+     */
+    if (!AcpiNsIsMethodLocal (Node))
+    {
+        AcpiGbl_NsGeneration++;
+    }
+    else if (ParentNode->Type == ACPI_TYPE_METHOD)
+    {
+        AcpiDsMethodCachePurgeName (ParentNode, Node->Name.Integer);
+    }
+
     ACPI_DEBUG_PRINT ((ACPI_DB_NAMES,
         "%4.4s (%s) [Node %p Owner %3.3X] added to %4.4s (%s) [Node %p]\n",
         AcpiUtGetNodeName (Node), AcpiUtGetTypeName (Node->Type), Node, OwnerId,
@@ -324,6 +431,91 @@ AcpiNsInstallNode (
 }
 
 
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsUnlinkOwnerNode
+ *
+ * PARAMETERS:  Node            - Node to be unlinked
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Remove a node from the node list of its owner. Nothing is done
+ *              if the node is not on a list.
+ *
+ ******************************************************************************/
+
+static void
+AcpiNsUnlinkOwnerNode (
+    ACPI_NAMESPACE_NODE     *Node)
+{
+
+    if (Node->OwnerPrev)
+    {
+        Node->OwnerPrev->OwnerNext = Node->OwnerNext;
+    }
+    else if (AcpiGbl_NsOwnerNodes[Node->OwnerId] == Node)
+    {
+        AcpiGbl_NsOwnerNodes[Node->OwnerId] = Node->OwnerNext;
+    }
+    else
+    {
+        return;
+    }
+
+    if (Node->OwnerNext)
+    {
+        Node->OwnerNext->OwnerPrev = Node->OwnerPrev;
+    }
+
+    Node->OwnerNext = NULL;
+    Node->OwnerPrev = NULL;
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsSetNodeOwner
+ *
+ * PARAMETERS:  Node            - Node to be (re)assigned
+ *              OwnerId         - New owner of the node
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Set the owner of a node and move the node to the head of the
+ *              node list of that owner. AcpiNsDeleteNamespaceByOwner uses
+ *              these lists to find the nodes of a table without walking the
+ *              entire namespace. Nodes owned by ID zero are never deleted by
+ *              owner and are not put on a list.
+ *
+ * MUTEX:       Caller must hold ACPI_MTX_NAMESPACE exclusively, or be loading
+ *              the namespace before it is visible to other threads.
+ *
+ ******************************************************************************/
+
+void
+AcpiNsSetNodeOwner (
+    ACPI_NAMESPACE_NODE     *Node,
+    ACPI_OWNER_ID           OwnerId)
+{
+
+    AcpiNsUnlinkOwnerNode (Node);
+
+    Node->OwnerId = OwnerId;
+    if (!OwnerId)
+    {
+        return;
+    }
+
+    Node->OwnerNext = AcpiGbl_NsOwnerNodes[OwnerId];
+    if (Node->OwnerNext)
+    {
+        Node->OwnerNext->OwnerPrev = Node;
+    }
+
+    AcpiGbl_NsOwnerNodes[OwnerId] = Node;
+}
+
+
 /*******************************************************************************
  *
  * FUNCTION:    AcpiNsDeleteChildren
@@ -375,50 +567,36 @@ AcpiNsDeleteChildren (
         AcpiNsDeleteNode (NodeToDelete);
     }
 
-    /* Clear the parent's child pointer */
+    /* Clear the parent's child pointer and child index */
 
     ParentNode->Child = NULL;
+    AcpiNsIndexDelete (ParentNode);
     return_VOID;
 }
 
 
 /*******************************************************************************
  *
- * FUNCTION:    AcpiNsDeleteNamespaceSubtree
+ * FUNCTION:    AcpiNsDeleteSubtreeNodes
  *
  * PARAMETERS:  ParentNode      - Root of the subtree to be deleted
  *
  * RETURN:      None.
  *
- * DESCRIPTION: Delete a subtree of the namespace. This includes all objects
- *              stored within the subtree.
+ * DESCRIPTION: Delete all nodes below ParentNode, including all objects
+ *              attached to them. ParentNode itself is not deleted.
+ *
+ * MUTEX:       Caller must hold ACPI_MTX_NAMESPACE.
  *
  ******************************************************************************/
 
-void
-AcpiNsDeleteNamespaceSubtree (
+static void
+AcpiNsDeleteSubtreeNodes (
     ACPI_NAMESPACE_NODE     *ParentNode)
 {
     ACPI_NAMESPACE_NODE     *ChildNode = NULL;
     UINT32                  Level = 1;
-    ACPI_STATUS             Status;
-
-
-    ACPI_FUNCTION_TRACE (NsDeleteNamespaceSubtree);
-
-
-    if (!ParentNode)
-    {
-        return_VOID;
-    }
 
-    /* Lock namespace for possible update */
-
-    Status = AcpiUtAcquireMutex (ACPI_MTX_NAMESPACE);
-    if (ACPI_FAILURE (Status))
-    {
-        return_VOID;
-    }
 
     /*
      * Traverse the tree of objects until we bubble back up
@@ -471,6 +649,46 @@ AcpiNsDeleteNamespaceSubtree (
             ParentNode = ParentNode->Parent;
         }
     }
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsDeleteNamespaceSubtree
+ *
+ * PARAMETERS:  ParentNode      - Root of the subtree to be deleted
+ *
+ * RETURN:      None.
+ *
+ * DESCRIPTION: Delete a subtree of the namespace. This includes all objects
+ *              stored within the subtree.
+ *
+ ******************************************************************************/
+
+void
+AcpiNsDeleteNamespaceSubtree (
+    ACPI_NAMESPACE_NODE     *ParentNode)
+{
+    ACPI_STATUS             Status;
+
+
+    ACPI_FUNCTION_TRACE (NsDeleteNamespaceSubtree);
+
+
+    if (!ParentNode)
+    {
+        return_VOID;
+    }
+
+    /* Lock namespace for possible update */
+
+    Status = AcpiUtAcquireMutex (ACPI_MTX_NAMESPACE);
+    if (ACPI_FAILURE (Status))
+    {
+        return_VOID;
+    }
+
+    AcpiNsDeleteSubtreeNodes (ParentNode);
 
     (void) AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
     return_VOID;
@@ -489,7 +707,12 @@ AcpiNsDeleteNamespaceSubtree (
  *              specific ID. Used to delete entire ACPI tables. All
  *              reference counts are updated.
  *
- * MUTEX:       Locks namespace during deletion walk.
+ *              Only the nodes on the node list of the owner are visited, so
+ *              the cost is proportional to the size of the table, not the
+ *              size of the namespace. Any nodes that other owners have
+ *              created below a deleted node are deleted along with it.
+ *
+ * MUTEX:       Locks namespace during deletion.
  *
  ******************************************************************************/
 
@@ -497,10 +720,7 @@ void
 AcpiNsDeleteNamespaceByOwner (
     ACPI_OWNER_ID            OwnerId)
 {
-    ACPI_NAMESPACE_NODE     *ChildNode;
-    ACPI_NAMESPACE_NODE     *DeletionNode;
-    ACPI_NAMESPACE_NODE     *ParentNode;
-    UINT32                  Level;
+    ACPI_NAMESPACE_NODE     *Node;
     ACPI_STATUS             Status;
 
 
@@ -520,79 +740,28 @@ AcpiNsDeleteNamespaceByOwner (
         return_VOID;
     }
 
-    DeletionNode = NULL;
-    ParentNode = AcpiGbl_RootNode;
-    ChildNode = NULL;
-    Level = 1;
+    /* Flush the owner's nodes from the pathname lookup cache in one pass */
+
+    AcpiNsPathCacheDeleteOwner (OwnerId);
+
+    /* The owner's objects may include _HID/_CID for any device */
+
+    AcpiNsInvalidateDeviceIds ();
 
     /*
-     * Traverse the tree of nodes until we bubble back up
-     * to where we started.
+     * The list is newest first, so nodes are normally deleted before their
+     * parents. Every deletion unlinks the node from the list, including
+     * nodes deleted as part of the subtree of another node.
      */
-    while (Level > 0)
+    while ((Node = AcpiGbl_NsOwnerNodes[OwnerId]) != NULL)
     {
-        /*
-         * Get the next child of this parent node. When ChildNode is NULL,
-         * the first child of the parent is returned
-         */
-        ChildNode = AcpiNsGetNextNode (ParentNode, ChildNode);
-
-        if (DeletionNode)
+        AcpiNsDetachObject (Node);
+        if (Node->Child)
         {
-            AcpiNsDeleteChildren (DeletionNode);
-            AcpiNsRemoveNode (DeletionNode);
-            DeletionNode = NULL;
-        }
-
-        if (ChildNode)
-        {
-            if (ChildNode->OwnerId == OwnerId)
-            {
-                /* Found a matching child node - detach any attached object */
-
-                AcpiNsDetachObject (ChildNode);
-            }
-
-            /* Check if this node has any children */
-
-            if (ChildNode->Child)
-            {
-                /*
-                 * There is at least one child of this node,
-                 * visit the node
-                 */
-                Level++;
-                ParentNode = ChildNode;
-                ChildNode  = NULL;
-            }
-            else if (ChildNode->OwnerId == OwnerId)
-            {
-                DeletionNode = ChildNode;
-            }
+            AcpiNsDeleteSubtreeNodes (Node);
         }
-        else
-        {
-            /*
-             * No more children of this parent node.
-             * Move up to the grandparent.
-             */
-            Level--;
-            if (Level != 0)
-            {
-                if (ParentNode->OwnerId == OwnerId)
-                {
-                    DeletionNode = ParentNode;
-                }
-            }
-
-            /* New "last child" is this parent node */
 
-            ChildNode = ParentNode;
-
-            /* Move up the tree to the grandparent */
-
-            ParentNode = ParentNode->Parent;
-        }
+        AcpiNsRemoveNode (Node);
     }
 
     (void) AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
@@ -0,0 +1,502 @@
+/*******************************************************************************
+ *
+ * Module Name: nsarena - Namespace node arena allocation
+ *
+ ******************************************************************************/
+
+/*
+ * Copyright (C) 2000 - 2023, Intel Corp.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions, and the following disclaimer,
+ *    without modification.
+ * 2. Redistributions in binary form must reproduce at minimum a disclaimer
+ *    substantially similar to the "NO WARRANTY" disclaimer below
+ *    ("Disclaimer") and any redistribution must be conditioned upon
+ *    including a substantially similar Disclaimer requirement for further
+ *    binary redistribution.
+ * 3. Neither the names of the above-listed copyright holders nor the names
+ *    of any contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * Alternatively, this software may be distributed under the terms of the
+ * GNU General Public License ("GPL") version 2 as published by the Free
+ * Software Foundation.
+ *
+ * NO WARRANTY
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGES.
+ */
+
+
+#include "acpi.h"
+#include "accommon.h"
+#include "acnamesp.h"
+
+
+#define _COMPONENT          ACPI_NAMESPACE
+        ACPI_MODULE_NAME    ("nsarena")
+
+/*
+ * Namespace nodes are normally allocated one at a time from
+ * AcpiGbl_NamespaceCache, which scatters the nodes of a table (and the
+ * siblings within a scope) across the heap. When AcpiGbl_EnableNamespaceArena
+ * is set, AcpiNsLoadTable opens an arena for the table's OwnerId, and every
+ * node created for that owner during the load is carved out of a slab of
+ * ACPI_NS_ARENA_SLAB_NODES contiguous nodes.
+ *
+ * Each arena node records the index of its slab in AcpiGbl_NsSlabTable.
+ * Deleting an arena node only decrements the live count of its slab; the
+ * slab itself is freed in one piece once all of its nodes have been deleted
+ * and no arena is still allocating from it. For a table unload, this happens
+ * during AcpiNsDeleteNamespaceByOwner. Because slabs are reference counted
+ * rather than tied to the OwnerId, nodes whose OwnerId later changes (for
+ * example via the runtime namespace override) remain valid.
+ *
+ * All arena and slab state is protected by ACPI_MTX_CACHES.
+ */
+
+/* Slab indexes are stored in a UINT16, and index zero means "no slab" */
+
+#define ACPI_NS_ARENA_MAX_SLABS     ACPI_UINT16_MAX
+
+/* Local prototypes */
+
+static ACPI_NS_SLAB *
+AcpiNsArenaCreateSlab (
+    ACPI_NS_ARENA           *Arena);
+
+static void
+AcpiNsArenaDeleteSlab (
+    ACPI_NS_SLAB            *Slab);
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsArenaBegin
+ *
+ * PARAMETERS:  Arena           - Arena to open (caller-provided storage)
+ *              OwnerId         - Owner whose new nodes are to be allocated
+ *                                from the arena
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Open an arena for a table that is about to be loaded. Does
+ *              nothing if arena allocation is disabled. Must be paired with
+ *              AcpiNsArenaEnd.
+ *
+ ******************************************************************************/
+
+void
+AcpiNsArenaBegin (
+    ACPI_NS_ARENA           *Arena,
+    ACPI_OWNER_ID           OwnerId)
+{
+    ACPI_STATUS             Status;
+
+
+    ACPI_FUNCTION_TRACE_U32 (NsArenaBegin, OwnerId);
+
+
+    Arena->Next = NULL;
+    Arena->Slab = NULL;
+    Arena->OwnerId = 0;
+
+    if (!AcpiGbl_EnableNamespaceArena || !OwnerId)
+    {
+        return_VOID;
+    }
+
+    Status = AcpiUtAcquireMutex (ACPI_MTX_CACHES);
+    if (ACPI_FAILURE (Status))
+    {
+        return_VOID;
+    }
+
+    Arena->OwnerId = OwnerId;
+    Arena->Next = AcpiGbl_NsArenaList;
+    AcpiGbl_NsArenaList = Arena;
+
+    (void) AcpiUtReleaseMutex (ACPI_MTX_CACHES);
+    return_VOID;
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsArenaEnd
+ *
+ * PARAMETERS:  Arena           - Arena opened by AcpiNsArenaBegin
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Close an arena. Its current slab is released to live on until
+ *              its last node is deleted (or is freed now if it is already
+ *              empty).
+ *
+ ******************************************************************************/
+
+void
+AcpiNsArenaEnd (
+    ACPI_NS_ARENA           *Arena)
+{
+    ACPI_NS_ARENA           **Link;
+    ACPI_STATUS             Status;
+
+
+    ACPI_FUNCTION_TRACE_U32 (NsArenaEnd, Arena->OwnerId);
+
+
+    if (!Arena->OwnerId)
+    {
+        return_VOID;
+    }
+
+    Status = AcpiUtAcquireMutex (ACPI_MTX_CACHES);
+    if (ACPI_FAILURE (Status))
+    {
+        return_VOID;
+    }
+
+    /* Unlink the arena from the list of open arenas */
+
+    Link = &AcpiGbl_NsArenaList;
+    while (*Link)
+    {
+        if (*Link == Arena)
+        {
+            *Link = Arena->Next;
+            break;
+        }
+
+        Link = &(*Link)->Next;
+    }
+
+    /* Retire the current slab */
+
+    if (Arena->Slab)
+    {
+        Arena->Slab->Arena = NULL;
+        if (!Arena->Slab->Live)
+        {
+            AcpiNsArenaDeleteSlab (Arena->Slab);
+        }
+
+        Arena->Slab = NULL;
+    }
+
+    Arena->OwnerId = 0;
+    (void) AcpiUtReleaseMutex (ACPI_MTX_CACHES);
+    return_VOID;
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsArenaCreateSlab
+ *
+ * PARAMETERS:  Arena           - Arena that needs a new slab
+ *
+ * RETURN:      New slab, NULL if out of memory or slab indexes
+ *
+ * DESCRIPTION: Allocate a slab and enter it into the slab table, growing the
+ *              table as necessary. Caller must hold ACPI_MTX_CACHES.
+ *
+ ******************************************************************************/
+
+static ACPI_NS_SLAB *
+AcpiNsArenaCreateSlab (
+    ACPI_NS_ARENA           *Arena)
+{
+    ACPI_NS_SLAB            *Slab;
+    ACPI_NS_SLAB            **NewTable;
+    UINT32                  NewSize;
+    UINT32                  Index;
+    UINT32                  i;
+
+
+    /* Find a free slab index, searching from the last one handed out */
+
+    Index = 0;
+    for (i = 1; i < AcpiGbl_NsSlabTableSize; i++)
+    {
+        Index = AcpiGbl_NsSlabNextIndex + i;
+        if (Index >= AcpiGbl_NsSlabTableSize)
+        {
+            Index -= (AcpiGbl_NsSlabTableSize - 1);
+        }
+
+        if (!AcpiGbl_NsSlabTable[Index])
+        {
+            break;
+        }
+
+        Index = 0;
+    }
+
+    if (!Index)
+    {
+        /* Table is full (or not yet allocated), grow it */
+
+        NewSize = AcpiGbl_NsSlabTableSize ?
+            (AcpiGbl_NsSlabTableSize * 2) : ACPI_NS_ARENA_TABLE_SIZE;
+        if (NewSize > ACPI_NS_ARENA_MAX_SLABS)
+        {
+            NewSize = ACPI_NS_ARENA_MAX_SLABS;
+        }
+
+        if (NewSize <= AcpiGbl_NsSlabTableSize)
+        {
+            return (NULL);
+        }
+
+        NewTable = ACPI_ALLOCATE_ZEROED (NewSize * sizeof (ACPI_NS_SLAB *));
+        if (!NewTable)
+        {
+            return (NULL);
+        }
+
+        if (AcpiGbl_NsSlabTable)
+        {
+            memcpy (NewTable, AcpiGbl_NsSlabTable,
+                AcpiGbl_NsSlabTableSize * sizeof (ACPI_NS_SLAB *));
+            ACPI_FREE (AcpiGbl_NsSlabTable);
+        }
+
+        Index = AcpiGbl_NsSlabTableSize ? AcpiGbl_NsSlabTableSize : 1;
+        AcpiGbl_NsSlabTable = NewTable;
+        AcpiGbl_NsSlabTableSize = NewSize;
+    }
+
+    /* The node array immediately follows the slab header */
+
+    Slab = ACPI_ALLOCATE (sizeof (ACPI_NS_SLAB) +
+        (ACPI_NS_ARENA_SLAB_NODES * sizeof (ACPI_NAMESPACE_NODE)));
+    if (!Slab)
+    {
+        return (NULL);
+    }
+
+    Slab->Arena = Arena;
+    Slab->Index = (UINT16) Index;
+    Slab->OwnerId = Arena->OwnerId;
+    Slab->Used = 0;
+    Slab->Live = 0;
+    Slab->Nodes = ACPI_CAST_PTR (ACPI_NAMESPACE_NODE, Slab + 1);
+
+    AcpiGbl_NsSlabTable[Index] = Slab;
+    AcpiGbl_NsSlabNextIndex = Index;
+
+    ACPI_DEBUG_PRINT ((ACPI_DB_ALLOCATIONS,
+        "Slab %u (%p) created for Owner %3.3X\n",
+        Index, Slab, Arena->OwnerId));
+    return (Slab);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsArenaDeleteSlab
+ *
+ * PARAMETERS:  Slab            - Slab with no live nodes
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Free a slab and its slab table entry. Caller must hold
+ *              ACPI_MTX_CACHES.
+ *
+ ******************************************************************************/
+
+static void
+AcpiNsArenaDeleteSlab (
+    ACPI_NS_SLAB            *Slab)
+{
+
+    ACPI_DEBUG_PRINT ((ACPI_DB_ALLOCATIONS,
+        "Slab %u (%p) for Owner %3.3X freed, %u nodes used\n",
+        Slab->Index, Slab, Slab->OwnerId, Slab->Used));
+
+    AcpiGbl_NsSlabTable[Slab->Index] = NULL;
+    ACPI_FREE (Slab);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsArenaAllocate
+ *
+ * PARAMETERS:  OwnerId         - Owner of the node to be allocated
+ *
+ * RETURN:      Zeroed node, or NULL if no arena is open for OwnerId (or out
+ *              of memory). The caller falls back to AcpiGbl_NamespaceCache.
+ *
+ * DESCRIPTION: Allocate a namespace node from the open arena for an owner.
+ *
+ ******************************************************************************/
+
+ACPI_NAMESPACE_NODE *
+AcpiNsArenaAllocate (
+    ACPI_OWNER_ID           OwnerId)
+{
+    ACPI_NS_ARENA           *Arena;
+    ACPI_NS_SLAB            *Slab;
+    ACPI_NAMESPACE_NODE     *Node = NULL;
+    ACPI_STATUS             Status;
+
+
+    if (!AcpiGbl_NsArenaList || !OwnerId)
+    {
+        return (NULL);
+    }
+
+    Status = AcpiUtAcquireMutex (ACPI_MTX_CACHES);
+    if (ACPI_FAILURE (Status))
+    {
+        return (NULL);
+    }
+
+    Arena = AcpiGbl_NsArenaList;
+    while (Arena && (Arena->OwnerId != OwnerId))
+    {
+        Arena = Arena->Next;
+    }
+
+    if (!Arena)
+    {
+        goto Exit;
+    }
+
+    Slab = Arena->Slab;
+    if (Slab && !Slab->Live)
+    {
+        /* Every node handed out so far has been deleted, start over */
+
+        Slab->Used = 0;
+    }
+
+    if (!Slab || (Slab->Used >= ACPI_NS_ARENA_SLAB_NODES))
+    {
+        if (Slab)
+        {
+            Slab->Arena = NULL;
+        }
+
+        Slab = AcpiNsArenaCreateSlab (Arena);
+        Arena->Slab = Slab;
+        if (!Slab)
+        {
+            goto Exit;
+        }
+    }
+
+    Node = &Slab->Nodes[Slab->Used];
+    Slab->Used++;
+    Slab->Live++;
+
+    memset (Node, 0, sizeof (ACPI_NAMESPACE_NODE));
+    Node->Slab = Slab->Index;
+
+Exit:
+    (void) AcpiUtReleaseMutex (ACPI_MTX_CACHES);
+    return (Node);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsArenaFree
+ *
+ * PARAMETERS:  Node            - Arena node that has been deleted
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Release an arena node. The slab is freed along with its last
+ *              node, unless an arena is still allocating from it.
+ *
+ ******************************************************************************/
+
+void
+AcpiNsArenaFree (
+    ACPI_NAMESPACE_NODE     *Node)
+{
+    ACPI_NS_SLAB            *Slab;
+    ACPI_STATUS             Status;
+
+
+    Status = AcpiUtAcquireMutex (ACPI_MTX_CACHES);
+    if (ACPI_FAILURE (Status))
+    {
+        return;
+    }
+
+    Slab = AcpiGbl_NsSlabTable[Node->Slab];
+    ACPI_SET_DESCRIPTOR_TYPE (Node, ACPI_DESC_TYPE_CACHED);
+
+    Slab->Live--;
+    if (!Slab->Live && !Slab->Arena)
+    {
+        AcpiNsArenaDeleteSlab (Slab);
+    }
+
+    (void) AcpiUtReleaseMutex (ACPI_MTX_CACHES);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsArenaTerminate
+ *
+ * PARAMETERS:  None
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Free the slab table at subsystem shutdown. All namespace
+ *              nodes (and therefore all slabs) have been deleted by now.
+ *
+ ******************************************************************************/
+
+void
+AcpiNsArenaTerminate (
+    void)
+{
+    UINT32                  i;
+
+
+    ACPI_FUNCTION_TRACE (NsArenaTerminate);
+
+
+    if (!AcpiGbl_NsSlabTable)
+    {
+        return_VOID;
+    }
+
+    for (i = 1; i < AcpiGbl_NsSlabTableSize; i++)
+    {
+        if (AcpiGbl_NsSlabTable[i])
+        {
+            ACPI_WARNING ((AE_INFO,
+                "Namespace slab %u still has %u live nodes at shutdown",
+                i, AcpiGbl_NsSlabTable[i]->Live));
+            ACPI_FREE (AcpiGbl_NsSlabTable[i]);
+        }
+    }
+
+    ACPI_FREE (AcpiGbl_NsSlabTable);
+    AcpiGbl_NsSlabTable = NULL;
+    AcpiGbl_NsSlabTableSize = 0;
+    AcpiGbl_NsSlabNextIndex = 0;
+    return_VOID;
+}
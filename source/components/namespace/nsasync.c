@@ -0,0 +1,400 @@
+/*******************************************************************************
+ *
+ * Module Name: nsasync - Cooperative scheduler for asynchronous evaluation
+ *
+ ******************************************************************************/
+
+/*
+ * Copyright (C) 2000 - 2023, Intel Corp.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions, and the following disclaimer,
+ *    without modification.
+ * 2. Redistributions in binary form must reproduce at minimum a disclaimer
+ *    substantially similar to the "NO WARRANTY" disclaimer below
+ *    ("Disclaimer") and any redistribution must be conditioned upon
+ *    including a substantially similar Disclaimer requirement for further
+ *    binary redistribution.
+ * 3. Neither the names of the above-listed copyright holders nor the names
+ *    of any contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * Alternatively, this software may be distributed under the terms of the
+ * GNU General Public License ("GPL") version 2 as published by the Free
+ * Software Foundation.
+ *
+ * NO WARRANTY
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGES.
+ */
+
+#include "acpi.h"
+#include "accommon.h"
+#include "acnamesp.h"
+
+
+#define _COMPONENT          ACPI_NAMESPACE
+        ACPI_MODULE_NAME    ("nsasync")
+
+/*
+ * AcpiEvaluateObjectAsync runs evaluations on a small pool of worker
+ * threads. When the AML of an evaluation executes Sleep, the worker is not
+ * blocked in AcpiOsSleep: AcpiExSystemSuspend records the wake time and
+ * the parser unwinds with AE_CTRL_SUSPEND, keeping the thread state and
+ * all of its walk states, in the same way that a method call leaves the
+ * walk state of the caller to be restarted later. The worker then moves
+ * on to another evaluation, and the suspended one is resumed by the next
+ * free worker once its wake time has passed.
+ *
+ * Evaluations wait on two lists under AcpiGbl_AsyncLock: the ready list
+ * in FIFO order, and the sleeping list ordered by wake time. Workers are
+ * started with AcpiOsExecute as evaluations are queued, up to
+ * ACPI_ASYNC_MAX_WORKERS. An idle worker waits on AcpiGbl_AsyncSemaphore
+ * until the earliest wake time, and exits once both lists are empty.
+ *
+ * Stall, Acquire, Wait and operation region accesses still block the
+ * worker, as does a Sleep while the evaluation holds an AML mutex or is
+ * in a Serialized method (see AcpiExSystemSuspend).
+ */
+
+/* Local prototypes */
+
+static ACPI_COROUTINE *
+AcpiNsAsyncGetNext (
+    void);
+
+static void
+AcpiNsAsyncSleep (
+    ACPI_COROUTINE          *Coroutine);
+
+static void
+AcpiNsAsyncRun (
+    ACPI_COROUTINE          *Coroutine);
+
+static void ACPI_SYSTEM_XFACE
+AcpiNsAsyncWorker (
+    void                    *Context);
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsAsyncGetNext
+ *
+ * PARAMETERS:  None
+ *
+ * RETURN:      The next evaluation to run, NULL if the worker should exit
+ *
+ * DESCRIPTION: Take the first ready evaluation, or the first sleeping one
+ *              whose wake time has passed. Waits for one of these if there
+ *              are sleeping evaluations. If there is no work at all, the
+ *              worker is removed from the count of running workers.
+ *
+ ******************************************************************************/
+
+static ACPI_COROUTINE *
+AcpiNsAsyncGetNext (
+    void)
+{
+    ACPI_COROUTINE          *Coroutine;
+    ACPI_CPU_FLAGS          LockFlags;
+    UINT64                  Now;
+    UINT64                  Timeout;
+
+
+    LockFlags = AcpiOsAcquireLock (AcpiGbl_AsyncLock);
+    for (;;)
+    {
+        Coroutine = AcpiGbl_AsyncReadyList;
+        if (Coroutine)
+        {
+            AcpiGbl_AsyncReadyList = Coroutine->Next;
+            break;
+        }
+
+        Coroutine = AcpiGbl_AsyncSleepList;
+        if (!Coroutine)
+        {
+            AcpiGbl_AsyncWorkers--;
+            break;
+        }
+
+        Now = AcpiOsGetTimer ();
+        if (Coroutine->WakeTime <= Now)
+        {
+            AcpiGbl_AsyncSleepList = Coroutine->Next;
+            break;
+        }
+
+        /* Wait for the earliest wake time or for new work */
+
+        Timeout = ((Coroutine->WakeTime - Now) / ACPI_100NSEC_PER_MSEC) + 1;
+        if (Timeout >= ACPI_WAIT_FOREVER)
+        {
+            Timeout = ACPI_WAIT_FOREVER - 1;
+        }
+
+        AcpiGbl_AsyncIdleWorkers++;
+        AcpiOsReleaseLock (AcpiGbl_AsyncLock, LockFlags);
+
+        (void) AcpiOsWaitSemaphore (AcpiGbl_AsyncSemaphore, 1,
+            (UINT16) Timeout);
+
+        LockFlags = AcpiOsAcquireLock (AcpiGbl_AsyncLock);
+        AcpiGbl_AsyncIdleWorkers--;
+    }
+
+    AcpiOsReleaseLock (AcpiGbl_AsyncLock, LockFlags);
+    if (Coroutine)
+    {
+        Coroutine->Next = NULL;
+    }
+
+    return (Coroutine);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsAsyncSleep
+ *
+ * PARAMETERS:  Coroutine       - A suspended evaluation
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Insert a suspended evaluation into the sleeping list, in
+ *              order of wake time. The calling worker is still running and
+ *              will pick it up, so no other worker is woken.
+ *
+ ******************************************************************************/
+
+static void
+AcpiNsAsyncSleep (
+    ACPI_COROUTINE          *Coroutine)
+{
+    ACPI_COROUTINE          **Link;
+    ACPI_CPU_FLAGS          LockFlags;
+
+
+    LockFlags = AcpiOsAcquireLock (AcpiGbl_AsyncLock);
+
+    Link = &AcpiGbl_AsyncSleepList;
+    while (*Link && ((*Link)->WakeTime <= Coroutine->WakeTime))
+    {
+        Link = &(*Link)->Next;
+    }
+
+    Coroutine->Next = *Link;
+    *Link = Coroutine;
+
+    AcpiOsReleaseLock (AcpiGbl_AsyncLock, LockFlags);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsAsyncRun
+ *
+ * PARAMETERS:  Coroutine       - Evaluation to start or resume
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Run an evaluation until it completes or sleeps. A completed
+ *              evaluation is handed to its completion routine and freed.
+ *
+ ******************************************************************************/
+
+static void
+AcpiNsAsyncRun (
+    ACPI_COROUTINE          *Coroutine)
+{
+    ACPI_STATUS             Status;
+
+
+    ACPI_FUNCTION_TRACE_PTR (NsAsyncRun, Coroutine);
+
+
+    if (!Coroutine->Started)
+    {
+        Coroutine->Started = TRUE;
+        Status = AcpiNsEvaluate (Coroutine->Info);
+    }
+    else
+    {
+        Status = AcpiNsResumeEvaluate (Coroutine->Info);
+    }
+
+    if (Status == AE_CTRL_SUSPEND)
+    {
+        AcpiNsAsyncSleep (Coroutine);
+        return_VOID;
+    }
+
+    Coroutine->Done (Coroutine, Status);
+    ACPI_FREE (Coroutine);
+    return_VOID;
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsAsyncWorker
+ *
+ * PARAMETERS:  Context         - Not used
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Entry point of the workers started with AcpiOsExecute. Runs
+ *              evaluations until there are none left.
+ *
+ ******************************************************************************/
+
+static void ACPI_SYSTEM_XFACE
+AcpiNsAsyncWorker (
+    void                    *Context)
+{
+    ACPI_COROUTINE          *Coroutine;
+
+
+    Coroutine = AcpiNsAsyncGetNext ();
+    while (Coroutine)
+    {
+        AcpiNsAsyncRun (Coroutine);
+        Coroutine = AcpiNsAsyncGetNext ();
+    }
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsEvaluateAsync
+ *
+ * PARAMETERS:  Info            - Evaluation info block, as for
+ *                                AcpiNsEvaluate
+ *              Done            - Called on a worker thread once the
+ *                                evaluation is complete
+ *              Callback        - Caller's callback, for use by Done
+ *              Context         - Context for Callback
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Queue an evaluation to the cooperative scheduler, starting a
+ *              worker if none is idle. On success, Info is owned by the
+ *              scheduler until it is passed to Done.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiNsEvaluateAsync (
+    ACPI_EVALUATE_INFO      *Info,
+    ACPI_ASYNC_DONE         Done,
+    ACPI_EVALUATE_CALLBACK  Callback,
+    void                    *Context)
+{
+    ACPI_STATUS             Status = AE_OK;
+    ACPI_COROUTINE          *Coroutine;
+    ACPI_COROUTINE          **Link;
+    ACPI_CPU_FLAGS          LockFlags;
+    BOOLEAN                 WakeWorker = FALSE;
+    BOOLEAN                 StartWorker = FALSE;
+
+
+    ACPI_FUNCTION_TRACE (NsEvaluateAsync);
+
+
+    Coroutine = ACPI_ALLOCATE_ZEROED (sizeof (ACPI_COROUTINE));
+    if (!Coroutine)
+    {
+        return_ACPI_STATUS (AE_NO_MEMORY);
+    }
+
+    Coroutine->Info = Info;
+    Coroutine->Done = Done;
+    Coroutine->Callback = Callback;
+    Coroutine->Context = Context;
+    Info->Coroutine = Coroutine;
+
+    /* Append to the ready list, then find a worker to run it */
+
+    LockFlags = AcpiOsAcquireLock (AcpiGbl_AsyncLock);
+
+    Link = &AcpiGbl_AsyncReadyList;
+    while (*Link)
+    {
+        Link = &(*Link)->Next;
+    }
+    *Link = Coroutine;
+
+    if (AcpiGbl_AsyncIdleWorkers)
+    {
+        WakeWorker = TRUE;
+    }
+    else if (AcpiGbl_AsyncWorkers < ACPI_ASYNC_MAX_WORKERS)
+    {
+        AcpiGbl_AsyncWorkers++;
+        StartWorker = TRUE;
+    }
+
+    AcpiOsReleaseLock (AcpiGbl_AsyncLock, LockFlags);
+
+    if (WakeWorker)
+    {
+        (void) AcpiOsSignalSemaphore (AcpiGbl_AsyncSemaphore, 1);
+    }
+
+    if (!StartWorker)
+    {
+        return_ACPI_STATUS (AE_OK);
+    }
+
+    Status = AcpiOsExecute (OSL_NOTIFY_HANDLER, AcpiNsAsyncWorker, NULL);
+    if (ACPI_SUCCESS (Status))
+    {
+        return_ACPI_STATUS (Status);
+    }
+
+    /*
+     * The worker could not be started. If there is no other worker, take
+     * the evaluation back (it cannot have been started yet) and fail.
+     */
+    LockFlags = AcpiOsAcquireLock (AcpiGbl_AsyncLock);
+    AcpiGbl_AsyncWorkers--;
+    if (!AcpiGbl_AsyncWorkers)
+    {
+        Link = &AcpiGbl_AsyncReadyList;
+        while (*Link != Coroutine)
+        {
+            Link = &(*Link)->Next;
+        }
+        *Link = Coroutine->Next;
+    }
+    else
+    {
+        Status = AE_OK;
+    }
+
+    AcpiOsReleaseLock (AcpiGbl_AsyncLock, LockFlags);
+
+    if (ACPI_FAILURE (Status))
+    {
+        ACPI_EXCEPTION ((AE_INFO, Status,
+            "Could not start an evaluation worker"));
+
+        Info->Coroutine = NULL;
+        ACPI_FREE (Coroutine);
+    }
+
+    return_ACPI_STATUS (Status);
+}
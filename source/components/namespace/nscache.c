@@ -0,0 +1,327 @@
+/*******************************************************************************
+ *
+ * Module Name: nscache - Absolute pathname lookup cache
+ *
+ ******************************************************************************/
+
+/*
+ * Copyright (C) 2000 - 2023, Intel Corp.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions, and the following disclaimer,
+ *    without modification.
+ * 2. Redistributions in binary form must reproduce at minimum a disclaimer
+ *    substantially similar to the "NO WARRANTY" disclaimer below
+ *    ("Disclaimer") and any redistribution must be conditioned upon
+ *    including a substantially similar Disclaimer requirement for further
+ *    binary redistribution.
+ * 3. Neither the names of the above-listed copyright holders nor the names
+ *    of any contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * Alternatively, this software may be distributed under the terms of the
+ * GNU General Public License ("GPL") version 2 as published by the Free
+ * Software Foundation.
+ *
+ * NO WARRANTY
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGES.
+ */
+
+
+#include "acpi.h"
+#include "accommon.h"
+#include "acnamesp.h"
+
+
+#define _COMPONENT          ACPI_NAMESPACE
+        ACPI_MODULE_NAME    ("nscache")
+
+/*
+ * Drivers tend to look up the same absolute pathnames over and over via
+ * AcpiGetHandle and AcpiEvaluateObject. Each such lookup internalizes the
+ * pathname (an allocation) and then descends the namespace one segment at
+ * a time. This module caches the result of successful lookups of absolute
+ * pathnames, keyed on the pathname string exactly as passed in, so that a
+ * repeated lookup costs one hash and one string compare.
+ *
+ * The cache is direct-mapped: a new entry simply replaces any entry in the
+ * same slot. Only successful lookups are cached, since a later table load
+ * may create a name that is not present now.
+ *
+ * Nodes referenced by the cache are marked with ANOBJ_PATH_CACHED. Entries
+ * are removed in bulk by owner when a table (or a method that created
+ * namespace objects) is unloaded, and AcpiNsDeleteNode removes any entries
+ * for a marked node that is deleted by other means.
+ *
+ * All interfaces assume that the namespace is locked. Lookups and inserts
+ * are made by AcpiNsGetNode with the namespace locked shared, so they are
+ * serialized by AcpiGbl_NsPathCacheLock. Entries are only removed with the
+ * namespace locked exclusively, when no lookup or insert can be running.
+ */
+
+/* Local prototypes */
+
+static UINT32
+AcpiNsPathCacheHash (
+    const char              *Pathname);
+
+static void
+AcpiNsPathCacheRemoveEntry (
+    ACPI_NS_PATH_CACHE_ENTRY    *Entry);
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsPathCacheHash
+ *
+ * PARAMETERS:  Pathname        - External pathname
+ *
+ * RETURN:      32-bit hash of the pathname (FNV-1a)
+ *
+ * DESCRIPTION: Hash a pathname for the lookup cache.
+ *
+ ******************************************************************************/
+
+static UINT32
+AcpiNsPathCacheHash (
+    const char              *Pathname)
+{
+    UINT32                  Hash = 2166136261;
+
+
+    while (*Pathname)
+    {
+        Hash ^= (UINT8) *Pathname;
+        Hash *= 16777619;
+        Pathname++;
+    }
+
+    return (Hash);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsPathCacheLookup
+ *
+ * PARAMETERS:  Pathname        - Absolute external pathname
+ *
+ * RETURN:      The cached node, NULL if the pathname is not in the cache
+ *
+ * DESCRIPTION: Look up an absolute pathname in the lookup cache. Updates the
+ *              hit/miss counters returned by AcpiGetStatistics.
+ *
+ ******************************************************************************/
+
+ACPI_NAMESPACE_NODE *
+AcpiNsPathCacheLookup (
+    const char              *Pathname)
+{
+    ACPI_NS_PATH_CACHE_ENTRY    *Entry;
+    ACPI_NAMESPACE_NODE         *Node = NULL;
+    ACPI_CPU_FLAGS              LockFlags;
+    UINT32                      Hash;
+
+
+    if (!AcpiGbl_EnablePathCache)
+    {
+        return (NULL);
+    }
+
+    Hash = AcpiNsPathCacheHash (Pathname);
+    Entry = &AcpiGbl_NsPathCache[Hash & (ACPI_NS_PATH_CACHE_SIZE - 1)];
+
+    LockFlags = AcpiOsAcquireLock (AcpiGbl_NsPathCacheLock);
+    if (Entry->Node &&
+        (Entry->Hash == Hash) &&
+        !strcmp (Entry->Pathname, Pathname))
+    {
+        Node = Entry->Node;
+        AcpiGbl_NsPathCacheHits++;
+    }
+    else
+    {
+        AcpiGbl_NsPathCacheMisses++;
+    }
+
+    AcpiOsReleaseLock (AcpiGbl_NsPathCacheLock, LockFlags);
+    return (Node);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsPathCacheInsert
+ *
+ * PARAMETERS:  Pathname        - Absolute external pathname
+ *              Node            - Node that the pathname resolved to
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Enter the result of a successful lookup into the cache,
+ *              replacing any entry in the same slot. Pathnames that are too
+ *              long for a cache entry are not cached.
+ *
+ ******************************************************************************/
+
+void
+AcpiNsPathCacheInsert (
+    const char              *Pathname,
+    ACPI_NAMESPACE_NODE     *Node)
+{
+    ACPI_NS_PATH_CACHE_ENTRY    *Entry;
+    ACPI_CPU_FLAGS              LockFlags;
+    UINT32                      Hash;
+    ACPI_SIZE                   Length;
+
+
+    if (!AcpiGbl_EnablePathCache || (Node == AcpiGbl_RootNode))
+    {
+        return;
+    }
+
+    Length = strlen (Pathname);
+    if (Length >= ACPI_NS_PATH_CACHE_MAX_PATH)
+    {
+        return;
+    }
+
+    Hash = AcpiNsPathCacheHash (Pathname);
+    Entry = &AcpiGbl_NsPathCache[Hash & (ACPI_NS_PATH_CACHE_SIZE - 1)];
+
+    LockFlags = AcpiOsAcquireLock (AcpiGbl_NsPathCacheLock);
+    if (Entry->Node)
+    {
+        AcpiNsPathCacheRemoveEntry (Entry);
+    }
+
+    memcpy (Entry->Pathname, Pathname, Length + 1);
+    Entry->Hash = Hash;
+    Entry->Node = Node;
+    Node->Flags |= ANOBJ_PATH_CACHED;
+    AcpiOsReleaseLock (AcpiGbl_NsPathCacheLock, LockFlags);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsPathCacheRemoveEntry
+ *
+ * PARAMETERS:  Entry           - Cache entry in use
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Remove a single entry from the cache. The ANOBJ_PATH_CACHED
+ *              flag is cleared only if no other entry (a different spelling
+ *              of the same pathname) still references the node.
+ *
+ ******************************************************************************/
+
+static void
+AcpiNsPathCacheRemoveEntry (
+    ACPI_NS_PATH_CACHE_ENTRY    *Entry)
+{
+    ACPI_NAMESPACE_NODE         *Node = Entry->Node;
+    UINT32                      i;
+
+
+    Entry->Node = NULL;
+    for (i = 0; i < ACPI_NS_PATH_CACHE_SIZE; i++)
+    {
+        if (AcpiGbl_NsPathCache[i].Node == Node)
+        {
+            return;
+        }
+    }
+
+    Node->Flags &= ~ANOBJ_PATH_CACHED;
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsPathCacheDeleteNode
+ *
+ * PARAMETERS:  Node            - Node that is being deleted
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Remove all cache entries that reference a node. Called by
+ *              AcpiNsDeleteNode for nodes marked with ANOBJ_PATH_CACHED.
+ *
+ ******************************************************************************/
+
+void
+AcpiNsPathCacheDeleteNode (
+    ACPI_NAMESPACE_NODE     *Node)
+{
+    UINT32                  i;
+
+
+    for (i = 0; i < ACPI_NS_PATH_CACHE_SIZE; i++)
+    {
+        if (AcpiGbl_NsPathCache[i].Node == Node)
+        {
+            AcpiGbl_NsPathCache[i].Node = NULL;
+        }
+    }
+
+    Node->Flags &= ~ANOBJ_PATH_CACHED;
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsPathCacheDeleteOwner
+ *
+ * PARAMETERS:  OwnerId         - Owner whose nodes are about to be deleted
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Remove all cache entries for nodes owned by OwnerId. Called
+ *              by AcpiNsDeleteNamespaceByOwner when a table is unloaded or a
+ *              method that created namespace objects terminates, so that the
+ *              individual node deletions that follow need not search the
+ *              cache.
+ *
+ ******************************************************************************/
+
+void
+AcpiNsPathCacheDeleteOwner (
+    ACPI_OWNER_ID           OwnerId)
+{
+    ACPI_NAMESPACE_NODE     *Node;
+    UINT32                  i;
+
+
+    ACPI_FUNCTION_TRACE_U32 (NsPathCacheDeleteOwner, OwnerId);
+
+
+    for (i = 0; i < ACPI_NS_PATH_CACHE_SIZE; i++)
+    {
+        Node = AcpiGbl_NsPathCache[i].Node;
+        if (Node && (Node->OwnerId == OwnerId))
+        {
+            /* All entries for this node have the same owner */
+
+            AcpiGbl_NsPathCache[i].Node = NULL;
+            Node->Flags &= ~ANOBJ_PATH_CACHED;
+        }
+    }
+
+    return_VOID;
+}
@@ -0,0 +1,602 @@
+/*******************************************************************************
+ *
+ * Module Name: nsdevid - Device hardware ID index
+ *
+ ******************************************************************************/
+
+/*
+ * Copyright (C) 2000 - 2023, Intel Corp.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions, and the following disclaimer,
+ *    without modification.
+ * 2. Redistributions in binary form must reproduce at minimum a disclaimer
+ *    substantially similar to the "NO WARRANTY" disclaimer below
+ *    ("Disclaimer") and any redistribution must be conditioned upon
+ *    including a substantially similar Disclaimer requirement for further
+ *    binary redistribution.
+ * 3. Neither the names of the above-listed copyright holders nor the names
+ *    of any contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * Alternatively, this software may be distributed under the terms of the
+ * GNU General Public License ("GPL") version 2 as published by the Free
+ * Software Foundation.
+ *
+ * NO WARRANTY
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGES.
+ */
+
+
+#include "acpi.h"
+#include "accommon.h"
+#include "acnamesp.h"
+
+
+#define _COMPONENT          ACPI_NAMESPACE
+        ACPI_MODULE_NAME    ("nsdevid")
+
+/*
+ * AcpiGetDevices with a hardware ID must otherwise evaluate _HID (and _CID)
+ * for every device in the namespace, on every call. Instead, the _HID and
+ * _CID values of all devices are collected into an index the first time
+ * they are needed, so that later calls only evaluate _STA for the devices
+ * that match.
+ *
+ * The index is invalidated by bumping AcpiGbl_DeviceIdGeneration whenever
+ * the set of devices or their IDs may have changed: a table load or unload,
+ * the deletion of a device node, or a Bus Check or Device Check notify. It
+ * is then rebuilt on the next lookup.
+ *
+ * The index is built with the same walk as AcpiGetDevices, so it skips the
+ * subtree of a device whose _HID cannot be evaluated. A device without a
+ * _HID is indexed without its _CIDs, as AcpiGetDevices never examines them.
+ */
+
+#define ACPI_NS_DEVICE_ID_INITIAL_SIZE  64
+#define ACPI_NS_DEVICE_ID_MIN_BUCKETS   16
+
+/* Local prototypes */
+
+static UINT32
+AcpiNsDeviceIdHash (
+    const char              *Id);
+
+static ACPI_STATUS
+AcpiNsAddDeviceId (
+    ACPI_NS_DEVICE_ID_INDEX *Index,
+    ACPI_NAMESPACE_NODE     *Node,
+    UINT32                  Level,
+    const char              *Id);
+
+static ACPI_STATUS
+AcpiNsDeviceIdCallback (
+    ACPI_HANDLE             ObjHandle,
+    UINT32                  NestingLevel,
+    void                    *Context,
+    void                    **ReturnValue);
+
+static ACPI_STATUS
+AcpiNsBuildDeviceIds (
+    ACPI_NS_DEVICE_ID_INDEX **ReturnIndex);
+
+static void
+AcpiNsFreeDeviceIds (
+    ACPI_NS_DEVICE_ID_INDEX *Index);
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsDeviceIdHash
+ *
+ * PARAMETERS:  Id              - Hardware ID string
+ *
+ * RETURN:      32-bit hash of the ID (FNV-1a)
+ *
+ * DESCRIPTION: Hash a hardware ID for the index.
+ *
+ ******************************************************************************/
+
+static UINT32
+AcpiNsDeviceIdHash (
+    const char              *Id)
+{
+    UINT32                  Hash = 2166136261;
+
+
+    while (*Id)
+    {
+        Hash ^= (UINT8) *Id;
+        Hash *= 16777619;
+        Id++;
+    }
+
+    return (Hash);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsAddDeviceId
+ *
+ * PARAMETERS:  Index           - Index being built
+ *              Node            - Device node
+ *              Level           - Nesting level of the device
+ *              Id              - One of the device's hardware IDs
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Append an entry to the index, growing it as necessary.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsAddDeviceId (
+    ACPI_NS_DEVICE_ID_INDEX *Index,
+    ACPI_NAMESPACE_NODE     *Node,
+    UINT32                  Level,
+    const char              *Id)
+{
+    ACPI_NS_DEVICE_ID       *NewEntries;
+    ACPI_NS_DEVICE_ID       *Entry;
+    UINT32                  NewSize;
+
+
+    if (Index->Count >= Index->Size)
+    {
+        NewSize = Index->Size ?
+            (Index->Size * 2) : ACPI_NS_DEVICE_ID_INITIAL_SIZE;
+
+        NewEntries = ACPI_ALLOCATE (NewSize * sizeof (ACPI_NS_DEVICE_ID));
+        if (!NewEntries)
+        {
+            return (AE_NO_MEMORY);
+        }
+
+        if (Index->Entries)
+        {
+            memcpy (NewEntries, Index->Entries,
+                Index->Count * sizeof (ACPI_NS_DEVICE_ID));
+            ACPI_FREE (Index->Entries);
+        }
+
+        Index->Entries = NewEntries;
+        Index->Size = NewSize;
+    }
+
+    Entry = &Index->Entries[Index->Count];
+    Entry->Id = ACPI_ALLOCATE (strlen (Id) + 1);
+    if (!Entry->Id)
+    {
+        return (AE_NO_MEMORY);
+    }
+
+    strcpy (Entry->Id, Id);
+    Entry->Node = Node;
+    Entry->Level = Level;
+    Entry->Next = ACPI_UINT32_MAX;
+
+    Index->Count++;
+    return (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsDeviceIdCallback
+ *
+ * PARAMETERS:  ACPI_WALK_CALLBACK
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Add the _HID and _CID values of one device to the index.
+ *              Called with the namespace unlocked.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsDeviceIdCallback (
+    ACPI_HANDLE             ObjHandle,
+    UINT32                  NestingLevel,
+    void                    *Context,
+    void                    **ReturnValue)
+{
+    ACPI_NS_DEVICE_ID_INDEX *Index = Context;
+    ACPI_NAMESPACE_NODE     *Node = ObjHandle;
+    ACPI_PNP_DEVICE_ID      *Hid;
+    ACPI_PNP_DEVICE_ID_LIST *Cid;
+    ACPI_STATUS             Status;
+    UINT32                  i;
+    UINT32                  j;
+
+
+    /* Same filtering as AcpiNsGetDeviceCallback */
+
+    Status = AcpiUtExecute_HID (Node, &Hid);
+    if (Status == AE_NOT_FOUND)
+    {
+        return (AE_OK);
+    }
+    else if (ACPI_FAILURE (Status))
+    {
+        return (AE_CTRL_DEPTH);
+    }
+
+    Status = AcpiNsAddDeviceId (Index, Node, NestingLevel, Hid->String);
+    if (ACPI_FAILURE (Status))
+    {
+        goto Exit;
+    }
+
+    if (ACPI_FAILURE (AcpiUtExecute_CID (Node, &Cid)))
+    {
+        goto Exit;
+    }
+
+    /* Add each distinct CID that differs from the HID */
+
+    for (i = 0; i < Cid->Count; i++)
+    {
+        if (!strcmp (Cid->Ids[i].String, Hid->String))
+        {
+            continue;
+        }
+
+        for (j = 0; j < i; j++)
+        {
+            if (!strcmp (Cid->Ids[i].String, Cid->Ids[j].String))
+            {
+                break;
+            }
+        }
+
+        if (j < i)
+        {
+            continue;
+        }
+
+        Status = AcpiNsAddDeviceId (Index, Node, NestingLevel,
+            Cid->Ids[i].String);
+        if (ACPI_FAILURE (Status))
+        {
+            break;
+        }
+    }
+
+    ACPI_FREE (Cid);
+
+Exit:
+    ACPI_FREE (Hid);
+    return (Status);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsFreeDeviceIds
+ *
+ * PARAMETERS:  Index           - Index to free
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Free a device ID index and all of its entries.
+ *
+ ******************************************************************************/
+
+static void
+AcpiNsFreeDeviceIds (
+    ACPI_NS_DEVICE_ID_INDEX *Index)
+{
+    UINT32                  i;
+
+
+    for (i = 0; i < Index->Count; i++)
+    {
+        ACPI_FREE (Index->Entries[i].Id);
+    }
+
+    if (Index->Entries)
+    {
+        ACPI_FREE (Index->Entries);
+    }
+
+    if (Index->Buckets)
+    {
+        ACPI_FREE (Index->Buckets);
+    }
+
+    ACPI_FREE (Index);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsBuildDeviceIds
+ *
+ * PARAMETERS:  ReturnIndex     - Where the new index is returned
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Evaluate _HID/_CID for all devices and build a new index.
+ *              Must be called with the namespace read lock held and
+ *              ACPI_MTX_NAMESPACE not held.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsBuildDeviceIds (
+    ACPI_NS_DEVICE_ID_INDEX **ReturnIndex)
+{
+    ACPI_NS_DEVICE_ID_INDEX *Index;
+    ACPI_NS_DEVICE_ID       *Entry;
+    ACPI_STATUS             Status;
+    UINT32                  Bucket;
+    UINT32                  i;
+
+
+    ACPI_FUNCTION_TRACE (NsBuildDeviceIds);
+
+
+    Index = ACPI_ALLOCATE_ZEROED (sizeof (ACPI_NS_DEVICE_ID_INDEX));
+    if (!Index)
+    {
+        return_ACPI_STATUS (AE_NO_MEMORY);
+    }
+
+    Status = AcpiUtAcquireSharedMutex (ACPI_MTX_NAMESPACE);
+    if (ACPI_FAILURE (Status))
+    {
+        ACPI_FREE (Index);
+        return_ACPI_STATUS (Status);
+    }
+
+    Index->Generation = AcpiGbl_DeviceIdGeneration;
+    Status = AcpiNsWalkNamespace (ACPI_TYPE_DEVICE, ACPI_ROOT_OBJECT,
+        ACPI_UINT32_MAX, ACPI_NS_WALK_UNLOCK | ACPI_NS_WALK_SHARED,
+        AcpiNsDeviceIdCallback, NULL, Index, NULL);
+
+    (void) AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
+    if (ACPI_FAILURE (Status))
+    {
+        goto ErrorExit;
+    }
+
+    /* Hash the entries, chaining them in namespace order */
+
+    Index->NumBuckets = ACPI_NS_DEVICE_ID_MIN_BUCKETS;
+    while (Index->NumBuckets < Index->Count)
+    {
+        Index->NumBuckets *= 2;
+    }
+
+    Index->Buckets = ACPI_ALLOCATE (Index->NumBuckets * sizeof (UINT32));
+    if (!Index->Buckets)
+    {
+        Status = AE_NO_MEMORY;
+        goto ErrorExit;
+    }
+
+    memset (Index->Buckets, 0xFF, Index->NumBuckets * sizeof (UINT32));
+
+    for (i = Index->Count; i > 0; i--)
+    {
+        Entry = &Index->Entries[i - 1];
+        Bucket = AcpiNsDeviceIdHash (Entry->Id) & (Index->NumBuckets - 1);
+
+        Entry->Next = Index->Buckets[Bucket];
+        Index->Buckets[Bucket] = i - 1;
+    }
+
+    ACPI_DEBUG_PRINT ((ACPI_DB_NAMES,
+        "Device ID index built: %u IDs, %u buckets\n",
+        Index->Count, Index->NumBuckets));
+
+    *ReturnIndex = Index;
+    return_ACPI_STATUS (AE_OK);
+
+ErrorExit:
+    AcpiNsFreeDeviceIds (Index);
+    return_ACPI_STATUS (Status);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsGetDeviceIdMatches
+ *
+ * PARAMETERS:  Id              - Hardware ID to look up
+ *              ReturnMatches   - Where the array of matches is returned.
+ *                                NULL if there are none, otherwise must be
+ *                                freed by the caller.
+ *              ReturnCount     - Where the number of matches is returned
+ *              ReturnGeneration - Where the AcpiGbl_DeviceIdGeneration of
+ *                                the matches is returned
+ *
+ * RETURN:      Status. AE_SUPPORT if the index is unavailable, in which case
+ *              the caller must fall back to walking the namespace.
+ *
+ * DESCRIPTION: Get the devices with a _HID or _CID of Id, in namespace
+ *              order. The index is (re)built first if it is out of date.
+ *              Must be called with the namespace read lock held and
+ *              ACPI_MTX_NAMESPACE not held. Only the Node and Level of
+ *              the returned entries are valid, and the nodes may only be
+ *              used while AcpiGbl_DeviceIdGeneration still equals
+ *              ReturnGeneration, since deleting a device changes it.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiNsGetDeviceIdMatches (
+    char                    *Id,
+    ACPI_NS_DEVICE_ID       **ReturnMatches,
+    UINT32                  *ReturnCount,
+    UINT32                  *ReturnGeneration)
+{
+    ACPI_NS_DEVICE_ID_INDEX *Index;
+    ACPI_NS_DEVICE_ID_INDEX *NewIndex = NULL;
+    ACPI_NS_DEVICE_ID       *Matches = NULL;
+    ACPI_NS_DEVICE_ID       *Entry;
+    ACPI_STATUS             Status;
+    UINT32                  First;
+    UINT32                  Count = 0;
+    UINT32                  i;
+
+
+    ACPI_FUNCTION_TRACE (NsGetDeviceIdMatches);
+
+
+    Status = AcpiUtAcquireMutex (ACPI_MTX_NAMESPACE);
+    if (ACPI_FAILURE (Status))
+    {
+        return_ACPI_STATUS (Status);
+    }
+
+    Index = AcpiGbl_DeviceIdIndex;
+    if (!Index || (Index->Generation != AcpiGbl_DeviceIdGeneration))
+    {
+        /* Only one thread builds at a time, others fall back to a walk */
+
+        if (AcpiGbl_DeviceIdIndexBuilding)
+        {
+            Status = AE_SUPPORT;
+            goto UnlockAndExit;
+        }
+
+        AcpiGbl_DeviceIdIndexBuilding = TRUE;
+        (void) AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
+
+        Status = AcpiNsBuildDeviceIds (&NewIndex);
+
+        (void) AcpiUtAcquireMutex (ACPI_MTX_NAMESPACE);
+        AcpiGbl_DeviceIdIndexBuilding = FALSE;
+
+        if (ACPI_FAILURE (Status))
+        {
+            Status = AE_SUPPORT;
+            goto UnlockAndExit;
+        }
+
+        /* Discard the new index if the namespace changed during the build */
+
+        if (NewIndex->Generation != AcpiGbl_DeviceIdGeneration)
+        {
+            AcpiNsFreeDeviceIds (NewIndex);
+            Status = AE_SUPPORT;
+            goto UnlockAndExit;
+        }
+
+        if (AcpiGbl_DeviceIdIndex)
+        {
+            AcpiNsFreeDeviceIds (AcpiGbl_DeviceIdIndex);
+        }
+
+        AcpiGbl_DeviceIdIndex = NewIndex;
+        Index = NewIndex;
+    }
+
+    /* Count the matches, then copy them out */
+
+    First = Index->Buckets[AcpiNsDeviceIdHash (Id) & (Index->NumBuckets - 1)];
+    for (i = First; i != ACPI_UINT32_MAX; i = Entry->Next)
+    {
+        Entry = &Index->Entries[i];
+        if (!strcmp (Entry->Id, Id))
+        {
+            Count++;
+        }
+    }
+
+    if (Count)
+    {
+        Matches = ACPI_ALLOCATE_ZEROED (Count * sizeof (ACPI_NS_DEVICE_ID));
+        if (!Matches)
+        {
+            Status = AE_NO_MEMORY;
+            goto UnlockAndExit;
+        }
+
+        Count = 0;
+        for (i = First; i != ACPI_UINT32_MAX; i = Entry->Next)
+        {
+            Entry = &Index->Entries[i];
+            if (!strcmp (Entry->Id, Id))
+            {
+                Matches[Count].Node = Entry->Node;
+                Matches[Count].Level = Entry->Level;
+                Count++;
+            }
+        }
+    }
+
+    *ReturnMatches = Matches;
+    *ReturnCount = Count;
+    *ReturnGeneration = Index->Generation;
+
+UnlockAndExit:
+    (void) AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
+    return_ACPI_STATUS (Status);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsInvalidateDeviceIds
+ *
+ * PARAMETERS:  None
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Mark the device ID index out of date. It is rebuilt on the
+ *              next lookup. The stale index is never used again, so this
+ *              may be called before the nodes it refers to are deleted.
+ *
+ ******************************************************************************/
+
+void
+AcpiNsInvalidateDeviceIds (
+    void)
+{
+
+    AcpiGbl_DeviceIdGeneration++;
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsDeleteDeviceIds
+ *
+ * PARAMETERS:  None
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Free the device ID index at namespace termination.
+ *
+ ******************************************************************************/
+
+void
+AcpiNsDeleteDeviceIds (
+    void)
+{
+
+    if (AcpiGbl_DeviceIdIndex)
+    {
+        AcpiNsFreeDeviceIds (AcpiGbl_DeviceIdIndex);
+        AcpiGbl_DeviceIdIndex = NULL;
+    }
+
+    AcpiGbl_DeviceIdGeneration++;
+}
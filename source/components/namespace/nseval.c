@@ -44,6 +44,7 @@
 #include "acpi.h"
 #include "accommon.h"
 #include "acparser.h"
+#include "acdispat.h"
 #include "acinterp.h"
 #include "acnamesp.h"
 
@@ -51,6 +52,17 @@
 #define _COMPONENT          ACPI_NAMESPACE
         ACPI_MODULE_NAME    ("nseval")
 
+/* Local prototypes */
+
+static ACPI_STATUS
+AcpiNsCheckEvaluationResult (
+    ACPI_EVALUATE_INFO      *Info,
+    ACPI_STATUS             Status);
+
+static void
+AcpiNsEndEvaluation (
+    ACPI_EVALUATE_INFO      *Info);
+
 
 /*******************************************************************************
  *
@@ -67,14 +79,16 @@
  *                  ParameterType   - Type of Parameter list
  *                  ReturnObject    - Where to put method's return value (if
  *                                    any). If NULL, no value is returned.
- *                  Flags           - ACPI_IGNORE_RETURN_VALUE to delete return
+ *                  Flags           - ACPI_IGNORE_RETURN_VALUE to delete return,
+ *                                    ACPI_INTERPRETER_LOCKED if the caller
+ *                                    has entered the interpreter
  *
  * RETURN:      Status
  *
  * DESCRIPTION: Execute a control method or return the current value of an
  *              ACPI namespace object.
  *
- * MUTEX:       Locks interpreter
+ * MUTEX:       Locks interpreter, unless ACPI_INTERPRETER_LOCKED is set
  *
  ******************************************************************************/
 
@@ -83,6 +97,7 @@ AcpiNsEvaluate (
     ACPI_EVALUATE_INFO      *Info)
 {
     ACPI_STATUS             Status;
+    BOOLEAN                 Cached;
 
 
     ACPI_FUNCTION_TRACE (NsEvaluate);
@@ -102,9 +117,20 @@ AcpiNsEvaluate (
          * 1) Null node, valid pathname from root (absolute path)
          * 2) Node and valid pathname (path relative to Node)
          * 3) Node, Null pathname
+         *
+         * A caller that has entered the interpreter already holds the
+         * namespace mutex.
          */
-        Status = AcpiNsGetNode (Info->PrefixNode, Info->RelativePathname,
-            ACPI_NS_NO_UPSEARCH, &Info->Node);
+        if (Info->Flags & ACPI_INTERPRETER_LOCKED)
+        {
+            Status = AcpiNsGetNodeUnlocked (Info->PrefixNode,
+                Info->RelativePathname, ACPI_NS_NO_UPSEARCH, &Info->Node);
+        }
+        else
+        {
+            Status = AcpiNsGetNode (Info->PrefixNode, Info->RelativePathname,
+                ACPI_NS_NO_UPSEARCH, &Info->Node);
+        }
         if (ACPI_FAILURE (Status))
         {
             return_ACPI_STATUS (Status);
@@ -137,12 +163,17 @@ AcpiNsEvaluate (
 
     /* Get the full pathname to the object, for use in warning messages */
 
-    Info->FullPathname = AcpiNsGetNormalizedPathname (Info->Node, TRUE);
+    Info->FullPathname = AcpiNsGetCachedPathname (Info->Node, &Cached);
     if (!Info->FullPathname)
     {
         return_ACPI_STATUS (AE_NO_MEMORY);
     }
 
+    if (Cached)
+    {
+        Info->Flags |= ACPI_FULL_PATHNAME_CACHED;
+    }
+
     /* Optional object evaluation log */
 
     ACPI_DEBUG_PRINT_RAW ((ACPI_DB_EVALUATION,
@@ -246,9 +277,36 @@ AcpiNsEvaluate (
          * Execute the method via the interpreter. The interpreter is locked
          * here before calling into the AML parser
          */
-        AcpiExEnterInterpreter ();
-        Status = AcpiPsExecuteMethod (Info);
-        AcpiExExitInterpreter ();
+        if (!(Info->Flags & ACPI_INTERPRETER_LOCKED))
+        {
+            AcpiExEnterInterpreter ();
+        }
+
+        /*
+         * Side-effect-free methods may have a remembered result, and hot
+         * methods may have native code
+         */
+        if (!AcpiDsMemoLookup (Info, &Status))
+        {
+            if (!AcpiDsJitExecute (Info, &Status))
+            {
+                Status = AcpiPsExecuteMethod (Info);
+            }
+
+            AcpiDsMemoInsert (Info, Status);
+        }
+
+        if (!(Info->Flags & ACPI_INTERPRETER_LOCKED))
+        {
+            AcpiExExitInterpreter ();
+        }
+
+        /* A cooperative evaluation slept, see AcpiNsResumeEvaluate */
+
+        if (Status == AE_CTRL_SUSPEND)
+        {
+            return_ACPI_STATUS (Status);
+        }
         break;
 
     default:
@@ -272,7 +330,10 @@ AcpiNsEvaluate (
          * resolution, we must lock it because we could access an OpRegion.
          * The OpRegion access code assumes that the interpreter is locked.
          */
-        AcpiExEnterInterpreter ();
+        if (!(Info->Flags & ACPI_INTERPRETER_LOCKED))
+        {
+            AcpiExEnterInterpreter ();
+        }
 
         /* TBD: ResolveNodeToValue has a strange interface, fix */
 
@@ -280,7 +341,11 @@ AcpiNsEvaluate (
 
         Status = AcpiExResolveNodeToValue (ACPI_CAST_INDIRECT_PTR (
             ACPI_NAMESPACE_NODE, &Info->ReturnObject), NULL);
-        AcpiExExitInterpreter ();
+
+        if (!(Info->Flags & ACPI_INTERPRETER_LOCKED))
+        {
+            AcpiExExitInterpreter ();
+        }
 
         if (ACPI_FAILURE (Status))
         {
@@ -296,6 +361,78 @@ AcpiNsEvaluate (
         break;
     }
 
+    Status = AcpiNsCheckEvaluationResult (Info, Status);
+
+Cleanup:
+    AcpiNsEndEvaluation (Info);
+    return_ACPI_STATUS (Status);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsResumeEvaluate
+ *
+ * PARAMETERS:  Info            - Evaluation info block for which
+ *                                AcpiNsEvaluate returned AE_CTRL_SUSPEND
+ *
+ * RETURN:      Status, as for AcpiNsEvaluate
+ *
+ * DESCRIPTION: Continue a suspended method evaluation of an
+ *              AcpiEvaluateObjectAsync request. May return AE_CTRL_SUSPEND
+ *              again, in which case the evaluation is still pending.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiNsResumeEvaluate (
+    ACPI_EVALUATE_INFO      *Info)
+{
+    ACPI_STATUS             Status;
+
+
+    ACPI_FUNCTION_TRACE (NsResumeEvaluate);
+
+
+    AcpiExEnterInterpreter ();
+    Status = AcpiPsResumeMethod (Info);
+    AcpiExExitInterpreter ();
+
+    if (Status == AE_CTRL_SUSPEND)
+    {
+        return_ACPI_STATUS (Status);
+    }
+
+    Status = AcpiNsCheckEvaluationResult (Info, Status);
+    AcpiNsEndEvaluation (Info);
+    return_ACPI_STATUS (Status);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsCheckEvaluationResult
+ *
+ * PARAMETERS:  Info            - Evaluation info block
+ *              Status          - Status of the evaluation
+ *
+ * RETURN:      Final status of the evaluation
+ *
+ * DESCRIPTION: Check and repair the return value of a predefined name and
+ *              map AE_CTRL_RETURN_VALUE to AE_OK. The return object is
+ *              deleted on failure or if the caller does not want it.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsCheckEvaluationResult (
+    ACPI_EVALUATE_INFO      *Info,
+    ACPI_STATUS             Status)
+{
+
+    ACPI_FUNCTION_TRACE (NsCheckEvaluationResult);
+
+
     /*
      * For predefined names, check the return value against the ACPI
      * specification. Some incorrect return value types are repaired.
@@ -334,7 +471,30 @@ AcpiNsEvaluate (
         "*** Completed evaluation of object %s ***\n",
         Info->RelativePathname));
 
-Cleanup:
+    return_ACPI_STATUS (Status);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsEndEvaluation
+ *
+ * PARAMETERS:  Info            - Evaluation info block
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Log the end of an evaluation and free the full pathname.
+ *
+ ******************************************************************************/
+
+static void
+AcpiNsEndEvaluation (
+    ACPI_EVALUATE_INFO      *Info)
+{
+
+    ACPI_FUNCTION_NAME (NsEndEvaluation);
+
+
     /* Optional object evaluation log */
 
     ACPI_DEBUG_PRINT_RAW ((ACPI_DB_EVALUATION,
@@ -345,7 +505,9 @@ Cleanup:
      * Namespace was unlocked by the handling AcpiNs* function, so we
      * just free the pathname and return
      */
-    ACPI_FREE (Info->FullPathname);
+    AcpiNsReleaseCachedPathname (Info->FullPathname,
+        (Info->Flags & ACPI_FULL_PATHNAME_CACHED) != 0);
+
+    Info->Flags &= ~ACPI_FULL_PATHNAME_CACHED;
     Info->FullPathname = NULL;
-    return_ACPI_STATUS (Status);
 }
@@ -0,0 +1,462 @@
+/*******************************************************************************
+ *
+ * Module Name: nsindex - Hashed child index for large namespace scopes
+ *
+ ******************************************************************************/
+
+/*
+ * Copyright (C) 2000 - 2023, Intel Corp.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions, and the following disclaimer,
+ *    without modification.
+ * 2. Redistributions in binary form must reproduce at minimum a disclaimer
+ *    substantially similar to the "NO WARRANTY" disclaimer below
+ *    ("Disclaimer") and any redistribution must be conditioned upon
+ *    including a substantially similar Disclaimer requirement for further
+ *    binary redistribution.
+ * 3. Neither the names of the above-listed copyright holders nor the names
+ *    of any contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * Alternatively, this software may be distributed under the terms of the
+ * GNU General Public License ("GPL") version 2 as published by the Free
+ * Software Foundation.
+ *
+ * NO WARRANTY
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGES.
+ */
+
+
+#include "acpi.h"
+#include "accommon.h"
+#include "acnamesp.h"
+
+
+#define _COMPONENT          ACPI_NAMESPACE
+        ACPI_MODULE_NAME    ("nsindex")
+
+/*
+ * Scopes with many children (for example, \_SB on large multi-socket
+ * servers) make the linear Child/Peer search in AcpiNsSearchOneScope
+ * expensive during table load and method execution. Once a scope reaches
+ * AcpiGbl_NamespaceIndexThreshold children, a small open-addressed hash
+ * table of its children is attached to the scope node. The Child/Peer list
+ * is still maintained and remains the authoritative list; if the index
+ * cannot be allocated or grown, the scope simply falls back to the linear
+ * search.
+ */
+#define ACPI_NS_INDEX_MIN_SIZE      32
+
+/* Local prototypes */
+
+static UINT32
+AcpiNsIndexHash (
+    UINT32                  Name,
+    UINT32                  Size);
+
+static ACPI_NS_CHILD_INDEX *
+AcpiNsIndexCreate (
+    ACPI_NAMESPACE_NODE     *ParentNode,
+    UINT32                  Size);
+
+static void
+AcpiNsIndexAdd (
+    ACPI_NS_CHILD_INDEX     *Index,
+    ACPI_NAMESPACE_NODE     *Node);
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsIndexHash
+ *
+ * PARAMETERS:  Name            - 4-character ACPI name
+ *              Size            - Size of the hash table (power of 2)
+ *
+ * RETURN:      Home slot for the name
+ *
+ * DESCRIPTION: Hash an ACPI name. ACPI names within a scope tend to differ
+ *              only in their last one or two characters, so mix all of the
+ *              bits before masking.
+ *
+ ******************************************************************************/
+
+static UINT32
+AcpiNsIndexHash (
+    UINT32                  Name,
+    UINT32                  Size)
+{
+    UINT32                  Hash;
+
+
+    Hash = Name * 0x9E3779B1;
+    Hash ^= (Hash >> 16);
+    return (Hash & (Size - 1));
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsIndexCreate
+ *
+ * PARAMETERS:  ParentNode      - Scope whose children are to be indexed
+ *              Size            - Number of hash table entries (power of 2)
+ *
+ * RETURN:      New index (NULL on allocation failure)
+ *
+ * DESCRIPTION: Allocate an index and enter all current children of the
+ *              scope, in Peer order. The hash table is allocated together
+ *              with the index header.
+ *
+ ******************************************************************************/
+
+static ACPI_NS_CHILD_INDEX *
+AcpiNsIndexCreate (
+    ACPI_NAMESPACE_NODE     *ParentNode,
+    UINT32                  Size)
+{
+    ACPI_NS_CHILD_INDEX     *Index;
+    ACPI_NAMESPACE_NODE     *ChildNode;
+
+
+    Index = ACPI_ALLOCATE_ZEROED (sizeof (ACPI_NS_CHILD_INDEX) +
+        ((ACPI_SIZE) Size * sizeof (ACPI_NAMESPACE_NODE *)));
+    if (!Index)
+    {
+        return (NULL);
+    }
+
+    Index->Size = Size;
+    Index->Table = ACPI_CAST_PTR (ACPI_NAMESPACE_NODE *, Index + 1);
+
+    ChildNode = ParentNode->Child;
+    while (ChildNode)
+    {
+        AcpiNsIndexAdd (Index, ChildNode);
+        Index->Tail = ChildNode;
+        ChildNode = ChildNode->Peer;
+    }
+
+    return (Index);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsIndexAdd
+ *
+ * PARAMETERS:  Index           - Index to update. Must have a free entry
+ *              Node            - Node to be entered
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Enter a node into the hash table. If a node with the same
+ *              name is already present, it precedes the new node in the
+ *              Peer list and is the one a linear search would find, so it
+ *              is kept and the new node is not entered.
+ *
+ ******************************************************************************/
+
+static void
+AcpiNsIndexAdd (
+    ACPI_NS_CHILD_INDEX     *Index,
+    ACPI_NAMESPACE_NODE     *Node)
+{
+    UINT32                  Slot;
+
+
+    Slot = AcpiNsIndexHash (Node->Name.Integer, Index->Size);
+    while (Index->Table[Slot])
+    {
+        if (Index->Table[Slot]->Name.Integer == Node->Name.Integer)
+        {
+            return;
+        }
+
+        Slot = (Slot + 1) & (Index->Size - 1);
+    }
+
+    Index->Table[Slot] = Node;
+    Index->Count++;
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsIndexBuild
+ *
+ * PARAMETERS:  ParentNode      - Scope to be indexed
+ *              ChildCount      - Current number of children of the scope
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Attach a hashed child index to a scope node. Called by
+ *              AcpiNsInstallNode when a scope reaches the index threshold.
+ *              Failure to allocate the index is not an error; lookups in
+ *              the scope continue to use the linear search.
+ *
+ * MUTEX:       Assumes namespace is locked.
+ *
+ ******************************************************************************/
+
+void
+AcpiNsIndexBuild (
+    ACPI_NAMESPACE_NODE     *ParentNode,
+    UINT32                  ChildCount)
+{
+    UINT32                  Size = ACPI_NS_INDEX_MIN_SIZE;
+
+
+    ACPI_FUNCTION_TRACE_PTR (NsIndexBuild, ParentNode);
+
+
+    if (ParentNode->ChildIndex)
+    {
+        return_VOID;
+    }
+
+    /* Keep the load factor at or below one half */
+
+    while (Size < (ChildCount * 2))
+    {
+        Size <<= 1;
+    }
+
+    ParentNode->ChildIndex = AcpiNsIndexCreate (ParentNode, Size);
+
+    ACPI_DEBUG_PRINT ((ACPI_DB_NAMES,
+        "Scope [%4.4s] %p: %u children, child index %p (%u entries)\n",
+        AcpiUtGetNodeName (ParentNode), ParentNode, ChildCount,
+        ParentNode->ChildIndex, Size));
+    return_VOID;
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsIndexInsert
+ *
+ * PARAMETERS:  ParentNode      - Indexed scope
+ *              Node            - Child that is linked into the scope
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Enter a new child into the index of its parent scope, growing
+ *              the hash table as necessary. If the table cannot be grown,
+ *              the index is discarded and the scope reverts to the linear
+ *              search.
+ *
+ * MUTEX:       Assumes namespace is locked.
+ *
+ ******************************************************************************/
+
+void
+AcpiNsIndexInsert (
+    ACPI_NAMESPACE_NODE     *ParentNode,
+    ACPI_NAMESPACE_NODE     *Node)
+{
+    ACPI_NS_CHILD_INDEX     *Index = ParentNode->ChildIndex;
+    ACPI_NS_CHILD_INDEX     *NewIndex;
+
+
+    if (!Index)
+    {
+        return;
+    }
+
+    if (((Index->Count + 1) * 2) > Index->Size)
+    {
+        /*
+         * Rebuild from the Peer list at twice the size. The new node is
+         * already linked, so it is entered by the rebuild.
+         */
+        NewIndex = AcpiNsIndexCreate (ParentNode, Index->Size * 2);
+        ACPI_FREE (Index);
+        ParentNode->ChildIndex = NewIndex;
+        return;
+    }
+
+    AcpiNsIndexAdd (Index, Node);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsIndexRemove
+ *
+ * PARAMETERS:  ParentNode      - Indexed scope
+ *              Node            - Child to be removed from the index
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Remove a child from the index of its parent scope. Uses
+ *              backward-shift deletion so that no tombstones are needed.
+ *              If another child has the same name, it becomes the indexed
+ *              node for that name. Node itself is never re-entered, whether
+ *              or not it is still linked into the Peer list.
+ *
+ * MUTEX:       Assumes namespace is locked.
+ *
+ ******************************************************************************/
+
+void
+AcpiNsIndexRemove (
+    ACPI_NAMESPACE_NODE     *ParentNode,
+    ACPI_NAMESPACE_NODE     *Node)
+{
+    ACPI_NS_CHILD_INDEX     *Index = ParentNode->ChildIndex;
+    ACPI_NAMESPACE_NODE     *ChildNode;
+    UINT32                  Mask;
+    UINT32                  Hole;
+    UINT32                  Slot;
+    UINT32                  Home;
+
+
+    if (!Index)
+    {
+        return;
+    }
+
+    Mask = Index->Size - 1;
+    Hole = AcpiNsIndexHash (Node->Name.Integer, Index->Size);
+    while (Index->Table[Hole] != Node)
+    {
+        if (!Index->Table[Hole])
+        {
+            /* Node is a duplicate name that was never entered */
+
+            return;
+        }
+
+        Hole = (Hole + 1) & Mask;
+    }
+
+    /*
+     * Close the hole: move back any later entry in the probe run whose
+     * home slot does not lie cyclically within (Hole, Slot].
+     */
+    Slot = Hole;
+    Index->Table[Hole] = NULL;
+    Index->Count--;
+
+    for (;;)
+    {
+        Slot = (Slot + 1) & Mask;
+        if (!Index->Table[Slot])
+        {
+            break;
+        }
+
+        Home = AcpiNsIndexHash (Index->Table[Slot]->Name.Integer,
+            Index->Size);
+
+        if ((Hole <= Slot) ?
+            ((Hole < Home) && (Home <= Slot)) :
+            ((Hole < Home) || (Home <= Slot)))
+        {
+            continue;
+        }
+
+        Index->Table[Hole] = Index->Table[Slot];
+        Index->Table[Slot] = NULL;
+        Hole = Slot;
+    }
+
+    /* Promote the next child with the same name, if any */
+
+    ChildNode = ParentNode->Child;
+    while (ChildNode)
+    {
+        if ((ChildNode != Node) &&
+            (ChildNode->Name.Integer == Node->Name.Integer))
+        {
+            AcpiNsIndexAdd (Index, ChildNode);
+            break;
+        }
+
+        ChildNode = ChildNode->Peer;
+    }
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsIndexLookup
+ *
+ * PARAMETERS:  ParentNode      - Indexed scope
+ *              TargetName      - 4-character ACPI name to find
+ *
+ * RETURN:      The first child of the scope with a matching name, or NULL
+ *
+ * DESCRIPTION: Find a child of an indexed scope by name.
+ *
+ * MUTEX:       Assumes namespace is locked.
+ *
+ ******************************************************************************/
+
+ACPI_NAMESPACE_NODE *
+AcpiNsIndexLookup (
+    ACPI_NAMESPACE_NODE     *ParentNode,
+    UINT32                  TargetName)
+{
+    ACPI_NS_CHILD_INDEX     *Index = ParentNode->ChildIndex;
+    ACPI_NAMESPACE_NODE     *Node;
+    UINT32                  Slot;
+
+
+    Slot = AcpiNsIndexHash (TargetName, Index->Size);
+    while ((Node = Index->Table[Slot]) != NULL)
+    {
+        if (Node->Name.Integer == TargetName)
+        {
+            return (Node);
+        }
+
+        Slot = (Slot + 1) & (Index->Size - 1);
+    }
+
+    return (NULL);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsIndexDelete
+ *
+ * PARAMETERS:  ParentNode      - Scope whose index is to be deleted
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Free the child index of a scope, if any. Called when all
+ *              children of the scope are deleted, and when the scope node
+ *              itself is deleted.
+ *
+ * MUTEX:       Assumes namespace is locked.
+ *
+ ******************************************************************************/
+
+void
+AcpiNsIndexDelete (
+    ACPI_NAMESPACE_NODE     *ParentNode)
+{
+
+    if (ParentNode->ChildIndex)
+    {
+        ACPI_FREE (ParentNode->ChildIndex);
+        ParentNode->ChildIndex = NULL;
+    }
+}
@@ -84,6 +84,7 @@ AcpiNsLoadTable (
     ACPI_NAMESPACE_NODE     *Node)
 {
     ACPI_STATUS             Status;
+    ACPI_NS_ARENA           Arena;
 
 
     ACPI_FUNCTION_TRACE (NsLoadTable);
@@ -114,11 +115,19 @@ AcpiNsLoadTable (
      * if a control method makes a forward reference (call)
      * to another control method, we can't continue parsing
      * because we don't know how many arguments to parse next!
+     *
+     * Nodes created by the table are allocated contiguously from
+     * a per-owner arena if enabled (see nsarena.c).
      */
+    AcpiNsArenaBegin (&Arena,
+        AcpiGbl_RootTableList.Tables[TableIndex].OwnerId);
+
     Status = AcpiNsParseTable (TableIndex, Node);
+    AcpiNsArenaEnd (&Arena);
     if (ACPI_SUCCESS (Status))
     {
         AcpiTbSetTableLoadedFlag (TableIndex, TRUE);
+        AcpiNsInvalidateDeviceIds ();
     }
     else
     {
@@ -50,6 +50,11 @@
 #define _COMPONENT          ACPI_NAMESPACE
         ACPI_MODULE_NAME    ("nsnames")
 
+/* Cached pathname header, from the Node->Pathname string that it holds */
+
+#define ACPI_GET_CACHED_PATHNAME(p) \
+    ACPI_SUB_PTR (ACPI_CACHED_PATHNAME, (p), ACPI_OFFSET (ACPI_CACHED_PATHNAME, Pathname))
+
 
 /*******************************************************************************
  *
@@ -192,6 +197,7 @@ AcpiNsHandleToPathname (
     ACPI_STATUS             Status;
     ACPI_NAMESPACE_NODE     *Node;
     ACPI_SIZE               RequiredSize;
+    char                    *Pathname = NULL;
 
 
     ACPI_FUNCTION_TRACE_PTR (NsHandleToPathname, TargetHandle);
@@ -205,10 +211,22 @@ AcpiNsHandleToPathname (
 
     /* Determine size required for the caller buffer */
 
-    RequiredSize = AcpiNsBuildNormalizedPath (Node, NULL, 0, NoTrailing);
-    if (!RequiredSize)
+    if (NoTrailing)
     {
-        return_ACPI_STATUS (AE_BAD_PARAMETER);
+        Pathname = Node->Pathname;
+    }
+
+    if (Pathname)
+    {
+        RequiredSize = strlen (Pathname) + 1;
+    }
+    else
+    {
+        RequiredSize = AcpiNsBuildNormalizedPath (Node, NULL, 0, NoTrailing);
+        if (!RequiredSize)
+        {
+            return_ACPI_STATUS (AE_BAD_PARAMETER);
+        }
     }
 
     /* Validate/Allocate/Clear caller buffer */
@@ -219,10 +237,17 @@ AcpiNsHandleToPathname (
         return_ACPI_STATUS (Status);
     }
 
-    /* Build the path in the caller buffer */
+    /* Copy the cached pathname or build the path in the caller buffer */
 
-    (void) AcpiNsBuildNormalizedPath (Node, Buffer->Pointer,
-        (UINT32) RequiredSize, NoTrailing);
+    if (Pathname)
+    {
+        memcpy (Buffer->Pointer, Pathname, RequiredSize);
+    }
+    else
+    {
+        (void) AcpiNsBuildNormalizedPath (Node, Buffer->Pointer,
+            (UINT32) RequiredSize, NoTrailing);
+    }
 
     ACPI_DEBUG_PRINT ((ACPI_DB_EXEC, "%s [%X]\n",
         (char *) Buffer->Pointer, (UINT32) RequiredSize));
@@ -375,6 +400,19 @@ AcpiNsGetNormalizedPathname (
     ACPI_FUNCTION_TRACE_PTR (NsGetNormalizedPathname, Node);
 
 
+    /* A cached pathname can simply be copied, no need to walk the parents */
+
+    if (NoTrailing && Node && Node->Pathname)
+    {
+        Size = strlen (Node->Pathname) + 1;
+        NameBuffer = ACPI_ALLOCATE (Size);
+        if (NameBuffer)
+        {
+            memcpy (NameBuffer, Node->Pathname, Size);
+        }
+        return_PTR (NameBuffer);
+    }
+
     /* Calculate required buffer size based on depth below root */
 
     Size = AcpiNsBuildNormalizedPath (Node, NULL, 0, NoTrailing);
@@ -404,6 +442,267 @@ AcpiNsGetNormalizedPathname (
 }
 
 
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsBuildCachedPathname
+ *
+ * PARAMETERS:  Node            - Namespace node whose pathname is needed.
+ *                                The parent must be the root or must have
+ *                                a cached pathname.
+ *
+ * RETURN:      TRUE if the pathname was built and attached to the node
+ *
+ * DESCRIPTION: Build the normalized pathname of a node by appending its
+ *              trimmed name segment to the cached pathname of its parent.
+ *              The new string starts with the one reference held by the
+ *              node. Caller must hold ACPI_MTX_CACHES.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiNsBuildCachedPathname (
+    ACPI_NAMESPACE_NODE     *Node)
+{
+    ACPI_NAMESPACE_NODE     *Parent = Node->Parent;
+    ACPI_CACHED_PATHNAME    *Cache;
+    char                    Name[ACPI_NAMESEG_SIZE];
+    char                    *Path;
+    ACPI_SIZE               PrefixLength = 0;
+    UINT32                  SegLength = ACPI_NAMESEG_SIZE;
+
+
+    if (Parent && (Parent != AcpiGbl_RootNode))
+    {
+        PrefixLength = strlen (Parent->Pathname);
+    }
+
+    /* Remove trailing underscores, as AcpiNsBuildNormalizedPath does */
+
+    ACPI_MOVE_32_TO_32 (Name, &Node->Name);
+    while (SegLength && (Name[SegLength - 1] == '_'))
+    {
+        SegLength--;
+    }
+
+    /* Root prefix or parent pathname and a dot, segment, null terminator */
+
+    Cache = ACPI_ALLOCATE (ACPI_OFFSET (ACPI_CACHED_PATHNAME, Pathname) +
+        (PrefixLength ? PrefixLength + 1 : 1) + SegLength + 1);
+    if (!Cache)
+    {
+        return (FALSE);
+    }
+
+    Cache->ReferenceCount = 1;
+    Path = Cache->Pathname;
+    if (PrefixLength)
+    {
+        memcpy (Path, Parent->Pathname, PrefixLength);
+        Path += PrefixLength;
+        *Path++ = AML_DUAL_NAME_PREFIX;
+    }
+    else
+    {
+        *Path++ = AML_ROOT_PREFIX;
+    }
+
+    memcpy (Path, Name, SegLength);
+    Path[SegLength] = 0;
+
+    Node->Pathname = Cache->Pathname;
+    return (TRUE);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsGetCachedPathname
+ *
+ * PARAMETERS:  Node            - Namespace node whose pathname is needed
+ *              Cached          - Where the pathname ownership is returned
+ *
+ * RETURN:      Pointer to the normalized pathname of the node (trailing '_'
+ *              removed from each name segment), NULL on failure
+ *
+ * DESCRIPTION: Get the normalized pathname of a node from the pathname cache
+ *              (AcpiGbl_EnablePathnameCache). On a miss, the pathnames of the
+ *              node and of any uncached parents are built from the nearest
+ *              cached parent pathname and attached to those nodes, so that
+ *              each prefix is built only once.
+ *
+ *              If *Cached is returned TRUE, the pathname is shared with the
+ *              node and the caller holds a reference to it, which keeps it
+ *              valid even if the node is deleted in the meantime. Otherwise
+ *              the cache is disabled or could not be filled, and a new
+ *              buffer is returned. Either way, the caller must pass the
+ *              pathname to AcpiNsReleaseCachedPathname when done.
+ *
+ ******************************************************************************/
+
+char *
+AcpiNsGetCachedPathname (
+    ACPI_NAMESPACE_NODE     *Node,
+    BOOLEAN                 *Cached)
+{
+    ACPI_NAMESPACE_NODE     *NextNode;
+    char                    *Pathname;
+    ACPI_STATUS             Status;
+
+
+    ACPI_FUNCTION_TRACE_PTR (NsGetCachedPathname, Node);
+
+
+    *Cached = FALSE;
+    if (!AcpiGbl_EnablePathnameCache ||
+        !Node || (Node == AcpiGbl_RootNode))
+    {
+        return_PTR (AcpiNsGetNormalizedPathname (Node, TRUE));
+    }
+
+    Status = AcpiUtAcquireMutex (ACPI_MTX_CACHES);
+    if (ACPI_FAILURE (Status))
+    {
+        return_PTR (AcpiNsGetNormalizedPathname (Node, TRUE));
+    }
+
+    /*
+     * Fill the cache from the top down. Each pass builds the pathname of
+     * the highest uncached node on the path to the root, whose parent is
+     * either the root or already cached.
+     */
+    while (!Node->Pathname)
+    {
+        NextNode = Node;
+        while (NextNode->Parent &&
+            (NextNode->Parent != AcpiGbl_RootNode) &&
+            !NextNode->Parent->Pathname)
+        {
+            NextNode = NextNode->Parent;
+        }
+
+        if (!AcpiNsBuildCachedPathname (NextNode))
+        {
+            break;
+        }
+    }
+
+    Pathname = Node->Pathname;
+    if (Pathname)
+    {
+        ACPI_GET_CACHED_PATHNAME (Pathname)->ReferenceCount++;
+    }
+
+    (void) AcpiUtReleaseMutex (ACPI_MTX_CACHES);
+
+    if (!Pathname)
+    {
+        return_PTR (AcpiNsGetNormalizedPathname (Node, TRUE));
+    }
+
+    ACPI_DEBUG_PRINT_RAW ((ACPI_DB_NAMES, "%s: Path \"%s\"\n",
+        ACPI_GET_FUNCTION_NAME, Pathname));
+
+    *Cached = TRUE;
+    return_PTR (Pathname);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsReleaseCachedPathname
+ *
+ * PARAMETERS:  Pathname        - Pathname from AcpiNsGetCachedPathname
+ *              Cached          - Ownership returned with the pathname
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Release a pathname obtained from AcpiNsGetCachedPathname. A
+ *              private buffer is freed. A cached pathname loses one
+ *              reference, and is freed if the node has been deleted and
+ *              this was the last user.
+ *
+ ******************************************************************************/
+
+void
+AcpiNsReleaseCachedPathname (
+    char                    *Pathname,
+    BOOLEAN                 Cached)
+{
+    ACPI_CACHED_PATHNAME    *Cache;
+    ACPI_STATUS             Status;
+
+
+    if (!Cached)
+    {
+        ACPI_FREE (Pathname);
+        return;
+    }
+
+    Status = AcpiUtAcquireMutex (ACPI_MTX_CACHES);
+    if (ACPI_FAILURE (Status))
+    {
+        return;
+    }
+
+    Cache = ACPI_GET_CACHED_PATHNAME (Pathname);
+    Cache->ReferenceCount--;
+    if (!Cache->ReferenceCount)
+    {
+        ACPI_FREE (Cache);
+    }
+
+    (void) AcpiUtReleaseMutex (ACPI_MTX_CACHES);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsDeleteCachedPathname
+ *
+ * PARAMETERS:  Node            - Namespace node being deleted
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Drop the reference of a node to its cached pathname. Called
+ *              when the node is deleted, so cached pathnames go away with
+ *              the table (owner) that created the node. A pathname still
+ *              in use by a running evaluation is freed by the last
+ *              AcpiNsReleaseCachedPathname instead.
+ *
+ ******************************************************************************/
+
+void
+AcpiNsDeleteCachedPathname (
+    ACPI_NAMESPACE_NODE     *Node)
+{
+    ACPI_CACHED_PATHNAME    *Cache;
+    ACPI_STATUS             Status;
+
+
+    if (!Node->Pathname)
+    {
+        return;
+    }
+
+    Status = AcpiUtAcquireMutex (ACPI_MTX_CACHES);
+    if (ACPI_FAILURE (Status))
+    {
+        return;
+    }
+
+    Cache = ACPI_GET_CACHED_PATHNAME (Node->Pathname);
+    Node->Pathname = NULL;
+
+    Cache->ReferenceCount--;
+    if (!Cache->ReferenceCount)
+    {
+        ACPI_FREE (Cache);
+    }
+
+    (void) AcpiUtReleaseMutex (ACPI_MTX_CACHES);
+}
+
+
 /*******************************************************************************
  *
  * FUNCTION:    AcpiNsBuildPrefixedPathname
@@ -81,6 +81,7 @@ AcpiNsAttachObject (
     ACPI_OPERAND_OBJECT     *ObjDesc;
     ACPI_OPERAND_OBJECT     *LastObjDesc;
     ACPI_OBJECT_TYPE        ObjectType = ACPI_TYPE_ANY;
+    ACPI_STATUS             Status;
 
 
     ACPI_FUNCTION_TRACE (NsAttachObject);
@@ -165,6 +166,36 @@ AcpiNsAttachObject (
     ACPI_DEBUG_PRINT ((ACPI_DB_EXEC, "Installing %p into Node %p [%4.4s]\n",
         ObjDesc, Node, AcpiUtGetNodeName (Node)));
 
+    if (ObjDesc)
+    {
+        /*
+         * Must increment the new value's reference count
+         * (if it is an internal object)
+         */
+        AcpiUtAddReference (ObjDesc);
+
+        /*
+         * An intermediate Integer lives in the walk arena of the executing
+         * method, attach a heap copy that can outlive the method instead
+         */
+        Status = AcpiUtArenaPromoteObject (&ObjDesc);
+        if (ACPI_FAILURE (Status))
+        {
+            AcpiUtRemoveReference (ObjDesc);
+            return_ACPI_STATUS (Status);
+        }
+    }
+
+    /*
+     * The value of the node changes. A change of its type also changes
+     * what AML that uses the name does, see dsmemo.c
+     */
+    AcpiGbl_NsDataGeneration++;
+    if ((Node->Type != ACPI_TYPE_ANY) && (Node->Type != ObjectType))
+    {
+        AcpiGbl_NsGeneration++;
+    }
+
     /* Detach an existing attached object if present */
 
     if (Node->Object)
@@ -174,12 +205,6 @@ AcpiNsAttachObject (
 
     if (ObjDesc)
     {
-        /*
-         * Must increment the new value's reference count
-         * (if it is an internal object)
-         */
-        AcpiUtAddReference (ObjDesc);
-
         /*
          * Handle objects with multiple descriptors - walk
          * to the end of the descriptor list
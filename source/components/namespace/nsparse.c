@@ -89,6 +89,7 @@ AcpiNsExecuteTable (
     UINT32                  AmlLength;
     UINT8                   *AmlStart;
     ACPI_OPERAND_OBJECT     *MethodObj = NULL;
+    BOOLEAN                 Cached;
 
 
     ACPI_FUNCTION_TRACE (NsExecuteTable);
@@ -146,13 +147,18 @@ AcpiNsExecuteTable (
     Info->Node = StartNode;
     Info->ObjDesc = MethodObj;
     Info->NodeFlags = Info->Node->Flags;
-    Info->FullPathname = AcpiNsGetNormalizedPathname (Info->Node, TRUE);
+    Info->FullPathname = AcpiNsGetCachedPathname (Info->Node, &Cached);
     if (!Info->FullPathname)
     {
         Status = AE_NO_MEMORY;
         goto Cleanup;
     }
 
+    if (Cached)
+    {
+        Info->Flags |= ACPI_FULL_PATHNAME_CACHED;
+    }
+
     /* Optional object evaluation log */
 
     ACPI_DEBUG_PRINT_RAW ((ACPI_DB_EVALUATION,
@@ -168,7 +174,11 @@ AcpiNsExecuteTable (
 Cleanup:
     if (Info)
     {
-        ACPI_FREE (Info->FullPathname);
+        if (Info->FullPathname)
+        {
+            AcpiNsReleaseCachedPathname (Info->FullPathname,
+                (Info->Flags & ACPI_FULL_PATHNAME_CACHED) != 0);
+        }
         Info->FullPathname = NULL;
     }
     ACPI_FREE (Info);
@@ -182,6 +182,16 @@ AcpiNsCheckReturnValue (
      */
     if ((*ReturnObjectPtr)->Common.Type == ACPI_TYPE_PACKAGE)
     {
+        /*
+         * Repairs modify the package in place, it must not share its
+         * elements copy-on-write with another package
+         */
+        Status = AcpiUtUnshareObject (*ReturnObjectPtr);
+        if (ACPI_FAILURE (Status))
+        {
+            goto Exit;
+        }
+
         Info->ParentPackage = *ReturnObjectPtr;
         Status = AcpiNsCheckPackage (Info, ReturnObjectPtr);
         if (ACPI_FAILURE (Status))
@@ -461,6 +461,16 @@ AcpiNsCheckPackageList (
             return (Status);
         }
 
+        /* The subpackage may be repaired in place, make it private */
+
+        Status = AcpiUtUnshareObject (SubPackage);
+        if (ACPI_FAILURE (Status))
+        {
+            return (Status);
+        }
+
+        SubElements = SubPackage->Package.Elements;
+
         /* Examine the different types of expected subpackages */
 
         Info->ParentPackage = SubPackage;
@@ -0,0 +1,720 @@
+/*******************************************************************************
+ *
+ * Module Name: nspwalk - Parallel namespace walk
+ *
+ ******************************************************************************/
+
+/*
+ * Copyright (C) 2000 - 2023, Intel Corp.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions, and the following disclaimer,
+ *    without modification.
+ * 2. Redistributions in binary form must reproduce at minimum a disclaimer
+ *    substantially similar to the "NO WARRANTY" disclaimer below
+ *    ("Disclaimer") and any redistribution must be conditioned upon
+ *    including a substantially similar Disclaimer requirement for further
+ *    binary redistribution.
+ * 3. Neither the names of the above-listed copyright holders nor the names
+ *    of any contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * Alternatively, this software may be distributed under the terms of the
+ * GNU General Public License ("GPL") version 2 as published by the Free
+ * Software Foundation.
+ *
+ * NO WARRANTY
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGES.
+ */
+
+
+#include "acpi.h"
+#include "accommon.h"
+#include "acnamesp.h"
+
+
+#define _COMPONENT          ACPI_NAMESPACE
+        ACPI_MODULE_NAME    ("nspwalk")
+
+/*
+ * A parallel walk splits the namespace below the start node into tasks, in
+ * namespace (pre-)order. Every node at the split depth becomes a "subtree"
+ * task: the node plus everything below it, walked by a single worker with
+ * AcpiNsWalkNamespace. Nodes above the split depth are visited one at a time
+ * by the calling thread before the workers start, so that AE_CTRL_DEPTH
+ * from the callback can still prune the tasks below them.
+ *
+ * Subtree tasks are dealt out to the workers in contiguous ranges. A worker
+ * takes tasks from the head of its own range and, once that is exhausted,
+ * steals from the tail of the busiest other worker. The calling thread acts
+ * as worker 0; the others are started with AcpiOsExecute. A worker that the
+ * host fails to start simply has its whole range stolen.
+ *
+ * Each task has its own ReturnValue slot. Once all workers are done, the
+ * merge handler is called for each task that produced a result, in task
+ * order. The merged output is therefore the same no matter how the tasks
+ * were scheduled.
+ *
+ * The caller holds the namespace read lock (AcpiGbl_NamespaceRwLock) for
+ * the whole walk, so no node can be deleted by a table unload. The workers
+ * hold ACPI_MTX_NAMESPACE shared, so that they walk their subtrees at the
+ * same time, and as with AcpiWalkNamespace release it around each callback.
+ */
+
+/* Local prototypes */
+
+static ACPI_STATUS
+AcpiNsParallelCountCallback (
+    ACPI_HANDLE             ObjHandle,
+    UINT32                  NestingLevel,
+    void                    *Context,
+    void                    **ReturnValue);
+
+static ACPI_STATUS
+AcpiNsParallelCollectCallback (
+    ACPI_HANDLE             ObjHandle,
+    UINT32                  NestingLevel,
+    void                    *Context,
+    void                    **ReturnValue);
+
+static ACPI_STATUS
+AcpiNsParallelWalkCallback (
+    ACPI_HANDLE             ObjHandle,
+    UINT32                  NestingLevel,
+    void                    *Context,
+    void                    **ReturnValue);
+
+static ACPI_STATUS
+AcpiNsParallelInvoke (
+    ACPI_NS_WALK_WORKER     *Worker,
+    ACPI_NS_WALK_TASK       *Task,
+    ACPI_NAMESPACE_NODE     *Node,
+    UINT32                  Level);
+
+static void
+AcpiNsParallelRunTask (
+    ACPI_NS_WALK_WORKER     *Worker,
+    ACPI_NS_WALK_TASK       *Task);
+
+static BOOLEAN
+AcpiNsParallelGetTask (
+    ACPI_NS_WALK_WORKER     *Worker,
+    UINT32                  *QueueIndex);
+
+static void
+AcpiNsParallelWorkerLoop (
+    ACPI_NS_WALK_WORKER     *Worker);
+
+static void ACPI_SYSTEM_XFACE
+AcpiNsParallelWorker (
+    void                    *Context);
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsParallelCountCallback
+ *
+ * PARAMETERS:  ACPI_WALK_CALLBACK
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Count the nodes at each level, used to pick the split depth.
+ *              Context is an array of ACPI_NS_PARALLEL_SPLIT_DEPTH + 1
+ *              counters.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsParallelCountCallback (
+    ACPI_HANDLE             ObjHandle,
+    UINT32                  NestingLevel,
+    void                    *Context,
+    void                    **ReturnValue)
+{
+    UINT32                  *LevelCount = Context;
+
+
+    LevelCount[NestingLevel]++;
+    return (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsParallelCollectCallback
+ *
+ * PARAMETERS:  ACPI_WALK_CALLBACK
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Append one node to the task list. Nodes at the split depth
+ *              become subtree tasks.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsParallelCollectCallback (
+    ACPI_HANDLE             ObjHandle,
+    UINT32                  NestingLevel,
+    void                    *Context,
+    void                    **ReturnValue)
+{
+    ACPI_NS_PARALLEL_WALK   *Walk = Context;
+    ACPI_NS_WALK_TASK       *Task;
+
+
+    if (Walk->NumTasks >= Walk->MaxTasks)
+    {
+        return (AE_CTRL_TERMINATE);
+    }
+
+    Task = &Walk->Tasks[Walk->NumTasks];
+    Walk->NumTasks++;
+
+    Task->Node = ObjHandle;
+    Task->Level = NestingLevel;
+    Task->Subtree = (NestingLevel == Walk->SplitDepth);
+    return (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsParallelInvoke
+ *
+ * PARAMETERS:  Worker          - Worker doing the call
+ *              Task            - Task the node belongs to
+ *              Node            - Node to pass to the user function
+ *              Level           - Nesting level relative to the start node
+ *
+ * RETURN:      Status from the user function
+ *
+ * DESCRIPTION: Invoke the user function for one node, with the worker's
+ *              context and the task's result slot. Called with the
+ *              namespace unlocked.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsParallelInvoke (
+    ACPI_NS_WALK_WORKER     *Worker,
+    ACPI_NS_WALK_TASK       *Task,
+    ACPI_NAMESPACE_NODE     *Node,
+    UINT32                  Level)
+{
+    ACPI_NS_PARALLEL_WALK   *Walk = Worker->Walk;
+    ACPI_STATUS             Status;
+
+
+    if (Walk->Abort)
+    {
+        return (AE_CTRL_TERMINATE);
+    }
+
+    if ((Walk->Type != ACPI_TYPE_ANY) &&
+        (Node->Type != Walk->Type))
+    {
+        return (AE_OK);
+    }
+
+    Status = Walk->UserFunction (Node, Level, Worker->Context, &Task->Result);
+    if (Status == AE_CTRL_TERMINATE)
+    {
+        Walk->Abort = TRUE;
+    }
+
+    return (Status);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsParallelWalkCallback
+ *
+ * PARAMETERS:  ACPI_WALK_CALLBACK
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: AcpiNsWalkNamespace callback for the nodes below a subtree
+ *              task. Converts the nesting level back to one relative to the
+ *              start of the parallel walk.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsParallelWalkCallback (
+    ACPI_HANDLE             ObjHandle,
+    UINT32                  NestingLevel,
+    void                    *Context,
+    void                    **ReturnValue)
+{
+    ACPI_NS_WALK_FRAME      *Frame = Context;
+
+
+    return (AcpiNsParallelInvoke (Frame->Worker, Frame->Task,
+        ObjHandle, Frame->Task->Level + NestingLevel));
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsParallelRunTask
+ *
+ * PARAMETERS:  Worker          - Worker running the task
+ *              Task            - Subtree task to run
+ *
+ * RETURN:      None. Task->Status is set.
+ *
+ * DESCRIPTION: Visit a subtree task's node and then walk everything below
+ *              it, down to the walk's MaxDepth.
+ *
+ ******************************************************************************/
+
+static void
+AcpiNsParallelRunTask (
+    ACPI_NS_WALK_WORKER     *Worker,
+    ACPI_NS_WALK_TASK       *Task)
+{
+    ACPI_NS_PARALLEL_WALK   *Walk = Worker->Walk;
+    ACPI_NS_WALK_FRAME      Frame;
+    ACPI_STATUS             Status;
+
+
+    Task->Started = TRUE;
+
+    Status = AcpiNsParallelInvoke (Worker, Task, Task->Node, Task->Level);
+    if ((Status == AE_OK) && (Task->Level < Walk->MaxDepth))
+    {
+        Frame.Worker = Worker;
+        Frame.Task = Task;
+
+        Status = AcpiUtAcquireSharedMutex (ACPI_MTX_NAMESPACE);
+        if (ACPI_SUCCESS (Status))
+        {
+            Status = AcpiNsWalkNamespace (Walk->Type, Task->Node,
+                Walk->MaxDepth - Task->Level,
+                ACPI_NS_WALK_UNLOCK | ACPI_NS_WALK_SHARED,
+                AcpiNsParallelWalkCallback, NULL, &Frame, &Task->Result);
+
+            (void) AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
+        }
+    }
+
+    if (Status == AE_CTRL_DEPTH)
+    {
+        Status = AE_OK;
+    }
+    else if (ACPI_FAILURE (Status) && (Status != AE_CTRL_TERMINATE))
+    {
+        Walk->Abort = TRUE;
+    }
+
+    Task->Status = Status;
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsParallelGetTask
+ *
+ * PARAMETERS:  Worker          - Worker looking for work
+ *              QueueIndex      - Where the queue index is returned
+ *
+ * RETURN:      TRUE if a task was found
+ *
+ * DESCRIPTION: Take the next task from the head of the worker's own range,
+ *              or steal one from the tail of the worker with the most
+ *              remaining tasks.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiNsParallelGetTask (
+    ACPI_NS_WALK_WORKER     *Worker,
+    UINT32                  *QueueIndex)
+{
+    ACPI_NS_PARALLEL_WALK   *Walk = Worker->Walk;
+    ACPI_NS_WALK_WORKER     *Victim = NULL;
+    ACPI_CPU_FLAGS          LockFlags;
+    BOOLEAN                 Found = FALSE;
+    UINT32                  Remaining = 0;
+    UINT32                  i;
+
+
+    LockFlags = AcpiOsAcquireLock (Walk->Lock);
+    if (Walk->Abort)
+    {
+        goto Exit;
+    }
+
+    if (Worker->Head < Worker->Tail)
+    {
+        *QueueIndex = Worker->Head;
+        Worker->Head++;
+        Found = TRUE;
+        goto Exit;
+    }
+
+    for (i = 0; i < Walk->NumWorkers; i++)
+    {
+        if ((Walk->Workers[i].Tail - Walk->Workers[i].Head) > Remaining)
+        {
+            Victim = &Walk->Workers[i];
+            Remaining = Victim->Tail - Victim->Head;
+        }
+    }
+
+    if (Victim)
+    {
+        Victim->Tail--;
+        *QueueIndex = Victim->Tail;
+        Worker->Steals++;
+        Found = TRUE;
+    }
+
+Exit:
+    AcpiOsReleaseLock (Walk->Lock, LockFlags);
+    return (Found);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsParallelWorkerLoop
+ *
+ * PARAMETERS:  Worker          - Worker to run
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Run subtree tasks until there are none left anywhere.
+ *
+ ******************************************************************************/
+
+static void
+AcpiNsParallelWorkerLoop (
+    ACPI_NS_WALK_WORKER     *Worker)
+{
+    ACPI_NS_PARALLEL_WALK   *Walk = Worker->Walk;
+    UINT32                  QueueIndex;
+
+
+    while (AcpiNsParallelGetTask (Worker, &QueueIndex))
+    {
+        AcpiNsParallelRunTask (Worker,
+            &Walk->Tasks[Walk->Queue[QueueIndex]]);
+    }
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsParallelWorker
+ *
+ * PARAMETERS:  Context         - Worker to run
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Entry point for the helper workers started with
+ *              AcpiOsExecute.
+ *
+ ******************************************************************************/
+
+static void ACPI_SYSTEM_XFACE
+AcpiNsParallelWorker (
+    void                    *Context)
+{
+    ACPI_NS_WALK_WORKER     *Worker = Context;
+
+
+    AcpiNsParallelWorkerLoop (Worker);
+    (void) AcpiOsSignalSemaphore (Worker->Walk->Done, 1);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsWalkNamespaceParallel
+ *
+ * PARAMETERS:  Type                - ACPI_OBJECT_TYPE to search for
+ *              StartNode           - Node where the walk begins
+ *              MaxDepth            - Depth to which the walk is to reach
+ *              NumWorkers          - Number of workers, including the
+ *                                    calling thread
+ *              UserFunction        - Called for each node of "Type"
+ *              WorkerContexts      - Optional array of NumWorkers contexts,
+ *                                    one is passed to each worker's calls
+ *              MergeHandler        - Optional, called in namespace order for
+ *                                    each task result
+ *              MergeContext        - Passed to MergeHandler
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Descending-only namespace walk, with the user function
+ *              called from up to NumWorkers threads at once. The
+ *              ReturnValue passed to the user function is a per-task
+ *              result slot (initially NULL); every non-NULL result is
+ *              handed to MergeHandler in deterministic order once all
+ *              workers have finished, including after an early
+ *              termination or error.
+ *
+ *              Must be called with the namespace read lock held and
+ *              ACPI_MTX_NAMESPACE not held.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiNsWalkNamespaceParallel (
+    ACPI_OBJECT_TYPE        Type,
+    ACPI_NAMESPACE_NODE     *StartNode,
+    UINT32                  MaxDepth,
+    UINT32                  NumWorkers,
+    ACPI_WALK_CALLBACK      UserFunction,
+    void                    **WorkerContexts,
+    ACPI_WALK_MERGE_HANDLER MergeHandler,
+    void                    *MergeContext)
+{
+    ACPI_NS_PARALLEL_WALK   Walk;
+    ACPI_NS_WALK_TASK       *Task;
+    ACPI_STATUS             Status;
+    UINT32                  LevelCount[ACPI_NS_PARALLEL_SPLIT_DEPTH + 1];
+    UINT32                  SplitLimit;
+    UINT32                  Launched = 0;
+    UINT32                  Steals = 0;
+    UINT32                  i;
+
+
+    ACPI_FUNCTION_TRACE (NsWalkNamespaceParallel);
+
+
+    memset (&Walk, 0, sizeof (ACPI_NS_PARALLEL_WALK));
+    Walk.Type = Type;
+    Walk.MaxDepth = MaxDepth;
+    Walk.NumWorkers = NumWorkers;
+    Walk.UserFunction = UserFunction;
+
+    /*
+     * Pick the split depth: the shallowest level with enough nodes to keep
+     * all workers busy, or the deepest level we are willing to split at.
+     */
+    SplitLimit = ACPI_MIN (MaxDepth, ACPI_NS_PARALLEL_SPLIT_DEPTH);
+    memset (LevelCount, 0, sizeof (LevelCount));
+
+    Status = AcpiUtAcquireSharedMutex (ACPI_MTX_NAMESPACE);
+    if (ACPI_FAILURE (Status))
+    {
+        return_ACPI_STATUS (Status);
+    }
+
+    Status = AcpiNsWalkNamespace (ACPI_TYPE_ANY, StartNode, SplitLimit,
+        ACPI_NS_WALK_NO_UNLOCK, AcpiNsParallelCountCallback, NULL,
+        LevelCount, NULL);
+    if (ACPI_FAILURE (Status))
+    {
+        goto UnlockAndExit;
+    }
+
+    for (i = 1; i <= SplitLimit; i++)
+    {
+        Walk.MaxTasks += LevelCount[i];
+        Walk.SplitDepth = i;
+
+        if ((LevelCount[i] >= (NumWorkers * ACPI_NS_PARALLEL_TASK_FACTOR)) ||
+            !LevelCount[i])
+        {
+            break;
+        }
+    }
+
+    if (!Walk.MaxTasks)
+    {
+        goto UnlockAndExit;
+    }
+
+    /* Tasks, workers, and the task queue share one allocation */
+
+    Walk.Tasks = ACPI_ALLOCATE_ZEROED (
+        (Walk.MaxTasks * sizeof (ACPI_NS_WALK_TASK)) +
+        (NumWorkers * sizeof (ACPI_NS_WALK_WORKER)) +
+        (Walk.MaxTasks * sizeof (UINT32)));
+    if (!Walk.Tasks)
+    {
+        Status = AE_NO_MEMORY;
+        goto UnlockAndExit;
+    }
+
+    Walk.Workers = ACPI_CAST_PTR (ACPI_NS_WALK_WORKER,
+        &Walk.Tasks[Walk.MaxTasks]);
+    Walk.Queue = ACPI_CAST_PTR (UINT32, &Walk.Workers[NumWorkers]);
+
+    /* Build the task list, in namespace order */
+
+    Status = AcpiNsWalkNamespace (ACPI_TYPE_ANY, StartNode, Walk.SplitDepth,
+        ACPI_NS_WALK_NO_UNLOCK, AcpiNsParallelCollectCallback, NULL,
+        &Walk, NULL);
+    (void) AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
+    if (ACPI_FAILURE (Status))
+    {
+        goto Cleanup;
+    }
+
+    for (i = 0; i < NumWorkers; i++)
+    {
+        Walk.Workers[i].Walk = &Walk;
+        Walk.Workers[i].Context = WorkerContexts ? WorkerContexts[i] : NULL;
+    }
+
+    /*
+     * Visit the nodes above the split depth on this thread (as worker 0),
+     * queueing the subtree tasks that are not pruned along the way.
+     */
+    for (i = 0; (i < Walk.NumTasks) && !Walk.Abort; i++)
+    {
+        Task = &Walk.Tasks[i];
+        if (Task->Subtree)
+        {
+            Walk.Queue[Walk.NumQueued] = i;
+            Walk.NumQueued++;
+            continue;
+        }
+
+        Task->Started = TRUE;
+        Status = AcpiNsParallelInvoke (&Walk.Workers[0], Task,
+            Task->Node, Task->Level);
+
+        if (Status == AE_CTRL_DEPTH)
+        {
+            /* Skip the tasks for all nodes below this one */
+
+            while (((i + 1) < Walk.NumTasks) &&
+                (Walk.Tasks[i + 1].Level > Task->Level))
+            {
+                i++;
+            }
+        }
+        else if (ACPI_FAILURE (Status))
+        {
+            Task->Status = Status;
+            Walk.Abort = TRUE;
+        }
+    }
+
+    Status = AE_OK;
+    if (!Walk.NumQueued || Walk.Abort)
+    {
+        goto Merge;
+    }
+
+    /* Deal out the subtree tasks in contiguous ranges */
+
+    if (NumWorkers > Walk.NumQueued)
+    {
+        NumWorkers = Walk.NumQueued;
+        Walk.NumWorkers = NumWorkers;
+    }
+
+    for (i = 0; i < NumWorkers; i++)
+    {
+        Walk.Workers[i].Head = (i * Walk.NumQueued) / NumWorkers;
+        Walk.Workers[i].Tail = ((i + 1) * Walk.NumQueued) / NumWorkers;
+    }
+
+    Status = AcpiOsCreateLock (&Walk.Lock);
+    if (ACPI_FAILURE (Status))
+    {
+        goto Merge;
+    }
+
+    if (NumWorkers > 1)
+    {
+        Status = AcpiOsCreateSemaphore (NumWorkers, 0, &Walk.Done);
+        if (ACPI_SUCCESS (Status))
+        {
+            for (i = 1; i < NumWorkers; i++)
+            {
+                Status = AcpiOsExecute (OSL_NOTIFY_HANDLER,
+                    AcpiNsParallelWorker, &Walk.Workers[i]);
+                if (ACPI_SUCCESS (Status))
+                {
+                    Launched++;
+                }
+            }
+        }
+    }
+
+    /* This thread is worker 0; anything left unstarted is stolen */
+
+    AcpiNsParallelWorkerLoop (&Walk.Workers[0]);
+
+    for (i = 0; i < Launched; i++)
+    {
+        (void) AcpiOsWaitSemaphore (Walk.Done, 1, ACPI_WAIT_FOREVER);
+    }
+
+    for (i = 0; i < NumWorkers; i++)
+    {
+        Steals += Walk.Workers[i].Steals;
+    }
+
+    if (Walk.Done)
+    {
+        (void) AcpiOsDeleteSemaphore (Walk.Done);
+    }
+
+    AcpiOsDeleteLock (Walk.Lock);
+    Status = AE_OK;
+
+    ACPI_DEBUG_PRINT ((ACPI_DB_NAMES,
+        "Parallel walk: %u tasks, split at level %u, %u queued, "
+        "%u workers, %u steals\n",
+        Walk.NumTasks, Walk.SplitDepth, Walk.NumQueued,
+        Launched + 1, Steals));
+
+Merge:
+    /*
+     * Merge the task results in namespace order. The first error (in that
+     * order) is the one returned.
+     */
+    for (i = 0; i < Walk.NumTasks; i++)
+    {
+        Task = &Walk.Tasks[i];
+        if (!Task->Started)
+        {
+            continue;
+        }
+
+        if (Task->Result && MergeHandler)
+        {
+            MergeHandler (Task->Node, Task->Level, Task->Result,
+                MergeContext);
+        }
+
+        if (ACPI_SUCCESS (Status) &&
+            ACPI_FAILURE (Task->Status) &&
+            (Task->Status != AE_CTRL_TERMINATE))
+        {
+            Status = Task->Status;
+        }
+    }
+
+Cleanup:
+    ACPI_FREE (Walk.Tasks);
+    return_ACPI_STATUS (Status);
+
+UnlockAndExit:
+    (void) AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
+    return_ACPI_STATUS (Status);
+}
@@ -81,16 +81,14 @@ AcpiNsSearchParentTree (
  *      Named object lists are built (and subsequently dumped) in the
  *      order in which the names are encountered during the namespace load;
  *
- *      All namespace searching is linear in this implementation, but
- *      could be easily modified to support any improved search
- *      algorithm. However, the linear search was chosen for simplicity
- *      and because the trees are small and the other interpreter
- *      execution overhead is relatively high.
- *
- *      Note: CPU execution analysis has shown that the AML interpreter spends
- *      a very small percentage of its time searching the namespace. Therefore,
- *      the linear search seems to be sufficient, as there would seem to be
- *      little value in improving the search.
+ *      Namespace searching is linear for most scopes, since the trees are
+ *      usually small and the other interpreter execution overhead is
+ *      relatively high. However, some platforms have scopes with hundreds
+ *      or thousands of children (such as \_SB on large servers), where the
+ *      linear search dominates table load time. Scopes that have reached
+ *      AcpiGbl_NamespaceIndexThreshold children are therefore searched via
+ *      a hashed child index instead. Either way, the first matching child
+ *      in Peer order is returned.
  *
  ******************************************************************************/
 
@@ -129,35 +127,40 @@ AcpiNsSearchOneScope (
      * Search for name at this namespace level, which is to say that we
      * must search for the name among the children of this object
      */
-    Node = ParentNode->Child;
-    while (Node)
+    if (ParentNode->ChildIndex)
     {
-        /* Check for match against the name */
-
-        if (Node->Name.Integer == TargetName)
+        Node = AcpiNsIndexLookup (ParentNode, TargetName);
+    }
+    else
+    {
+        Node = ParentNode->Child;
+        while (Node && (Node->Name.Integer != TargetName))
         {
-            /* Resolve a control method alias if any */
-
-            if (AcpiNsGetType (Node) == ACPI_TYPE_LOCAL_METHOD_ALIAS)
-            {
-                Node = ACPI_CAST_PTR (ACPI_NAMESPACE_NODE, Node->Object);
-            }
+            /* Didn't match name, move on to the next peer object */
 
-            /* Found matching entry */
+            Node = Node->Peer;
+        }
+    }
 
-            ACPI_DEBUG_PRINT ((ACPI_DB_NAMES,
-                "Name [%4.4s] (%s) %p found in scope [%4.4s] %p\n",
-                ACPI_CAST_PTR (char, &TargetName),
-                AcpiUtGetTypeName (Node->Type),
-                Node, AcpiUtGetNodeName (ParentNode), ParentNode));
+    if (Node)
+    {
+        /* Resolve a control method alias if any */
 
-            *ReturnNode = Node;
-            return_ACPI_STATUS (AE_OK);
+        if (AcpiNsGetType (Node) == ACPI_TYPE_LOCAL_METHOD_ALIAS)
+        {
+            Node = ACPI_CAST_PTR (ACPI_NAMESPACE_NODE, Node->Object);
         }
 
-        /* Didn't match name, move on to the next peer object */
+        /* Found matching entry */
+
+        ACPI_DEBUG_PRINT ((ACPI_DB_NAMES,
+            "Name [%4.4s] (%s) %p found in scope [%4.4s] %p\n",
+            ACPI_CAST_PTR (char, &TargetName),
+            AcpiUtGetTypeName (Node->Type),
+            Node, AcpiUtGetNodeName (ParentNode), ParentNode));
 
-        Node = Node->Peer;
+        *ReturnNode = Node;
+        return_ACPI_STATUS (AE_OK);
     }
 
     /* Searched entire namespace level, not found */
@@ -359,7 +362,7 @@ AcpiNsSearchAndEnter (
                 {
                     AcpiUtRemoveReference ((*ReturnNode)->Object);
                     (*ReturnNode)->Object = NULL;
-                    (*ReturnNode)->OwnerId = WalkState->OwnerId;
+                    AcpiNsSetNodeOwner (*ReturnNode, WalkState->OwnerId);
                 }
                 else
                 {
@@ -423,7 +426,8 @@ AcpiNsSearchAndEnter (
 
     /* Create the new named object */
 
-    NewNode = AcpiNsCreateNode (TargetName);
+    NewNode = AcpiNsCreateNode (TargetName,
+        WalkState ? WalkState->OwnerId : 0);
     if (!NewNode)
     {
         return_ACPI_STATUS (AE_NO_MEMORY);
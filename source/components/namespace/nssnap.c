@@ -0,0 +1,2371 @@
+/*******************************************************************************
+ *
+ * Module Name: nssnap - Binary namespace snapshot
+ *
+ ******************************************************************************/
+
+/*
+ * Copyright (C) 2000 - 2023, Intel Corp.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions, and the following disclaimer,
+ *    without modification.
+ * 2. Redistributions in binary form must reproduce at minimum a disclaimer
+ *    substantially similar to the "NO WARRANTY" disclaimer below
+ *    ("Disclaimer") and any redistribution must be conditioned upon
+ *    including a substantially similar Disclaimer requirement for further
+ *    binary redistribution.
+ * 3. Neither the names of the above-listed copyright holders nor the names
+ *    of any contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * Alternatively, this software may be distributed under the terms of the
+ * GNU General Public License ("GPL") version 2 as published by the Free
+ * Software Foundation.
+ *
+ * NO WARRANTY
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGES.
+ */
+
+
+
+#include "acpi.h"
+#include "accommon.h"
+#include "acnamesp.h"
+#include "actables.h"
+#include "acdispat.h"
+#include "acinterp.h"
+
+
+#define _COMPONENT          ACPI_NAMESPACE
+        ACPI_MODULE_NAME    ("nssnap")
+
+/*
+ * A namespace snapshot records the namespace created by loading the DSDT
+ * and the SSDTs, so that a later boot with the same tables can rebuild it
+ * without parsing any AML. The image (see aclocal.h) holds:
+ *
+ * - A key for every table that was loaded: signature, length, checksum,
+ *   OEM IDs and OEM revision. The snapshot is only used if the same tables
+ *   are installed and not yet loaded, in the same order.
+ * - One record per namespace node owned by those tables, in namespace
+ *   order. Nodes created by the host (the predefined scopes) are recorded
+ *   as "existing" when they are the parent of a snapshot node, and must be
+ *   present when the snapshot is restored.
+ * - The object attached to each node. AML that is executed later (method
+ *   bodies and the operands of regions, buffer fields, bank fields and
+ *   buffers) is recorded as an offset into the owner table, so the
+ *   restored objects point into the installed tables exactly like parsed
+ *   ones. Operands that were already evaluated when the table was loaded
+ *   (region address and length, buffer contents, buffer field location)
+ *   are saved as well, so that the objects are restored as initialized.
+ *   Packages are saved element by element, with named references already
+ *   resolved.
+ *
+ * A snapshot should be created right after AcpiLoadTables: it contains the
+ * objects as they are at that time, and objects that cannot be described
+ * statically (for example, PCC or table data regions, or methods installed
+ * by the host) make the creation fail with AE_SUPPORT. Any mismatch or
+ * corrupt record when restoring leaves the namespace untouched, and the
+ * tables are then loaded normally.
+ */
+
+/* Node record being sized or not yet written */
+
+#define ACPI_NS_SNAPSHOT_NOT_SAVED      (ACPI_UINT32_MAX - 1)
+
+/* Node flags that describe runtime state, not saved in a snapshot */
+
+#define ACPI_NS_SNAPSHOT_RUNTIME_FLAGS  (ANOBJ_PATH_CACHED | \
+                                         ANOBJ_SUBTREE_HAS_INI | \
+                                         ANOBJ_EVALUATED)
+
+/* Offset 0 of the data area is reserved to mean "none" */
+
+#define ACPI_NS_SNAPSHOT_DATA_START     8
+
+
+/* A table covered by a snapshot */
+
+typedef struct acpi_ns_snapshot_source
+{
+    UINT8                   *Aml;           /* Entire table, including the header */
+    UINT32                  Length;
+    UINT32                  TableIndex;
+    ACPI_OWNER_ID           OwnerId;
+    ACPI_NS_ARENA           Arena;
+
+} ACPI_NS_SNAPSHOT_SOURCE;
+
+/* Namespace nodes along the current walk path, indexed by level */
+
+typedef struct acpi_ns_snapshot_level
+{
+    ACPI_NAMESPACE_NODE     *Node;
+    UINT32                  Index;          /* Node record, or ACPI_NS_SNAPSHOT_NOT_SAVED */
+
+} ACPI_NS_SNAPSHOT_LEVEL;
+
+typedef struct acpi_ns_snapshot_info
+{
+    ACPI_NS_SNAPSHOT_SOURCE *Sources;
+    UINT32                  SourceCount;
+    ACPI_NS_SNAPSHOT_NODE   *Nodes;
+    ACPI_NS_SNAPSHOT_OBJECT *Objects;
+    UINT8                   *Data;          /* NULL while sizing the image */
+    UINT32                  NodeCount;
+    UINT32                  ObjectCount;
+    UINT32                  DataLength;
+    ACPI_NAMESPACE_NODE     **NsNodes;      /* Restore: node for each record */
+    ACPI_NS_SNAPSHOT_LEVEL  Stack[ACPI_NS_SNAPSHOT_MAX_DEPTH + 1];
+
+} ACPI_NS_SNAPSHOT_INFO;
+
+
+/* Local prototypes */
+
+static ACPI_STATUS
+AcpiNsGetSnapshotTables (
+    BOOLEAN                 Loaded,
+    ACPI_NS_SNAPSHOT_SOURCE **ReturnSources,
+    UINT32                  *ReturnCount);
+
+static void
+AcpiNsFreeSnapshotTables (
+    ACPI_NS_SNAPSHOT_SOURCE *Sources,
+    UINT32                  Count);
+
+static ACPI_STATUS
+AcpiNsSnapshotAml (
+    ACPI_NS_SNAPSHOT_SOURCE *Source,
+    UINT8                   *Aml,
+    UINT32                  Length,
+    UINT32                  *ReturnOffset);
+
+static UINT32
+AcpiNsSnapshotAddPath (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    ACPI_NAMESPACE_NODE     *Node);
+
+static UINT32
+AcpiNsSnapshotAddData (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    void                    *Data,
+    UINT32                  Length);
+
+static ACPI_STATUS
+AcpiNsSnapshotSavePackage (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    ACPI_OPERAND_OBJECT     *ObjDesc,
+    UINT32                  Depth,
+    UINT32                  *ReturnOffset);
+
+static ACPI_STATUS
+AcpiNsSnapshotSaveField (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    ACPI_NS_SNAPSHOT_SOURCE *Source,
+    ACPI_OPERAND_OBJECT     *ObjDesc,
+    ACPI_NS_SNAPSHOT_OBJECT *Object);
+
+static ACPI_STATUS
+AcpiNsSnapshotSaveObject (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    ACPI_NS_SNAPSHOT_SOURCE *Source,
+    ACPI_NAMESPACE_NODE     *Node,
+    ACPI_NS_SNAPSHOT_OBJECT *Object);
+
+static ACPI_STATUS
+AcpiNsSnapshotOneNode (
+    ACPI_HANDLE             ObjHandle,
+    UINT32                  Level,
+    void                    *Context,
+    void                    **ReturnValue);
+
+static ACPI_STATUS
+AcpiNsSnapshotValidate (
+    ACPI_NS_SNAPSHOT_HEADER *Header,
+    UINT32                  Length);
+
+static const char *
+AcpiNsSnapshotGetString (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    UINT32                  Offset);
+
+static ACPI_STATUS
+AcpiNsSnapshotGetNode (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    UINT32                  Offset,
+    ACPI_NAMESPACE_NODE     **ReturnNode);
+
+static ACPI_STATUS
+AcpiNsSnapshotGetAml (
+    ACPI_NS_SNAPSHOT_SOURCE *Source,
+    UINT32                  Offset,
+    UINT32                  Length,
+    UINT8                   **ReturnAml);
+
+static ACPI_STATUS
+AcpiNsSnapshotGetData (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    UINT32                  Offset,
+    UINT32                  Length,
+    UINT8                   **ReturnData);
+
+static ACPI_STATUS
+AcpiNsRestorePackage (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    UINT32                  Offset,
+    UINT32                  Count,
+    UINT32                  Depth,
+    ACPI_OPERAND_OBJECT     **ReturnObjDesc);
+
+static UINT32
+AcpiNsSnapshotObjectPass (
+    UINT8                   Type);
+
+static ACPI_STATUS
+AcpiNsRestoreField (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    ACPI_NS_SNAPSHOT_SOURCE *Source,
+    ACPI_NAMESPACE_NODE     *Node,
+    ACPI_NS_SNAPSHOT_OBJECT *Object);
+
+static ACPI_STATUS
+AcpiNsRestoreObject (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    ACPI_NS_SNAPSHOT_SOURCE *Source,
+    ACPI_NAMESPACE_NODE     *Node,
+    ACPI_NS_SNAPSHOT_OBJECT *Object);
+
+static ACPI_STATUS
+AcpiNsRestoreNamespace (
+    ACPI_NS_SNAPSHOT_INFO   *Info);
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsGetSnapshotTables
+ *
+ * PARAMETERS:  Loaded          - TRUE for the loaded tables, FALSE for the
+ *                                tables that are installed but not loaded
+ *              ReturnSources   - Where the table list is returned
+ *              ReturnCount     - Where the number of tables is returned
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Get the AML tables that a snapshot covers, in the order that
+ *              AcpiTbLoadNamespace loads them: the DSDT first, then the
+ *              SSDT, PSDT and OSDT tables in table index order.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsGetSnapshotTables (
+    BOOLEAN                 Loaded,
+    ACPI_NS_SNAPSHOT_SOURCE **ReturnSources,
+    UINT32                  *ReturnCount)
+{
+    ACPI_NS_SNAPSHOT_SOURCE *Sources;
+    ACPI_TABLE_DESC         *Table;
+    UINT32                  Count = 0;
+    UINT32                  TableIndex;
+    UINT32                  i;
+
+
+    (void) AcpiUtAcquireMutex (ACPI_MTX_TABLES);
+
+    if (!AcpiGbl_RootTableList.CurrentTableCount)
+    {
+        (void) AcpiUtReleaseMutex (ACPI_MTX_TABLES);
+        return (AE_NO_ACPI_TABLES);
+    }
+
+    Sources = ACPI_ALLOCATE_ZEROED (AcpiGbl_RootTableList.CurrentTableCount *
+        sizeof (ACPI_NS_SNAPSHOT_SOURCE));
+    if (!Sources)
+    {
+        (void) AcpiUtReleaseMutex (ACPI_MTX_TABLES);
+        return (AE_NO_MEMORY);
+    }
+
+    for (i = 0; i <= AcpiGbl_RootTableList.CurrentTableCount; i++)
+    {
+        if (i == 0)
+        {
+            TableIndex = AcpiGbl_DsdtIndex;
+            Table = &AcpiGbl_RootTableList.Tables[TableIndex];
+            if (!ACPI_COMPARE_NAMESEG (Table->Signature.Ascii, ACPI_SIG_DSDT))
+            {
+                continue;
+            }
+        }
+        else
+        {
+            TableIndex = i - 1;
+            Table = &AcpiGbl_RootTableList.Tables[TableIndex];
+            if (!Table->Address ||
+                (!ACPI_COMPARE_NAMESEG (Table->Signature.Ascii, ACPI_SIG_SSDT) &&
+                 !ACPI_COMPARE_NAMESEG (Table->Signature.Ascii, ACPI_SIG_PSDT) &&
+                 !ACPI_COMPARE_NAMESEG (Table->Signature.Ascii, ACPI_SIG_OSDT)))
+            {
+                continue;
+            }
+        }
+
+        if ((Loaded && !(Table->Flags & ACPI_TABLE_IS_LOADED)) ||
+            (!Loaded && (Table->Flags & ACPI_TABLE_IS_LOADED)) ||
+            ACPI_FAILURE (AcpiTbValidateTable (Table)))
+        {
+            continue;
+        }
+
+        Sources[Count].Aml = ACPI_CAST_PTR (UINT8, Table->Pointer);
+        Sources[Count].Length = Table->Length;
+        Sources[Count].TableIndex = TableIndex;
+        if (Loaded)
+        {
+            Sources[Count].OwnerId = Table->OwnerId;
+        }
+        Count++;
+    }
+
+    (void) AcpiUtReleaseMutex (ACPI_MTX_TABLES);
+
+    if (!Count)
+    {
+        ACPI_FREE (Sources);
+        return (AE_NO_ACPI_TABLES);
+    }
+
+    *ReturnSources = Sources;
+    *ReturnCount = Count;
+    return (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsFreeSnapshotTables
+ *
+ * PARAMETERS:  Sources         - Table list from AcpiNsGetSnapshotTables
+ *              Count           - Number of tables in the list
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Free a table list. Any node arena still open for one of the
+ *              tables is closed first.
+ *
+ ******************************************************************************/
+
+static void
+AcpiNsFreeSnapshotTables (
+    ACPI_NS_SNAPSHOT_SOURCE *Sources,
+    UINT32                  Count)
+{
+    UINT32                  i;
+
+
+    for (i = 0; i < Count; i++)
+    {
+        AcpiNsArenaEnd (&Sources[i].Arena);
+    }
+
+    ACPI_FREE (Sources);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsSnapshotAml
+ *
+ * PARAMETERS:  Source          - Owner table of the object
+ *              Aml             - AML referenced by the object
+ *              Length          - Length of the AML
+ *              ReturnOffset    - Where the table offset is returned
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Convert an AML pointer to an offset into the owner table.
+ *              Fails with AE_SUPPORT if the AML is not part of the table.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsSnapshotAml (
+    ACPI_NS_SNAPSHOT_SOURCE *Source,
+    UINT8                   *Aml,
+    UINT32                  Length,
+    UINT32                  *ReturnOffset)
+{
+
+    if (!Aml ||
+        Aml < Source->Aml ||
+        Aml > Source->Aml + Source->Length ||
+        Length > (UINT32) ((Source->Aml + Source->Length) - Aml))
+    {
+        return (AE_SUPPORT);
+    }
+
+    *ReturnOffset = (UINT32) ACPI_PTR_DIFF (Aml, Source->Aml);
+    return (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsSnapshotAddData
+ *
+ * PARAMETERS:  Info            - Snapshot being created
+ *              Data            - Data to add
+ *              Length          - Length of the data
+ *
+ * RETURN:      Offset of the data within the data area
+ *
+ * DESCRIPTION: Append data to the data area of the image. While the image is
+ *              being sized, only the length is accounted for.
+ *
+ ******************************************************************************/
+
+static UINT32
+AcpiNsSnapshotAddData (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    void                    *Data,
+    UINT32                  Length)
+{
+    UINT32                  Offset = Info->DataLength;
+
+
+    if (Info->Data && Data && Length)
+    {
+        memcpy (Info->Data + Offset, Data, Length);
+    }
+
+    Info->DataLength += Length;
+    return (Offset);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsSnapshotAddPath
+ *
+ * PARAMETERS:  Info            - Snapshot being created
+ *              Node            - Node to refer to
+ *
+ * RETURN:      Offset of the pathname within the data area
+ *
+ * DESCRIPTION: Append the full pathname of a node to the data area. Other
+ *              nodes are referenced by pathname so that the reference does
+ *              not depend on the set of nodes in the snapshot.
+ *
+ ******************************************************************************/
+
+static UINT32
+AcpiNsSnapshotAddPath (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    ACPI_NAMESPACE_NODE     *Node)
+{
+    UINT32                  Offset = Info->DataLength;
+    UINT32                  Length;
+
+
+    Length = AcpiNsBuildNormalizedPath (Node, NULL, 0, FALSE);
+    if (Info->Data)
+    {
+        (void) AcpiNsBuildNormalizedPath (Node,
+            ACPI_CAST_PTR (char, Info->Data + Offset), Length, FALSE);
+    }
+
+    Info->DataLength += Length;
+    return (Offset);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsSnapshotSavePackage
+ *
+ * PARAMETERS:  Info            - Snapshot being created
+ *              ObjDesc         - Initialized Package object
+ *              Depth           - Nesting level of the package
+ *              ReturnOffset    - Where the offset of the element array is
+ *                                returned
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Add the elements of a package to the data area. Named
+ *              references are saved as the pathname of the target node.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsSnapshotSavePackage (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    ACPI_OPERAND_OBJECT     *ObjDesc,
+    UINT32                  Depth,
+    UINT32                  *ReturnOffset)
+{
+    ACPI_NS_SNAPSHOT_ELEMENT    *Element;
+    ACPI_NS_SNAPSHOT_ELEMENT    Scratch;
+    ACPI_OPERAND_OBJECT         *ElementDesc;
+    ACPI_STATUS                 Status;
+    UINT32                      Offset;
+    UINT32                      i;
+
+
+    if (Depth > ACPI_NS_SNAPSHOT_MAX_DEPTH)
+    {
+        return (AE_SUPPORT);
+    }
+
+    /* The element array is 8-byte aligned, as is the data area */
+
+    Info->DataLength = (UINT32) ACPI_ROUND_UP (Info->DataLength, 8);
+    Offset = AcpiNsSnapshotAddData (Info, NULL,
+        ObjDesc->Package.Count * sizeof (ACPI_NS_SNAPSHOT_ELEMENT));
+
+    for (i = 0; i < ObjDesc->Package.Count; i++)
+    {
+        if (Info->Data)
+        {
+            Element = ACPI_ADD_PTR (ACPI_NS_SNAPSHOT_ELEMENT, Info->Data,
+                Offset + (i * sizeof (ACPI_NS_SNAPSHOT_ELEMENT)));
+        }
+        else
+        {
+            Element = &Scratch;
+        }
+
+        ElementDesc = ObjDesc->Package.Elements[i];
+        if (!ElementDesc)
+        {
+            continue;
+        }
+
+        Element->Type = ElementDesc->Common.Type;
+        switch (ElementDesc->Common.Type)
+        {
+        case ACPI_TYPE_INTEGER:
+
+            Element->Integer = ElementDesc->Integer.Value;
+            break;
+
+        case ACPI_TYPE_STRING:
+
+            Element->Length = ElementDesc->String.Length;
+            Element->Data = AcpiNsSnapshotAddData (Info,
+                ElementDesc->String.Pointer, ElementDesc->String.Length);
+            break;
+
+        case ACPI_TYPE_BUFFER:
+
+            Element->Length = ElementDesc->Buffer.Length;
+            Element->Data = AcpiNsSnapshotAddData (Info,
+                ElementDesc->Buffer.Pointer, ElementDesc->Buffer.Length);
+            break;
+
+        case ACPI_TYPE_PACKAGE:
+
+            Element->Length = ElementDesc->Package.Count;
+            Status = AcpiNsSnapshotSavePackage (Info, ElementDesc,
+                Depth + 1, &Element->Data);
+            if (ACPI_FAILURE (Status))
+            {
+                return (Status);
+            }
+            break;
+
+        case ACPI_TYPE_LOCAL_REFERENCE:
+
+            /* Only resolved references to named objects are supported */
+
+            if (ElementDesc->Reference.Class != ACPI_REFCLASS_NAME ||
+                !ElementDesc->Reference.Resolved)
+            {
+                return (AE_SUPPORT);
+            }
+
+            Element->Data = AcpiNsSnapshotAddPath (Info,
+                ElementDesc->Reference.Node);
+            break;
+
+        default:
+
+            return (AE_SUPPORT);
+        }
+    }
+
+    *ReturnOffset = Offset;
+    return (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsSnapshotSaveField
+ *
+ * PARAMETERS:  Info            - Snapshot being created
+ *              Source          - Owner table of the field
+ *              ObjDesc         - Buffer, Region, Bank or Index field object
+ *              Object          - Object record to fill in
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Describe a field object. The buffer, region, bank and index
+ *              register objects are referenced by the pathnames of their
+ *              nodes.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsSnapshotSaveField (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    ACPI_NS_SNAPSHOT_SOURCE *Source,
+    ACPI_OPERAND_OBJECT     *ObjDesc,
+    ACPI_NS_SNAPSHOT_OBJECT *Object)
+{
+    ACPI_OPERAND_OBJECT     *ExtraDesc;
+    ACPI_OPERAND_OBJECT     *BufferDesc;
+    ACPI_STATUS             Status;
+
+
+    Object->FieldFlags = ObjDesc->CommonField.FieldFlags;
+    Object->Attribute = ObjDesc->CommonField.Attribute;
+    Object->AccessByteWidth = ObjDesc->CommonField.AccessByteWidth;
+    Object->BitLength = ObjDesc->CommonField.BitLength;
+    Object->BaseByteOffset = ObjDesc->CommonField.BaseByteOffset;
+    Object->Value = ObjDesc->CommonField.Value;
+    Object->StartFieldBitOffset = ObjDesc->CommonField.StartFieldBitOffset;
+    Object->AccessLength = ObjDesc->CommonField.AccessLength;
+
+    switch (ObjDesc->Common.Type)
+    {
+    case ACPI_TYPE_LOCAL_REGION_FIELD:
+
+        if (!ObjDesc->Field.RegionObj ||
+            ObjDesc->Field.InternalPccBuffer)
+        {
+            return (AE_SUPPORT);
+        }
+
+        if (ObjDesc->Field.ResourceBuffer)
+        {
+            Status = AcpiNsSnapshotAml (Source, ObjDesc->Field.ResourceBuffer,
+                ObjDesc->Field.ResourceLength, &Object->ResourceOffset);
+            if (ACPI_FAILURE (Status))
+            {
+                return (Status);
+            }
+
+            Object->ResourceLength = ObjDesc->Field.ResourceLength;
+        }
+
+        Object->Order = ObjDesc->Field.PinNumberIndex;
+        Object->Reference[0] = AcpiNsSnapshotAddPath (Info,
+            ObjDesc->Field.RegionObj->Region.Node);
+        break;
+
+    case ACPI_TYPE_LOCAL_BANK_FIELD:
+
+        ExtraDesc = AcpiNsGetSecondaryObject (ObjDesc);
+        if (!ObjDesc->BankField.RegionObj ||
+            !ObjDesc->BankField.BankObj ||
+            !ExtraDesc)
+        {
+            return (AE_SUPPORT);
+        }
+
+        Status = AcpiNsSnapshotAml (Source, ExtraDesc->Extra.AmlStart,
+            ExtraDesc->Extra.AmlLength, &Object->AmlOffset);
+        if (ACPI_FAILURE (Status))
+        {
+            return (Status);
+        }
+
+        Object->AmlLength = ExtraDesc->Extra.AmlLength;
+        Object->Reference[0] = AcpiNsSnapshotAddPath (Info,
+            ObjDesc->BankField.RegionObj->Region.Node);
+        Object->Reference[1] = AcpiNsSnapshotAddPath (Info,
+            ObjDesc->BankField.BankObj->CommonField.Node);
+        break;
+
+    case ACPI_TYPE_BUFFER_FIELD:
+
+        ExtraDesc = AcpiNsGetSecondaryObject (ObjDesc);
+        if (!ExtraDesc)
+        {
+            return (AE_SUPPORT);
+        }
+
+        Status = AcpiNsSnapshotAml (Source, ExtraDesc->Extra.AmlStart,
+            ExtraDesc->Extra.AmlLength, &Object->AmlOffset);
+        if (ACPI_FAILURE (Status))
+        {
+            return (Status);
+        }
+
+        Object->AmlLength = ExtraDesc->Extra.AmlLength;
+        if (!(ObjDesc->Common.Flags & AOPOBJ_DATA_VALID))
+        {
+            break;
+        }
+
+        /* The containing buffer must be the object of a named Buffer */
+
+        BufferDesc = ObjDesc->BufferField.BufferObj;
+        if (!BufferDesc ||
+            !BufferDesc->Buffer.Node ||
+            AcpiNsGetAttachedObject (BufferDesc->Buffer.Node) != BufferDesc)
+        {
+            return (AE_SUPPORT);
+        }
+
+        Object->InfoFlags = ObjDesc->BufferField.IsCreateField;
+        Object->Reference[0] = AcpiNsSnapshotAddPath (Info,
+            BufferDesc->Buffer.Node);
+        break;
+
+    case ACPI_TYPE_LOCAL_INDEX_FIELD:
+
+        if (!ObjDesc->IndexField.IndexObj ||
+            !ObjDesc->IndexField.DataObj)
+        {
+            return (AE_SUPPORT);
+        }
+
+        Object->Reference[0] = AcpiNsSnapshotAddPath (Info,
+            ObjDesc->IndexField.IndexObj->CommonField.Node);
+        Object->Reference[1] = AcpiNsSnapshotAddPath (Info,
+            ObjDesc->IndexField.DataObj->CommonField.Node);
+        break;
+
+    default:
+
+        return (AE_SUPPORT);
+    }
+
+    return (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsSnapshotSaveObject
+ *
+ * PARAMETERS:  Info            - Snapshot being created
+ *              Source          - Owner table of the node
+ *              Node            - Node whose object is saved
+ *              Object          - Object record to fill in
+ *
+ * RETURN:      Status. AE_SUPPORT if the object cannot be described by a
+ *              snapshot.
+ *
+ * DESCRIPTION: Describe the object attached to a node.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsSnapshotSaveObject (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    ACPI_NS_SNAPSHOT_SOURCE *Source,
+    ACPI_NAMESPACE_NODE     *Node,
+    ACPI_NS_SNAPSHOT_OBJECT *Object)
+{
+    ACPI_OPERAND_OBJECT     *ObjDesc;
+    ACPI_OPERAND_OBJECT     *ExtraDesc;
+    ACPI_STATUS             Status = AE_OK;
+
+
+    /* An alias refers directly to its target node */
+
+    if (Node->Type == ACPI_TYPE_LOCAL_ALIAS ||
+        Node->Type == ACPI_TYPE_LOCAL_METHOD_ALIAS)
+    {
+        Object->Type = (UINT8) Node->Type;
+        Object->Reference[0] = AcpiNsSnapshotAddPath (Info,
+            ACPI_CAST_PTR (ACPI_NAMESPACE_NODE, Node->Object));
+        return (AE_OK);
+    }
+
+    ObjDesc = AcpiNsGetAttachedObject (Node);
+    Object->Type = ObjDesc->Common.Type;
+    Object->Flags = ObjDesc->Common.Flags &
+        (AOPOBJ_AML_CONSTANT | AOPOBJ_DATA_VALID);
+
+    switch (ObjDesc->Common.Type)
+    {
+    case ACPI_TYPE_INTEGER:
+
+        Object->Integer = ObjDesc->Integer.Value;
+        break;
+
+    case ACPI_TYPE_STRING:
+
+        Object->DataLength = ObjDesc->String.Length;
+        Object->Data = AcpiNsSnapshotAddData (Info,
+            ObjDesc->String.Pointer, ObjDesc->String.Length);
+        break;
+
+    case ACPI_TYPE_BUFFER:
+
+        /* Keep the AML of a named buffer, in case it is not initialized */
+
+        if (ObjDesc->Buffer.Node == Node)
+        {
+            Object->InfoFlags = TRUE;
+        }
+
+        if (ObjDesc->Buffer.Node == Node &&
+            ObjDesc->Buffer.AmlLength &&
+            ACPI_SUCCESS (AcpiNsSnapshotAml (Source, ObjDesc->Buffer.AmlStart,
+                ObjDesc->Buffer.AmlLength, &Object->AmlOffset)))
+        {
+            Object->AmlLength = ObjDesc->Buffer.AmlLength;
+        }
+
+        if (ObjDesc->Common.Flags & AOPOBJ_DATA_VALID)
+        {
+            Object->DataLength = ObjDesc->Buffer.Length;
+            Object->Data = AcpiNsSnapshotAddData (Info,
+                ObjDesc->Buffer.Pointer, ObjDesc->Buffer.Length);
+        }
+        else if (!Object->AmlLength)
+        {
+            Status = AE_SUPPORT;
+        }
+        break;
+
+    case ACPI_TYPE_PACKAGE:
+
+        /* Named references in the package must have been resolved */
+
+        if (!(ObjDesc->Common.Flags & AOPOBJ_DATA_VALID))
+        {
+            Status = AE_SUPPORT;
+            break;
+        }
+
+        Object->DataLength = ObjDesc->Package.Count;
+        Status = AcpiNsSnapshotSavePackage (Info, ObjDesc, 0, &Object->Data);
+        break;
+
+    case ACPI_TYPE_METHOD:
+
+        if (ObjDesc->Method.InfoFlags & ACPI_METHOD_INTERNAL_ONLY)
+        {
+            Status = AE_SUPPORT;
+            break;
+        }
+
+        /* Keep the result of auto-serialization, done at load time */
+
+        Object->InfoFlags = ObjDesc->Method.InfoFlags &
+            (ACPI_METHOD_SERIALIZED | ACPI_METHOD_IGNORE_SYNC_LEVEL);
+        Object->ParamCount = ObjDesc->Method.ParamCount;
+        Object->SyncLevel = ObjDesc->Method.SyncLevel;
+        Object->AmlLength = ObjDesc->Method.AmlLength;
+        Status = AcpiNsSnapshotAml (Source, ObjDesc->Method.AmlStart,
+            ObjDesc->Method.AmlLength, &Object->AmlOffset);
+        break;
+
+    case ACPI_TYPE_MUTEX:
+
+        Object->SyncLevel = ObjDesc->Mutex.SyncLevel;
+        break;
+
+    case ACPI_TYPE_EVENT:
+
+        break;
+
+    case ACPI_TYPE_REGION:
+
+        ExtraDesc = AcpiNsGetSecondaryObject (ObjDesc);
+        if (!ExtraDesc ||
+            ObjDesc->Region.SpaceId == ACPI_ADR_SPACE_DATA_TABLE ||
+            ObjDesc->Region.SpaceId == ACPI_ADR_SPACE_PLATFORM_COMM)
+        {
+            Status = AE_SUPPORT;
+            break;
+        }
+
+        Object->SpaceId = ObjDesc->Region.SpaceId;
+        Object->Integer = ObjDesc->Region.Address;
+        Object->Value = ObjDesc->Region.Length;
+        Object->AmlLength = ExtraDesc->Extra.AmlLength;
+        Status = AcpiNsSnapshotAml (Source, ExtraDesc->Extra.AmlStart,
+            ExtraDesc->Extra.AmlLength, &Object->AmlOffset);
+        if (ExtraDesc->Extra.ScopeNode)
+        {
+            Object->Reference[0] = AcpiNsSnapshotAddPath (Info,
+                ExtraDesc->Extra.ScopeNode);
+        }
+        break;
+
+    case ACPI_TYPE_POWER:
+
+        Object->SyncLevel = (UINT8) ObjDesc->PowerResource.SystemLevel;
+        Object->Order = (UINT16) ObjDesc->PowerResource.ResourceOrder;
+        break;
+
+    case ACPI_TYPE_PROCESSOR:
+
+        Object->SpaceId = ObjDesc->Processor.ProcId;
+        Object->Length = ObjDesc->Processor.Length;
+        Object->Integer = ObjDesc->Processor.Address;
+        break;
+
+    case ACPI_TYPE_BUFFER_FIELD:
+    case ACPI_TYPE_LOCAL_REGION_FIELD:
+    case ACPI_TYPE_LOCAL_BANK_FIELD:
+    case ACPI_TYPE_LOCAL_INDEX_FIELD:
+
+        Status = AcpiNsSnapshotSaveField (Info, Source, ObjDesc, Object);
+        break;
+
+    default:
+
+        Status = AE_SUPPORT;
+        break;
+    }
+
+    if (ACPI_FAILURE (Status))
+    {
+        ACPI_ERROR ((AE_INFO,
+            "Cannot save [%4.4s] (%s) in namespace snapshot",
+            AcpiUtGetNodeName (Node), AcpiUtGetTypeName (ObjDesc->Common.Type)));
+    }
+
+    return (Status);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsSnapshotOneNode
+ *
+ * PARAMETERS:  ACPI_WALK_CALLBACK
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Namespace walk callback: add a node and its object to the
+ *              snapshot, if the node is owned by one of the snapshot tables.
+ *              The ancestors of the node that are not part of the snapshot
+ *              are added as "existing" nodes.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsSnapshotOneNode (
+    ACPI_HANDLE             ObjHandle,
+    UINT32                  Level,
+    void                    *Context,
+    void                    **ReturnValue)
+{
+    ACPI_NS_SNAPSHOT_INFO   *Info = ACPI_CAST_PTR (ACPI_NS_SNAPSHOT_INFO, Context);
+    ACPI_NAMESPACE_NODE     *Node = ACPI_CAST_PTR (ACPI_NAMESPACE_NODE, ObjHandle);
+    ACPI_NS_SNAPSHOT_NODE   *Record = NULL;
+    ACPI_NS_SNAPSHOT_OBJECT *Object;
+    ACPI_NS_SNAPSHOT_OBJECT Scratch;
+    ACPI_STATUS             Status;
+    UINT32                  Table;
+    UINT32                  i;
+
+
+    if (Level > ACPI_NS_SNAPSHOT_MAX_DEPTH)
+    {
+        ACPI_ERROR ((AE_INFO,
+            "Namespace too deep for snapshot at [%4.4s]",
+            AcpiUtGetNodeName (Node)));
+        return (AE_SUPPORT);
+    }
+
+    Info->Stack[Level].Node = Node;
+    Info->Stack[Level].Index = ACPI_NS_SNAPSHOT_NOT_SAVED;
+
+    for (Table = 0; Table < Info->SourceCount; Table++)
+    {
+        if (Node->OwnerId == Info->Sources[Table].OwnerId)
+        {
+            break;
+        }
+    }
+
+    if (Table == Info->SourceCount)
+    {
+        return (AE_OK);
+    }
+
+    /* Add any ancestors that are not part of the snapshot yet */
+
+    for (i = 1; i <= Level; i++)
+    {
+        if (Info->Stack[i].Index != ACPI_NS_SNAPSHOT_NOT_SAVED)
+        {
+            continue;
+        }
+
+        if (Info->Data)
+        {
+            Record = &Info->Nodes[Info->NodeCount];
+            Record->Name = Info->Stack[i].Node->Name.Integer;
+            Record->Parent = (i == 1) ?
+                ACPI_NS_SNAPSHOT_ROOT : Info->Stack[i - 1].Index;
+            Record->Table = ACPI_NS_SNAPSHOT_EXISTING;
+            Record->Type = (UINT8) Info->Stack[i].Node->Type;
+        }
+
+        Info->Stack[i].Index = Info->NodeCount;
+        Info->NodeCount++;
+    }
+
+    /* The last record added is the node itself */
+
+    if (Info->Data)
+    {
+        Record->Table = (UINT16) Table;
+        Record->Flags = Node->Flags & ~ACPI_NS_SNAPSHOT_RUNTIME_FLAGS;
+    }
+
+    /*
+     * Device and ThermalZone objects only hold handlers installed by the
+     * host, they are not created by the AML.
+     */
+    if (Node->Type != ACPI_TYPE_LOCAL_ALIAS &&
+        Node->Type != ACPI_TYPE_LOCAL_METHOD_ALIAS &&
+        (!AcpiNsGetAttachedObject (Node) ||
+         Node->Type == ACPI_TYPE_DEVICE ||
+         Node->Type == ACPI_TYPE_THERMAL))
+    {
+        return (AE_OK);
+    }
+
+    if (Info->Data)
+    {
+        Object = &Info->Objects[Info->ObjectCount];
+        Record->Object = Info->ObjectCount + 1;
+    }
+    else
+    {
+        memset (&Scratch, 0, sizeof (ACPI_NS_SNAPSHOT_OBJECT));
+        Object = &Scratch;
+    }
+
+    Info->ObjectCount++;
+    Status = AcpiNsSnapshotSaveObject (Info, &Info->Sources[Table],
+        Node, Object);
+    return (Status);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsCreateSnapshot
+ *
+ * PARAMETERS:  Buffer          - Where the snapshot image is returned. Must
+ *                                be validated by the caller.
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Create a snapshot of the namespace loaded from the DSDT and
+ *              SSDTs. The image is sized with a first walk of the namespace,
+ *              and written with a second one.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiNsCreateSnapshot (
+    ACPI_BUFFER             *Buffer)
+{
+    ACPI_NS_SNAPSHOT_INFO   *Info;
+    ACPI_NS_SNAPSHOT_HEADER *Header;
+    ACPI_NS_SNAPSHOT_TABLE  *Key;
+    ACPI_TABLE_HEADER       *Table;
+    ACPI_STATUS             Status;
+    UINT64                  Length;
+    UINT32                  NodeOffset;
+    UINT32                  ObjectOffset;
+    UINT32                  DataOffset;
+    UINT32                  i;
+
+
+    ACPI_FUNCTION_TRACE (NsCreateSnapshot);
+
+
+    Info = ACPI_ALLOCATE_ZEROED (sizeof (ACPI_NS_SNAPSHOT_INFO));
+    if (!Info)
+    {
+        return_ACPI_STATUS (AE_NO_MEMORY);
+    }
+
+    Status = AcpiNsGetSnapshotTables (TRUE, &Info->Sources, &Info->SourceCount);
+    if (ACPI_FAILURE (Status))
+    {
+        goto Exit;
+    }
+
+    Status = AcpiUtAcquireMutex (ACPI_MTX_NAMESPACE);
+    if (ACPI_FAILURE (Status))
+    {
+        goto Exit;
+    }
+
+    /* Size the image */
+
+    Info->DataLength = ACPI_NS_SNAPSHOT_DATA_START;
+    Status = AcpiNsWalkNamespace (ACPI_TYPE_ANY, ACPI_ROOT_OBJECT,
+        ACPI_UINT32_MAX, ACPI_NS_WALK_NO_UNLOCK, AcpiNsSnapshotOneNode,
+        NULL, Info, NULL);
+    if (ACPI_FAILURE (Status))
+    {
+        goto UnlockAndExit;
+    }
+
+    NodeOffset = sizeof (ACPI_NS_SNAPSHOT_HEADER) +
+        (Info->SourceCount * sizeof (ACPI_NS_SNAPSHOT_TABLE));
+    Length = ACPI_ROUND_UP ((UINT64) NodeOffset +
+        ((UINT64) Info->NodeCount * sizeof (ACPI_NS_SNAPSHOT_NODE)), 8);
+    ObjectOffset = (UINT32) Length;
+    Length += ((UINT64) Info->ObjectCount * sizeof (ACPI_NS_SNAPSHOT_OBJECT)) +
+        Info->DataLength;
+    if (Length > ACPI_UINT32_MAX)
+    {
+        Status = AE_NO_MEMORY;
+        goto UnlockAndExit;
+    }
+
+    DataOffset = ObjectOffset +
+        (Info->ObjectCount * sizeof (ACPI_NS_SNAPSHOT_OBJECT));
+
+    Status = AcpiUtInitializeBuffer (Buffer, (ACPI_SIZE) Length);
+    if (ACPI_FAILURE (Status))
+    {
+        goto UnlockAndExit;
+    }
+
+    memset (Buffer->Pointer, 0, (ACPI_SIZE) Length);
+
+    /* Write the node and object records and the data area */
+
+    Header = ACPI_CAST_PTR (ACPI_NS_SNAPSHOT_HEADER, Buffer->Pointer);
+    Info->Nodes = ACPI_ADD_PTR (ACPI_NS_SNAPSHOT_NODE, Header, NodeOffset);
+    Info->Objects = ACPI_ADD_PTR (ACPI_NS_SNAPSHOT_OBJECT, Header, ObjectOffset);
+    Info->Data = ACPI_ADD_PTR (UINT8, Header, DataOffset);
+    Info->NodeCount = 0;
+    Info->ObjectCount = 0;
+    Info->DataLength = ACPI_NS_SNAPSHOT_DATA_START;
+
+    Status = AcpiNsWalkNamespace (ACPI_TYPE_ANY, ACPI_ROOT_OBJECT,
+        ACPI_UINT32_MAX, ACPI_NS_WALK_NO_UNLOCK, AcpiNsSnapshotOneNode,
+        NULL, Info, NULL);
+    if (ACPI_FAILURE (Status))
+    {
+        goto UnlockAndExit;
+    }
+
+    /* Header and table keys */
+
+    ACPI_COPY_NAMESEG (Header->Signature, ACPI_NS_SNAPSHOT_SIGNATURE);
+    Header->Length = (UINT32) Length;
+    Header->Version = ACPI_NS_SNAPSHOT_VERSION;
+    Header->IntegerWidth = AcpiGbl_IntegerByteWidth;
+    Header->TableCount = Info->SourceCount;
+    Header->NodeCount = Info->NodeCount;
+    Header->ObjectCount = Info->ObjectCount;
+    Header->TableOffset = sizeof (ACPI_NS_SNAPSHOT_HEADER);
+    Header->NodeOffset = NodeOffset;
+    Header->ObjectOffset = ObjectOffset;
+    Header->DataOffset = DataOffset;
+    Header->DataLength = Info->DataLength;
+
+    Key = ACPI_ADD_PTR (ACPI_NS_SNAPSHOT_TABLE, Header, Header->TableOffset);
+    for (i = 0; i < Info->SourceCount; i++, Key++)
+    {
+        Table = ACPI_CAST_PTR (ACPI_TABLE_HEADER, Info->Sources[i].Aml);
+        ACPI_COPY_NAMESEG (Key->Signature, Table->Signature);
+        Key->Length = Table->Length;
+        Key->OemRevision = Table->OemRevision;
+        Key->Checksum = Table->Checksum;
+        memcpy (Key->OemId, Table->OemId, ACPI_OEM_ID_SIZE);
+        memcpy (Key->OemTableId, Table->OemTableId, ACPI_OEM_TABLE_ID_SIZE);
+    }
+
+    Header->Checksum = (UINT8) (0 - AcpiUtChecksum (
+        ACPI_CAST_PTR (UINT8, Header), Header->Length));
+
+    ACPI_DEBUG_PRINT ((ACPI_DB_INFO,
+        "Namespace snapshot: %u tables, %u nodes, %u objects, %u bytes\n",
+        Info->SourceCount, Info->NodeCount, Info->ObjectCount, Header->Length));
+
+UnlockAndExit:
+    (void) AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
+
+Exit:
+    if (Info->Sources)
+    {
+        AcpiNsFreeSnapshotTables (Info->Sources, Info->SourceCount);
+    }
+
+    ACPI_FREE (Info);
+    return_ACPI_STATUS (Status);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsSnapshotValidate
+ *
+ * PARAMETERS:  Header          - Snapshot image
+ *              Length          - Length of the buffer holding the image
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Check the header and the checksum of a snapshot image, and
+ *              that all the record arrays are within the image.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsSnapshotValidate (
+    ACPI_NS_SNAPSHOT_HEADER *Header,
+    UINT32                  Length)
+{
+    UINT32                  Limit;
+
+
+    if (!ACPI_IS_ALIGNED (ACPI_TO_INTEGER (Header), 8))
+    {
+        return (AE_BAD_ADDRESS);
+    }
+
+    if (Length < sizeof (ACPI_NS_SNAPSHOT_HEADER) ||
+        Header->Length < sizeof (ACPI_NS_SNAPSHOT_HEADER) ||
+        Header->Length > Length)
+    {
+        return (AE_BAD_DATA);
+    }
+
+    if (!ACPI_COMPARE_NAMESEG (Header->Signature, ACPI_NS_SNAPSHOT_SIGNATURE))
+    {
+        return (AE_BAD_SIGNATURE);
+    }
+
+    if (Header->Version != ACPI_NS_SNAPSHOT_VERSION ||
+        Header->IntegerWidth != AcpiGbl_IntegerByteWidth)
+    {
+        return (AE_BAD_HEADER);
+    }
+
+    if (AcpiUtChecksum (ACPI_CAST_PTR (UINT8, Header), Header->Length))
+    {
+        return (AE_BAD_CHECKSUM);
+    }
+
+    /* Each record array must be aligned and fit within the image */
+
+    Limit = Header->Length;
+    if (!ACPI_IS_ALIGNED (Header->TableOffset, 4) ||
+        !ACPI_IS_ALIGNED (Header->NodeOffset, 4) ||
+        !ACPI_IS_ALIGNED (Header->ObjectOffset, 8) ||
+        Header->TableOffset > Limit ||
+        Header->NodeOffset > Limit ||
+        Header->ObjectOffset > Limit ||
+        Header->DataOffset > Limit ||
+        Header->TableCount > (Limit - Header->TableOffset) /
+            sizeof (ACPI_NS_SNAPSHOT_TABLE) ||
+        Header->NodeCount > (Limit - Header->NodeOffset) /
+            sizeof (ACPI_NS_SNAPSHOT_NODE) ||
+        Header->ObjectCount > (Limit - Header->ObjectOffset) /
+            sizeof (ACPI_NS_SNAPSHOT_OBJECT) ||
+        Header->DataLength > Limit - Header->DataOffset ||
+        Header->NodeCount >= ACPI_NS_SNAPSHOT_NOT_SAVED)
+    {
+        return (AE_BAD_DATA);
+    }
+
+    return (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsSnapshotGetString
+ *
+ * PARAMETERS:  Info            - Snapshot being restored
+ *              Offset          - Offset of the string in the data area
+ *
+ * RETURN:      Pointer to the string. NULL if the offset is zero or invalid,
+ *              or the string is not terminated within the data area.
+ *
+ * DESCRIPTION: Get a null-terminated string from the data area.
+ *
+ ******************************************************************************/
+
+static const char *
+AcpiNsSnapshotGetString (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    UINT32                  Offset)
+{
+    UINT32                  i;
+
+
+    if (!Offset)
+    {
+        return (NULL);
+    }
+
+    for (i = Offset; i < Info->DataLength; i++)
+    {
+        if (!Info->Data[i])
+        {
+            return (ACPI_CAST_PTR (char, Info->Data + Offset));
+        }
+    }
+
+    return (NULL);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsSnapshotGetNode
+ *
+ * PARAMETERS:  Info            - Snapshot being restored
+ *              Offset          - Offset of a pathname in the data area
+ *              ReturnNode      - Where the node is returned
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Get the node referenced by a pathname. The namespace must be
+ *              locked.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsSnapshotGetNode (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    UINT32                  Offset,
+    ACPI_NAMESPACE_NODE     **ReturnNode)
+{
+    const char              *Path;
+
+
+    Path = AcpiNsSnapshotGetString (Info, Offset);
+    if (!Path)
+    {
+        return (AE_BAD_DATA);
+    }
+
+    return (AcpiNsGetNodeUnlocked (NULL, Path, ACPI_NS_NO_UPSEARCH,
+        ReturnNode));
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsSnapshotGetAml
+ *
+ * PARAMETERS:  Source          - Owner table of the object
+ *              Offset          - Offset of the AML in the table
+ *              Length          - Length of the AML
+ *              ReturnAml       - Where the AML pointer is returned
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Convert a table offset back to an AML pointer.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsSnapshotGetAml (
+    ACPI_NS_SNAPSHOT_SOURCE *Source,
+    UINT32                  Offset,
+    UINT32                  Length,
+    UINT8                   **ReturnAml)
+{
+
+    if (Offset < sizeof (ACPI_TABLE_HEADER) ||
+        Offset > Source->Length ||
+        Length > Source->Length - Offset)
+    {
+        return (AE_BAD_DATA);
+    }
+
+    *ReturnAml = Source->Aml + Offset;
+    return (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsSnapshotGetData
+ *
+ * PARAMETERS:  Info            - Snapshot being restored
+ *              Offset          - Offset of the data in the data area
+ *              Length          - Length of the data
+ *              ReturnData      - Where the data pointer is returned
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Get a pointer to data within the data area.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsSnapshotGetData (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    UINT32                  Offset,
+    UINT32                  Length,
+    UINT8                   **ReturnData)
+{
+
+    if (Length &&
+        (Offset < ACPI_NS_SNAPSHOT_DATA_START ||
+         Offset > Info->DataLength ||
+         Length > Info->DataLength - Offset))
+    {
+        return (AE_BAD_DATA);
+    }
+
+    *ReturnData = Info->Data + Offset;
+    return (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsRestorePackage
+ *
+ * PARAMETERS:  Info            - Snapshot being restored
+ *              Offset          - Offset of the element array
+ *              Count           - Number of elements
+ *              Depth           - Nesting level of the package
+ *              ReturnObjDesc   - Where the Package object is returned
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Create a Package object from an element array. The package
+ *              is returned fully initialized, so that AcpiNsInitializeObjects
+ *              does not resolve its elements again.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsRestorePackage (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    UINT32                  Offset,
+    UINT32                  Count,
+    UINT32                  Depth,
+    ACPI_OPERAND_OBJECT     **ReturnObjDesc)
+{
+    ACPI_NS_SNAPSHOT_ELEMENT    *Element;
+    ACPI_OPERAND_OBJECT         *ObjDesc;
+    ACPI_OPERAND_OBJECT         *ElementDesc;
+    ACPI_NAMESPACE_NODE         *TargetNode;
+    UINT8                       *Data;
+    ACPI_STATUS                 Status = AE_OK;
+    UINT32                      i;
+
+
+    if (Depth > ACPI_NS_SNAPSHOT_MAX_DEPTH ||
+        !ACPI_IS_ALIGNED (Offset, 8) ||
+        Count > (ACPI_UINT32_MAX / sizeof (ACPI_NS_SNAPSHOT_ELEMENT)))
+    {
+        return (AE_BAD_DATA);
+    }
+
+    Status = AcpiNsSnapshotGetData (Info, Offset,
+        Count * sizeof (ACPI_NS_SNAPSHOT_ELEMENT), &Data);
+    if (ACPI_FAILURE (Status))
+    {
+        return (Status);
+    }
+
+    ObjDesc = AcpiUtCreatePackageObject (Count);
+    if (!ObjDesc)
+    {
+        return (AE_NO_MEMORY);
+    }
+
+    Element = ACPI_CAST_PTR (ACPI_NS_SNAPSHOT_ELEMENT, Data);
+    for (i = 0; i < Count; i++, Element++)
+    {
+        ElementDesc = NULL;
+        switch (Element->Type)
+        {
+        case ACPI_TYPE_ANY:
+
+            continue;
+
+        case ACPI_TYPE_INTEGER:
+
+            ElementDesc = AcpiUtCreateIntegerObject (Element->Integer);
+            break;
+
+        case ACPI_TYPE_STRING:
+        case ACPI_TYPE_BUFFER:
+
+            Status = AcpiNsSnapshotGetData (Info, Element->Data,
+                Element->Length, &Data);
+            if (ACPI_FAILURE (Status))
+            {
+                break;
+            }
+
+            if (Element->Type == ACPI_TYPE_STRING)
+            {
+                ElementDesc = AcpiUtCreateStringObject (Element->Length);
+                if (ElementDesc)
+                {
+                    memcpy (ElementDesc->String.Pointer, Data, Element->Length);
+                }
+            }
+            else
+            {
+                ElementDesc = AcpiUtCreateBufferObject (Element->Length);
+                if (ElementDesc && Element->Length)
+                {
+                    memcpy (ElementDesc->Buffer.Pointer, Data, Element->Length);
+                }
+            }
+            break;
+
+        case ACPI_TYPE_PACKAGE:
+
+            Status = AcpiNsRestorePackage (Info, Element->Data,
+                Element->Length, Depth + 1, &ElementDesc);
+            break;
+
+        case ACPI_TYPE_LOCAL_REFERENCE:
+
+            /* A resolved named reference, see AcpiDsResolvePackageElement */
+
+            Status = AcpiNsSnapshotGetNode (Info, Element->Data, &TargetNode);
+            if (ACPI_FAILURE (Status))
+            {
+                break;
+            }
+
+            ElementDesc = AcpiUtCreateInternalObject (ACPI_TYPE_LOCAL_REFERENCE);
+            if (ElementDesc)
+            {
+                ElementDesc->Reference.Class = ACPI_REFCLASS_NAME;
+                ElementDesc->Reference.Node = TargetNode;
+                ElementDesc->Reference.Resolved = TRUE;
+            }
+            break;
+
+        default:
+
+            Status = AE_BAD_DATA;
+            break;
+        }
+
+        if (ACPI_SUCCESS (Status) && !ElementDesc)
+        {
+            Status = AE_NO_MEMORY;
+        }
+
+        if (ACPI_FAILURE (Status))
+        {
+            AcpiUtRemoveReference (ObjDesc);
+            return (Status);
+        }
+
+        ObjDesc->Package.Elements[i] = ElementDesc;
+    }
+
+    ObjDesc->Package.Flags |= AOPOBJ_DATA_VALID;
+    *ReturnObjDesc = ObjDesc;
+    return (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsSnapshotObjectPass
+ *
+ * PARAMETERS:  Type            - Object type of an object record
+ *
+ * RETURN:      Restore pass for the object
+ *
+ * DESCRIPTION: Objects are restored in several passes, so that the objects
+ *              referenced by a field exist before the field itself: buffer
+ *              fields refer to buffers, region fields to regions, bank
+ *              fields to region fields, and index fields to region or bank
+ *              fields.
+ *
+ ******************************************************************************/
+
+static UINT32
+AcpiNsSnapshotObjectPass (
+    UINT8                   Type)
+{
+
+    switch (Type)
+    {
+    case ACPI_TYPE_BUFFER_FIELD:
+    case ACPI_TYPE_LOCAL_REGION_FIELD:
+
+        return (1);
+
+    case ACPI_TYPE_LOCAL_BANK_FIELD:
+
+        return (2);
+
+    case ACPI_TYPE_LOCAL_INDEX_FIELD:
+
+        return (3);
+
+    default:
+
+        return (0);
+    }
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsRestoreField
+ *
+ * PARAMETERS:  Info            - Snapshot being restored
+ *              Source          - Owner table of the node
+ *              Node            - Node for the field
+ *              Object          - Field object record
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Create a Buffer, Region, Bank or Index field object and attach
+ *              it to its node, as AcpiExPrepFieldValue does. A buffer field
+ *              is only connected to its buffer if it was initialized.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsRestoreField (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    ACPI_NS_SNAPSHOT_SOURCE *Source,
+    ACPI_NAMESPACE_NODE     *Node,
+    ACPI_NS_SNAPSHOT_OBJECT *Object)
+{
+    ACPI_OPERAND_OBJECT     *ObjDesc;
+    ACPI_OPERAND_OBJECT     *ExtraDesc;
+    ACPI_OPERAND_OBJECT     *Related[2];
+    ACPI_NAMESPACE_NODE     *RelatedNode;
+    UINT8                   *Aml = NULL;
+    ACPI_STATUS             Status = AE_OK;
+    UINT32                  i;
+
+
+    /* Get the objects of the buffer, region, bank and index registers */
+
+    for (i = 0; i < 2; i++)
+    {
+        Related[i] = NULL;
+        if (Object->Type == ACPI_TYPE_BUFFER_FIELD &&
+            (i == 1 || !(Object->Flags & AOPOBJ_DATA_VALID)))
+        {
+            break;
+        }
+
+        if (i == 1 && Object->Type == ACPI_TYPE_LOCAL_REGION_FIELD)
+        {
+            break;
+        }
+
+        Status = AcpiNsSnapshotGetNode (Info, Object->Reference[i],
+            &RelatedNode);
+        if (ACPI_FAILURE (Status))
+        {
+            return (Status);
+        }
+
+        Related[i] = AcpiNsGetAttachedObject (RelatedNode);
+        if (!Related[i])
+        {
+            return (AE_BAD_DATA);
+        }
+    }
+
+    if (Object->Type == ACPI_TYPE_BUFFER_FIELD)
+    {
+        if (Related[0] && Related[0]->Common.Type != ACPI_TYPE_BUFFER)
+        {
+            return (AE_BAD_DATA);
+        }
+    }
+    else if (Object->Type != ACPI_TYPE_LOCAL_INDEX_FIELD &&
+        Related[0]->Common.Type != ACPI_TYPE_REGION)
+    {
+        return (AE_BAD_DATA);
+    }
+
+    if (Object->Type == ACPI_TYPE_LOCAL_REGION_FIELD &&
+        Object->ResourceLength)
+    {
+        Status = AcpiNsSnapshotGetAml (Source, Object->ResourceOffset,
+            Object->ResourceLength, &Aml);
+    }
+    else if (Object->Type == ACPI_TYPE_BUFFER_FIELD ||
+        Object->Type == ACPI_TYPE_LOCAL_BANK_FIELD)
+    {
+        Status = AcpiNsSnapshotGetAml (Source, Object->AmlOffset,
+            Object->AmlLength, &Aml);
+    }
+
+    if (ACPI_FAILURE (Status))
+    {
+        return (Status);
+    }
+
+    ObjDesc = AcpiUtCreateInternalObject (Object->Type);
+    if (!ObjDesc)
+    {
+        return (AE_NO_MEMORY);
+    }
+
+    ObjDesc->Common.Flags |= (Object->Flags & AOPOBJ_DATA_VALID);
+    ObjDesc->CommonField.Node = Node;
+    ObjDesc->CommonField.FieldFlags = Object->FieldFlags;
+    ObjDesc->CommonField.Attribute = Object->Attribute;
+    ObjDesc->CommonField.AccessByteWidth = Object->AccessByteWidth;
+    ObjDesc->CommonField.BitLength = Object->BitLength;
+    ObjDesc->CommonField.BaseByteOffset = Object->BaseByteOffset;
+    ObjDesc->CommonField.Value = Object->Value;
+    ObjDesc->CommonField.StartFieldBitOffset = Object->StartFieldBitOffset;
+    ObjDesc->CommonField.AccessLength = Object->AccessLength;
+
+    switch (Object->Type)
+    {
+    case ACPI_TYPE_BUFFER_FIELD:
+
+        ExtraDesc = AcpiNsGetSecondaryObject (ObjDesc);
+        ExtraDesc->Extra.AmlStart = Aml;
+        ExtraDesc->Extra.AmlLength = Object->AmlLength;
+        if (Related[0])
+        {
+            ObjDesc->BufferField.IsCreateField = Object->InfoFlags;
+            ObjDesc->BufferField.BufferObj = Related[0];
+            AcpiUtAddReference (Related[0]);
+        }
+        break;
+
+    case ACPI_TYPE_LOCAL_REGION_FIELD:
+
+        /* A region field does not hold a reference to its region */
+
+        ObjDesc->Field.RegionObj = Related[0];
+        ObjDesc->Field.ResourceBuffer = Aml;
+        ObjDesc->Field.ResourceLength = Object->ResourceLength;
+        ObjDesc->Field.PinNumberIndex = Object->Order;
+        break;
+
+    case ACPI_TYPE_LOCAL_BANK_FIELD:
+
+        ObjDesc->BankField.RegionObj = Related[0];
+        ObjDesc->BankField.BankObj = Related[1];
+        AcpiUtAddReference (Related[0]);
+        AcpiUtAddReference (Related[1]);
+
+        ExtraDesc = AcpiNsGetSecondaryObject (ObjDesc);
+        ExtraDesc->Extra.AmlStart = Aml;
+        ExtraDesc->Extra.AmlLength = Object->AmlLength;
+        break;
+
+    default: /* ACPI_TYPE_LOCAL_INDEX_FIELD */
+
+        ObjDesc->IndexField.IndexObj = Related[0];
+        ObjDesc->IndexField.DataObj = Related[1];
+        AcpiUtAddReference (Related[0]);
+        AcpiUtAddReference (Related[1]);
+        break;
+    }
+
+    Status = AcpiNsAttachObject (Node, ObjDesc, Node->Type);
+    AcpiUtRemoveReference (ObjDesc);
+    return (Status);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsRestoreObject
+ *
+ * PARAMETERS:  Info            - Snapshot being restored
+ *              Source          - Owner table of the node
+ *              Node            - Node for the object
+ *              Object          - Object record
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Create the object described by an object record and attach
+ *              it to its node, as the AcpiExCreate* functions do when the
+ *              table is parsed.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsRestoreObject (
+    ACPI_NS_SNAPSHOT_INFO   *Info,
+    ACPI_NS_SNAPSHOT_SOURCE *Source,
+    ACPI_NAMESPACE_NODE     *Node,
+    ACPI_NS_SNAPSHOT_OBJECT *Object)
+{
+    ACPI_OPERAND_OBJECT     *ObjDesc;
+    ACPI_OPERAND_OBJECT     *ExtraDesc;
+    ACPI_NAMESPACE_NODE     *TargetNode;
+    UINT8                   *Aml = NULL;
+    UINT8                   *Data = NULL;
+    ACPI_STATUS             Status;
+
+
+    /* All deferred AML must be within the owner table */
+
+    if (Object->AmlLength || Object->Type == ACPI_TYPE_METHOD)
+    {
+        Status = AcpiNsSnapshotGetAml (Source, Object->AmlOffset,
+            Object->AmlLength, &Aml);
+        if (ACPI_FAILURE (Status))
+        {
+            return (Status);
+        }
+    }
+
+    if (Object->Type == ACPI_TYPE_STRING ||
+        Object->Type == ACPI_TYPE_BUFFER)
+    {
+        Status = AcpiNsSnapshotGetData (Info, Object->Data,
+            Object->DataLength, &Data);
+        if (ACPI_FAILURE (Status))
+        {
+            return (Status);
+        }
+    }
+
+    switch (Object->Type)
+    {
+    case ACPI_TYPE_LOCAL_ALIAS:
+    case ACPI_TYPE_LOCAL_METHOD_ALIAS:
+
+        /* The target node is attached directly, as in AcpiExCreateAlias */
+
+        if (Node->Type != Object->Type)
+        {
+            return (AE_BAD_DATA);
+        }
+
+        Status = AcpiNsSnapshotGetNode (Info, Object->Reference[0],
+            &TargetNode);
+        if (ACPI_SUCCESS (Status))
+        {
+            Node->Object = ACPI_CAST_PTR (ACPI_OPERAND_OBJECT, TargetNode);
+        }
+        return (Status);
+
+    case ACPI_TYPE_BUFFER_FIELD:
+    case ACPI_TYPE_LOCAL_REGION_FIELD:
+    case ACPI_TYPE_LOCAL_BANK_FIELD:
+    case ACPI_TYPE_LOCAL_INDEX_FIELD:
+
+        return (AcpiNsRestoreField (Info, Source, Node, Object));
+
+    case ACPI_TYPE_INTEGER:
+    case ACPI_TYPE_STRING:
+    case ACPI_TYPE_BUFFER:
+    case ACPI_TYPE_PACKAGE:
+    case ACPI_TYPE_METHOD:
+    case ACPI_TYPE_MUTEX:
+    case ACPI_TYPE_EVENT:
+    case ACPI_TYPE_REGION:
+    case ACPI_TYPE_POWER:
+    case ACPI_TYPE_PROCESSOR:
+
+        break;
+
+    default:
+
+        return (AE_BAD_DATA);
+    }
+
+    if (Object->Type == ACPI_TYPE_PACKAGE)
+    {
+        Status = AcpiNsRestorePackage (Info, Object->Data,
+            Object->DataLength, 0, &ObjDesc);
+        if (ACPI_FAILURE (Status))
+        {
+            return (Status);
+        }
+    }
+    else if (Object->Type == ACPI_TYPE_STRING)
+    {
+        ObjDesc = AcpiUtCreateStringObject (Object->DataLength);
+    }
+    else if (Object->Type == ACPI_TYPE_BUFFER)
+    {
+        ObjDesc = AcpiUtCreateBufferObject (Object->DataLength);
+    }
+    else
+    {
+        ObjDesc = AcpiUtCreateInternalObject (Object->Type);
+    }
+
+    if (!ObjDesc)
+    {
+        return (AE_NO_MEMORY);
+    }
+
+    ObjDesc->Common.Flags &= ~(AOPOBJ_AML_CONSTANT | AOPOBJ_DATA_VALID);
+    ObjDesc->Common.Flags |=
+        (Object->Flags & (AOPOBJ_AML_CONSTANT | AOPOBJ_DATA_VALID));
+
+    Status = AE_OK;
+    switch (Object->Type)
+    {
+    case ACPI_TYPE_INTEGER:
+
+        ObjDesc->Integer.Value = Object->Integer;
+        break;
+
+    case ACPI_TYPE_STRING:
+
+        memcpy (ObjDesc->String.Pointer, Data, Object->DataLength);
+        break;
+
+    case ACPI_TYPE_BUFFER:
+
+        if (Object->InfoFlags)
+        {
+            /* Named buffer, see AcpiDsInitObjectFromOp */
+
+            ObjDesc->Buffer.Node = Node;
+            ObjDesc->Buffer.AmlStart = Aml;
+            ObjDesc->Buffer.AmlLength = Object->AmlLength;
+        }
+
+        if (Object->DataLength)
+        {
+            memcpy (ObjDesc->Buffer.Pointer, Data, Object->DataLength);
+        }
+        break;
+
+    case ACPI_TYPE_PACKAGE:
+
+        ObjDesc->Package.Node = Node;
+        break;
+
+    case ACPI_TYPE_METHOD:
+
+        ObjDesc->Method.AmlStart = Aml;
+        ObjDesc->Method.AmlLength = Object->AmlLength;
+        ObjDesc->Method.Node = ACPI_CAST_PTR (ACPI_OPERAND_OBJECT, Node);
+        ObjDesc->Method.ParamCount = Object->ParamCount;
+        ObjDesc->Method.InfoFlags = Object->InfoFlags &
+            (ACPI_METHOD_SERIALIZED | ACPI_METHOD_IGNORE_SYNC_LEVEL);
+        ObjDesc->Method.SyncLevel = Object->SyncLevel;
+        break;
+
+    case ACPI_TYPE_MUTEX:
+
+        Status = AcpiOsCreateMutex (&ObjDesc->Mutex.OsMutex);
+        ObjDesc->Mutex.SyncLevel = Object->SyncLevel;
+        ObjDesc->Mutex.Node = Node;
+        break;
+
+    case ACPI_TYPE_EVENT:
+
+        Status = AcpiOsCreateSemaphore (ACPI_NO_UNIT_LIMIT, 0,
+            &ObjDesc->Event.OsSemaphore);
+        break;
+
+    case ACPI_TYPE_REGION:
+
+        ExtraDesc = AcpiNsGetSecondaryObject (ObjDesc);
+        ExtraDesc->Extra.AmlStart = Aml;
+        ExtraDesc->Extra.AmlLength = Object->AmlLength;
+        ExtraDesc->Extra.Method_REG = NULL;
+        ExtraDesc->Extra.ScopeNode = Node;
+        if (Object->Reference[0])
+        {
+            Status = AcpiNsSnapshotGetNode (Info, Object->Reference[0],
+                &ExtraDesc->Extra.ScopeNode);
+        }
+
+        ObjDesc->Region.SpaceId = Object->SpaceId;
+        ObjDesc->Region.Node = Node;
+
+        /* Evaluated regions, see AcpiDsEvalRegionOperands */
+
+        if (ACPI_SUCCESS (Status) &&
+            (Object->Flags & AOPOBJ_DATA_VALID))
+        {
+            ObjDesc->Region.Address = Object->Integer;
+            ObjDesc->Region.Length = Object->Value;
+            Status = AcpiUtAddAddressRange (ObjDesc->Region.SpaceId,
+                ObjDesc->Region.Address, ObjDesc->Region.Length, Node);
+        }
+        break;
+
+    case ACPI_TYPE_POWER:
+
+        ObjDesc->PowerResource.SystemLevel = Object->SyncLevel;
+        ObjDesc->PowerResource.ResourceOrder = Object->Order;
+        break;
+
+    case ACPI_TYPE_PROCESSOR:
+
+        ObjDesc->Processor.ProcId = Object->SpaceId;
+        ObjDesc->Processor.Length = Object->Length;
+        ObjDesc->Processor.Address = (ACPI_IO_ADDRESS) Object->Integer;
+        break;
+
+    default:
+
+        break;
+    }
+
+    if (ACPI_SUCCESS (Status))
+    {
+        Status = AcpiNsAttachObject (Node, ObjDesc, Node->Type);
+    }
+
+    AcpiUtRemoveReference (ObjDesc);
+    return (Status);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsRestoreNamespace
+ *
+ * PARAMETERS:  Info            - Snapshot being restored, with owner IDs
+ *                                allocated for all of its tables
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Create the nodes and objects of a snapshot. On failure, the
+ *              caller deletes everything owned by the snapshot tables.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsRestoreNamespace (
+    ACPI_NS_SNAPSHOT_INFO   *Info)
+{
+    ACPI_NS_SNAPSHOT_NODE   *Record;
+    ACPI_NS_SNAPSHOT_OBJECT *Object;
+    ACPI_NAMESPACE_NODE     *ParentNode;
+    ACPI_NAMESPACE_NODE     *Node;
+    ACPI_STATUS             Status;
+    UINT32                  Pass;
+    UINT32                  i;
+
+
+    ACPI_FUNCTION_TRACE (NsRestoreNamespace);
+
+
+    /* Create the nodes. Parents are always ahead of their children */
+
+    for (i = 0; i < Info->NodeCount; i++)
+    {
+        Record = &Info->Nodes[i];
+        if (Record->Parent == ACPI_NS_SNAPSHOT_ROOT)
+        {
+            ParentNode = AcpiGbl_RootNode;
+        }
+        else if (Record->Parent < i)
+        {
+            ParentNode = Info->NsNodes[Record->Parent];
+        }
+        else
+        {
+            return_ACPI_STATUS (AE_BAD_DATA);
+        }
+
+        if (!AcpiUtValidNameseg (ACPI_CAST_PTR (char, &Record->Name)) ||
+            Record->Type > ACPI_TYPE_LOCAL_MAX)
+        {
+            return_ACPI_STATUS (AE_BAD_DATA);
+        }
+
+        Status = AcpiNsSearchOneScope (Record->Name, ParentNode,
+            ACPI_TYPE_ANY, &Node);
+
+        if (Record->Table == ACPI_NS_SNAPSHOT_EXISTING)
+        {
+            if (ACPI_FAILURE (Status))
+            {
+                ACPI_ERROR ((AE_INFO,
+                    "Namespace snapshot: [%4.4s] does not exist",
+                    ACPI_CAST_PTR (char, &Record->Name)));
+                return_ACPI_STATUS (Status);
+            }
+
+            Info->NsNodes[i] = Node;
+            continue;
+        }
+
+        if (ACPI_SUCCESS (Status))
+        {
+            ACPI_ERROR ((AE_INFO,
+                "Namespace snapshot: [%4.4s] already exists",
+                ACPI_CAST_PTR (char, &Record->Name)));
+            return_ACPI_STATUS (AE_ALREADY_EXISTS);
+        }
+
+        if (Record->Table >= Info->SourceCount ||
+            Record->Object > Info->ObjectCount)
+        {
+            return_ACPI_STATUS (AE_BAD_DATA);
+        }
+
+        Node = AcpiNsCreateNode (Record->Name,
+            Info->Sources[Record->Table].OwnerId);
+        if (!Node)
+        {
+            return_ACPI_STATUS (AE_NO_MEMORY);
+        }
+
+        AcpiNsInstallNode (NULL, ParentNode, Node, Record->Type);
+        AcpiNsSetNodeOwner (Node, Info->Sources[Record->Table].OwnerId);
+        Node->Flags = (UINT8) Record->Flags;
+        Info->NsNodes[i] = Node;
+    }
+
+    /* Create the objects, see AcpiNsSnapshotObjectPass */
+
+    for (Pass = 0; Pass <= 3; Pass++)
+    {
+        for (i = 0; i < Info->NodeCount; i++)
+        {
+            Record = &Info->Nodes[i];
+            if (Record->Table == ACPI_NS_SNAPSHOT_EXISTING ||
+                !Record->Object)
+            {
+                continue;
+            }
+
+            Object = &Info->Objects[Record->Object - 1];
+            if (AcpiNsSnapshotObjectPass (Object->Type) != Pass)
+            {
+                continue;
+            }
+
+            Status = AcpiNsRestoreObject (Info,
+                &Info->Sources[Record->Table], Info->NsNodes[i], Object);
+            if (ACPI_FAILURE (Status))
+            {
+                ACPI_EXCEPTION ((AE_INFO, Status,
+                    "Namespace snapshot: cannot restore [%4.4s]",
+                    AcpiUtGetNodeName (Info->NsNodes[i])));
+                return_ACPI_STATUS (Status);
+            }
+        }
+    }
+
+    return_ACPI_STATUS (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsRestoreSnapshot
+ *
+ * PARAMETERS:  Snapshot        - Snapshot image, 8-byte aligned
+ *              Length          - Length of the buffer holding the image
+ *              TablesLoaded    - Where the number of tables is returned
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Materialize the namespace of the DSDT and SSDTs from a
+ *              snapshot, instead of loading the tables. The snapshot must
+ *              have been created from the same tables, which must all be
+ *              installed and not loaded. On success, the tables are marked
+ *              as loaded and the regions are initialized, as after a
+ *              normal table load. On failure, nothing is changed.
+ *
+ *              The image is only read, and is not referenced after return.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiNsRestoreSnapshot (
+    void                    *Snapshot,
+    UINT32                  Length,
+    UINT32                  *TablesLoaded)
+{
+    ACPI_NS_SNAPSHOT_HEADER *Header = Snapshot;
+    ACPI_NS_SNAPSHOT_TABLE  *Key;
+    ACPI_NS_SNAPSHOT_INFO   *Info;
+    ACPI_TABLE_HEADER       *Table;
+    ACPI_NAMESPACE_NODE     *Node;
+    ACPI_STATUS             Status;
+    UINT32                  i;
+
+
+    ACPI_FUNCTION_TRACE (NsRestoreSnapshot);
+
+
+    Status = AcpiNsSnapshotValidate (Header, Length);
+    if (ACPI_FAILURE (Status))
+    {
+        return_ACPI_STATUS (Status);
+    }
+
+    Info = ACPI_ALLOCATE_ZEROED (sizeof (ACPI_NS_SNAPSHOT_INFO));
+    if (!Info)
+    {
+        return_ACPI_STATUS (AE_NO_MEMORY);
+    }
+
+    Info->Nodes = ACPI_ADD_PTR (ACPI_NS_SNAPSHOT_NODE, Header, Header->NodeOffset);
+    Info->Objects = ACPI_ADD_PTR (ACPI_NS_SNAPSHOT_OBJECT, Header, Header->ObjectOffset);
+    Info->Data = ACPI_ADD_PTR (UINT8, Header, Header->DataOffset);
+    Info->NodeCount = Header->NodeCount;
+    Info->ObjectCount = Header->ObjectCount;
+    Info->DataLength = Header->DataLength;
+
+    /* The tables must match the snapshot keys exactly, in order */
+
+    Status = AcpiNsGetSnapshotTables (FALSE, &Info->Sources, &Info->SourceCount);
+    if (ACPI_FAILURE (Status))
+    {
+        goto Exit;
+    }
+
+    if (Info->SourceCount != Header->TableCount)
+    {
+        Status = AE_NOT_FOUND;
+        goto Exit;
+    }
+
+    Key = ACPI_ADD_PTR (ACPI_NS_SNAPSHOT_TABLE, Header, Header->TableOffset);
+    for (i = 0; i < Info->SourceCount; i++, Key++)
+    {
+        Table = ACPI_CAST_PTR (ACPI_TABLE_HEADER, Info->Sources[i].Aml);
+        if (!ACPI_COMPARE_NAMESEG (Key->Signature, Table->Signature) ||
+            Key->Length != Table->Length ||
+            Key->OemRevision != Table->OemRevision ||
+            Key->Checksum != Table->Checksum ||
+            memcmp (Key->OemId, Table->OemId, ACPI_OEM_ID_SIZE) ||
+            memcmp (Key->OemTableId, Table->OemTableId, ACPI_OEM_TABLE_ID_SIZE))
+        {
+            ACPI_DEBUG_PRINT ((ACPI_DB_INFO,
+                "Namespace snapshot does not match table [%4.4s]\n",
+                Table->Signature));
+            Status = AE_NOT_FOUND;
+            goto Exit;
+        }
+    }
+
+    if (Info->NodeCount)
+    {
+        Info->NsNodes = ACPI_ALLOCATE_ZEROED (
+            (ACPI_SIZE) Info->NodeCount * sizeof (ACPI_NAMESPACE_NODE *));
+        if (!Info->NsNodes)
+        {
+            Status = AE_NO_MEMORY;
+            goto Exit;
+        }
+    }
+
+    /* Same ownership and node allocation as AcpiNsLoadTable */
+
+    for (i = 0; i < Info->SourceCount; i++)
+    {
+        Status = AcpiTbAllocateOwnerId (Info->Sources[i].TableIndex);
+        if (ACPI_FAILURE (Status))
+        {
+            break;
+        }
+
+        (void) AcpiTbGetOwnerId (Info->Sources[i].TableIndex,
+            &Info->Sources[i].OwnerId);
+        AcpiNsArenaBegin (&Info->Sources[i].Arena, Info->Sources[i].OwnerId);
+    }
+
+    if (ACPI_SUCCESS (Status))
+    {
+        Status = AcpiUtAcquireMutex (ACPI_MTX_NAMESPACE);
+        if (ACPI_SUCCESS (Status))
+        {
+            Status = AcpiNsRestoreNamespace (Info);
+            (void) AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
+        }
+    }
+
+    for (i = 0; i < Info->SourceCount; i++)
+    {
+        AcpiNsArenaEnd (&Info->Sources[i].Arena);
+    }
+
+    if (ACPI_FAILURE (Status))
+    {
+        /* Delete any namespace objects created so far */
+
+        for (i = 0; i < Info->SourceCount; i++)
+        {
+            if (Info->Sources[i].OwnerId)
+            {
+                AcpiNsDeleteNamespaceByOwner (Info->Sources[i].OwnerId);
+                (void) AcpiTbReleaseOwnerId (Info->Sources[i].TableIndex);
+            }
+        }
+
+        goto Exit;
+    }
+
+    for (i = 0; i < Info->SourceCount; i++)
+    {
+        AcpiTbSetTableLoadedFlag (Info->Sources[i].TableIndex, TRUE);
+    }
+
+    AcpiNsInvalidateDeviceIds ();
+
+    /* Initialize the regions, as AcpiDsInitializeObjects does */
+
+    AcpiExEnterInterpreter ();
+
+    for (i = 0; i < Info->NodeCount; i++)
+    {
+        Node = Info->NsNodes[i];
+        if (Info->Nodes[i].Table != ACPI_NS_SNAPSHOT_EXISTING &&
+            Node->Type == ACPI_TYPE_REGION)
+        {
+            (void) AcpiDsInitializeRegion (Node);
+        }
+    }
+
+    AcpiExExitInterpreter ();
+
+    ACPI_DEBUG_PRINT ((ACPI_DB_INIT,
+        "Restored %u nodes and %u objects from namespace snapshot\n",
+        Info->NodeCount, Info->ObjectCount));
+    *TablesLoaded = Info->SourceCount;
+
+Exit:
+    if (Info->NsNodes)
+    {
+        ACPI_FREE (Info->NsNodes);
+    }
+
+    if (Info->Sources)
+    {
+        AcpiNsFreeSnapshotTables (Info->Sources, Info->SourceCount);
+    }
+
+    ACPI_FREE (Info);
+    return_ACPI_STATUS (Status);
+}
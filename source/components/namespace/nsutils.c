@@ -756,6 +756,11 @@ AcpiNsTerminate (
     AcpiNsDeleteNode (AcpiGbl_RootNode);
     (void) AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
 
+    /* Free the device ID index and the node arena slab table */
+
+    AcpiNsDeleteDeviceIds ();
+    AcpiNsArenaTerminate ();
+
     ACPI_DEBUG_PRINT ((ACPI_DB_INFO, "Namespace freed\n"));
     return_VOID;
 }
@@ -791,6 +796,39 @@ AcpiNsOpensScope (
 }
 
 
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsIsMethodLocal
+ *
+ * PARAMETERS:  Node        - Node to check
+ *
+ * RETURN:      TRUE if the node is within the scope of a control method
+ *
+ * DESCRIPTION: Check for a node that was created by a running method in its
+ *              own scope. Such nodes are deleted when the method exits.
+ *
+ ******************************************************************************/
+
+BOOLEAN
+AcpiNsIsMethodLocal (
+    ACPI_NAMESPACE_NODE     *Node)
+{
+    ACPI_NAMESPACE_NODE     *ParentNode;
+
+
+    for (ParentNode = Node->Parent; ParentNode;
+        ParentNode = ParentNode->Parent)
+    {
+        if (ParentNode->Type == ACPI_TYPE_METHOD)
+        {
+            return (TRUE);
+        }
+    }
+
+    return (FALSE);
+}
+
+
 /*******************************************************************************
  *
  * FUNCTION:    AcpiNsGetNodeUnlocked
@@ -849,6 +887,17 @@ AcpiNsGetNodeUnlocked (
         return_ACPI_STATUS (AE_OK);
     }
 
+    /* Absolute paths do not depend on the prefix, check the lookup cache */
+
+    if (ACPI_IS_ROOT_PREFIX (Pathname[0]))
+    {
+        *ReturnNode = AcpiNsPathCacheLookup (Pathname);
+        if (*ReturnNode)
+        {
+            return_ACPI_STATUS (AE_OK);
+        }
+    }
+
     /* Convert path to internal representation */
 
     Status = AcpiNsInternalizeName (Pathname, &InternalPath);
@@ -871,6 +920,10 @@ AcpiNsGetNodeUnlocked (
         ACPI_DEBUG_PRINT ((ACPI_DB_EXEC, "%s, %s\n",
             Pathname, AcpiFormatException (Status)));
     }
+    else if (ACPI_IS_ROOT_PREFIX (Pathname[0]))
+    {
+        AcpiNsPathCacheInsert (Pathname, *ReturnNode);
+    }
 
     ACPI_FREE (InternalPath);
     return_ACPI_STATUS (Status);
@@ -893,9 +946,10 @@ AcpiNsGetNodeUnlocked (
  *              ReturnNode  - Where the Node is returned
  *
  * DESCRIPTION: Look up a name relative to a given scope and return the
- *              corresponding Node. NOTE: Scope can be null.
+ *              corresponding Node. NOTE: Scope can be null. Successful
+ *              lookups of absolute pathnames are cached (nscache.c).
  *
- * MUTEX:       Locks namespace
+ * MUTEX:       Locks namespace (shared)
  *
  ******************************************************************************/
 
@@ -912,7 +966,7 @@ AcpiNsGetNode (
     ACPI_FUNCTION_TRACE_PTR (NsGetNode, ACPI_CAST_PTR (char, Pathname));
 
 
-    Status = AcpiUtAcquireMutex (ACPI_MTX_NAMESPACE);
+    Status = AcpiUtAcquireSharedMutex (ACPI_MTX_NAMESPACE);
     if (ACPI_FAILURE (Status))
     {
         return_ACPI_STATUS (Status);
@@ -921,6 +975,6 @@ AcpiNsGetNode (
     Status = AcpiNsGetNodeUnlocked (PrefixNode, Pathname,
         Flags, ReturnNode);
 
-    (void) AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
+    (void) AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
     return_ACPI_STATUS (Status);
 }
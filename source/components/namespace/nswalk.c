@@ -161,7 +161,8 @@ AcpiNsGetNextNodeTyped (
  *              StartNode           - Handle in namespace where search begins
  *              MaxDepth            - Depth to which search is to reach
  *              Flags               - Whether to unlock the NS before invoking
- *                                    the callback routine
+ *                                    the callback routine, and whether the
+ *                                    caller holds it shared
  *              DescendingCallback  - Called during tree descent
  *                                    when an object of "Type" is found
  *              AscendingCallback   - Called during tree ascent
@@ -267,7 +268,15 @@ AcpiNsWalkNamespace (
              */
             if (Flags & ACPI_NS_WALK_UNLOCK)
             {
-                MutexStatus = AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
+                if (Flags & ACPI_NS_WALK_SHARED)
+                {
+                    MutexStatus = AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
+                }
+                else
+                {
+                    MutexStatus = AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
+                }
+
                 if (ACPI_FAILURE (MutexStatus))
                 {
                     return_ACPI_STATUS (MutexStatus);
@@ -297,7 +306,15 @@ AcpiNsWalkNamespace (
 
             if (Flags & ACPI_NS_WALK_UNLOCK)
             {
-                MutexStatus = AcpiUtAcquireMutex (ACPI_MTX_NAMESPACE);
+                if (Flags & ACPI_NS_WALK_SHARED)
+                {
+                    MutexStatus = AcpiUtAcquireSharedMutex (ACPI_MTX_NAMESPACE);
+                }
+                else
+                {
+                    MutexStatus = AcpiUtAcquireMutex (ACPI_MTX_NAMESPACE);
+                }
+
                 if (ACPI_FAILURE (MutexStatus))
                 {
                     return_ACPI_STATUS (MutexStatus);
@@ -59,6 +59,32 @@ static void
 AcpiNsResolveReferences (
     ACPI_EVALUATE_INFO      *Info);
 
+static ACPI_STATUS
+AcpiNsSetupEvaluation (
+    ACPI_EVALUATE_INFO      *Info,
+    ACPI_HANDLE             Handle,
+    ACPI_STRING             Pathname,
+    ACPI_OBJECT_LIST        *ExternalParams);
+
+static ACPI_STATUS
+AcpiNsReturnExternalObject (
+    ACPI_EVALUATE_INFO      *Info,
+    ACPI_STATUS             Status,
+    ACPI_BUFFER             *ReturnBuffer);
+
+static void
+AcpiNsAsyncEvaluationDone (
+    ACPI_COROUTINE          *Coroutine,
+    ACPI_STATUS             Status);
+
+static ACPI_STATUS
+AcpiNsGetIndexedDevices (
+    ACPI_GET_DEVICES_INFO   *Info,
+    ACPI_NS_DEVICE_ID       *Matches,
+    UINT32                  Count,
+    UINT32                  Generation,
+    void                    **ReturnValue);
+
 
 /*******************************************************************************
  *
@@ -93,6 +119,7 @@ AcpiEvaluateObjectTyped (
     BOOLEAN                 FreeBufferOnError = FALSE;
     ACPI_HANDLE             TargetHandle;
     char                    *FullPathname;
+    BOOLEAN                 Cached = FALSE;
 
 
     ACPI_FUNCTION_TRACE (AcpiEvaluateObjectTyped);
@@ -122,7 +149,18 @@ AcpiEvaluateObjectTyped (
         }
     }
 
-    FullPathname = AcpiNsGetExternalPathname (TargetHandle);
+    if (AcpiGbl_EnablePathnameCache)
+    {
+        /* Use the pathname cached on the node, no allocation once filled */
+
+        FullPathname = AcpiNsGetCachedPathname (
+            AcpiNsValidateHandle (TargetHandle), &Cached);
+    }
+    else
+    {
+        FullPathname = AcpiNsGetExternalPathname (TargetHandle);
+    }
+
     if (!FullPathname)
     {
         return_ACPI_STATUS (AE_NO_MEMORY);
@@ -186,7 +224,7 @@ AcpiEvaluateObjectTyped (
     Status = AE_TYPE;
 
 Exit:
-    ACPI_FREE (FullPathname);
+    AcpiNsReleaseCachedPathname (FullPathname, Cached);
     return_ACPI_STATUS (Status);
 }
 
@@ -195,55 +233,40 @@ ACPI_EXPORT_SYMBOL (AcpiEvaluateObjectTyped)
 
 /*******************************************************************************
  *
- * FUNCTION:    AcpiEvaluateObject
+ * FUNCTION:    AcpiNsSetupEvaluation
  *
- * PARAMETERS:  Handle              - Object handle (optional)
+ * PARAMETERS:  Info                - Zeroed evaluation info block
+ *              Handle              - Object handle (optional)
  *              Pathname            - Object pathname (optional)
  *              ExternalParams      - List of parameters to pass to method,
- *                                    terminated by NULL. May be NULL
- *                                    if no parameters are being passed.
- *              ReturnBuffer        - Where to put method's return value (if
- *                                    any). If NULL, no value is returned.
+ *                                    may be NULL
  *
  * RETURN:      Status
  *
- * DESCRIPTION: Find and evaluate the given object, passing the given
- *              parameters if necessary. One of "Handle" or "Pathname" must
- *              be valid (non-null)
+ * DESCRIPTION: Set up the prefix node and pathname of an evaluation request
+ *              and convert the external arguments to internal objects. On
+ *              failure, any converted arguments are left in Info->Parameters
+ *              for the caller to delete.
  *
  ******************************************************************************/
 
-ACPI_STATUS
-AcpiEvaluateObject (
+static ACPI_STATUS
+AcpiNsSetupEvaluation (
+    ACPI_EVALUATE_INFO      *Info,
     ACPI_HANDLE             Handle,
     ACPI_STRING             Pathname,
-    ACPI_OBJECT_LIST        *ExternalParams,
-    ACPI_BUFFER             *ReturnBuffer)
+    ACPI_OBJECT_LIST        *ExternalParams)
 {
     ACPI_STATUS             Status;
-    ACPI_EVALUATE_INFO      *Info;
-    ACPI_SIZE               BufferSpaceNeeded;
     UINT32                  i;
 
 
-    ACPI_FUNCTION_TRACE (AcpiEvaluateObject);
-
-
-    /* Allocate and initialize the evaluation information block */
-
-    Info = ACPI_ALLOCATE_ZEROED (sizeof (ACPI_EVALUATE_INFO));
-    if (!Info)
-    {
-        return_ACPI_STATUS (AE_NO_MEMORY);
-    }
-
     /* Convert and validate the device handle */
 
     Info->PrefixNode = AcpiNsValidateHandle (Handle);
     if (!Info->PrefixNode)
     {
-        Status = AE_BAD_PARAMETER;
-        goto Cleanup;
+        return (AE_BAD_PARAMETER);
     }
 
     /*
@@ -279,8 +302,7 @@ AcpiEvaluateObject (
                 "Null Handle with relative pathname [%s]", Pathname));
         }
 
-        Status = AE_BAD_PARAMETER;
-        goto Cleanup;
+        return (AE_BAD_PARAMETER);
     }
 
     Info->RelativePathname = Pathname;
@@ -312,8 +334,7 @@ AcpiEvaluateObject (
             ((ACPI_SIZE) Info->ParamCount + 1) * sizeof (void *));
         if (!Info->Parameters)
         {
-            Status = AE_NO_MEMORY;
-            goto Cleanup;
+            return (AE_NO_MEMORY);
         }
 
         /* Convert each external object in the list to an internal object */
@@ -324,13 +345,68 @@ AcpiEvaluateObject (
                 &ExternalParams->Pointer[i], &Info->Parameters[i]);
             if (ACPI_FAILURE (Status))
             {
-                goto Cleanup;
+                return (Status);
             }
         }
 
         Info->Parameters[Info->ParamCount] = NULL;
     }
 
+    return (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiEvaluateObject
+ *
+ * PARAMETERS:  Handle              - Object handle (optional)
+ *              Pathname            - Object pathname (optional)
+ *              ExternalParams      - List of parameters to pass to method,
+ *                                    terminated by NULL. May be NULL
+ *                                    if no parameters are being passed.
+ *              ReturnBuffer        - Where to put method's return value (if
+ *                                    any). If NULL, no value is returned.
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Find and evaluate the given object, passing the given
+ *              parameters if necessary. One of "Handle" or "Pathname" must
+ *              be valid (non-null)
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiEvaluateObject (
+    ACPI_HANDLE             Handle,
+    ACPI_STRING             Pathname,
+    ACPI_OBJECT_LIST        *ExternalParams,
+    ACPI_BUFFER             *ReturnBuffer)
+{
+    ACPI_STATUS             Status;
+    ACPI_EVALUATE_INFO      *Info;
+#ifdef _FUTURE_FEATURE
+    UINT32                  i;
+#endif
+
+
+    ACPI_FUNCTION_TRACE (AcpiEvaluateObject);
+
+
+    /* Allocate and initialize the evaluation information block */
+
+    Info = ACPI_ALLOCATE_ZEROED (sizeof (ACPI_EVALUATE_INFO));
+    if (!Info)
+    {
+        return_ACPI_STATUS (AE_NO_MEMORY);
+    }
+
+    Status = AcpiNsSetupEvaluation (Info, Handle, Pathname, ExternalParams);
+    if (ACPI_FAILURE (Status))
+    {
+        goto Cleanup;
+    }
+
 
 #ifdef _FUTURE_FEATURE
 
@@ -421,6 +497,58 @@ AcpiEvaluateObject (
 
     Status = AcpiNsEvaluate (Info);
 
+    /* Copy the return value (if any) to the caller's buffer */
+
+    Status = AcpiNsReturnExternalObject (Info, Status, ReturnBuffer);
+
+
+Cleanup:
+
+    /* Free the input parameter list (if we created one) */
+
+    if (Info->Parameters)
+    {
+        /* Free the allocated parameter block */
+
+        AcpiUtDeleteInternalObjectList (Info->Parameters);
+    }
+
+    ACPI_FREE (Info);
+    return_ACPI_STATUS (Status);
+}
+
+ACPI_EXPORT_SYMBOL (AcpiEvaluateObject)
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsReturnExternalObject
+ *
+ * PARAMETERS:  Info                - Evaluation info block after
+ *                                    AcpiNsEvaluate
+ *              Status              - Status of the evaluation
+ *              ReturnBuffer        - Where to put the return value (if
+ *                                    any). If NULL, no value is returned.
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Copy the internal return object of an evaluation to the
+ *              caller's buffer as an external object, and delete it.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsReturnExternalObject (
+    ACPI_EVALUATE_INFO      *Info,
+    ACPI_STATUS             Status,
+    ACPI_BUFFER             *ReturnBuffer)
+{
+    ACPI_SIZE               BufferSpaceNeeded;
+
+
+    ACPI_FUNCTION_TRACE (NsReturnExternalObject);
+
+
     /*
      * If we are expecting a return value, and all went well above,
      * copy the return value to an external object.
@@ -433,7 +561,7 @@ AcpiEvaluateObject (
     if (!Info->ReturnObject)
     {
         ReturnBuffer->Length = 0;
-        goto Cleanup;
+        return_ACPI_STATUS (Status);
     }
 
     if (ACPI_GET_DESCRIPTOR_TYPE (Info->ReturnObject) ==
@@ -507,23 +635,323 @@ CleanupReturnObject:
         AcpiExExitInterpreter ();
     }
 
+    return_ACPI_STATUS (Status);
+}
 
-Cleanup:
 
-    /* Free the input parameter list (if we created one) */
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiEvaluateObjectAsync
+ *
+ * PARAMETERS:  Handle              - Object handle (optional)
+ *              Pathname            - Object pathname (optional)
+ *              ExternalParams      - List of parameters to pass to method,
+ *                                    terminated by NULL. May be NULL
+ *                                    if no parameters are being passed.
+ *              Callback            - Called when the evaluation completes
+ *              Context             - Passed to Callback
+ *
+ * RETURN:      Status of starting the evaluation. If AE_OK, the status and
+ *              return value of the evaluation are passed to Callback.
+ *
+ * DESCRIPTION: Evaluate an object as AcpiEvaluateObject does, on one of the
+ *              worker threads of the cooperative scheduler (nsasync.c).
+ *              The evaluation does not block a thread while the AML
+ *              sleeps, so that many evaluations can be in flight on a few
+ *              workers. Callback is called on a worker thread, with a
+ *              return buffer allocated as for ACPI_ALLOCATE_BUFFER (free
+ *              it with AcpiOsFree).
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiEvaluateObjectAsync (
+    ACPI_HANDLE             Handle,
+    ACPI_STRING             Pathname,
+    ACPI_OBJECT_LIST        *ExternalParams,
+    ACPI_EVALUATE_CALLBACK  Callback,
+    void                    *Context)
+{
+    ACPI_STATUS             Status;
+    ACPI_EVALUATE_INFO      *Info;
+
+
+    ACPI_FUNCTION_TRACE (AcpiEvaluateObjectAsync);
+
+
+    if (!Callback)
+    {
+        return_ACPI_STATUS (AE_BAD_PARAMETER);
+    }
+
+    /* Allocate and initialize the evaluation information block */
+
+    Info = ACPI_ALLOCATE_ZEROED (sizeof (ACPI_EVALUATE_INFO));
+    if (!Info)
+    {
+        return_ACPI_STATUS (AE_NO_MEMORY);
+    }
+
+    Status = AcpiNsSetupEvaluation (Info, Handle, Pathname, ExternalParams);
+    if (ACPI_SUCCESS (Status))
+    {
+        /* Info is freed by AcpiNsAsyncEvaluationDone from now on */
+
+        Status = AcpiNsEvaluateAsync (Info, AcpiNsAsyncEvaluationDone,
+            Callback, Context);
+        if (ACPI_SUCCESS (Status))
+        {
+            return_ACPI_STATUS (Status);
+        }
+    }
 
     if (Info->Parameters)
     {
-        /* Free the allocated parameter block */
+        AcpiUtDeleteInternalObjectList (Info->Parameters);
+    }
+
+    ACPI_FREE (Info);
+    return_ACPI_STATUS (Status);
+}
+
+ACPI_EXPORT_SYMBOL (AcpiEvaluateObjectAsync)
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsAsyncEvaluationDone
+ *
+ * PARAMETERS:  Coroutine           - A completed AcpiEvaluateObjectAsync
+ *                                    evaluation
+ *              Status              - Status of the evaluation
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Copy the return value to a new external buffer, free the
+ *              evaluation info and call the completion callback.
+ *
+ ******************************************************************************/
+
+static void
+AcpiNsAsyncEvaluationDone (
+    ACPI_COROUTINE          *Coroutine,
+    ACPI_STATUS             Status)
+{
+    ACPI_EVALUATE_INFO      *Info = Coroutine->Info;
+    ACPI_BUFFER             ReturnBuffer;
+
 
+    ACPI_FUNCTION_TRACE (NsAsyncEvaluationDone);
+
+
+    ReturnBuffer.Length = ACPI_ALLOCATE_BUFFER;
+    ReturnBuffer.Pointer = NULL;
+
+    Status = AcpiNsReturnExternalObject (Info, Status, &ReturnBuffer);
+    if (ACPI_FAILURE (Status))
+    {
+        if (ReturnBuffer.Pointer)
+        {
+            AcpiOsFree (ReturnBuffer.Pointer);
+        }
+
+        ReturnBuffer.Length = 0;
+        ReturnBuffer.Pointer = NULL;
+    }
+
+    if (Info->Parameters)
+    {
         AcpiUtDeleteInternalObjectList (Info->Parameters);
     }
 
     ACPI_FREE (Info);
+    Coroutine->Callback (Status, &ReturnBuffer, Coroutine->Context);
+    return_VOID;
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiEvaluateObjects
+ *
+ * PARAMETERS:  Items               - Objects to evaluate. Handle, Pathname
+ *                                    and Parameters of each item are as for
+ *                                    AcpiEvaluateObject
+ *              Count               - Number of items
+ *              ReturnBuffer        - Where to put the return values (if
+ *                                    any). If NULL, no values are returned.
+ *
+ * RETURN:      Status. The status of each evaluation is returned in
+ *              Items[i].Status.
+ *
+ * DESCRIPTION: Evaluate a list of objects with a single interpreter entry.
+ *              All return values are copied into one return buffer, and
+ *              Items[i].ReturnObject is set to the external object of each
+ *              item that returned a value. If the buffer is too small,
+ *              AE_BUFFER_OVERFLOW is returned along with the required
+ *              length; the objects have been evaluated in that case, but no
+ *              values are returned.
+ *
+ *              Other threads cannot enter the interpreter until all of the
+ *              items have been evaluated, except while a method waits.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiEvaluateObjects (
+    ACPI_EVALUATE_ITEM      *Items,
+    UINT32                  Count,
+    ACPI_BUFFER             *ReturnBuffer)
+{
+    ACPI_STATUS             Status = AE_OK;
+    ACPI_EVALUATE_INFO      *InfoList;
+    ACPI_EVALUATE_INFO      *Info;
+    ACPI_SIZE               *ObjectSizes;
+    ACPI_SIZE               BufferSpaceNeeded = 0;
+    ACPI_BUFFER             ItemBuffer;
+    UINT8                   *Pointer;
+    UINT32                  i;
+
+
+    ACPI_FUNCTION_TRACE (AcpiEvaluateObjects);
+
+
+    if (!Items || !Count)
+    {
+        return_ACPI_STATUS (AE_BAD_PARAMETER);
+    }
+
+    /* One allocation for all of the info blocks and return object sizes */
+
+    InfoList = ACPI_ALLOCATE_ZEROED ((ACPI_SIZE) Count *
+        (sizeof (ACPI_EVALUATE_INFO) + sizeof (ACPI_SIZE)));
+    if (!InfoList)
+    {
+        return_ACPI_STATUS (AE_NO_MEMORY);
+    }
+
+    ObjectSizes = ACPI_CAST_PTR (ACPI_SIZE, &InfoList[Count]);
+
+    AcpiExEnterInterpreter ();
+
+    /* Evaluate all of the items and size their return objects */
+
+    for (i = 0; i < Count; i++)
+    {
+        Info = &InfoList[i];
+        Items[i].ReturnObject = NULL;
+
+        Items[i].Status = AcpiNsSetupEvaluation (Info, Items[i].Handle,
+            Items[i].Pathname, Items[i].Parameters);
+        if (ACPI_FAILURE (Items[i].Status))
+        {
+            continue;
+        }
+
+        Info->Flags = ACPI_INTERPRETER_LOCKED;
+        if (!ReturnBuffer)
+        {
+            Info->Flags |= ACPI_IGNORE_RETURN_VALUE;
+        }
+
+        Items[i].Status = AcpiNsEvaluate (Info);
+        if (ACPI_FAILURE (Items[i].Status) || !Info->ReturnObject)
+        {
+            continue;
+        }
+
+        if (ACPI_GET_DESCRIPTOR_TYPE (Info->ReturnObject) ==
+            ACPI_DESC_TYPE_NAMED)
+        {
+            /* Unsupported return type, see AcpiEvaluateObject */
+
+            Items[i].Status = AE_TYPE;
+            Info->ReturnObject = NULL;
+            continue;
+        }
+
+        AcpiNsResolveReferences (Info);
+
+        Items[i].Status = AcpiUtGetObjectSize (Info->ReturnObject,
+            &ObjectSizes[i]);
+        if (ACPI_SUCCESS (Items[i].Status))
+        {
+            BufferSpaceNeeded += ObjectSizes[i];
+        }
+    }
+
+    if (!ReturnBuffer)
+    {
+        goto Cleanup;
+    }
+
+    if (!BufferSpaceNeeded)
+    {
+        ReturnBuffer->Length = 0;
+        goto Cleanup;
+    }
+
+    /* Validate/Allocate/Clear caller buffer */
+
+    Status = AcpiUtInitializeBuffer (ReturnBuffer, BufferSpaceNeeded);
+    if (ACPI_FAILURE (Status))
+    {
+        ACPI_DEBUG_PRINT ((ACPI_DB_INFO,
+            "Needed buffer size %X, %s\n",
+            (UINT32) BufferSpaceNeeded, AcpiFormatException (Status)));
+        goto Cleanup;
+    }
+
+    /* Build the external objects back to back in the buffer */
+
+    Pointer = ReturnBuffer->Pointer;
+    for (i = 0; i < Count; i++)
+    {
+        Info = &InfoList[i];
+        if (ACPI_FAILURE (Items[i].Status) || !Info->ReturnObject)
+        {
+            continue;
+        }
+
+        ItemBuffer.Length = ObjectSizes[i];
+        ItemBuffer.Pointer = Pointer;
+
+        Items[i].Status = AcpiUtCopyIobjectToEobject (
+            Info->ReturnObject, &ItemBuffer);
+        if (ACPI_SUCCESS (Items[i].Status))
+        {
+            Items[i].ReturnObject = ACPI_CAST_PTR (ACPI_OBJECT, Pointer);
+        }
+
+        Pointer += ObjectSizes[i];
+    }
+
+
+Cleanup:
+
+    /* Delete the internal return objects and parameter lists */
+
+    for (i = 0; i < Count; i++)
+    {
+        Info = &InfoList[i];
+        if (Info->ReturnObject)
+        {
+            AcpiUtRemoveReference (Info->ReturnObject);
+        }
+
+        if (Info->Parameters)
+        {
+            AcpiUtDeleteInternalObjectList (Info->Parameters);
+        }
+    }
+
+    AcpiExExitInterpreter ();
+
+    ACPI_FREE (InfoList);
     return_ACPI_STATUS (Status);
 }
 
-ACPI_EXPORT_SYMBOL (AcpiEvaluateObject)
+ACPI_EXPORT_SYMBOL (AcpiEvaluateObjects)
 
 
 /*******************************************************************************
@@ -573,7 +1001,7 @@ AcpiNsResolveReferences (
     {
     case ACPI_REFCLASS_INDEX:
 
-        ObjDesc = *(Info->ReturnObject->Reference.Where);
+        ObjDesc = *(AcpiExGetElementPointer (Info->ReturnObject));
         break;
 
     case ACPI_REFCLASS_REFOF:
@@ -679,12 +1107,12 @@ AcpiWalkNamespace (
     }
 
     /*
-     * Lock the namespace around the walk. The namespace will be
+     * Lock the namespace (shared) around the walk. The namespace will be
      * unlocked/locked around each call to the user function - since the user
      * function must be allowed to make ACPICA calls itself (for example, it
      * will typically execute control methods during device enumeration.)
      */
-    Status = AcpiUtAcquireMutex (ACPI_MTX_NAMESPACE);
+    Status = AcpiUtAcquireSharedMutex (ACPI_MTX_NAMESPACE);
     if (ACPI_FAILURE (Status))
     {
         goto UnlockAndExit;
@@ -699,11 +1127,11 @@ AcpiWalkNamespace (
     }
 
     Status = AcpiNsWalkNamespace (Type, StartObject, MaxDepth,
-        ACPI_NS_WALK_UNLOCK, DescendingCallback,
+        ACPI_NS_WALK_UNLOCK | ACPI_NS_WALK_SHARED, DescendingCallback,
         AscendingCallback, Context, ReturnValue);
 
 UnlockAndExit2:
-    (void) AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
+    (void) AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
 
 UnlockAndExit:
     (void) AcpiUtReleaseReadLock (&AcpiGbl_NamespaceRwLock);
@@ -713,6 +1141,112 @@ UnlockAndExit:
 ACPI_EXPORT_SYMBOL (AcpiWalkNamespace)
 
 
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiWalkNamespaceParallel
+ *
+ * PARAMETERS:  Type                - ACPI_OBJECT_TYPE to search for
+ *              StartObject         - Handle in namespace where search begins
+ *              MaxDepth            - Depth to which search is to reach
+ *              NumWorkers          - Max number of threads to invoke
+ *                                    DescendingCallback from, including the
+ *                                    caller (1 to ACPI_NS_PARALLEL_MAX_WORKERS)
+ *              DescendingCallback  - Called when an object of "Type" is found
+ *              WorkerContexts      - Optional array of NumWorkers contexts.
+ *                                    Each worker passes its own entry to the
+ *                                    callback as the Context parameter.
+ *              MergeHandler        - Optional, called after the walk for each
+ *                                    result produced by the callbacks
+ *              MergeContext        - Passed to MergeHandler
+ *
+ * RETURNS      Status
+ *
+ * DESCRIPTION: Descending walk of the namespace with the callbacks spread
+ *              across a pool of workers. The namespace is split into
+ *              independent subtrees that the workers take (and steal from
+ *              each other) as they go, so callbacks for different nodes may
+ *              run concurrently and in any order. The callback must only
+ *              write to its worker context and to *ReturnValue.
+ *
+ *              ReturnValue points to a result slot (initially NULL) that is
+ *              private to the subtree being walked. Once the walk is done,
+ *              MergeHandler is called for every non-NULL result slot in
+ *              namespace order, so the merged output does not depend on
+ *              scheduling. It is called even if the walk was terminated
+ *              early, so that results can be released.
+ *
+ *              AE_CTRL_DEPTH and AE_CTRL_TERMINATE have the same meaning as
+ *              for AcpiWalkNamespace; after AE_CTRL_TERMINATE, workers stop
+ *              taking new nodes as soon as they notice it.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiWalkNamespaceParallel (
+    ACPI_OBJECT_TYPE        Type,
+    ACPI_HANDLE             StartObject,
+    UINT32                  MaxDepth,
+    UINT32                  NumWorkers,
+    ACPI_WALK_CALLBACK      DescendingCallback,
+    void                    **WorkerContexts,
+    ACPI_WALK_MERGE_HANDLER MergeHandler,
+    void                    *MergeContext)
+{
+    ACPI_NAMESPACE_NODE     *StartNode;
+    ACPI_STATUS             Status;
+
+
+    ACPI_FUNCTION_TRACE (AcpiWalkNamespaceParallel);
+
+
+    /* Parameter validation */
+
+    if ((Type > ACPI_TYPE_LOCAL_MAX) ||
+        (!MaxDepth)                  ||
+        (!NumWorkers)                ||
+        (NumWorkers > ACPI_NS_PARALLEL_MAX_WORKERS) ||
+        (!DescendingCallback))
+    {
+        return_ACPI_STATUS (AE_BAD_PARAMETER);
+    }
+
+    /*
+     * Hold the namespace reader lock for the whole walk, as for
+     * AcpiWalkNamespace above. The workers run under the caller's
+     * hold on the lock.
+     */
+    Status = AcpiUtAcquireReadLock (&AcpiGbl_NamespaceRwLock);
+    if (ACPI_FAILURE (Status))
+    {
+        return_ACPI_STATUS (Status);
+    }
+
+    Status = AcpiUtAcquireSharedMutex (ACPI_MTX_NAMESPACE);
+    if (ACPI_FAILURE (Status))
+    {
+        goto UnlockAndExit;
+    }
+
+    StartNode = AcpiNsValidateHandle (StartObject);
+    (void) AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
+    if (!StartNode)
+    {
+        Status = AE_BAD_PARAMETER;
+        goto UnlockAndExit;
+    }
+
+    Status = AcpiNsWalkNamespaceParallel (Type, StartNode, MaxDepth,
+        NumWorkers, DescendingCallback, WorkerContexts,
+        MergeHandler, MergeContext);
+
+UnlockAndExit:
+    (void) AcpiUtReleaseReadLock (&AcpiGbl_NamespaceRwLock);
+    return_ACPI_STATUS (Status);
+}
+
+ACPI_EXPORT_SYMBOL (AcpiWalkNamespaceParallel)
+
+
 /*******************************************************************************
  *
  * FUNCTION:    AcpiNsGetDeviceCallback
@@ -745,14 +1279,14 @@ AcpiNsGetDeviceCallback (
     int                     NoMatch;
 
 
-    Status = AcpiUtAcquireMutex (ACPI_MTX_NAMESPACE);
+    Status = AcpiUtAcquireSharedMutex (ACPI_MTX_NAMESPACE);
     if (ACPI_FAILURE (Status))
     {
         return (Status);
     }
 
     Node = AcpiNsValidateHandle (ObjHandle);
-    Status = AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
+    Status = AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
     if (ACPI_FAILURE (Status))
     {
         return (Status);
@@ -763,6 +1297,16 @@ AcpiNsGetDeviceCallback (
         return (AE_BAD_PARAMETER);
     }
 
+    /* Skip the devices already handled through the device ID index */
+
+    for (i = 0; i < Info->HandledCount; i++)
+    {
+        if (Info->Handled[i].Node == Node)
+        {
+            return (Info->Handled[i].Next ? AE_CTRL_DEPTH : AE_OK);
+        }
+    }
+
     /*
      * First, filter based on the device HID and CID.
      *
@@ -857,6 +1401,150 @@ AcpiNsGetDeviceCallback (
 }
 
 
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiNsGetIndexedDevices
+ *
+ * PARAMETERS:  Info                - AcpiGetDevices request, with a HID
+ *              Matches             - Devices with that HID or CID, from
+ *                                    AcpiNsGetDeviceIdMatches
+ *              Count               - Number of Matches
+ *              Generation          - AcpiGbl_DeviceIdGeneration of Matches
+ *              ReturnValue         - Passed to the user function
+ *
+ * RETURN:      Status. AE_SUPPORT if the namespace changed, in which case
+ *              Info->Handled lists the matches already handled and the
+ *              caller must walk the namespace for the rest.
+ *
+ * DESCRIPTION: AcpiGetDevices for a specific HID using the device ID index
+ *              (nsdevid.c). Produces the same callbacks as the namespace walk
+ *              with AcpiNsGetDeviceCallback: matching devices are visited in
+ *              namespace order, and a match that is neither present nor
+ *              functioning (or for which the user function returns
+ *              AE_CTRL_DEPTH) hides the matches below it.
+ *
+ *              No lock is held across the user function, as with the walk,
+ *              so that it may load or unload tables. Like
+ *              AcpiNsGetDeviceCallback, each match is checked again under
+ *              the namespace mutex before it is used: a match is only
+ *              valid while the generation is unchanged, since deleting a
+ *              device changes it. The Next field of a handled match (unused
+ *              in the copies) records whether the matches below it were
+ *              skipped.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiNsGetIndexedDevices (
+    ACPI_GET_DEVICES_INFO   *Info,
+    ACPI_NS_DEVICE_ID       *Matches,
+    UINT32                  Count,
+    UINT32                  Generation,
+    void                    **ReturnValue)
+{
+    ACPI_NAMESPACE_NODE     *Node;
+    ACPI_NAMESPACE_NODE     *Parent;
+    ACPI_STATUS             Status = AE_OK;
+    UINT32                  Flags;
+    UINT32                  i = 0;
+
+
+    while (i < Count)
+    {
+        Status = AcpiUtAcquireSharedMutex (ACPI_MTX_NAMESPACE);
+        if (ACPI_FAILURE (Status))
+        {
+            return (Status);
+        }
+
+        if (Generation != AcpiGbl_DeviceIdGeneration)
+        {
+            (void) AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
+            goto NamespaceChanged;
+        }
+
+        Node = Matches[i].Node;
+        Status = AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
+        if (ACPI_FAILURE (Status))
+        {
+            return (Status);
+        }
+
+        /* Run _STA to determine if device is present */
+
+        Status = AcpiUtExecute_STA (Node, &Flags);
+        if (ACPI_FAILURE (Status) ||
+            (!(Flags & ACPI_STA_DEVICE_PRESENT) &&
+             !(Flags & ACPI_STA_DEVICE_FUNCTIONING)))
+        {
+            Status = AE_CTRL_DEPTH;
+        }
+        else
+        {
+            Status = Info->UserFunction (Node, Matches[i].Level,
+                Info->Context, ReturnValue);
+        }
+
+        i++;
+        if (Status == AE_CTRL_TERMINATE)
+        {
+            return (AE_OK);
+        }
+        else if (Status == AE_CTRL_DEPTH)
+        {
+            /*
+             * Skip the matches below this device. They immediately
+             * follow it, since the matches are in namespace order.
+             */
+            Matches[i - 1].Next = TRUE;
+
+            Status = AcpiUtAcquireSharedMutex (ACPI_MTX_NAMESPACE);
+            if (ACPI_FAILURE (Status))
+            {
+                return (Status);
+            }
+
+            if (Generation != AcpiGbl_DeviceIdGeneration)
+            {
+                (void) AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
+                goto NamespaceChanged;
+            }
+
+            while (i < Count)
+            {
+                Parent = Matches[i].Node->Parent;
+                while (Parent && (Parent != Node))
+                {
+                    Parent = Parent->Parent;
+                }
+
+                if (!Parent)
+                {
+                    break;
+                }
+
+                Matches[i].Next = TRUE;
+                i++;
+            }
+
+            (void) AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
+        }
+        else if (ACPI_FAILURE (Status))
+        {
+            return (Status);
+        }
+    }
+
+    return (AE_OK);
+
+
+NamespaceChanged:
+    Info->Handled = Matches;
+    Info->HandledCount = i;
+    return (AE_SUPPORT);
+}
+
+
 /*******************************************************************************
  *
  * FUNCTION:    AcpiGetDevices
@@ -879,6 +1567,10 @@ AcpiNsGetDeviceCallback (
  *
  *              This is a wrapper for WalkNamespace, but the callback performs
  *              additional filtering. Please see AcpiNsGetDeviceCallback.
+ *              With a HID, the device ID index is used instead when enabled
+ *              (AcpiNsGetIndexedDevices). In both cases no lock is held
+ *              while the UserFunction runs, so it may call ACPICA itself,
+ *              including loading and unloading tables.
  *
  ******************************************************************************/
 
@@ -891,6 +1583,9 @@ AcpiGetDevices (
 {
     ACPI_STATUS             Status;
     ACPI_GET_DEVICES_INFO   Info;
+    ACPI_NS_DEVICE_ID       *Matches = NULL;
+    UINT32                  Count;
+    UINT32                  Generation;
 
 
     ACPI_FUNCTION_TRACE (AcpiGetDevices);
@@ -910,24 +1605,69 @@ AcpiGetDevices (
     Info.Hid = HID;
     Info.Context = Context;
     Info.UserFunction = UserFunction;
+    Info.Handled = NULL;
+    Info.HandledCount = 0;
+
+    /*
+     * Look up a specific HID in the device ID index, if enabled. The
+     * reader lock keeps a table unload from deleting nodes during the
+     * lookup only; it is not held across the user function. Fall back to
+     * the walk below if the index is unavailable, or if the namespace
+     * changed during the callbacks (the devices already handled are then
+     * skipped by AcpiNsGetDeviceCallback).
+     */
+    if (HID && AcpiGbl_EnableDeviceIdIndex)
+    {
+        Status = AcpiUtAcquireReadLock (&AcpiGbl_NamespaceRwLock);
+        if (ACPI_FAILURE (Status))
+        {
+            return_ACPI_STATUS (Status);
+        }
+
+        Status = AcpiNsGetDeviceIdMatches (HID, &Matches, &Count,
+            &Generation);
+        (void) AcpiUtReleaseReadLock (&AcpiGbl_NamespaceRwLock);
+
+        if (ACPI_SUCCESS (Status))
+        {
+            Status = AcpiNsGetIndexedDevices (&Info, Matches, Count,
+                Generation, ReturnValue);
+            if (Status != AE_SUPPORT)
+            {
+                if (Matches)
+                {
+                    ACPI_FREE (Matches);
+                }
+
+                return_ACPI_STATUS (Status);
+            }
+        }
+    }
 
     /*
-     * Lock the namespace around the walk.
+     * Lock the namespace (shared) around the walk.
      * The namespace will be unlocked/locked around each call
      * to the user function - since this function
      * must be allowed to make Acpi calls itself.
      */
-    Status = AcpiUtAcquireMutex (ACPI_MTX_NAMESPACE);
+    Status = AcpiUtAcquireSharedMutex (ACPI_MTX_NAMESPACE);
     if (ACPI_FAILURE (Status))
     {
-        return_ACPI_STATUS (Status);
+        goto Cleanup;
     }
 
     Status = AcpiNsWalkNamespace (ACPI_TYPE_DEVICE, ACPI_ROOT_OBJECT,
-        ACPI_UINT32_MAX, ACPI_NS_WALK_UNLOCK,
+        ACPI_UINT32_MAX, ACPI_NS_WALK_UNLOCK | ACPI_NS_WALK_SHARED,
         AcpiNsGetDeviceCallback, NULL, &Info, ReturnValue);
 
-    (void) AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
+    (void) AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
+
+Cleanup:
+    if (Matches)
+    {
+        ACPI_FREE (Matches);
+    }
+
     return_ACPI_STATUS (Status);
 }
 
@@ -1080,7 +1820,7 @@ AcpiGetData (
         return (AE_BAD_PARAMETER);
     }
 
-    Status = AcpiUtAcquireMutex (ACPI_MTX_NAMESPACE);
+    Status = AcpiUtAcquireSharedMutex (ACPI_MTX_NAMESPACE);
     if (ACPI_FAILURE (Status))
     {
         return (Status);
@@ -1098,7 +1838,7 @@ AcpiGetData (
     Status = AcpiNsGetAttachedData (Node, Handler, Data);
 
 UnlockAndExit:
-    (void) AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
+    (void) AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
     return (Status);
 }
 
@@ -195,7 +195,7 @@ AcpiGetName (
      * Wants the single segment ACPI name.
      * Validate handle and convert to a namespace Node
      */
-    Status = AcpiUtAcquireMutex (ACPI_MTX_NAMESPACE);
+    Status = AcpiUtAcquireSharedMutex (ACPI_MTX_NAMESPACE);
     if (ACPI_FAILURE (Status))
     {
         return (Status);
@@ -216,7 +216,7 @@ AcpiGetName (
         Status = AcpiNsHandleToName (Handle, Buffer);
     }
 
-    (void) AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
+    (void) AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
     return (Status);
 }
 
@@ -311,7 +311,7 @@ AcpiGetObjectInfo (
         return (AE_BAD_PARAMETER);
     }
 
-    Status = AcpiUtAcquireMutex (ACPI_MTX_NAMESPACE);
+    Status = AcpiUtAcquireSharedMutex (ACPI_MTX_NAMESPACE);
     if (ACPI_FAILURE (Status))
     {
         return (Status);
@@ -320,7 +320,7 @@ AcpiGetObjectInfo (
     Node = AcpiNsValidateHandle (Handle);
     if (!Node)
     {
-        (void) AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
+        (void) AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
         return (AE_BAD_PARAMETER);
     }
 
@@ -335,7 +335,7 @@ AcpiGetObjectInfo (
         ParamCount = Node->Object->Method.ParamCount;
     }
 
-    Status = AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
+    Status = AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
     if (ACPI_FAILURE (Status))
     {
         return (Status);
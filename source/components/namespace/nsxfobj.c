@@ -90,7 +90,7 @@ AcpiGetType (
         return (AE_OK);
     }
 
-    Status = AcpiUtAcquireMutex (ACPI_MTX_NAMESPACE);
+    Status = AcpiUtAcquireSharedMutex (ACPI_MTX_NAMESPACE);
     if (ACPI_FAILURE (Status))
     {
         return (Status);
@@ -101,13 +101,13 @@ AcpiGetType (
     Node = AcpiNsValidateHandle (Handle);
     if (!Node)
     {
-        (void) AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
+        (void) AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
         return (AE_BAD_PARAMETER);
     }
 
     *RetType = Node->Type;
 
-    Status = AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
+    Status = AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
     return (Status);
 }
 
@@ -150,7 +150,7 @@ AcpiGetParent (
         return (AE_NULL_ENTRY);
     }
 
-    Status = AcpiUtAcquireMutex (ACPI_MTX_NAMESPACE);
+    Status = AcpiUtAcquireSharedMutex (ACPI_MTX_NAMESPACE);
     if (ACPI_FAILURE (Status))
     {
         return (Status);
@@ -180,7 +180,7 @@ AcpiGetParent (
 
 UnlockAndExit:
 
-    (void) AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
+    (void) AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
     return (Status);
 }
 
@@ -225,7 +225,7 @@ AcpiGetNextObject (
         return (AE_BAD_PARAMETER);
     }
 
-    Status = AcpiUtAcquireMutex (ACPI_MTX_NAMESPACE);
+    Status = AcpiUtAcquireSharedMutex (ACPI_MTX_NAMESPACE);
     if (ACPI_FAILURE (Status))
     {
         return (Status);
@@ -274,7 +274,7 @@ AcpiGetNextObject (
 
 UnlockAndExit:
 
-    (void) AcpiUtReleaseMutex (ACPI_MTX_NAMESPACE);
+    (void) AcpiUtReleaseSharedMutex (ACPI_MTX_NAMESPACE);
     return (Status);
 }
 
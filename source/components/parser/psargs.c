@@ -47,6 +47,7 @@
 #include "amlcode.h"
 #include "acnamesp.h"
 #include "acdispat.h"
+#include "acinterp.h"
 #include "acconvert.h"
 
 #define _COMPONENT          ACPI_PARSER
@@ -263,33 +264,63 @@ AcpiPsGetNextNamepath (
     ACPI_OPERAND_OBJECT     *MethodDesc;
     ACPI_NAMESPACE_NODE     *Node;
     UINT8                   *Start = ParserState->Aml;
+    UINT32                  Length;
 
 
     ACPI_FUNCTION_TRACE (PsGetNextNamepath);
 
 
-    Path = AcpiPsGetNextNamestring (ParserState);
-    AcpiPsInitOp (Arg, AML_INT_NAMEPATH_OP);
+    /*
+     * A NullName (omitted target) needs no lookup. Other names need the
+     * interpreter, which parallel execution may have yielded.
+     */
+    Node = NULL;
+    if (*Start)
+    {
+        AcpiExResumeInterpreter (WalkState);
+
+        /* A name that was resolved before in this method is in its cache */
 
-    /* Null path case is allowed, just exit */
+        Node = AcpiDsMethodCacheLookup (WalkState, Start, &Length);
+    }
 
-    if (!Path)
+    if (Node)
     {
-        Arg->Common.Value.Name = Path;
-        return_ACPI_STATUS (AE_OK);
+        Path = ACPI_CAST_PTR (char, Start);
+        ParserState->Aml = Start + Length;
+        AcpiPsInitOp (Arg, AML_INT_NAMEPATH_OP);
+        Status = AE_OK;
     }
+    else
+    {
+        Path = AcpiPsGetNextNamestring (ParserState);
+        AcpiPsInitOp (Arg, AML_INT_NAMEPATH_OP);
 
-    /*
-     * Lookup the name in the internal namespace, starting with the current
-     * scope. We don't want to add anything new to the namespace here,
-     * however, so we use MODE_EXECUTE.
-     * Allow searching of the parent tree, but don't open a new scope -
-     * we just want to lookup the object (must be mode EXECUTE to perform
-     * the upsearch)
-     */
-    Status = AcpiNsLookup (WalkState->ScopeInfo, Path,
-        ACPI_TYPE_ANY, ACPI_IMODE_EXECUTE,
-        ACPI_NS_SEARCH_PARENT | ACPI_NS_DONT_OPEN_SCOPE, NULL, &Node);
+        /* Null path case is allowed, just exit */
+
+        if (!Path)
+        {
+            Arg->Common.Value.Name = Path;
+            return_ACPI_STATUS (AE_OK);
+        }
+
+        /*
+         * Lookup the name in the internal namespace, starting with the
+         * current scope. We don't want to add anything new to the namespace
+         * here, however, so we use MODE_EXECUTE.
+         * Allow searching of the parent tree, but don't open a new scope -
+         * we just want to lookup the object (must be mode EXECUTE to perform
+         * the upsearch)
+         */
+        Status = AcpiNsLookup (WalkState->ScopeInfo, Path,
+            ACPI_TYPE_ANY, ACPI_IMODE_EXECUTE,
+            ACPI_NS_SEARCH_PARENT | ACPI_NS_DONT_OPEN_SCOPE, NULL, &Node);
+        if (ACPI_SUCCESS (Status))
+        {
+            AcpiDsMethodCacheInsert (WalkState, Start,
+                (UINT32) ACPI_PTR_DIFF (ParserState->Aml, Start), Node);
+        }
+    }
 
     /*
      * If this name is a control method invocation, we must
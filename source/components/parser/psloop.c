@@ -466,7 +466,8 @@ AcpiPsParseLoop (
                             AcpiPsGetNextPackageEnd (ParserState);
                         WalkState->Aml = ParserState->Aml;
                     }
-                    ACPI_FREE(AcpiUtPopGenericState (&WalkState->ControlState));
+                    AcpiUtArenaDeleteState (ParserState->Arena,
+                        AcpiUtPopGenericState (&WalkState->ControlState));
                 }
                 Op = NULL;
                 continue;
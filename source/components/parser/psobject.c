@@ -47,6 +47,7 @@
 #include "amlcode.h"
 #include "acconvert.h"
 #include "acnamesp.h"
+#include "acinterp.h"
 
 #define _COMPONENT          ACPI_PARSER
         ACPI_MODULE_NAME    ("psobject")
@@ -525,8 +526,9 @@ AcpiPsCompleteOp (
         break;
 
     case AE_CTRL_TRANSFER:
+    case AE_CTRL_SUSPEND:
 
-        /* We are about to transfer to a called method */
+        /* We are about to transfer to a called method, or to suspend */
 
         WalkState->PrevOp = NULL;
         WalkState->PrevArgTypes = WalkState->ArgTypes;
@@ -596,7 +598,7 @@ AcpiPsCompleteOp (
                     return_ACPI_STATUS (Status2);
                 }
 
-                AcpiUtDeleteGenericState (
+                AcpiUtArenaDeleteState (WalkState->ParserState.Arena,
                     AcpiUtPopGenericState (&WalkState->ControlState));
             }
 
@@ -609,6 +611,7 @@ AcpiPsCompleteOp (
 
     default:  /* All other non-AE_OK status */
 
+        AcpiExResumeInterpreter (WalkState);
         do
         {
             if (*Op)
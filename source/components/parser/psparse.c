@@ -61,6 +61,12 @@
 #define _COMPONENT          ACPI_PARSER
         ACPI_MODULE_NAME    ("psparse")
 
+/* Local prototypes */
+
+static ACPI_STATUS
+AcpiPsRunWalks (
+    ACPI_THREAD_STATE       *Thread);
+
 
 /*******************************************************************************
  *
@@ -422,6 +428,13 @@ AcpiPsNextParseState (
         WalkState->ReturnUsed = AcpiDsIsResultUsed (Op, WalkState);
         break;
 
+    case AE_CTRL_SUSPEND:
+
+        /* A cooperative evaluation slept, unwind to the scheduler */
+
+        Status = AE_CTRL_SUSPEND;
+        break;
+
     default:
 
         Status = CallbackStatus;
@@ -455,8 +468,6 @@ AcpiPsParseAml (
 {
     ACPI_STATUS             Status;
     ACPI_THREAD_STATE       *Thread;
-    ACPI_THREAD_STATE       *PrevWalkList = AcpiGbl_CurrentWalkList;
-    ACPI_WALK_STATE         *PreviousWalkState;
 
 
     ACPI_FUNCTION_TRACE (PsParseAml);
@@ -471,9 +482,15 @@ AcpiPsParseAml (
         return_ACPI_STATUS (AE_BAD_ADDRESS);
     }
 
-    /* Create and initialize a new thread state */
-
-    Thread = AcpiUtCreateThreadState ();
+    /*
+     * Create and initialize a new thread state, unless the caller created
+     * one for a cooperative evaluation (AcpiPsExecuteMethod)
+     */
+    Thread = WalkState->Thread;
+    if (!Thread)
+    {
+        Thread = AcpiUtCreateThreadState ();
+    }
     if (!Thread)
     {
         if (WalkState->MethodDesc)
@@ -488,6 +505,7 @@ AcpiPsParseAml (
     }
 
     WalkState->Thread = Thread;
+    WalkState->ParserState.Arena = &Thread->Arena;
 
     /*
      * If executing a method, the starting SyncLevel is this method's
@@ -501,6 +519,71 @@ AcpiPsParseAml (
 
     AcpiDsPushWalkState (WalkState, Thread);
 
+    Status = AcpiPsRunWalks (Thread);
+    return_ACPI_STATUS (Status);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiPsResumeAml
+ *
+ * PARAMETERS:  Thread          - Thread state of a suspended parse
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Continue a parse that returned AE_CTRL_SUSPEND, starting at
+ *              the op after the one that suspended it. The interpreter must
+ *              be held by the caller.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiPsResumeAml (
+    ACPI_THREAD_STATE       *Thread)
+{
+    ACPI_STATUS             Status;
+
+
+    ACPI_FUNCTION_TRACE (PsResumeAml);
+
+
+    /* The walk may resume on a different OS thread */
+
+    Thread->ThreadId = AcpiOsGetThreadId ();
+
+    Status = AcpiPsRunWalks (Thread);
+    return_ACPI_STATUS (Status);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiPsRunWalks
+ *
+ * PARAMETERS:  Thread          - Thread state with the walk states to run
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Run the walk loop of a thread until the outermost walk state
+ *              completes. The thread state is deleted on completion, but
+ *              kept intact if a walk suspends with AE_CTRL_SUSPEND.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiPsRunWalks (
+    ACPI_THREAD_STATE       *Thread)
+{
+    ACPI_STATUS             Status;
+    ACPI_THREAD_STATE       *PrevWalkList = AcpiGbl_CurrentWalkList;
+    ACPI_WALK_STATE         *WalkState;
+    ACPI_WALK_STATE         *PreviousWalkState;
+
+
+    ACPI_FUNCTION_TRACE (PsRunWalks);
+
+
     /*
      * This global allows the AML debugger to get a handle to the currently
      * executing control method.
@@ -511,6 +594,7 @@ AcpiPsParseAml (
      * Execute the walk loop as long as there is a valid Walk State. This
      * handles nested control method invocations without recursion.
      */
+    WalkState = AcpiDsGetCurrentWalkState (Thread);
     ACPI_DEBUG_PRINT ((ACPI_DB_PARSE, "State=%p\n", WalkState));
 
     Status = AE_OK;
@@ -525,10 +609,26 @@ AcpiPsParseAml (
             Status = AcpiPsParseLoop (WalkState);
         }
 
+        /* The loop may have yielded the interpreter (parallel execution) */
+
+        AcpiExResumeInterpreter (WalkState);
+
         ACPI_DEBUG_PRINT ((ACPI_DB_PARSE,
             "Completed one call to walk loop, %s State=%p\n",
             AcpiFormatException (Status), WalkState));
 
+        if (Status == AE_CTRL_SUSPEND)
+        {
+            /*
+             * A cooperative evaluation slept. Keep the thread and all of
+             * its walk states; the walk is restarted after the op that
+             * suspended it, in the same way as after a method call.
+             */
+            WalkState->WalkType |= ACPI_WALK_METHOD_RESTART;
+            AcpiGbl_CurrentWalkList = PrevWalkList;
+            return_ACPI_STATUS (Status);
+        }
+
         if (WalkState->MethodPathname && WalkState->MethodIsNested)
         {
             /* Optional object evaluation log */
@@ -538,7 +638,9 @@ AcpiPsParseAml (
                 (WalkState->MethodNestingDepth + 1) * 3, " ",
                 &WalkState->MethodPathname[1]));
 
-            ACPI_FREE (WalkState->MethodPathname);
+            AcpiNsReleaseCachedPathname (WalkState->MethodPathname,
+                WalkState->MethodPathnameCached);
+            WalkState->MethodPathnameCached = FALSE;
             WalkState->MethodIsNested = FALSE;
         }
         if (Status == AE_CTRL_TRANSFER)
@@ -706,6 +808,16 @@ AcpiPsParseAml (
                 *(PreviousWalkState->CallerReturnDesc) =
                     PreviousWalkState->ReturnDesc;
             }
+
+            /* The return value must outlive the walk arena of the thread */
+
+            if (ACPI_FAILURE (AcpiUtArenaPromoteObject (
+                PreviousWalkState->CallerReturnDesc)))
+            {
+                AcpiUtRemoveReference (*(PreviousWalkState->CallerReturnDesc));
+                *(PreviousWalkState->CallerReturnDesc) = NULL;
+                Status = AE_NO_MEMORY;
+            }
         }
         else
         {
@@ -729,6 +841,8 @@ AcpiPsParseAml (
     /* Normal exit */
 
     AcpiExReleaseAllMutexes (Thread);
+    AcpiDsResultStackRelease (&Thread->ResultStack);
+    AcpiUtArenaRelease (&Thread->Arena);
     AcpiUtDeleteGenericState (ACPI_CAST_PTR (ACPI_GENERIC_STATE, Thread));
     AcpiGbl_CurrentWalkList = PrevWalkList;
     return_ACPI_STATUS (Status);
@@ -119,7 +119,7 @@ AcpiPsInitScope (
     ACPI_FUNCTION_TRACE_PTR (PsInitScope, RootOp);
 
 
-    Scope = AcpiUtCreateGenericState ();
+    Scope = AcpiUtArenaCreateState (ParserState->Arena);
     if (!Scope)
     {
         return_ACPI_STATUS (AE_NO_MEMORY);
@@ -166,7 +166,7 @@ AcpiPsPushScope (
     ACPI_FUNCTION_TRACE_PTR (PsPushScope, Op);
 
 
-    Scope = AcpiUtCreateGenericState ();
+    Scope = AcpiUtArenaCreateState (ParserState->Arena);
     if (!Scope)
     {
         return_ACPI_STATUS (AE_NO_MEMORY);
@@ -243,7 +243,7 @@ AcpiPsPopScope (
 
         /* All done with this scope state structure */
 
-        AcpiUtDeleteGenericState (Scope);
+        AcpiUtArenaDeleteState (ParserState->Arena, Scope);
     }
     else
     {
@@ -293,7 +293,7 @@ AcpiPsCleanupScope (
     while (ParserState->Scope)
     {
         Scope = AcpiUtPopGenericState (&ParserState->Scope);
-        AcpiUtDeleteGenericState (Scope);
+        AcpiUtArenaDeleteState (ParserState->Arena, Scope);
     }
 
     return_VOID;
@@ -60,6 +60,12 @@ AcpiPsUpdateParameterList (
     ACPI_EVALUATE_INFO      *Info,
     UINT16                  Action);
 
+static ACPI_STATUS
+AcpiPsCompleteMethod (
+    ACPI_EVALUATE_INFO      *Info,
+    ACPI_PARSE_OBJECT       *Op,
+    ACPI_STATUS             Status);
+
 
 /*******************************************************************************
  *
@@ -239,13 +245,106 @@ AcpiPsExecuteMethod (
         }
     }
 
+    /*
+     * A cooperative evaluation (AcpiEvaluateObjectAsync) provides its own
+     * thread state, so that the walk can suspend at Sleep and be resumed
+     * later by AcpiPsResumeMethod
+     */
+    if (Info->Coroutine)
+    {
+        WalkState->Thread = AcpiUtCreateThreadState ();
+        if (!WalkState->Thread)
+        {
+            Status = AE_NO_MEMORY;
+            AcpiDsTerminateControlMethod (WalkState->MethodDesc, WalkState);
+            AcpiDsDeleteWalkState (WalkState);
+            goto Cleanup;
+        }
+
+        WalkState->Thread->Coroutine = Info->Coroutine;
+        Info->Coroutine->Thread = WalkState->Thread;
+        Info->Coroutine->Op = Op;
+    }
+
     /* Parse the AML */
 
     Status = AcpiPsParseAml (WalkState);
+    if (Status == AE_CTRL_SUSPEND)
+    {
+        return_ACPI_STATUS (Status);
+    }
 
     /* WalkState was deleted by ParseAml */
 
 Cleanup:
+    Status = AcpiPsCompleteMethod (Info, Op, Status);
+    return_ACPI_STATUS (Status);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiPsResumeMethod
+ *
+ * PARAMETERS:  Info            - Method info block of a method for which
+ *                                AcpiPsExecuteMethod returned
+ *                                AE_CTRL_SUSPEND
+ *
+ * RETURN:      Status, as for AcpiPsExecuteMethod
+ *
+ * DESCRIPTION: Continue executing a suspended control method. May return
+ *              AE_CTRL_SUSPEND again.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiPsResumeMethod (
+    ACPI_EVALUATE_INFO      *Info)
+{
+    ACPI_STATUS             Status;
+
+
+    ACPI_FUNCTION_TRACE (PsResumeMethod);
+
+
+    Status = AcpiPsResumeAml (Info->Coroutine->Thread);
+    if (Status == AE_CTRL_SUSPEND)
+    {
+        return_ACPI_STATUS (Status);
+    }
+
+    /* The thread state was deleted by ResumeAml */
+
+    Info->Coroutine->Thread = NULL;
+    Status = AcpiPsCompleteMethod (Info, Info->Coroutine->Op, Status);
+    return_ACPI_STATUS (Status);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiPsCompleteMethod
+ *
+ * PARAMETERS:  Info            - Method info block
+ *              Op              - Root op of the method parse tree
+ *              Status          - Status of the method execution
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Common cleanup after a method has been executed.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiPsCompleteMethod (
+    ACPI_EVALUATE_INFO      *Info,
+    ACPI_PARSE_OBJECT       *Op,
+    ACPI_STATUS             Status)
+{
+
+    ACPI_FUNCTION_TRACE (PsCompleteMethod);
+
+
     AcpiPsDeleteParseTree (Op);
 
     /* Take away the extra reference that we gave the parameters above */
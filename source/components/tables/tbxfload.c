@@ -53,6 +53,14 @@
         ACPI_MODULE_NAME    ("tbxfload")
 
 
+/* Local prototypes */
+
+static ACPI_STATUS
+AcpiTbLoadAllTables (
+    void                    *Snapshot,
+    UINT32                  SnapshotLength);
+
+
 /*******************************************************************************
  *
  * FUNCTION:    AcpiLoadTables
@@ -75,6 +83,119 @@ AcpiLoadTables (
     ACPI_FUNCTION_TRACE (AcpiLoadTables);
 
 
+    Status = AcpiTbLoadAllTables (NULL, 0);
+    return_ACPI_STATUS (Status);
+}
+
+ACPI_EXPORT_SYMBOL_INIT (AcpiLoadTables)
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiLoadTablesFromSnapshot
+ *
+ * PARAMETERS:  Snapshot            - Namespace snapshot image, from
+ *                                    AcpiGetNamespaceSnapshot
+ *              Length              - Length of the image
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Load the ACPI tables from the RSDT/XSDT, like AcpiLoadTables,
+ *              but materialize the namespace directly from a snapshot taken
+ *              on an earlier boot instead of parsing the tables. The snapshot
+ *              is only used if it is intact and was created from exactly the
+ *              tables that are installed now (compared by signature, OEM IDs,
+ *              OEM revision, length and checksum); otherwise the tables are
+ *              parsed as usual.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS ACPI_INIT_FUNCTION
+AcpiLoadTablesFromSnapshot (
+    void                    *Snapshot,
+    UINT32                  Length)
+{
+    ACPI_STATUS             Status;
+
+
+    ACPI_FUNCTION_TRACE (AcpiLoadTablesFromSnapshot);
+
+
+    if (!Snapshot)
+    {
+        return_ACPI_STATUS (AE_BAD_PARAMETER);
+    }
+
+    Status = AcpiTbLoadAllTables (Snapshot, Length);
+    return_ACPI_STATUS (Status);
+}
+
+ACPI_EXPORT_SYMBOL_INIT (AcpiLoadTablesFromSnapshot)
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiGetNamespaceSnapshot
+ *
+ * PARAMETERS:  RetBuffer           - Where the snapshot image is returned
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Serialize the namespace created by the loaded ACPI tables into
+ *              a relocatable binary image that can be passed to
+ *              AcpiLoadTablesFromSnapshot on a later boot. Should be called
+ *              right after AcpiLoadTables, before AcpiEnableSubsystem and
+ *              AcpiInitializeObjects have run any _INI or _REG methods.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiGetNamespaceSnapshot (
+    ACPI_BUFFER             *RetBuffer)
+{
+    ACPI_STATUS             Status;
+
+
+    ACPI_FUNCTION_TRACE (AcpiGetNamespaceSnapshot);
+
+
+    Status = AcpiUtValidateBuffer (RetBuffer);
+    if (ACPI_FAILURE (Status))
+    {
+        return_ACPI_STATUS (Status);
+    }
+
+    Status = AcpiNsCreateSnapshot (RetBuffer);
+    return_ACPI_STATUS (Status);
+}
+
+ACPI_EXPORT_SYMBOL (AcpiGetNamespaceSnapshot)
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiTbLoadAllTables
+ *
+ * PARAMETERS:  Snapshot            - Optional namespace snapshot
+ *              SnapshotLength      - Length of the snapshot
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Common code for AcpiLoadTables and AcpiLoadTablesFromSnapshot
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiTbLoadAllTables (
+    void                    *Snapshot,
+    UINT32                  SnapshotLength)
+{
+    ACPI_STATUS             Status;
+
+
+    ACPI_FUNCTION_TRACE (TbLoadAllTables);
+
+
     /*
      * Install the default operation region handlers. These are the
      * handlers that are defined by the ACPI specification to be
@@ -96,7 +217,7 @@ AcpiLoadTables (
 
     /* Load the namespace from the tables */
 
-    Status = AcpiTbLoadNamespace ();
+    Status = AcpiTbLoadNamespace (Snapshot, SnapshotLength);
 
     /* Don't let single failures abort the load */
 
@@ -127,25 +248,27 @@ AcpiLoadTables (
     return_ACPI_STATUS (Status);
 }
 
-ACPI_EXPORT_SYMBOL_INIT (AcpiLoadTables)
-
 
 /*******************************************************************************
  *
  * FUNCTION:    AcpiTbLoadNamespace
  *
- * PARAMETERS:  None
+ * PARAMETERS:  Snapshot            - Optional namespace snapshot
+ *              SnapshotLength      - Length of the snapshot
  *
  * RETURN:      Status
  *
  * DESCRIPTION: Load the namespace from the DSDT and all SSDTs/PSDTs found in
- *              the RSDT/XSDT.
+ *              the RSDT/XSDT. If a snapshot is provided and it matches the
+ *              installed tables, the namespace is materialized from the
+ *              snapshot instead.
  *
  ******************************************************************************/
 
 ACPI_STATUS
 AcpiTbLoadNamespace (
-    void)
+    void                    *Snapshot,
+    UINT32                  SnapshotLength)
 {
     ACPI_STATUS             Status;
     UINT32                  i;
@@ -204,6 +327,26 @@ AcpiTbLoadNamespace (
     memcpy (&AcpiGbl_OriginalDsdtHeader, AcpiGbl_DSDT,
         sizeof (ACPI_TABLE_HEADER));
 
+    /* Materialize the namespace from the snapshot, if possible */
+
+    if (Snapshot)
+    {
+        (void) AcpiUtReleaseMutex (ACPI_MTX_TABLES);
+        Status = AcpiNsRestoreSnapshot (Snapshot, SnapshotLength,
+            &TablesLoaded);
+        (void) AcpiUtAcquireMutex (ACPI_MTX_TABLES);
+        if (ACPI_SUCCESS (Status))
+        {
+            ACPI_INFO ((
+                "%u ACPI AML tables successfully restored from snapshot",
+                TablesLoaded));
+            goto UnlockAndExit;
+        }
+
+        ACPI_EXCEPTION ((AE_INFO, Status,
+            "Namespace snapshot not used, loading tables"));
+    }
+
     /* Load and parse tables */
 
     (void) AcpiUtReleaseMutex (ACPI_MTX_TABLES);
@@ -0,0 +1,524 @@
+/*******************************************************************************
+ *
+ * Module Name: utarena - per-invocation walk arena
+ *
+ ******************************************************************************/
+
+/*
+ * Copyright (C) 2000 - 2023, Intel Corp.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions, and the following disclaimer,
+ *    without modification.
+ * 2. Redistributions in binary form must reproduce at minimum a disclaimer
+ *    substantially similar to the "NO WARRANTY" disclaimer below
+ *    ("Disclaimer") and any redistribution must be conditioned upon
+ *    including a substantially similar Disclaimer requirement for further
+ *    binary redistribution.
+ * 3. Neither the names of the above-listed copyright holders nor the names
+ *    of any contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * Alternatively, this software may be distributed under the terms of the
+ * GNU General Public License ("GPL") version 2 as published by the Free
+ * Software Foundation.
+ *
+ * NO WARRANTY
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGES.
+ */
+#include "acpi.h"
+#include "accommon.h"
+
+#define _COMPONENT          ACPI_UTILITIES
+        ACPI_MODULE_NAME    ("utarena")
+
+/*
+ * Executing a control method pushes and pops a parse scope state for nearly
+ * every AML operator, a result state for every few intermediate results and
+ * a control state for every If and While, and each nested method call
+ * allocates and frees a walk state. The walk arena turns this traffic into
+ * pointer operations on free lists that belong to the invocation, so that
+ * the state cache and its lock are not touched at all while the method
+ * runs.
+ *
+ * The arena lives in the thread state, which exists for the duration of one
+ * top-level AcpiPsParseAml. Only the thread executing the invocation uses
+ * it, so no locking is required. States allocated from the arena carry the
+ * ACPI_STATE_ARENA flag; if one of them is passed to AcpiUtDeleteGenericState
+ * it is simply left in place and reclaimed by AcpiUtArenaRelease.
+ *
+ * Intermediate Integer values (constants, loop counters, arithmetic and
+ * logical results) are arena objects as well. They look like any other
+ * operand object to the executer, but carry AOPOBJ_ARENA and go back to the
+ * arena free list instead of the object cache when their last reference is
+ * removed. Such an object must not outlive the invocation: before an Integer
+ * is attached to a namespace node or handed back to the caller of the
+ * top-level method it is replaced by a heap copy (AcpiUtArenaPromoteObject).
+ * Stores to package elements and locals that are still referenced elsewhere
+ * already copy the value.
+ */
+
+/* Chunk data starts at the first 64-bit boundary after the chunk header */
+
+#define ACPI_ARENA_CHUNK_HEADER     ACPI_ROUND_UP (sizeof (ACPI_ARENA_CHUNK), 8)
+
+/* States and Integer objects share one free list of fixed-size slots */
+
+#define ACPI_ARENA_SLOT_SIZE        ACPI_MAX (sizeof (ACPI_GENERIC_STATE), \
+                                        sizeof (ACPI_OPERAND_OBJECT))
+
+/* Local prototypes */
+
+static void *
+AcpiUtArenaAllocate (
+    ACPI_WALK_ARENA         *Arena,
+    ACPI_SIZE               Size);
+
+static void *
+AcpiUtArenaAllocateSlot (
+    ACPI_WALK_ARENA         *Arena);
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtArenaAllocate
+ *
+ * PARAMETERS:  Arena               - Walk arena
+ *              Size                - Bytes to allocate
+ *
+ * RETURN:      Pointer to the (uninitialized) memory. NULL on failure.
+ *
+ * DESCRIPTION: Carve a block out of the newest chunk of the arena, adding a
+ *              chunk if the newest one is full.
+ *
+ ******************************************************************************/
+
+static void *
+AcpiUtArenaAllocate (
+    ACPI_WALK_ARENA         *Arena,
+    ACPI_SIZE               Size)
+{
+    ACPI_ARENA_CHUNK        *Chunk;
+    void                    *Block;
+
+
+    Size = ACPI_ROUND_UP (Size, 8);
+    if (Size > (ACPI_WALK_ARENA_CHUNK_SIZE - ACPI_ARENA_CHUNK_HEADER))
+    {
+        return (NULL);
+    }
+
+    if ((ACPI_SIZE) (Arena->End - Arena->Free) < Size)
+    {
+        Chunk = ACPI_ALLOCATE (ACPI_WALK_ARENA_CHUNK_SIZE);
+        if (!Chunk)
+        {
+            return (NULL);
+        }
+
+        Chunk->Next = Arena->Chunks;
+        Arena->Chunks = Chunk;
+        Arena->Free = ACPI_ADD_PTR (UINT8, Chunk, ACPI_ARENA_CHUNK_HEADER);
+        Arena->End = ACPI_ADD_PTR (UINT8, Chunk, ACPI_WALK_ARENA_CHUNK_SIZE);
+    }
+
+    Block = Arena->Free;
+    Arena->Free += Size;
+    return (Block);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtArenaAllocateSlot
+ *
+ * PARAMETERS:  Arena               - Walk arena
+ *
+ * RETURN:      Pointer to an (uninitialized) slot. NULL on failure.
+ *
+ * DESCRIPTION: Take a slot from the arena free list, or carve a new one.
+ *
+ ******************************************************************************/
+
+static void *
+AcpiUtArenaAllocateSlot (
+    ACPI_WALK_ARENA         *Arena)
+{
+    ACPI_ARENA_SLOT         *Slot;
+
+
+    Slot = Arena->FreeSlots;
+    if (Slot)
+    {
+        Arena->FreeSlots = Slot->Next;
+        return (Slot);
+    }
+
+    return (AcpiUtArenaAllocate (Arena, ACPI_ARENA_SLOT_SIZE));
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtArenaCreateState
+ *
+ * PARAMETERS:  Arena               - Walk arena, NULL if none
+ *
+ * RETURN:      New zeroed generic state. NULL on failure.
+ *
+ * DESCRIPTION: Create a generic state object in the arena. Falls back to the
+ *              state cache if there is no arena or it is disabled.
+ *
+ ******************************************************************************/
+
+ACPI_GENERIC_STATE *
+AcpiUtArenaCreateState (
+    ACPI_WALK_ARENA         *Arena)
+{
+    ACPI_GENERIC_STATE      *State;
+
+
+    ACPI_FUNCTION_ENTRY ();
+
+
+    if (!Arena || !AcpiGbl_EnableWalkArena)
+    {
+        return (AcpiUtCreateGenericState ());
+    }
+
+    State = AcpiUtArenaAllocateSlot (Arena);
+    if (!State)
+    {
+        return (AcpiUtCreateGenericState ());
+    }
+
+    memset (State, 0, sizeof (ACPI_GENERIC_STATE));
+    State->Common.DescriptorType = ACPI_DESC_TYPE_STATE;
+    State->Common.Flags = ACPI_STATE_ARENA;
+    return (State);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtArenaDeleteState
+ *
+ * PARAMETERS:  Arena               - Walk arena, NULL if none
+ *              State               - State object to delete
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Return a state to the arena free list, or to the state cache
+ *              if it was not allocated from an arena. NULL states are
+ *              ignored.
+ *
+ ******************************************************************************/
+
+void
+AcpiUtArenaDeleteState (
+    ACPI_WALK_ARENA         *Arena,
+    ACPI_GENERIC_STATE      *State)
+{
+    ACPI_FUNCTION_ENTRY ();
+
+
+    if (!State)
+    {
+        return;
+    }
+
+    if (!(State->Common.Flags & ACPI_STATE_ARENA))
+    {
+        AcpiUtDeleteGenericState (State);
+        return;
+    }
+
+    if (Arena)
+    {
+        ACPI_CAST_PTR (ACPI_ARENA_SLOT, State)->Next = Arena->FreeSlots;
+        Arena->FreeSlots = ACPI_CAST_PTR (ACPI_ARENA_SLOT, State);
+    }
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtArenaCreateInteger
+ *
+ * PARAMETERS:  Arena               - Walk arena, NULL if none
+ *              InitialValue        - Initial value for the integer
+ *
+ * RETURN:      Pointer to a new Integer object. NULL on failure.
+ *
+ * DESCRIPTION: Create an intermediate Integer object in the arena. Falls back
+ *              to AcpiUtCreateIntegerObject if there is no arena or immediate
+ *              integers are disabled.
+ *
+ ******************************************************************************/
+
+ACPI_OPERAND_OBJECT *
+AcpiUtArenaCreateInteger (
+    ACPI_WALK_ARENA         *Arena,
+    UINT64                  InitialValue)
+{
+    ACPI_OPERAND_OBJECT     *ObjDesc;
+
+
+    ACPI_FUNCTION_ENTRY ();
+
+
+    if (!Arena || !AcpiGbl_EnableWalkArena ||
+        !AcpiGbl_EnableImmediateIntegers)
+    {
+        return (AcpiUtCreateIntegerObject (InitialValue));
+    }
+
+    ObjDesc = AcpiUtArenaAllocateSlot (Arena);
+    if (!ObjDesc)
+    {
+        return (AcpiUtCreateIntegerObject (InitialValue));
+    }
+
+    memset (ObjDesc, 0, sizeof (ACPI_OPERAND_OBJECT));
+    ACPI_SET_DESCRIPTOR_TYPE (ObjDesc, ACPI_DESC_TYPE_OPERAND);
+    ObjDesc->Common.Type = ACPI_TYPE_INTEGER;
+    ObjDesc->Common.ReferenceCount = 1;
+    ObjDesc->Common.Flags = AOPOBJ_ARENA;
+    ObjDesc->Integer.Value = InitialValue;
+    ObjDesc->Integer.Arena = Arena;
+    return (ObjDesc);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtArenaDeleteObject
+ *
+ * PARAMETERS:  Object              - Integer object allocated from an arena
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Return an arena Integer to the free list of its arena. Called
+ *              by AcpiUtDeleteObjectDesc when the last reference is removed.
+ *
+ ******************************************************************************/
+
+void
+AcpiUtArenaDeleteObject (
+    ACPI_OPERAND_OBJECT     *Object)
+{
+    ACPI_WALK_ARENA         *Arena = Object->Integer.Arena;
+
+
+    ACPI_FUNCTION_ENTRY ();
+
+
+    ACPI_SET_DESCRIPTOR_TYPE (Object, ACPI_DESC_TYPE_CACHED);
+    ACPI_CAST_PTR (ACPI_ARENA_SLOT, Object)->Next = Arena->FreeSlots;
+    Arena->FreeSlots = ACPI_CAST_PTR (ACPI_ARENA_SLOT, Object);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtArenaPromoteObject
+ *
+ * PARAMETERS:  ObjDescPtr          - Where the object pointer is stored
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: If *ObjDescPtr is an arena Integer, replace it with a heap
+ *              Integer holding the same value. The reference owned by
+ *              *ObjDescPtr moves to the new object. Used wherever an object
+ *              can outlive the current method invocation.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiUtArenaPromoteObject (
+    ACPI_OPERAND_OBJECT     **ObjDescPtr)
+{
+    ACPI_OPERAND_OBJECT     *ObjDesc = *ObjDescPtr;
+    ACPI_OPERAND_OBJECT     *NewDesc;
+
+
+    ACPI_FUNCTION_ENTRY ();
+
+
+    if (!ObjDesc ||
+        (ACPI_GET_DESCRIPTOR_TYPE (ObjDesc) != ACPI_DESC_TYPE_OPERAND) ||
+        !(ObjDesc->Common.Flags & AOPOBJ_ARENA))
+    {
+        return (AE_OK);
+    }
+
+    NewDesc = AcpiUtCreateIntegerObject (ObjDesc->Integer.Value);
+    if (!NewDesc)
+    {
+        return (AE_NO_MEMORY);
+    }
+
+    NewDesc->Common.Flags |= (ObjDesc->Common.Flags & ~AOPOBJ_ARENA);
+    AcpiUtRemoveReference (ObjDesc);
+    *ObjDescPtr = NewDesc;
+    return (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtArenaCreateWalkState
+ *
+ * PARAMETERS:  Arena               - Walk arena
+ *
+ * RETURN:      Zeroed memory for a walk state. NULL if the arena is disabled
+ *              or out of memory, the caller then allocates from the heap.
+ *
+ * DESCRIPTION: Allocate a walk state (for a nested method call) in the arena.
+ *
+ ******************************************************************************/
+
+ACPI_WALK_STATE *
+AcpiUtArenaCreateWalkState (
+    ACPI_WALK_ARENA         *Arena)
+{
+    ACPI_WALK_STATE         *WalkState;
+
+
+    ACPI_FUNCTION_ENTRY ();
+
+
+    if (!AcpiGbl_EnableWalkArena)
+    {
+        return (NULL);
+    }
+
+    WalkState = Arena->FreeWalks;
+    if (WalkState)
+    {
+        Arena->FreeWalks = WalkState->Next;
+    }
+    else
+    {
+        WalkState = AcpiUtArenaAllocate (Arena, sizeof (ACPI_WALK_STATE));
+        if (!WalkState)
+        {
+            return (NULL);
+        }
+    }
+
+    memset (WalkState, 0, sizeof (ACPI_WALK_STATE));
+    WalkState->WalkArena = Arena;
+    return (WalkState);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtArenaDeleteWalkState
+ *
+ * PARAMETERS:  WalkState           - Walk state allocated from an arena
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Return a walk state to the free list of its arena.
+ *
+ ******************************************************************************/
+
+void
+AcpiUtArenaDeleteWalkState (
+    ACPI_WALK_STATE         *WalkState)
+{
+    ACPI_WALK_ARENA         *Arena = WalkState->WalkArena;
+
+
+    ACPI_FUNCTION_ENTRY ();
+
+
+    WalkState->DescriptorType = 0;
+    WalkState->Next = Arena->FreeWalks;
+    Arena->FreeWalks = WalkState;
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtArenaAllocateArray
+ *
+ * PARAMETERS:  Arena               - Walk arena, NULL if none
+ *              Size                - Bytes to allocate
+ *
+ * RETURN:      Pointer to the (uninitialized) memory. NULL if there is no
+ *              arena, it is disabled, or the block does not fit in a chunk.
+ *
+ * DESCRIPTION: Allocate a variable-size block (e.g. the result stack array)
+ *              from the arena. The block cannot be freed individually; it
+ *              is reclaimed by AcpiUtArenaRelease. On NULL the caller falls
+ *              back to the heap.
+ *
+ ******************************************************************************/
+
+void *
+AcpiUtArenaAllocateArray (
+    ACPI_WALK_ARENA         *Arena,
+    ACPI_SIZE               Size)
+{
+    ACPI_FUNCTION_ENTRY ();
+
+
+    if (!Arena || !AcpiGbl_EnableWalkArena)
+    {
+        return (NULL);
+    }
+
+    return (AcpiUtArenaAllocate (Arena, Size));
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtArenaRelease
+ *
+ * PARAMETERS:  Arena               - Walk arena
+ *
+ * RETURN:      None
+ *
+ * DESCRIPTION: Free all chunks of an arena at the end of the invocation. All
+ *              walk states, states and Integer objects allocated from it
+ *              must be unused.
+ *
+ ******************************************************************************/
+
+void
+AcpiUtArenaRelease (
+    ACPI_WALK_ARENA         *Arena)
+{
+    ACPI_ARENA_CHUNK        *Chunk;
+
+
+    ACPI_FUNCTION_ENTRY ();
+
+
+    while (Arena->Chunks)
+    {
+        Chunk = Arena->Chunks;
+        Arena->Chunks = Chunk->Next;
+        ACPI_FREE (Chunk);
+    }
+
+    memset (Arena, 0, sizeof (ACPI_WALK_ARENA));
+}
@@ -222,24 +222,25 @@ AcpiOsReleaseObject (
         return (AE_BAD_PARAMETER);
     }
 
+    Status = AcpiUtAcquireMutex (ACPI_MTX_CACHES);
+    if (ACPI_FAILURE (Status))
+    {
+        return (Status);
+    }
+
     /* If cache is full, just free this object */
 
     if (Cache->CurrentDepth >= Cache->MaxDepth)
     {
-        ACPI_FREE (Object);
         ACPI_MEM_TRACKING (Cache->TotalFreed++);
+        (void) AcpiUtReleaseMutex (ACPI_MTX_CACHES);
+        ACPI_FREE (Object);
     }
 
     /* Otherwise put this object back into the cache */
 
     else
     {
-        Status = AcpiUtAcquireMutex (ACPI_MTX_CACHES);
-        if (ACPI_FAILURE (Status))
-        {
-            return (Status);
-        }
-
         /* Mark the object as cached */
 
         memset (Object, 0xCA, Cache->ObjectSize);
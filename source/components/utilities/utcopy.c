@@ -99,6 +99,18 @@ AcpiUtCopyIpackageToIpackage (
     ACPI_OPERAND_OBJECT     *DestObj,
     ACPI_WALK_STATE         *WalkState);
 
+static ACPI_STATUS
+AcpiUtShareData (
+    ACPI_OBJECT_SHARE       **SharePtr);
+
+static BOOLEAN
+AcpiUtReleaseShare (
+    ACPI_OBJECT_SHARE       *Share);
+
+static ACPI_STATUS
+AcpiUtUnsharePackage (
+    ACPI_OPERAND_OBJECT     *ObjDesc);
+
 
 /*******************************************************************************
  *
@@ -743,15 +755,18 @@ AcpiUtCopySimpleObject (
     DestDesc->Common.ReferenceCount = ReferenceCount;
     DestDesc->Common.NextObject = NextObject;
 
-    /* New object is not static, regardless of source */
+    /* New object is not static or arena-owned, regardless of source */
 
-    DestDesc->Common.Flags &= ~AOPOBJ_STATIC_POINTER;
+    DestDesc->Common.Flags &= ~(AOPOBJ_STATIC_POINTER | AOPOBJ_ARENA);
 
     /* Handle the objects with extra data */
 
     switch (DestDesc->Common.Type)
     {
     case ACPI_TYPE_BUFFER:
+
+        DestDesc->Buffer.Share = NULL;
+
         /*
          * Allocate and copy the actual buffer if and only if:
          * 1) There is a valid buffer pointer
@@ -760,6 +775,22 @@ AcpiUtCopySimpleObject (
         if ((SourceDesc->Buffer.Pointer) &&
             (SourceDesc->Buffer.Length))
         {
+            /*
+             * Share the buffer data with the source until one of the
+             * two objects is written (copy-on-write). A static source
+             * pointer stays static in the copy.
+             */
+            if (AcpiGbl_EnableCopyOnWrite &&
+                (ACPI_GET_DESCRIPTOR_TYPE (SourceDesc) ==
+                    ACPI_DESC_TYPE_OPERAND) &&
+                ACPI_SUCCESS (AcpiUtShareData (&SourceDesc->Buffer.Share)))
+            {
+                DestDesc->Buffer.Share = SourceDesc->Buffer.Share;
+                DestDesc->Common.Flags |= (SourceDesc->Common.Flags &
+                    AOPOBJ_STATIC_POINTER);
+                break;
+            }
+
             DestDesc->Buffer.Pointer =
                 ACPI_ALLOCATE (SourceDesc->Buffer.Length);
             if (!DestDesc->Buffer.Pointer)
@@ -823,6 +854,14 @@ AcpiUtCopySimpleObject (
         }
         break;
 
+    case ACPI_TYPE_METHOD:
+
+        /* The name cache depends on the scope, the copy makes its own */
+
+        DestDesc->Method.NameCache = NULL;
+        DestDesc->Method.Memo = NULL;
+        break;
+
     /*
      * For Mutex and Event objects, we cannot simply copy the underlying
      * OS object. We must create a new one.
@@ -981,6 +1020,7 @@ AcpiUtCopyIpackageToIpackage (
     ACPI_WALK_STATE         *WalkState)
 {
     ACPI_STATUS             Status = AE_OK;
+    UINT32                  i;
 
 
     ACPI_FUNCTION_TRACE (UtCopyIpackageToIpackage);
@@ -990,6 +1030,31 @@ AcpiUtCopyIpackageToIpackage (
     DestObj->Common.Flags = SourceObj->Common.Flags;
     DestObj->Package.Count = SourceObj->Package.Count;
 
+    /*
+     * Share the element array of an initialized package with the source
+     * until one of the two packages is modified (copy-on-write). Each
+     * element gains a reference for the new parent, as it would if it
+     * had been copied.
+     */
+    if (AcpiGbl_EnableCopyOnWrite &&
+        (SourceObj->Common.Flags & AOPOBJ_DATA_VALID) &&
+        SourceObj->Package.Elements &&
+        ACPI_SUCCESS (AcpiUtShareData (&SourceObj->Package.Share)))
+    {
+        DestObj->Package.Elements = SourceObj->Package.Elements;
+        DestObj->Package.Share = SourceObj->Package.Share;
+
+        for (i = 0; i < DestObj->Package.Count; i++)
+        {
+            if (DestObj->Package.Elements[i])
+            {
+                AcpiUtAddReference (DestObj->Package.Elements[i]);
+            }
+        }
+
+        return_ACPI_STATUS (AE_OK);
+    }
+
     /*
      * Create the object array and walk the source package tree
      */
@@ -1074,3 +1139,318 @@ AcpiUtCopyIobjectToIobject (
 
     return_ACPI_STATUS (Status);
 }
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtShareData
+ *
+ * PARAMETERS:  SharePtr            - Share block of the source object
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Add a user to the copy-on-write data of a Buffer or Package.
+ *              The share block is created on the first copy; the source
+ *              object itself is then counted as its first user.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiUtShareData (
+    ACPI_OBJECT_SHARE       **SharePtr)
+{
+    ACPI_CPU_FLAGS          LockFlags;
+
+
+    if (!*SharePtr)
+    {
+        *SharePtr = ACPI_ALLOCATE (sizeof (ACPI_OBJECT_SHARE));
+        if (!*SharePtr)
+        {
+            return (AE_NO_MEMORY);
+        }
+
+        (*SharePtr)->Count = 1;
+    }
+
+    LockFlags = AcpiOsAcquireLock (AcpiGbl_ReferenceCountLock);
+    (*SharePtr)->Count++;
+    AcpiOsReleaseLock (AcpiGbl_ReferenceCountLock, LockFlags);
+    return (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtReleaseShare
+ *
+ * PARAMETERS:  Share               - Share block of the object
+ *
+ * RETURN:      TRUE if the caller was the last user of the shared data
+ *
+ * DESCRIPTION: Remove a user from copy-on-write data. The share block is
+ *              freed by the last user, who then owns the data.
+ *
+ ******************************************************************************/
+
+static BOOLEAN
+AcpiUtReleaseShare (
+    ACPI_OBJECT_SHARE       *Share)
+{
+    ACPI_CPU_FLAGS          LockFlags;
+    UINT32                  Count;
+
+
+    LockFlags = AcpiOsAcquireLock (AcpiGbl_ReferenceCountLock);
+    Count = --Share->Count;
+    AcpiOsReleaseLock (AcpiGbl_ReferenceCountLock, LockFlags);
+
+    if (Count)
+    {
+        return (FALSE);
+    }
+
+    ACPI_FREE (Share);
+    return (TRUE);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtReleaseSharedData
+ *
+ * PARAMETERS:  Object              - Buffer or Package being deleted
+ *
+ * RETURN:      TRUE if the data of the object must be freed by the caller
+ *
+ * DESCRIPTION: Called when a Buffer or Package object is deleted. Shared
+ *              data is only freed along with its last user.
+ *
+ ******************************************************************************/
+
+BOOLEAN
+AcpiUtReleaseSharedData (
+    ACPI_OPERAND_OBJECT     *Object)
+{
+    ACPI_OBJECT_SHARE       *Share;
+
+
+    switch (Object->Common.Type)
+    {
+    case ACPI_TYPE_BUFFER:
+
+        Share = Object->Buffer.Share;
+        Object->Buffer.Share = NULL;
+        break;
+
+    case ACPI_TYPE_PACKAGE:
+
+        Share = Object->Package.Share;
+        Object->Package.Share = NULL;
+        break;
+
+    default:
+
+        return (TRUE);
+    }
+
+    if (!Share)
+    {
+        return (TRUE);
+    }
+
+    return (AcpiUtReleaseShare (Share));
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtUnsharePackage
+ *
+ * PARAMETERS:  ObjDesc             - Package object with shared elements
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Give a package a private element array. Integer and
+ *              reference elements are immutable and stay shared; String,
+ *              Buffer and Package elements can be modified in place and
+ *              are replaced by (copy-on-write) copies. The references that
+ *              the package holds on the replaced elements are moved to the
+ *              copies.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiUtUnsharePackage (
+    ACPI_OPERAND_OBJECT     *ObjDesc)
+{
+    ACPI_OPERAND_OBJECT     **OldElements = ObjDesc->Package.Elements;
+    ACPI_OPERAND_OBJECT     **NewElements;
+    ACPI_OPERAND_OBJECT     *Element;
+    ACPI_STATUS             Status;
+    UINT16                  ReferenceCount;
+    UINT32                  i;
+    UINT32                  j;
+
+
+    ACPI_FUNCTION_TRACE_PTR (UtUnsharePackage, ObjDesc);
+
+
+    NewElements = ACPI_ALLOCATE_ZEROED (
+        ((ACPI_SIZE) ObjDesc->Package.Count + 1) * sizeof (void *));
+    if (!NewElements)
+    {
+        return_ACPI_STATUS (AE_NO_MEMORY);
+    }
+
+    for (i = 0; i < ObjDesc->Package.Count; i++)
+    {
+        Element = OldElements[i];
+        if (Element &&
+            ((Element->Common.Type == ACPI_TYPE_STRING) ||
+             (Element->Common.Type == ACPI_TYPE_BUFFER) ||
+             (Element->Common.Type == ACPI_TYPE_PACKAGE)))
+        {
+            Status = AcpiUtCopyIobjectToIobject (Element,
+                &NewElements[i], NULL);
+            if (ACPI_FAILURE (Status))
+            {
+                for (j = 0; j < i; j++)
+                {
+                    if (NewElements[j] != OldElements[j])
+                    {
+                        AcpiUtRemoveReference (NewElements[j]);
+                    }
+                }
+
+                ACPI_FREE (NewElements);
+                return_ACPI_STATUS (Status);
+            }
+        }
+        else
+        {
+            NewElements[i] = Element;
+        }
+    }
+
+    /*
+     * Each reference to the package accounts for one reference to each
+     * of its elements. Move these from the old elements to the copies.
+     */
+    ReferenceCount = ObjDesc->Common.ReferenceCount;
+    for (i = 0; i < ObjDesc->Package.Count; i++)
+    {
+        if (NewElements[i] == OldElements[i])
+        {
+            continue;
+        }
+
+        for (j = 1; j < ReferenceCount; j++)
+        {
+            AcpiUtAddReference (NewElements[i]);
+        }
+
+        for (j = 0; j < ReferenceCount; j++)
+        {
+            AcpiUtRemoveReference (OldElements[i]);
+        }
+    }
+
+    ObjDesc->Package.Elements = NewElements;
+    if (AcpiUtReleaseShare (ObjDesc->Package.Share))
+    {
+        /* The other users went away meanwhile, old array is unused */
+
+        ACPI_FREE (OldElements);
+    }
+
+    ObjDesc->Package.Share = NULL;
+    return_ACPI_STATUS (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtUnshareObject
+ *
+ * PARAMETERS:  ObjDesc             - Object about to be modified in place
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Called before a Buffer or Package object is written through
+ *              Index, a BufferField or an in-place Store. If the data of the
+ *              object is shared copy-on-write with other objects, give the
+ *              object a private copy. No-op for all other objects.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiUtUnshareObject (
+    ACPI_OPERAND_OBJECT     *ObjDesc)
+{
+    UINT8                   *OldPointer;
+    UINT8                   *NewPointer;
+
+
+    ACPI_FUNCTION_ENTRY ();
+
+
+    switch (ObjDesc->Common.Type)
+    {
+    case ACPI_TYPE_BUFFER:
+
+        if (!ObjDesc->Buffer.Share)
+        {
+            return (AE_OK);
+        }
+
+        if (ObjDesc->Buffer.Share->Count == 1)
+        {
+            /* All other users are gone, the data is private again */
+
+            ACPI_FREE (ObjDesc->Buffer.Share);
+            ObjDesc->Buffer.Share = NULL;
+            return (AE_OK);
+        }
+
+        NewPointer = ACPI_ALLOCATE (ObjDesc->Buffer.Length);
+        if (!NewPointer)
+        {
+            return (AE_NO_MEMORY);
+        }
+
+        memcpy (NewPointer, ObjDesc->Buffer.Pointer, ObjDesc->Buffer.Length);
+
+        OldPointer = ObjDesc->Buffer.Pointer;
+        ObjDesc->Buffer.Pointer = NewPointer;
+        if (AcpiUtReleaseShare (ObjDesc->Buffer.Share) &&
+            !(ObjDesc->Common.Flags & AOPOBJ_STATIC_POINTER))
+        {
+            ACPI_FREE (OldPointer);
+        }
+
+        ObjDesc->Common.Flags &= ~AOPOBJ_STATIC_POINTER;
+        ObjDesc->Buffer.Share = NULL;
+        return (AE_OK);
+
+    case ACPI_TYPE_PACKAGE:
+
+        if (!ObjDesc->Package.Share)
+        {
+            return (AE_OK);
+        }
+
+        if (ObjDesc->Package.Share->Count == 1)
+        {
+            ACPI_FREE (ObjDesc->Package.Share);
+            ObjDesc->Package.Share = NULL;
+            return (AE_OK);
+        }
+
+        return (AcpiUtUnsharePackage (ObjDesc));
+
+    default:
+
+        return (AE_OK);
+    }
+}
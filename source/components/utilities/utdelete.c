@@ -46,6 +46,7 @@
 #include "acinterp.h"
 #include "acnamesp.h"
 #include "acevents.h"
+#include "acdispat.h"
 
 
 #define _COMPONENT          ACPI_UTILITIES
@@ -124,10 +125,13 @@ AcpiUtDeleteInternalObj (
 
         /* Free the actual buffer */
 
-        if (!(Object->Common.Flags & AOPOBJ_STATIC_POINTER))
+        if (AcpiUtReleaseSharedData (Object) &&
+            !(Object->Common.Flags & AOPOBJ_STATIC_POINTER))
         {
-            /* But only if it is NOT a pointer into an ACPI table */
-
+            /*
+             * But only if it is not still shared copy-on-write with
+             * another buffer, and is NOT a pointer into an ACPI table
+             */
             ObjPointer = Object->Buffer.Pointer;
         }
         break;
@@ -142,9 +146,14 @@ AcpiUtDeleteInternalObj (
          * separately
          */
 
-        /* Free the (variable length) element pointer array */
-
-        ObjPointer = Object->Package.Elements;
+        /*
+         * Free the (variable length) element pointer array, unless it is
+         * still shared copy-on-write with another package
+         */
+        if (AcpiUtReleaseSharedData (Object))
+        {
+            ObjPointer = Object->Package.Elements;
+        }
         break;
 
     /*
@@ -225,6 +234,10 @@ AcpiUtDeleteInternalObj (
         {
             Object->Method.Node = NULL;
         }
+
+        AcpiDsMethodCacheDelete (Object);
+        AcpiDsMemoDelete (Object);
+        AcpiDsJitDelete (Object);
         break;
 
     case ACPI_TYPE_REGION:
@@ -171,11 +171,20 @@ AcpiUtInitGlobals (
 
     AcpiGbl_OwnerIdMask[ACPI_NUM_OWNERID_MASKS - 1] = 0x80000000;
 
+    for (i = 0; i < ACPI_NUM_OWNER_IDS; i++)
+    {
+        AcpiGbl_NsOwnerNodes[i]             = NULL;
+    }
+
     /* Event counters */
 
     AcpiMethodCount                     = 0;
     AcpiSciCount                        = 0;
     AcpiGpeCount                        = 0;
+    AcpiGpeStormCount                   = 0;
+    AcpiGpePolledCount                  = 0;
+    AcpiGpeCoalescedCount               = 0;
+    AcpiGpeRerunCount                   = 0;
 
     for (i = 0; i < ACPI_NUM_FIXED_EVENTS; i++)
     {
@@ -194,6 +203,8 @@ AcpiUtInitGlobals (
 
     AcpiGbl_GlobalEventHandler          = NULL;
     AcpiGbl_SciHandlerList              = NULL;
+    AcpiGbl_GpePollerRunning            = FALSE;
+    AcpiGbl_GpePollerStop               = FALSE;
 
 #endif /* !ACPI_REDUCED_HARDWARE */
 
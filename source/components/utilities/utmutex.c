@@ -57,6 +57,11 @@ static void
 AcpiUtDeleteMutex (
     ACPI_MUTEX_HANDLE       MutexId);
 
+static ACPI_STATUS
+AcpiUtWaitMutex (
+    ACPI_MUTEX              Mutex,
+    BOOLEAN                 *Contended);
+
 
 /*******************************************************************************
  *
@@ -113,6 +118,35 @@ AcpiUtMutexInitialize (
         return_ACPI_STATUS (Status);
     }
 
+    Status = AcpiOsCreateLock (&AcpiGbl_NsPathCacheLock);
+    if (ACPI_FAILURE (Status))
+    {
+        return_ACPI_STATUS (Status);
+    }
+
+    /* Scheduler of AcpiEvaluateObjectAsync */
+
+    Status = AcpiOsCreateLock (&AcpiGbl_AsyncLock);
+    if (ACPI_FAILURE (Status))
+    {
+        return_ACPI_STATUS (Status);
+    }
+
+    Status = AcpiOsCreateSemaphore (ACPI_ASYNC_MAX_WORKERS, 0,
+        &AcpiGbl_AsyncSemaphore);
+    if (ACPI_FAILURE (Status))
+    {
+        return_ACPI_STATUS (Status);
+    }
+
+    /* Wakes the poller of stormed GPEs when the subsystem terminates */
+
+    Status = AcpiOsCreateSemaphore (1, 0, &AcpiGbl_GpePollSemaphore);
+    if (ACPI_FAILURE (Status))
+    {
+        return_ACPI_STATUS (Status);
+    }
+
     /* Mutex for _OSI support */
 
     Status = AcpiOsCreateMutex (&AcpiGbl_OsiMutex);
@@ -170,6 +204,10 @@ AcpiUtMutexTerminate (
     AcpiOsDeleteLock (AcpiGbl_GpeLock);
     AcpiOsDeleteLock (AcpiGbl_HardwareLock);
     AcpiOsDeleteLock (AcpiGbl_ReferenceCountLock);
+    AcpiOsDeleteLock (AcpiGbl_NsPathCacheLock);
+    AcpiOsDeleteLock (AcpiGbl_AsyncLock);
+    (void) AcpiOsDeleteSemaphore (AcpiGbl_AsyncSemaphore);
+    (void) AcpiOsDeleteSemaphore (AcpiGbl_GpePollSemaphore);
 
     /* Delete the reader/writer lock */
 
@@ -205,6 +243,15 @@ AcpiUtCreateMutex (
         Status = AcpiOsCreateMutex (&AcpiGbl_MutexInfo[MutexId].Mutex);
         AcpiGbl_MutexInfo[MutexId].ThreadId = ACPI_MUTEX_NOT_ACQUIRED;
         AcpiGbl_MutexInfo[MutexId].UseCount = 0;
+        AcpiGbl_MutexInfo[MutexId].NumReaders = 0;
+        AcpiGbl_MutexInfo[MutexId].SharedCount = 0;
+        AcpiGbl_MutexInfo[MutexId].ContentionCount = 0;
+        AcpiGbl_MutexInfo[MutexId].SharedContentionCount = 0;
+    }
+
+    if (ACPI_SUCCESS (Status) && !AcpiGbl_MutexInfo[MutexId].ReaderMutex)
+    {
+        Status = AcpiOsCreateMutex (&AcpiGbl_MutexInfo[MutexId].ReaderMutex);
     }
 
     return_ACPI_STATUS (Status);
@@ -232,14 +279,51 @@ AcpiUtDeleteMutex (
 
 
     AcpiOsDeleteMutex (AcpiGbl_MutexInfo[MutexId].Mutex);
+    AcpiOsDeleteMutex (AcpiGbl_MutexInfo[MutexId].ReaderMutex);
 
     AcpiGbl_MutexInfo[MutexId].Mutex = NULL;
+    AcpiGbl_MutexInfo[MutexId].ReaderMutex = NULL;
     AcpiGbl_MutexInfo[MutexId].ThreadId = ACPI_MUTEX_NOT_ACQUIRED;
+    AcpiGbl_MutexInfo[MutexId].NumReaders = 0;
 
     return_VOID;
 }
 
 
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtWaitMutex
+ *
+ * PARAMETERS:  Mutex           - OS mutex to be acquired
+ *              Contended       - Set to TRUE if the mutex was not available
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Acquire an OS mutex, waiting as long as necessary. The mutex
+ *              is polled first, so that the caller can count the
+ *              acquisitions that had to wait.
+ *
+ ******************************************************************************/
+
+static ACPI_STATUS
+AcpiUtWaitMutex (
+    ACPI_MUTEX              Mutex,
+    BOOLEAN                 *Contended)
+{
+    ACPI_STATUS             Status;
+
+
+    Status = AcpiOsAcquireMutex (Mutex, ACPI_DO_NOT_WAIT);
+    if (Status == AE_TIME)
+    {
+        *Contended = TRUE;
+        Status = AcpiOsAcquireMutex (Mutex, ACPI_WAIT_FOREVER);
+    }
+
+    return (Status);
+}
+
+
 /*******************************************************************************
  *
  * FUNCTION:    AcpiUtAcquireMutex
@@ -248,7 +332,8 @@ AcpiUtDeleteMutex (
  *
  * RETURN:      Status
  *
- * DESCRIPTION: Acquire a mutex object.
+ * DESCRIPTION: Acquire a mutex object for exclusive use. Waits for all
+ *              shared holders (AcpiUtAcquireSharedMutex) to release it.
  *
  ******************************************************************************/
 
@@ -258,6 +343,7 @@ AcpiUtAcquireMutex (
 {
     ACPI_STATUS             Status;
     ACPI_THREAD_ID          ThisThreadId;
+    BOOLEAN                 Contended = FALSE;
 
 
     ACPI_FUNCTION_NAME (UtAcquireMutex);
@@ -310,8 +396,7 @@ AcpiUtAcquireMutex (
         "Thread %u attempting to acquire Mutex [%s]\n",
         (UINT32) ThisThreadId, AcpiUtGetMutexName (MutexId)));
 
-    Status = AcpiOsAcquireMutex (
-        AcpiGbl_MutexInfo[MutexId].Mutex, ACPI_WAIT_FOREVER);
+    Status = AcpiUtWaitMutex (AcpiGbl_MutexInfo[MutexId].Mutex, &Contended);
     if (ACPI_SUCCESS (Status))
     {
         ACPI_DEBUG_PRINT ((ACPI_DB_MUTEX,
@@ -320,6 +405,10 @@ AcpiUtAcquireMutex (
 
         AcpiGbl_MutexInfo[MutexId].UseCount++;
         AcpiGbl_MutexInfo[MutexId].ThreadId = ThisThreadId;
+        if (Contended)
+        {
+            AcpiGbl_MutexInfo[MutexId].ContentionCount++;
+        }
     }
     else
     {
@@ -408,3 +497,157 @@ AcpiUtReleaseMutex (
     AcpiOsReleaseMutex (AcpiGbl_MutexInfo[MutexId].Mutex);
     return (AE_OK);
 }
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtAcquireSharedMutex
+ *
+ * PARAMETERS:  MutexID         - ID of the mutex to be acquired
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Acquire a mutex object for shared (read-only) use. Any number
+ *              of threads may hold the mutex shared at the same time, while
+ *              AcpiUtAcquireMutex waits until all of them have released it.
+ *              As with the reader/writer locks (utlock.c), only the first
+ *              reader acquires the mutex itself and only the last one
+ *              releases it, so a steady stream of readers can in theory
+ *              starve an exclusive user.
+ *
+ *              A shared holder must not acquire the same mutex again, either
+ *              shared or exclusive.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiUtAcquireSharedMutex (
+    ACPI_MUTEX_HANDLE       MutexId)
+{
+    ACPI_MUTEX_INFO         *Info;
+    ACPI_STATUS             Status;
+    BOOLEAN                 Contended = FALSE;
+
+
+    ACPI_FUNCTION_NAME (UtAcquireSharedMutex);
+
+
+    if (MutexId > ACPI_MAX_MUTEX)
+    {
+        return (AE_BAD_PARAMETER);
+    }
+
+    Info = &AcpiGbl_MutexInfo[MutexId];
+
+#ifdef ACPI_MUTEX_DEBUG
+    {
+        ACPI_THREAD_ID          ThisThreadId = AcpiOsGetThreadId ();
+        UINT32                  i;
+
+
+        /* Same ordering rule as for AcpiUtAcquireMutex */
+
+        for (i = MutexId; i < ACPI_NUM_MUTEX; i++)
+        {
+            if (AcpiGbl_MutexInfo[i].ThreadId == ThisThreadId)
+            {
+                ACPI_ERROR ((AE_INFO,
+                    "Invalid acquire order: Thread %u owns [%s], wants [%s] shared",
+                    (UINT32) ThisThreadId, AcpiUtGetMutexName (i),
+                    AcpiUtGetMutexName (MutexId)));
+
+                return (AE_ACQUIRE_DEADLOCK);
+            }
+        }
+    }
+#endif
+
+    Status = AcpiUtWaitMutex (Info->ReaderMutex, &Contended);
+    if (ACPI_FAILURE (Status))
+    {
+        return (Status);
+    }
+
+    /* Acquire the mutex itself only for the first reader */
+
+    if (!Info->NumReaders)
+    {
+        Status = AcpiUtWaitMutex (Info->Mutex, &Contended);
+        if (ACPI_FAILURE (Status))
+        {
+            AcpiOsReleaseMutex (Info->ReaderMutex);
+            ACPI_EXCEPTION ((AE_INFO, Status,
+                "Could not acquire Mutex [%s] shared",
+                AcpiUtGetMutexName (MutexId)));
+            return (Status);
+        }
+    }
+
+    Info->NumReaders++;
+    Info->SharedCount++;
+    if (Contended)
+    {
+        Info->SharedContentionCount++;
+    }
+
+    AcpiOsReleaseMutex (Info->ReaderMutex);
+    return (AE_OK);
+}
+
+
+/*******************************************************************************
+ *
+ * FUNCTION:    AcpiUtReleaseSharedMutex
+ *
+ * PARAMETERS:  MutexID         - ID of the mutex to be released
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Release a mutex object acquired by AcpiUtAcquireSharedMutex.
+ *
+ ******************************************************************************/
+
+ACPI_STATUS
+AcpiUtReleaseSharedMutex (
+    ACPI_MUTEX_HANDLE       MutexId)
+{
+    ACPI_MUTEX_INFO         *Info;
+    ACPI_STATUS             Status;
+
+
+    ACPI_FUNCTION_NAME (UtReleaseSharedMutex);
+
+
+    if (MutexId > ACPI_MAX_MUTEX)
+    {
+        return (AE_BAD_PARAMETER);
+    }
+
+    Info = &AcpiGbl_MutexInfo[MutexId];
+    Status = AcpiOsAcquireMutex (Info->ReaderMutex, ACPI_WAIT_FOREVER);
+    if (ACPI_FAILURE (Status))
+    {
+        return (Status);
+    }
+
+    if (!Info->NumReaders)
+    {
+        AcpiOsReleaseMutex (Info->ReaderMutex);
+        ACPI_ERROR ((AE_INFO,
+            "Mutex [%s] (0x%X) is not acquired shared, cannot release",
+            AcpiUtGetMutexName (MutexId), MutexId));
+
+        return (AE_NOT_ACQUIRED);
+    }
+
+    /* Release the mutex itself only for the very last reader */
+
+    Info->NumReaders--;
+    if (!Info->NumReaders)
+    {
+        AcpiOsReleaseMutex (Info->Mutex);
+    }
+
+    AcpiOsReleaseMutex (Info->ReaderMutex);
+    return (AE_OK);
+}
@@ -486,6 +486,14 @@ AcpiUtDeleteObjectDesc (
         return_VOID;
     }
 
+    /* Arena integers go back to the arena of their method invocation */
+
+    if (Object->Common.Flags & AOPOBJ_ARENA)
+    {
+        AcpiUtArenaDeleteObject (Object);
+        return_VOID;
+    }
+
     (void) AcpiOsReleaseObject (AcpiGbl_OperandCache, Object);
     return_VOID;
 }
@@ -343,9 +343,9 @@ AcpiUtDeleteGenericState (
     ACPI_FUNCTION_ENTRY ();
 
 
-    /* Ignore null state */
+    /* Ignore null state. Arena states are reclaimed with the arena */
 
-    if (State)
+    if (State && !(State->Common.Flags & ACPI_STATE_ARENA))
     {
         (void) AcpiOsReleaseObject (AcpiGbl_StateCache, State);
     }
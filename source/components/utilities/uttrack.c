@@ -175,17 +175,6 @@ AcpiUtAllocateAndTrack (
         return (NULL);
     }
 
-    AcpiGbl_GlobalList->TotalAllocated++;
-    AcpiGbl_GlobalList->TotalSize += (UINT32) Size;
-    AcpiGbl_GlobalList->CurrentTotalSize += (UINT32) Size;
-
-    if (AcpiGbl_GlobalList->CurrentTotalSize >
-        AcpiGbl_GlobalList->MaxOccupied)
-    {
-        AcpiGbl_GlobalList->MaxOccupied =
-            AcpiGbl_GlobalList->CurrentTotalSize;
-    }
-
     return ((void *) &Allocation->UserSpace);
 }
 
@@ -244,17 +233,6 @@ AcpiUtAllocateZeroedAndTrack (
         return (NULL);
     }
 
-    AcpiGbl_GlobalList->TotalAllocated++;
-    AcpiGbl_GlobalList->TotalSize += (UINT32) Size;
-    AcpiGbl_GlobalList->CurrentTotalSize += (UINT32) Size;
-
-    if (AcpiGbl_GlobalList->CurrentTotalSize >
-        AcpiGbl_GlobalList->MaxOccupied)
-    {
-        AcpiGbl_GlobalList->MaxOccupied =
-            AcpiGbl_GlobalList->CurrentTotalSize;
-    }
-
     return ((void *) &Allocation->UserSpace);
 }
 
@@ -299,9 +277,6 @@ AcpiUtFreeAndTrack (
     DebugBlock = ACPI_CAST_PTR (ACPI_DEBUG_MEM_BLOCK,
         (((char *) Allocation) - sizeof (ACPI_DEBUG_MEM_HEADER)));
 
-    AcpiGbl_GlobalList->TotalFreed++;
-    AcpiGbl_GlobalList->CurrentTotalSize -= DebugBlock->Size;
-
     Status = AcpiUtRemoveAllocation (DebugBlock, Component, Module, Line);
     if (ACPI_FAILURE (Status))
     {
@@ -417,11 +392,6 @@ AcpiUtTrackAllocation (
     ACPI_FUNCTION_TRACE_PTR (UtTrackAllocation, Allocation);
 
 
-    if (AcpiGbl_DisableMemTracking)
-    {
-        return_ACPI_STATUS (AE_OK);
-    }
-
     MemList = AcpiGbl_GlobalList;
     Status = AcpiUtAcquireMutex (ACPI_MTX_MEMORY);
     if (ACPI_FAILURE (Status))
@@ -429,6 +399,26 @@ AcpiUtTrackAllocation (
         return_ACPI_STATUS (Status);
     }
 
+    /*
+     * The statistics are updated under the lock, since allocations also
+     * happen on threads that run without the interpreter (parallel
+     * execution, see AcpiExYieldInterpreter)
+     */
+    Allocation->Size = (UINT32) Size;
+    MemList->TotalAllocated++;
+    MemList->TotalSize += (UINT32) Size;
+    MemList->CurrentTotalSize += (UINT32) Size;
+
+    if (MemList->CurrentTotalSize > MemList->MaxOccupied)
+    {
+        MemList->MaxOccupied = MemList->CurrentTotalSize;
+    }
+
+    if (AcpiGbl_DisableMemTracking)
+    {
+        goto UnlockAndExit;
+    }
+
     /*
      * Search the global list for this address to make sure it is not
      * already present. This will catch several kinds of problems.
@@ -444,7 +434,6 @@ AcpiUtTrackAllocation (
 
     /* Fill in the instance data */
 
-    Allocation->Size = (UINT32) Size;
     Allocation->AllocType = AllocType;
     Allocation->Component = Component;
     Allocation->Line = Line;
@@ -517,12 +506,23 @@ AcpiUtRemoveAllocation (
     ACPI_FUNCTION_NAME (UtRemoveAllocation);
 
 
+    MemList = AcpiGbl_GlobalList;
+    Status = AcpiUtAcquireMutex (ACPI_MTX_MEMORY);
+    if (ACPI_FAILURE (Status))
+    {
+        return (Status);
+    }
+
+    /* Statistics are updated under the lock, see AcpiUtTrackAllocation */
+
+    MemList->TotalFreed++;
+    MemList->CurrentTotalSize -= Allocation->Size;
+
     if (AcpiGbl_DisableMemTracking)
     {
-        return (AE_OK);
+        return (AcpiUtReleaseMutex (ACPI_MTX_MEMORY));
     }
 
-    MemList = AcpiGbl_GlobalList;
     if (NULL == MemList->ListHead)
     {
         /* No allocations! */
@@ -530,15 +530,10 @@ AcpiUtRemoveAllocation (
         ACPI_ERROR ((Module, Line,
             "Empty allocation list, nothing to free!"));
 
+        (void) AcpiUtReleaseMutex (ACPI_MTX_MEMORY);
         return (AE_OK);
     }
 
-    Status = AcpiUtAcquireMutex (ACPI_MTX_MEMORY);
-    if (ACPI_FAILURE (Status))
-    {
-        return (Status);
-    }
-
     /* Unlink */
 
     if (Allocation->Previous)
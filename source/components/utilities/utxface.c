@@ -235,6 +235,10 @@ AcpiGetStatistics (
 
     Stats->SciCount = AcpiSciCount;
     Stats->GpeCount = AcpiGpeCount;
+    Stats->GpeStormCount = AcpiGpeStormCount;
+    Stats->GpePolledCount = AcpiGpePolledCount;
+    Stats->GpeCoalescedCount = AcpiGpeCoalescedCount;
+    Stats->GpeRerunCount = AcpiGpeRerunCount;
 
     memcpy (Stats->FixedEventCount, AcpiFixedEventCount,
         sizeof (AcpiFixedEventCount));
@@ -242,6 +246,43 @@ AcpiGetStatistics (
     /* Other counters */
 
     Stats->MethodCount = AcpiMethodCount;
+
+    /* Absolute pathname lookup cache */
+
+    Stats->PathCacheHits = AcpiGbl_NsPathCacheHits;
+    Stats->PathCacheMisses = AcpiGbl_NsPathCacheMisses;
+
+    /* Control method name cache */
+
+    Stats->MethodCacheHits = AcpiGbl_MethodCacheHits;
+    Stats->MethodCacheMisses = AcpiGbl_MethodCacheMisses;
+    Stats->MethodMemoHits = AcpiGbl_MethodMemoHits;
+    Stats->MethodMemoMisses = AcpiGbl_MethodMemoMisses;
+
+    /* Native JIT */
+
+    Stats->JitMethodCount = AcpiGbl_JitMethodCount;
+    Stats->JitExecutions = AcpiGbl_JitExecutions;
+    Stats->JitBailouts = AcpiGbl_JitBailouts;
+
+    /* SystemMemory operation region mappings */
+
+    Stats->MemMappingHits = AcpiGbl_MemMappingHits;
+    Stats->MemMappingMisses = AcpiGbl_MemMappingMisses;
+    Stats->MemMappingMerges = AcpiGbl_MemMappingMerges;
+    Stats->MemMappingEvictions = AcpiGbl_MemMappingEvictions;
+    Stats->FieldBlockTransfers = AcpiGbl_FieldBlockTransfers;
+
+    /* Namespace lock usage, and acquisitions that had to wait */
+
+    Stats->NamespaceLockCount =
+        AcpiGbl_MutexInfo[ACPI_MTX_NAMESPACE].UseCount;
+    Stats->NamespaceLockWaits =
+        AcpiGbl_MutexInfo[ACPI_MTX_NAMESPACE].ContentionCount;
+    Stats->NamespaceSharedLockCount =
+        AcpiGbl_MutexInfo[ACPI_MTX_NAMESPACE].SharedCount;
+    Stats->NamespaceSharedLockWaits =
+        AcpiGbl_MutexInfo[ACPI_MTX_NAMESPACE].SharedContentionCount;
     return_ACPI_STATUS (AE_OK);
 }
 
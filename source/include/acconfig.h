@@ -60,6 +60,17 @@
  * ACPI_APPLICATION     - Use this switch if the subsystem is going to be run
  *                        at the application level.
  *
+ * ACPI_USE_THREADED_DISPATCH - Dispatch executed AML opcodes through a
+ *                        table of label addresses (computed goto) instead
+ *                        of the class/type switches. Requires a compiler
+ *                        with the GCC labels-as-values extension.
+ *
+ * ACPI_USE_NATIVE_JIT  - Build the x86-64 native code generator for hot
+ *                        control methods (dsjit.c). Requires the System V
+ *                        calling convention and the OSL interfaces
+ *                        AcpiOsCreateExecutable/AcpiOsDeleteExecutable.
+ *                        Enabled at run time by AcpiGbl_EnableJit.
+ *
  */
 
 /*
@@ -131,9 +142,17 @@
 
 #define ACPI_DEFAULT_PAGE_SIZE          4096    /* Must be power of 2 */
 
+/*
+ * SystemMemory operation regions: default number of mappings cached per
+ * region, and the largest mapping built by merging adjacent windows
+ */
+#define ACPI_MEM_MAPPING_CACHE_SIZE     16
+#define ACPI_MEM_MAPPING_MAX_LENGTH     (16 * ACPI_DEFAULT_PAGE_SIZE)
+
 /* OwnerId tracking. 128 entries allows for 4095 OwnerIds */
 
 #define ACPI_NUM_OWNERID_MASKS          128
+#define ACPI_NUM_OWNER_IDS              (ACPI_NUM_OWNERID_MASKS * 32)
 
 /* Size of the root table array is increased by this increment */
 
@@ -151,6 +170,69 @@
 
 #define ACPI_MAX_LOOP_TIMEOUT           30
 
+/* Scopes with at least this many children get a hashed child index */
+
+#define ACPI_NS_INDEX_THRESHOLD         16
+
+/* Absolute pathname lookup cache: entries (power of 2) and max path length */
+
+#define ACPI_NS_PATH_CACHE_SIZE         64
+#define ACPI_NS_PATH_CACHE_MAX_PATH     64
+
+/* Control method name cache: initial and maximum entries (power of 2) */
+
+#define ACPI_DS_METHOD_CACHE_MIN_SIZE   16
+#define ACPI_DS_METHOD_CACHE_MAX_SIZE   4096
+
+/* Results remembered per side-effect-free control method */
+
+#define ACPI_DS_METHOD_MEMO_ENTRIES     4
+
+/*
+ * Native JIT (dsjit.c): evaluations of a method before it is compiled, the
+ * largest native code generated for one method, and While iterations
+ * between two checks of the loop timeout
+ */
+#define ACPI_JIT_CALL_THRESHOLD         16
+#define ACPI_JIT_MAX_CODE_SIZE          (32 * 1024)
+#define ACPI_JIT_LOOP_CHECK_INTERVAL    0x10000
+
+/* Namespace node arena: nodes per slab, initial size of the slab table */
+
+#define ACPI_NS_ARENA_SLAB_NODES        64
+#define ACPI_NS_ARENA_TABLE_SIZE        64
+
+/* Walk arena: size of each chunk in bytes */
+
+#define ACPI_WALK_ARENA_CHUNK_SIZE      8192
+
+/*
+ * Parallel namespace walk: max workers, target tasks per worker, and the
+ * deepest level at which the namespace is split into tasks
+ */
+#define ACPI_NS_PARALLEL_MAX_WORKERS    64
+#define ACPI_NS_PARALLEL_TASK_FACTOR    8
+#define ACPI_NS_PARALLEL_SPLIT_DEPTH    8
+
+/* Namespace snapshot: deepest namespace level that can be saved */
+
+#define ACPI_NS_SNAPSHOT_MAX_DEPTH      64
+
+/* Max worker threads of the AcpiEvaluateObjectAsync scheduler */
+
+#define ACPI_ASYNC_MAX_WORKERS          4
+
+/*
+ * GPE storm detection: default number of dispatches of one GPE within the
+ * rate window that switches it to polling (zero, disabled), the threshold
+ * suggested to hosts that enable it, the window, and the polling period
+ * (both in milliseconds)
+ */
+#define ACPI_GPE_STORM_THRESHOLD        0
+#define ACPI_GPE_STORM_SUGGESTED        1000
+#define ACPI_GPE_STORM_WINDOW           1000
+#define ACPI_GPE_POLL_INTERVAL          100
+
 
 /******************************************************************************
  *
@@ -172,14 +254,16 @@
 #define ACPI_OBJ_NUM_OPERANDS           8
 #define ACPI_OBJ_MAX_OPERAND            7
 
-/* Number of elements in the Result Stack frame, can be an arbitrary value */
-
-#define ACPI_RESULTS_FRAME_OBJ_NUM      8
+/*
+ * Initial number of elements in the per-thread Result Stack. The stack
+ * doubles in size whenever it fills up.
+ */
+#define ACPI_RESULTS_STACK_INITIAL_SIZE 32
 
 /*
- * Maximal number of elements the Result Stack can contain,
- * it may be an arbitrary value not exceeding the types of
- * ResultSize and ResultCount (now UINT8).
+ * Maximal number of elements a single walk may keep on the Result Stack,
+ * it may be an arbitrary value not exceeding the type of ResultCount
+ * (now UINT8).
  */
 #define ACPI_RESULTS_OBJ_NUM_MAX        255
 
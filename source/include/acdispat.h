@@ -48,6 +48,11 @@
 #define NAMEOF_LOCAL_NTE    "__L0"
 #define NAMEOF_ARG_NTE      "__A0"
 
+/* Element Index (0 = oldest) of the results of a walk on the result stack */
+
+#define ACPI_DS_RESULT(WalkState, Index) \
+    ((WalkState)->ResultStack->Objects [(WalkState)->ResultBase + (Index)])
+
 
 /*
  * dsargs - execution of dynamic arguments for static objects
@@ -288,6 +293,74 @@ AcpiDsMethodError (
     ACPI_STATUS             Status,
     ACPI_WALK_STATE         *WalkState);
 
+/*
+ * dsmcache - Control method name cache
+ */
+ACPI_NAMESPACE_NODE *
+AcpiDsMethodCacheLookup (
+    ACPI_WALK_STATE         *WalkState,
+    UINT8                   *Aml,
+    UINT32                  *Length);
+
+void
+AcpiDsMethodCacheInsert (
+    ACPI_WALK_STATE         *WalkState,
+    UINT8                   *Aml,
+    UINT32                  Length,
+    ACPI_NAMESPACE_NODE     *Node);
+
+void
+AcpiDsMethodCachePurgeName (
+    ACPI_NAMESPACE_NODE     *MethodNode,
+    UINT32                  Name);
+
+void
+AcpiDsMethodCacheDelete (
+    ACPI_OPERAND_OBJECT     *MethodDesc);
+
+
+/*
+ * dsmemo - Memoization of side-effect-free control methods
+ */
+void
+AcpiDsMemoAnalyzeMethod (
+    ACPI_NAMESPACE_NODE     *Node,
+    ACPI_OPERAND_OBJECT     *ObjDesc);
+
+BOOLEAN
+AcpiDsMemoLookup (
+    ACPI_EVALUATE_INFO      *Info,
+    ACPI_STATUS             *Status);
+
+void
+AcpiDsMemoInsert (
+    ACPI_EVALUATE_INFO      *Info,
+    ACPI_STATUS             Status);
+
+void
+AcpiDsMemoDelete (
+    ACPI_OPERAND_OBJECT     *MethodDesc);
+
+
+/*
+ * dsjit - Native code for hot control methods
+ */
+#ifdef ACPI_USE_NATIVE_JIT
+BOOLEAN
+AcpiDsJitExecute (
+    ACPI_EVALUATE_INFO      *Info,
+    ACPI_STATUS             *Status);
+
+void
+AcpiDsJitDelete (
+    ACPI_OPERAND_OBJECT     *MethodDesc);
+
+#else
+#define AcpiDsJitExecute(Info, Status)      FALSE
+#define AcpiDsJitDelete(MethodDesc)
+#endif
+
+
 /*
  * dsinit
  */
@@ -478,6 +551,10 @@ AcpiDsResultPush (
     ACPI_OPERAND_OBJECT     *Object,
     ACPI_WALK_STATE         *WalkState);
 
+void
+AcpiDsResultStackRelease (
+    ACPI_VALUE_STACK        *Stack);
+
 
 /*
  * dsdebug - parser debugging routines
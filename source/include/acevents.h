@@ -196,6 +196,20 @@ AcpiEvGpeDispatch (
     UINT32                  GpeNumber);
 
 
+/*
+ * evgpepoll - GPE storm detection and polling
+ */
+void
+AcpiEvCheckGpeStorm (
+    ACPI_GPE_EVENT_INFO     *GpeEventInfo,
+    UINT32                  GpeNumber);
+
+ACPI_HW_DEPENDENT_RETURN_VOID (
+void
+AcpiEvStopGpePoller (
+    void))
+
+
 /*
  * evgpeinit - GPE initialization and update
  */
@@ -269,7 +283,8 @@ AcpiEvInstallSpaceHandler (
     ACPI_ADR_SPACE_TYPE     SpaceId,
     ACPI_ADR_SPACE_HANDLER  Handler,
     ACPI_ADR_SPACE_SETUP    Setup,
-    void                    *Context);
+    void                    *Context,
+    UINT32                  HandlerFlags);
 
 
 /*
@@ -233,8 +233,9 @@ typedef struct acpi_exception_info
 #define AE_CTRL_CONTINUE                EXCEP_CTL (0x000A)
 #define AE_CTRL_PARSE_CONTINUE          EXCEP_CTL (0x000B)
 #define AE_CTRL_PARSE_PENDING           EXCEP_CTL (0x000C)
+#define AE_CTRL_SUSPEND                 EXCEP_CTL (0x000D)
 
-#define AE_CODE_CTRL_MAX                0x000C
+#define AE_CODE_CTRL_MAX                0x000D
 
 
 /* Exception strings for AcpiFormatException */
@@ -365,7 +366,8 @@ static const ACPI_EXCEPTION_INFO    AcpiGbl_ExceptionNames_Ctrl[] =
     EXCEP_TXT ("AE_CTRL_BREAK",                 "A Break has been executed"),
     EXCEP_TXT ("AE_CTRL_CONTINUE",              "A Continue has been executed"),
     EXCEP_TXT ("AE_CTRL_PARSE_CONTINUE",        "Used to skip over bad opcodes"),
-    EXCEP_TXT ("AE_CTRL_PARSE_PENDING",         "Used to implement AML While loops")
+    EXCEP_TXT ("AE_CTRL_PARSE_PENDING",         "Used to implement AML While loops"),
+    EXCEP_TXT ("AE_CTRL_SUSPEND",               "Method suspended until a later resume")
 };
 
 #endif /* EXCEPTION_TABLE */
@@ -130,6 +130,25 @@ ACPI_GLOBAL (ACPI_MUTEX,                AcpiGbl_OsiMutex);
 
 ACPI_GLOBAL (ACPI_RW_LOCK,              AcpiGbl_NamespaceRwLock);
 
+/* Pathname lookup cache, updated by readers holding the namespace shared */
+
+ACPI_GLOBAL (ACPI_SPINLOCK,             AcpiGbl_NsPathCacheLock);
+
+/* Scheduler for AcpiEvaluateObjectAsync (nsasync.c), lists under the lock */
+
+ACPI_GLOBAL (ACPI_SPINLOCK,             AcpiGbl_AsyncLock);
+ACPI_GLOBAL (ACPI_SEMAPHORE,            AcpiGbl_AsyncSemaphore);
+ACPI_GLOBAL (ACPI_COROUTINE *,          AcpiGbl_AsyncReadyList);
+ACPI_GLOBAL (ACPI_COROUTINE *,          AcpiGbl_AsyncSleepList);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_AsyncWorkers);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_AsyncIdleWorkers);
+
+/* Poller of stormed GPEs (evgpepoll.c), flags under the GpeLock */
+
+ACPI_GLOBAL (ACPI_SEMAPHORE,            AcpiGbl_GpePollSemaphore);
+ACPI_GLOBAL (BOOLEAN,                   AcpiGbl_GpePollerRunning);
+ACPI_GLOBAL (BOOLEAN,                   AcpiGbl_GpePollerStop);
+
 
 /*****************************************************************************
  *
@@ -175,6 +194,20 @@ ACPI_INIT_GLOBAL (BOOLEAN,              AcpiGbl_NamespaceInitialized, FALSE);
 
 ACPI_GLOBAL (UINT32,                    AcpiGbl_OriginalMode);
 ACPI_GLOBAL (UINT32,                    AcpiGbl_NsLookupCount);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_NsPathCacheHits);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_NsPathCacheMisses);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_MethodCacheHits);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_MethodCacheMisses);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_MethodMemoHits);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_MethodMemoMisses);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_JitMethodCount);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_JitExecutions);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_JitBailouts);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_MemMappingHits);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_MemMappingMisses);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_MemMappingMerges);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_MemMappingEvictions);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_FieldBlockTransfers);
 ACPI_GLOBAL (UINT32,                    AcpiGbl_PsFindCount);
 ACPI_GLOBAL (UINT16,                    AcpiGbl_Pm1EnableRegisterSave);
 ACPI_GLOBAL (UINT8,                     AcpiGbl_DebuggerConfiguration);
@@ -216,6 +249,36 @@ ACPI_GLOBAL (BOOLEAN,                   AcpiGbl_VerboseLeakDump);
 ACPI_GLOBAL (ACPI_NAMESPACE_NODE,       AcpiGbl_RootNodeStruct);
 ACPI_GLOBAL (ACPI_NAMESPACE_NODE *,     AcpiGbl_RootNode);
 ACPI_GLOBAL (ACPI_NAMESPACE_NODE *,     AcpiGbl_FadtGpeDevice);
+ACPI_GLOBAL (ACPI_NS_PATH_CACHE_ENTRY,  AcpiGbl_NsPathCache[ACPI_NS_PATH_CACHE_SIZE]);
+
+/*
+ * Incremented whenever a node is added to or removed from the namespace,
+ * other than the temporary nodes of a running method (dsmcache.c)
+ */
+ACPI_GLOBAL (UINT32,                    AcpiGbl_NsGeneration);
+
+/*
+ * Incremented whenever the value of a named object may have changed: a
+ * store to a named object, package element, buffer byte or field (dsmemo.c)
+ */
+ACPI_GLOBAL (UINT32,                    AcpiGbl_NsDataGeneration);
+
+/* Nodes created by each owner, newest first (protected by ACPI_MTX_NAMESPACE) */
+
+ACPI_GLOBAL (ACPI_NAMESPACE_NODE *,     AcpiGbl_NsOwnerNodes[ACPI_NUM_OWNER_IDS]);
+
+/* Namespace node arenas and slabs (protected by ACPI_MTX_CACHES) */
+
+ACPI_GLOBAL (ACPI_NS_ARENA *,           AcpiGbl_NsArenaList);
+ACPI_GLOBAL (ACPI_NS_SLAB **,           AcpiGbl_NsSlabTable);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_NsSlabTableSize);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_NsSlabNextIndex);
+
+/* Device hardware ID index (protected by ACPI_MTX_NAMESPACE) */
+
+ACPI_GLOBAL (ACPI_NS_DEVICE_ID_INDEX *, AcpiGbl_DeviceIdIndex);
+ACPI_GLOBAL (UINT32,                    AcpiGbl_DeviceIdGeneration);
+ACPI_GLOBAL (BOOLEAN,                   AcpiGbl_DeviceIdIndexBuilding);
 
 extern const UINT8                      AcpiGbl_NsProperties [ACPI_NUM_NS_TYPES];
 extern const ACPI_PREDEFINED_NAMES      AcpiGbl_PreDefinedNames [NUM_PREDEFINED_NAMES];
@@ -289,6 +352,10 @@ extern ACPI_FIXED_EVENT_INFO            AcpiGbl_FixedEventInfo[ACPI_NUM_FIXED_EV
 
 ACPI_GLOBAL (UINT32,                    AcpiMethodCount);
 ACPI_GLOBAL (UINT32,                    AcpiGpeCount);
+ACPI_GLOBAL (UINT32,                    AcpiGpeStormCount);
+ACPI_GLOBAL (UINT32,                    AcpiGpePolledCount);
+ACPI_GLOBAL (UINT32,                    AcpiGpeCoalescedCount);
+ACPI_GLOBAL (UINT32,                    AcpiGpeRerunCount);
 ACPI_GLOBAL (UINT32,                    AcpiSciCount);
 ACPI_GLOBAL (UINT32,                    AcpiFixedEventCount[ACPI_NUM_FIXED_EVENTS]);
 
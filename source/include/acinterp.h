@@ -429,6 +429,11 @@ ACPI_STATUS
 AcpiExSystemDoSleep(
     UINT64                  Time);
 
+ACPI_STATUS
+AcpiExSystemSuspend (
+    ACPI_WALK_STATE         *WalkState,
+    UINT64                  HowLongMs);
+
 ACPI_STATUS
 AcpiExSystemDoStall (
     UINT32                  Time);
@@ -673,6 +678,18 @@ void
 AcpiExExitInterpreter (
     void);
 
+void
+AcpiExYieldInterpreter (
+    ACPI_WALK_STATE         *WalkState);
+
+void
+AcpiExResumeInterpreter (
+    ACPI_WALK_STATE         *WalkState);
+
+void
+AcpiExCheckInterpreter (
+    ACPI_WALK_STATE         *WalkState);
+
 BOOLEAN
 AcpiExTruncateFor32bitTable (
     ACPI_OPERAND_OBJECT     *ObjDesc);
@@ -704,6 +721,15 @@ BOOLEAN
 AcpiIsValidSpaceId (
     UINT8                   SpaceId);
 
+ACPI_OPERAND_OBJECT **
+AcpiExGetElementPointer (
+    ACPI_OPERAND_OBJECT     *IndexDesc);
+
+ACPI_STATUS
+AcpiExGetPackageElement (
+    ACPI_OPERAND_OBJECT     *IndexDesc,
+    ACPI_OPERAND_OBJECT     **ElementDesc);
+
 
 /*
  * exregion - default OpRegion handlers
@@ -717,6 +743,10 @@ AcpiExSystemMemorySpaceHandler (
     void                    *HandlerContext,
     void                    *RegionContext);
 
+void
+AcpiExDeleteMemMappings (
+    ACPI_MEM_SPACE_CONTEXT  *MemInfo);
+
 ACPI_STATUS
 AcpiExSystemIoSpaceHandler (
     UINT32                  Function,
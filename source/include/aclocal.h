@@ -133,6 +133,11 @@ typedef struct acpi_mutex_info
     ACPI_MUTEX                      Mutex;
     UINT32                          UseCount;
     ACPI_THREAD_ID                  ThreadId;
+    ACPI_MUTEX                      ReaderMutex;        /* Serializes shared acquisitions */
+    UINT32                          NumReaders;         /* Current shared holders */
+    UINT32                          SharedCount;        /* Shared acquisitions */
+    UINT32                          ContentionCount;    /* Exclusive acquisitions that had to wait */
+    UINT32                          SharedContentionCount; /* Shared acquisitions that had to wait */
 
 } ACPI_MUTEX_INFO;
 
@@ -176,7 +181,10 @@ typedef enum
  * DescriptorType is used to differentiate between internal descriptors.
  *
  * The node is optimized for both 32-bit and 64-bit platforms:
- * 20 bytes for the 32-bit case, 32 bytes for the 64-bit case.
+ * 44 bytes for the 32-bit case, 80 bytes for the 64-bit case.
+ * Slab uses the padding after OwnerId and does not add to the size.
+ * Pathname adds one pointer (4/8 bytes).
+ * OwnerNext and OwnerPrev add two pointers (8/16 bytes).
  *
  * Note: The DescriptorType and Type fields must appear in the identical
  * position in both the ACPI_NAMESPACE_NODE and ACPI_OPERAND_OBJECT
@@ -192,7 +200,12 @@ typedef struct acpi_namespace_node
     struct acpi_namespace_node      *Parent;        /* Parent node */
     struct acpi_namespace_node      *Child;         /* First child */
     struct acpi_namespace_node      *Peer;          /* First peer */
+    struct acpi_ns_child_index      *ChildIndex;    /* Hashed child lookup (large scopes only) */
     ACPI_OWNER_ID                   OwnerId;        /* Node creator */
+    UINT16                          Slab;           /* Arena slab holding this node, 0 if none */
+    char                            *Pathname;      /* Cached normalized pathname, if any (ACPI_CACHED_PATHNAME) */
+    struct acpi_namespace_node      *OwnerNext;     /* Next node with the same OwnerId */
+    struct acpi_namespace_node      *OwnerPrev;     /* Previous node with the same OwnerId */
 
     /*
      * The following fields are used by the ASL compiler and disassembler only
@@ -210,9 +223,306 @@ typedef struct acpi_namespace_node
 } ACPI_NAMESPACE_NODE;
 
 
+/*
+ * Cached normalized pathname of a namespace node. Node->Pathname points at
+ * the Pathname field. The node holds one reference and each user of the
+ * string (evaluation, nested method call) holds another, so the string
+ * stays valid if the node is deleted while a method is running, for example
+ * when a method unloads its own table.
+ */
+typedef struct acpi_cached_pathname
+{
+    UINT32                          ReferenceCount;
+    char                            Pathname[1];    /* Variable length, null terminated */
+
+} ACPI_CACHED_PATHNAME;
+
+
+/*
+ * Hashed index of the children of a single scope. Built by AcpiNsInstallNode
+ * once a scope reaches AcpiGbl_NamespaceIndexThreshold children, and kept in
+ * sync by AcpiNsInstallNode/AcpiNsRemoveNode. The Child/Peer list remains
+ * the authoritative list of children; the index only accelerates lookups.
+ *
+ * The table uses open addressing with linear probing. Only the first child
+ * (in Peer order) with any given name is entered into the table.
+ */
+typedef struct acpi_ns_child_index
+{
+    struct acpi_namespace_node      *Tail;          /* Last child, for fast appends */
+    UINT32                          Count;          /* Entries in use */
+    UINT32                          Size;           /* Entries allocated (power of 2) */
+    struct acpi_namespace_node      **Table;        /* Hash table (follows this struct) */
+
+} ACPI_NS_CHILD_INDEX;
+
+
+/*
+ * Entry in the absolute pathname lookup cache used by AcpiNsGetNodeUnlocked.
+ * Maps an external (ASL) pathname, exactly as passed by the caller, to the
+ * node that it resolved to.
+ */
+typedef struct acpi_ns_path_cache_entry
+{
+    struct acpi_namespace_node      *Node;          /* Resolved node, NULL if entry unused */
+    UINT32                          Hash;           /* Hash of the pathname */
+    char                            Pathname[ACPI_NS_PATH_CACHE_MAX_PATH];
+
+} ACPI_NS_PATH_CACHE_ENTRY;
+
+
+/*
+ * Control method name cache (dsmcache.c). Maps the AML offset of a name
+ * string within a method to the node that the name resolved to when the
+ * method ran, so that later executions skip decoding the name and looking
+ * it up. Open addressing with linear probing; Offset is zero in free slots.
+ */
+typedef struct acpi_method_cache_entry
+{
+    struct acpi_namespace_node      *Node;          /* Resolved node */
+    UINT32                          Offset;         /* AML offset of the name string, plus one */
+    UINT32                          Name;           /* Single relative NameSeg, else zero */
+    UINT16                          Length;         /* Length of the name string in the AML */
+
+} ACPI_METHOD_CACHE_ENTRY;
+
+typedef struct acpi_method_cache
+{
+    UINT32                          Generation;     /* AcpiGbl_NsGeneration when filled */
+    UINT32                          Size;           /* Number of slots, power of 2 */
+    UINT32                          Count;          /* Slots in use */
+    ACPI_METHOD_CACHE_ENTRY         Entries[1];     /* Size slots */
+
+} ACPI_METHOD_CACHE;
+
+
+/*
+ * Result memo of a side-effect-free control method (dsmemo.c). Holds the
+ * results of the most recent evaluations, keyed by the argument values.
+ * An entry is valid only while neither the namespace nor the value of any
+ * named object has changed since it was filled.
+ */
+typedef struct acpi_method_memo_entry
+{
+    union acpi_operand_object       *Args[ACPI_METHOD_NUM_ARGS];
+    union acpi_operand_object       *Result;        /* NULL if no value was returned */
+    UINT32                          NsGeneration;   /* AcpiGbl_NsGeneration when filled */
+    UINT32                          DataGeneration; /* AcpiGbl_NsDataGeneration when filled */
+    UINT8                           ArgCount;
+    BOOLEAN                         Valid;
+
+} ACPI_METHOD_MEMO_ENTRY;
+
+typedef struct acpi_method_memo
+{
+    UINT32                          Generation;     /* AcpiGbl_NsGeneration when analyzed */
+    UINT32                          Next;           /* Next entry to replace */
+    ACPI_METHOD_MEMO_ENTRY          Entries[ACPI_DS_METHOD_MEMO_ENTRIES];
+
+} ACPI_METHOD_MEMO;
+
+
+/*
+ * Native code of a control method (dsjit.c). The frame holds the Integer
+ * values of the arguments and locals while the code runs; Valid has a bit
+ * for each local (bits 0-7) and argument (bits 8-14) that has a value.
+ */
+typedef struct acpi_jit_frame
+{
+    UINT64                          Args[ACPI_METHOD_NUM_ARGS];
+    UINT64                          Locals[ACPI_METHOD_NUM_LOCALS];
+    UINT64                          ReturnValue;
+    UINT64                          Scratch;        /* Value returned by a helper */
+    UINT64                          LoopBudget;     /* Iterations until the next timeout check */
+    UINT64                          LoopTimeout;    /* Timer value at which While loops time out */
+    UINT32                          Valid;
+
+} ACPI_JIT_FRAME;
+
+typedef
+UINT32 (*ACPI_JIT_ENTRY) (
+    ACPI_JIT_FRAME                  *Frame);
+
+/* Values returned by an ACPI_JIT_ENTRY */
+
+#define ACPI_JIT_COMPLETED              0       /* End of method, no return value */
+#define ACPI_JIT_RETURNED               1       /* Return, value in Frame->ReturnValue */
+#define ACPI_JIT_BAILOUT                2       /* Method must be run by the interpreter */
+
+typedef struct acpi_method_jit
+{
+    ACPI_JIT_ENTRY                  Entry;          /* Native code, NULL if not compiled */
+    ACPI_SIZE                       CodeLength;
+    UINT32                          Generation;     /* AcpiGbl_NsGeneration when compiled */
+    UINT32                          CallCount;      /* Evaluations while not compiled */
+    BOOLEAN                         Rejected;       /* Method uses unsupported operators */
+
+} ACPI_METHOD_JIT;
+
+
+/*
+ * Namespace node arena (nsarena.c). While a table is loaded, nodes owned by
+ * that table are carved out of contiguous slabs rather than allocated one
+ * at a time. A slab is freed when its last node is deleted, normally when
+ * the table is unloaded. The arena itself lives on the stack of
+ * AcpiNsLoadTable for the duration of the load.
+ */
+typedef struct acpi_ns_slab
+{
+    struct acpi_ns_arena            *Arena;         /* Arena allocating from this slab, if any */
+    UINT16                          Index;          /* Index in AcpiGbl_NsSlabTable */
+    ACPI_OWNER_ID                   OwnerId;        /* Owner the slab was created for */
+    UINT32                          Used;           /* Nodes handed out */
+    UINT32                          Live;           /* Nodes not yet deleted */
+    struct acpi_namespace_node      *Nodes;         /* Node array (follows this struct) */
+
+} ACPI_NS_SLAB;
+
+typedef struct acpi_ns_arena
+{
+    struct acpi_ns_arena            *Next;          /* Next open arena */
+    ACPI_NS_SLAB                    *Slab;          /* Current slab, NULL if none */
+    ACPI_OWNER_ID                   OwnerId;        /* Owner served, 0 if arena not open */
+
+} ACPI_NS_ARENA;
+
+
+/*
+ * Index of device hardware IDs (_HID and _CID) used by AcpiGetDevices.
+ * Entries are in namespace order; each hash chain links the entries whose
+ * IDs hash to the same bucket, also in namespace order.
+ */
+typedef struct acpi_ns_device_id
+{
+    struct acpi_namespace_node      *Node;
+    char                            *Id;
+    UINT32                          Level;          /* Nesting level below the root */
+    UINT32                          Next;           /* Next entry in chain, ACPI_UINT32_MAX if none */
+
+} ACPI_NS_DEVICE_ID;
+
+typedef struct acpi_ns_device_id_index
+{
+    ACPI_NS_DEVICE_ID               *Entries;
+    UINT32                          *Buckets;       /* First entry in each chain */
+    UINT32                          Count;          /* Entries in use */
+    UINT32                          Size;           /* Entries allocated */
+    UINT32                          NumBuckets;     /* Power of 2 */
+    UINT32                          Generation;     /* AcpiGbl_DeviceIdGeneration when built */
+
+} ACPI_NS_DEVICE_ID_INDEX;
+
+
+/*
+ * Binary namespace snapshot (see nssnap.c). The image is laid out as a
+ * header followed by the table keys, the node records, the object records,
+ * and a data area. Records refer to each other only by index or by offset
+ * (relative to the image, the data area, or the owner table), so the image
+ * can be used in place at any address, for example mapped from a file.
+ */
+#define ACPI_NS_SNAPSHOT_SIGNATURE      "NSSN"
+#define ACPI_NS_SNAPSHOT_VERSION        1
+
+#define ACPI_NS_SNAPSHOT_ROOT           ACPI_UINT32_MAX /* Node Parent: the root node */
+#define ACPI_NS_SNAPSHOT_EXISTING       ACPI_UINT16_MAX /* Node Table: node not created by a snapshot table */
+
+typedef struct acpi_ns_snapshot_header
+{
+    char                            Signature[ACPI_NAMESEG_SIZE];
+    UINT32                          Length;         /* Length of the entire image */
+    UINT16                          Version;
+    UINT8                           Checksum;       /* Entire image sums to zero */
+    UINT8                           IntegerWidth;   /* AcpiGbl_IntegerByteWidth */
+    UINT32                          TableCount;
+    UINT32                          NodeCount;
+    UINT32                          ObjectCount;
+    UINT32                          TableOffset;
+    UINT32                          NodeOffset;
+    UINT32                          ObjectOffset;
+    UINT32                          DataOffset;
+    UINT32                          DataLength;
+    UINT32                          Reserved;
+
+} ACPI_NS_SNAPSHOT_HEADER;
+
+/* Identifies a table the snapshot was created from, in load order */
+
+typedef struct acpi_ns_snapshot_table
+{
+    char                            Signature[ACPI_NAMESEG_SIZE];
+    UINT32                          Length;
+    UINT32                          OemRevision;
+    char                            OemId[ACPI_OEM_ID_SIZE];
+    char                            OemTableId[ACPI_OEM_TABLE_ID_SIZE];
+    UINT8                           Checksum;
+    UINT8                           Reserved;
+
+} ACPI_NS_SNAPSHOT_TABLE;
+
+/* Nodes are stored in namespace (pre-)order, parents before children */
+
+typedef struct acpi_ns_snapshot_node
+{
+    UINT32                          Name;
+    UINT32                          Parent;         /* Node index, or ACPI_NS_SNAPSHOT_ROOT */
+    UINT32                          Object;         /* Object index + 1, zero if none */
+    UINT16                          Table;          /* Owner table index, or ACPI_NS_SNAPSHOT_EXISTING */
+    UINT16                          Flags;          /* ANOBJ_* flags */
+    UINT8                           Type;
+    UINT8                           Reserved[3];
+
+} ACPI_NS_SNAPSHOT_NODE;
+
+/*
+ * Static part of the object attached to a node. AML offsets are relative
+ * to the owner table, Data and Reference[] to the data area. Not all
+ * fields are used by every object type.
+ */
+typedef struct acpi_ns_snapshot_object
+{
+    UINT64                          Integer;        /* Integer value, Region or Processor address */
+    UINT32                          AmlOffset;      /* Method AML or deferred operands */
+    UINT32                          AmlLength;
+    UINT32                          Data;           /* String or Buffer contents, Package elements */
+    UINT32                          DataLength;     /* Package: element count */
+    UINT32                          Reference[2];   /* Pathnames of related nodes, zero if none */
+    UINT32                          BitLength;      /* Fields: see ACPI_COMMON_FIELD_INFO */
+    UINT32                          BaseByteOffset;
+    UINT32                          Value;          /* Bank or Index register value, Region length */
+    UINT32                          ResourceOffset; /* Region field resource template (AML offset) */
+    UINT16                          ResourceLength;
+    UINT16                          Order;          /* PowerResource order, Field PinNumberIndex */
+    UINT8                           Type;           /* ACPI_TYPE_* of the object */
+    UINT8                           Flags;          /* AOPOBJ_AML_CONSTANT, AOPOBJ_DATA_VALID */
+    UINT8                           ParamCount;     /* Method */
+    UINT8                           InfoFlags;      /* Method flags, BufferField IsCreateField, named Buffer */
+    UINT8                           SyncLevel;      /* Method, Mutex; PowerResource SystemLevel */
+    UINT8                           SpaceId;        /* Region; Processor ProcId */
+    UINT8                           Length;         /* Processor address length */
+    UINT8                           FieldFlags;
+    UINT8                           Attribute;
+    UINT8                           AccessByteWidth;
+    UINT8                           StartFieldBitOffset;
+    UINT8                           AccessLength;
+
+} ACPI_NS_SNAPSHOT_OBJECT;
+
+/* Package element, in an array in the data area */
+
+typedef struct acpi_ns_snapshot_element
+{
+    UINT64                          Integer;
+    UINT32                          Data;           /* String or Buffer contents, reference pathname, Package elements */
+    UINT32                          Length;         /* String or Buffer length, Package element count */
+    UINT8                           Type;           /* ACPI_TYPE_*, ACPI_TYPE_ANY for a null element */
+    UINT8                           Reserved[7];
+
+} ACPI_NS_SNAPSHOT_ELEMENT;
+
+
 /* Namespace Node flags */
 
-#define ANOBJ_RESERVED                  0x01    /* Available for use */
+#define ANOBJ_PATH_CACHED               0x01    /* Node is referenced by the pathname lookup cache */
 #define ANOBJ_TEMPORARY                 0x02    /* Node is create by a method and is temporary */
 #define ANOBJ_METHOD_ARG                0x04    /* Node is a method argument */
 #define ANOBJ_METHOD_LOCAL              0x08    /* Node is a method local */
@@ -557,9 +867,26 @@ typedef struct acpi_gpe_event_info
     UINT8                           GpeNumber;          /* This GPE */
     UINT8                           RuntimeCount;       /* References to a run GPE */
     BOOLEAN                         DisableForDispatch; /* Masked during dispatching */
+    BOOLEAN                         Polling;            /* Masked after a storm, status is polled */
+    UINT8                           MethodState;        /* Execution of the method/notify in flight */
+    UINT32                          RateWindowStart;    /* Start of the rate window, in milliseconds */
+    UINT32                          RateCount;          /* Dispatches (or active polls) in the window */
+    UINT32                          PollCount;          /* Polls in the window */
+    UINT32                          StormCount;         /* Storms detected on this GPE */
+    UINT32                          PolledEvents;       /* Events dispatched by the poller */
+    UINT32                          CoalescedCount;     /* Events folded into an execution in flight */
 
 } ACPI_GPE_EVENT_INFO;
 
+/*
+ * Values for MethodState field above. At most one execution of the GPE
+ * method (or implicit notify) is queued or running; events that arrive in
+ * the meantime request a single rerun after it.
+ */
+#define ACPI_GPE_METHOD_IDLE            0
+#define ACPI_GPE_METHOD_QUEUED          1   /* Queued or running */
+#define ACPI_GPE_METHOD_RERUN           2   /* Queued or running, run again when done */
+
 /* Information about a GPE register pair, one per each status/enable pair in an array */
 
 typedef struct acpi_gpe_register_info
@@ -592,6 +919,9 @@ typedef struct acpi_gpe_block_info
     UINT16                          BlockBaseNumber;/* Base GPE number for this block */
     UINT8                           SpaceId;
     BOOLEAN                         Initialized;    /* TRUE if this block is initialized */
+    UINT32                          DetectCount;    /* AcpiEvGpeDetect passes over this block */
+    UINT32                          RegisterReads;  /* Status/enable reads by AcpiEvGpeDetect */
+    UINT32                          DispatchCount;  /* GPEs dispatched by AcpiEvGpeDetect */
 
 } ACPI_GPE_BLOCK_INFO;
 
@@ -622,6 +952,7 @@ typedef struct acpi_gpe_device_info
     UINT32                          NextBlockBaseIndex;
     ACPI_STATUS                     Status;
     ACPI_NAMESPACE_NODE             *GpeDevice;
+    ACPI_GPE_BLOCK_STATISTICS       *Statistics;    /* Optional, filled for the block */
 
 } ACPI_GPE_DEVICE_INFO;
 
@@ -682,6 +1013,10 @@ typedef struct acpi_field_info
 
     /* There are 2 bytes available here until the next natural alignment boundary */
 
+/* Generic state flags */
+
+#define ACPI_STATE_ARENA                0x01    /* Allocated from a walk arena */
+
 typedef struct acpi_common_state
 {
     ACPI_STATE_COMMON
@@ -754,6 +1089,51 @@ typedef struct acpi_pscope_state
 } ACPI_PSCOPE_STATE;
 
 
+/*
+ * Walk arena (utarena.c) - one per thread state, so one per top-level method
+ * invocation. The walk states of nested method calls, the parse scope,
+ * control and result states pushed while executing and the intermediate
+ * Integer objects are carved out of large chunks, recycled through free
+ * lists, and released all at once when the invocation completes.
+ */
+typedef struct acpi_arena_chunk
+{
+    struct acpi_arena_chunk         *Next;                  /* Next older chunk */
+
+} ACPI_ARENA_CHUNK;
+
+typedef struct acpi_arena_slot
+{
+    struct acpi_arena_slot          *Next;                  /* Next free slot */
+
+} ACPI_ARENA_SLOT;
+
+typedef struct acpi_walk_arena
+{
+    ACPI_ARENA_CHUNK                *Chunks;                /* Chunks, newest first */
+    UINT8                           *Free;                  /* Unused space in the newest chunk */
+    UINT8                           *End;                   /* End of the newest chunk */
+    ACPI_ARENA_SLOT                 *FreeSlots;             /* Released states and Integer objects */
+    struct acpi_walk_state          *FreeWalks;             /* Released walk states */
+
+} ACPI_WALK_ARENA;
+
+
+/*
+ * Value stack - a contiguous, growable stack of operand objects. Used for the
+ * result stack that is shared by all walk states of a thread: each walk
+ * occupies the elements above the ones of the walk that called it.
+ */
+typedef struct acpi_value_stack
+{
+    union acpi_operand_object       **Objects;              /* Element array */
+    UINT32                          Size;                   /* Allocated elements */
+    UINT32                          Top;                    /* First free element */
+    BOOLEAN                         Allocated;              /* Objects is on the heap, not in an arena */
+
+} ACPI_VALUE_STACK;
+
+
 /*
  * Thread state - one per thread across multiple walk states. Multiple walk
  * states are created when there are nested control methods executing.
@@ -762,25 +1142,17 @@ typedef struct acpi_thread_state
 {
     ACPI_STATE_COMMON
     UINT8                           CurrentSyncLevel;       /* Mutex Sync (nested acquire) level */
+    BOOLEAN                         InterpreterYielded;     /* Interpreter released for a private op */
     struct acpi_walk_state          *WalkStateList;         /* Head of list of WalkStates for this thread */
     union acpi_operand_object       *AcquiredMutexList;     /* List of all currently acquired mutexes */
     ACPI_THREAD_ID                  ThreadId;               /* Running thread ID */
+    ACPI_WALK_ARENA                 Arena;                  /* Per-invocation allocations */
+    struct acpi_coroutine           *Coroutine;             /* Set for suspendable evaluations */
+    ACPI_VALUE_STACK                ResultStack;            /* Results of all walks in this thread */
 
 } ACPI_THREAD_STATE;
 
 
-/*
- * Result values - used to accumulate the results of nested
- * AML arguments
- */
-typedef struct acpi_result_values
-{
-    ACPI_STATE_COMMON
-    union acpi_operand_object       *ObjDesc [ACPI_RESULTS_FRAME_OBJ_NUM];
-
-} ACPI_RESULT_VALUES;
-
-
 typedef
 ACPI_STATUS (*ACPI_PARSE_DOWNWARDS) (
     struct acpi_walk_state          *WalkState,
@@ -826,7 +1198,6 @@ typedef union acpi_generic_state
     ACPI_PSCOPE_STATE               ParseScope;
     ACPI_PKG_STATE                  Pkg;
     ACPI_THREAD_STATE               Thread;
-    ACPI_RESULT_VALUES              Results;
     ACPI_NOTIFY_INFO                Notify;
 
 } ACPI_GENERIC_STATE;
@@ -1107,6 +1478,7 @@ typedef struct acpi_parse_state
     struct acpi_namespace_node      *StartNode;
     union acpi_generic_state        *Scope;         /* Current scope */
     union acpi_parse_object         *StartScope;
+    struct acpi_walk_arena          *Arena;         /* Arena for scope states, if any */
     UINT32                          AmlSize;
 
 } ACPI_PARSE_STATE;
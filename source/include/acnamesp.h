@@ -76,6 +76,7 @@
 #define ACPI_NS_WALK_NO_UNLOCK      0
 #define ACPI_NS_WALK_UNLOCK         0x01
 #define ACPI_NS_WALK_TEMP_NODES     0x02
+#define ACPI_NS_WALK_SHARED         0x04    /* Namespace is locked shared */
 
 /* Object is not a package element */
 
@@ -137,6 +138,54 @@ AcpiNsGetNextNode (
     ACPI_NAMESPACE_NODE     *Parent,
     ACPI_NAMESPACE_NODE     *Child);
 
+
+/*
+ * nsdevid - device hardware ID index
+ */
+ACPI_STATUS
+AcpiNsGetDeviceIdMatches (
+    char                    *Id,
+    ACPI_NS_DEVICE_ID       **ReturnMatches,
+    UINT32                  *ReturnCount,
+    UINT32                  *ReturnGeneration);
+
+void
+AcpiNsInvalidateDeviceIds (
+    void);
+
+void
+AcpiNsDeleteDeviceIds (
+    void);
+
+
+/*
+ * nssnap - binary namespace snapshot
+ */
+ACPI_STATUS
+AcpiNsCreateSnapshot (
+    ACPI_BUFFER             *Buffer);
+
+ACPI_STATUS
+AcpiNsRestoreSnapshot (
+    void                    *Snapshot,
+    UINT32                  Length,
+    UINT32                  *TablesLoaded);
+
+
+/*
+ * nspwalk - parallel namespace walk
+ */
+ACPI_STATUS
+AcpiNsWalkNamespaceParallel (
+    ACPI_OBJECT_TYPE        Type,
+    ACPI_NAMESPACE_NODE     *StartNode,
+    UINT32                  MaxDepth,
+    UINT32                  NumWorkers,
+    ACPI_WALK_CALLBACK      UserFunction,
+    void                    **WorkerContexts,
+    ACPI_WALK_MERGE_HANDLER MergeHandler,
+    void                    *MergeContext);
+
 ACPI_NAMESPACE_NODE *
 AcpiNsGetNextNodeTyped (
     ACPI_OBJECT_TYPE        Type,
@@ -186,7 +235,8 @@ AcpiNsLookup (
  */
 ACPI_NAMESPACE_NODE *
 AcpiNsCreateNode (
-    UINT32                  Name);
+    UINT32                  Name,
+    ACPI_OWNER_ID           OwnerId);
 
 void
 AcpiNsDeleteNode (
@@ -196,6 +246,11 @@ void
 AcpiNsRemoveNode (
     ACPI_NAMESPACE_NODE     *Node);
 
+void
+AcpiNsSetNodeOwner (
+    ACPI_NAMESPACE_NODE     *Node,
+    ACPI_OWNER_ID           OwnerId);
+
 void
 AcpiNsDeleteNamespaceSubtree (
     ACPI_NAMESPACE_NODE     *ParentHandle);
@@ -218,6 +273,80 @@ AcpiNsCompareNames (
     char                    *Name2);
 
 
+/*
+ * nsindex - Hashed child index for large scopes
+ */
+void
+AcpiNsIndexBuild (
+    ACPI_NAMESPACE_NODE     *ParentNode,
+    UINT32                  ChildCount);
+
+void
+AcpiNsIndexInsert (
+    ACPI_NAMESPACE_NODE     *ParentNode,
+    ACPI_NAMESPACE_NODE     *Node);
+
+void
+AcpiNsIndexRemove (
+    ACPI_NAMESPACE_NODE     *ParentNode,
+    ACPI_NAMESPACE_NODE     *Node);
+
+ACPI_NAMESPACE_NODE *
+AcpiNsIndexLookup (
+    ACPI_NAMESPACE_NODE     *ParentNode,
+    UINT32                  TargetName);
+
+void
+AcpiNsIndexDelete (
+    ACPI_NAMESPACE_NODE     *ParentNode);
+
+
+/*
+ * nsarena - Namespace node arena allocation
+ */
+void
+AcpiNsArenaBegin (
+    ACPI_NS_ARENA           *Arena,
+    ACPI_OWNER_ID           OwnerId);
+
+void
+AcpiNsArenaEnd (
+    ACPI_NS_ARENA           *Arena);
+
+ACPI_NAMESPACE_NODE *
+AcpiNsArenaAllocate (
+    ACPI_OWNER_ID           OwnerId);
+
+void
+AcpiNsArenaFree (
+    ACPI_NAMESPACE_NODE     *Node);
+
+void
+AcpiNsArenaTerminate (
+    void);
+
+
+/*
+ * nscache - Absolute pathname lookup cache
+ */
+ACPI_NAMESPACE_NODE *
+AcpiNsPathCacheLookup (
+    const char              *Pathname);
+
+void
+AcpiNsPathCacheInsert (
+    const char              *Pathname,
+    ACPI_NAMESPACE_NODE     *Node);
+
+void
+AcpiNsPathCacheDeleteNode (
+    ACPI_NAMESPACE_NODE     *Node);
+
+void
+AcpiNsPathCacheDeleteOwner (
+    ACPI_OWNER_ID           OwnerId);
+
+
 /*
  * nsconvert - Dynamic object conversion routines
  */
@@ -311,6 +440,21 @@ ACPI_STATUS
 AcpiNsEvaluate (
     ACPI_EVALUATE_INFO      *Info);
 
+ACPI_STATUS
+AcpiNsResumeEvaluate (
+    ACPI_EVALUATE_INFO      *Info);
+
+
+/*
+ * nsasync - Cooperative evaluation scheduler
+ */
+ACPI_STATUS
+AcpiNsEvaluateAsync (
+    ACPI_EVALUATE_INFO      *Info,
+    ACPI_ASYNC_DONE         Done,
+    ACPI_EVALUATE_CALLBACK  Callback,
+    void                    *Context);
+
 
 /*
  * nsarguments - Argument count/type checking for predefined/reserved names
@@ -368,6 +512,10 @@ UINT32
 AcpiNsOpensScope (
     ACPI_OBJECT_TYPE        Type);
 
+BOOLEAN
+AcpiNsIsMethodLocal (
+    ACPI_NAMESPACE_NODE     *Node);
+
 char *
 AcpiNsGetExternalPathname (
     ACPI_NAMESPACE_NODE     *Node);
@@ -388,6 +536,20 @@ AcpiNsGetNormalizedPathname (
     ACPI_NAMESPACE_NODE     *Node,
     BOOLEAN                 NoTrailing);
 
+char *
+AcpiNsGetCachedPathname (
+    ACPI_NAMESPACE_NODE     *Node,
+    BOOLEAN                 *Cached);
+
+void
+AcpiNsReleaseCachedPathname (
+    char                    *Pathname,
+    BOOLEAN                 Cached);
+
+void
+AcpiNsDeleteCachedPathname (
+    ACPI_NAMESPACE_NODE     *Node);
+
 char *
 AcpiNsBuildPrefixedPathname (
     ACPI_GENERIC_STATE      *PrefixScope,
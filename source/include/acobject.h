@@ -98,6 +98,7 @@
 #define AOPOBJ_REG_CONNECTED        0x10    /* _REG was run */
 #define AOPOBJ_SETUP_COMPLETE       0x20    /* Region setup is complete */
 #define AOPOBJ_INVALID              0x40    /* Host OS won't allow a Region address */
+#define AOPOBJ_ARENA                0x80    /* Integer allocated from a walk arena */
 
 
 /******************************************************************************
@@ -118,10 +119,22 @@ typedef struct acpi_object_integer
     ACPI_OBJECT_COMMON_HEADER
     UINT8                           Fill[3];            /* Prevent warning on some compilers */
     UINT64                          Value;
+    struct acpi_walk_arena          *Arena;             /* Owning arena if AOPOBJ_ARENA */
 
 } ACPI_OBJECT_INTEGER;
 
 
+/*
+ * Reference count for data (buffer bytes or a package element array) that
+ * is shared copy-on-write between several Buffer or Package objects.
+ */
+typedef struct acpi_object_share
+{
+    UINT32                          Count;              /* # of objects using the data */
+
+} ACPI_OBJECT_SHARE;
+
+
 /*
  * Note: The String and Buffer object must be identical through the
  * pointer and length elements. There is code that depends on this.
@@ -150,6 +163,7 @@ typedef struct acpi_object_buffer
     UINT32                          AmlLength;
     UINT8                           *AmlStart;
     ACPI_NAMESPACE_NODE             *Node;              /* Link back to parent node */
+    ACPI_OBJECT_SHARE               *Share;             /* Copy-on-write data, NULL if private */
 
 } ACPI_OBJECT_BUFFER;
 
@@ -162,6 +176,7 @@ typedef struct acpi_object_package
     UINT8                           *AmlStart;
     UINT32                          AmlLength;
     UINT32                          Count;              /* # of elements in package */
+    ACPI_OBJECT_SHARE               *Share;             /* Copy-on-write elements, NULL if private */
 
 } ACPI_OBJECT_PACKAGE;
 
@@ -228,6 +243,9 @@ typedef struct acpi_object_method
     UINT32                          AmlLength;
     ACPI_OWNER_ID                   OwnerId;
     UINT8                           ThreadCount;
+    struct acpi_method_cache        *NameCache;     /* Resolved names, see dsmcache.c */
+    struct acpi_method_memo         *Memo;          /* Results if side-effect-free, see dsmemo.c */
+    struct acpi_method_jit          *Jit;           /* Native code if hot, see dsjit.c */
 
 } ACPI_OBJECT_METHOD;
 
@@ -424,6 +442,7 @@ typedef struct acpi_object_addr_handler
 /* Flags for address handler (HandlerFlags) */
 
 #define ACPI_ADDR_HANDLER_DEFAULT_INSTALLED  0x01
+#define ACPI_ADDR_HANDLER_BLOCK_IO           0x02
 
 
 /******************************************************************************
@@ -83,6 +83,10 @@ ACPI_STATUS
 AcpiPsExecuteMethod (
     ACPI_EVALUATE_INFO      *Info);
 
+ACPI_STATUS
+AcpiPsResumeMethod (
+    ACPI_EVALUATE_INFO      *Info);
+
 ACPI_STATUS
 AcpiPsExecuteTable (
     ACPI_EVALUATE_INFO      *Info);
@@ -191,6 +195,10 @@ ACPI_STATUS
 AcpiPsParseAml (
     ACPI_WALK_STATE         *WalkState);
 
+ACPI_STATUS
+AcpiPsResumeAml (
+    ACPI_THREAD_STATE       *Thread);
+
 UINT32
 AcpiPsGetOpcodeSize (
     UINT32                  Opcode);
@@ -268,6 +268,22 @@ AcpiOsGetPhysicalAddress (
     ACPI_PHYSICAL_ADDRESS   *PhysicalAddress);
 #endif
 
+#ifdef ACPI_USE_NATIVE_JIT
+#ifndef ACPI_USE_ALTERNATE_PROTOTYPE_AcpiOsCreateExecutable
+void *
+AcpiOsCreateExecutable (
+    void                    *Code,
+    ACPI_SIZE               Length);
+#endif
+
+#ifndef ACPI_USE_ALTERNATE_PROTOTYPE_AcpiOsDeleteExecutable
+void
+AcpiOsDeleteExecutable (
+    void                    *Code,
+    ACPI_SIZE               Length);
+#endif
+#endif
+
 
 /*
  * Memory/Object Cache
@@ -256,6 +256,143 @@ ACPI_INIT_GLOBAL (BOOLEAN,          AcpiGbl_ReducedHardware, FALSE);
  */
 ACPI_INIT_GLOBAL (UINT32,           AcpiGbl_MaxLoopIterations, ACPI_MAX_LOOP_TIMEOUT);
 
+/*
+ * Number of children at which a namespace scope gets a hashed child index,
+ * making name lookups within wide scopes (such as \_SB on large servers)
+ * constant time. Set to zero to disable the index and always search
+ * linearly.
+ */
+ACPI_INIT_GLOBAL (UINT32,           AcpiGbl_NamespaceIndexThreshold, ACPI_NS_INDEX_THRESHOLD);
+
+/*
+ * Optionally disable the cache of absolute pathname lookups used by
+ * AcpiGetHandle, AcpiEvaluateObject, and other external interfaces.
+ * Default is TRUE, cache lookups.
+ */
+ACPI_INIT_GLOBAL (UINT8,            AcpiGbl_EnablePathCache, TRUE);
+
+/*
+ * Optionally allocate the namespace nodes created by each table load from
+ * contiguous per-table slabs instead of individually. This improves the
+ * locality of namespace walks and reduces allocator overhead on systems
+ * with very large namespaces. Default is FALSE, allocate individually.
+ */
+ACPI_INIT_GLOBAL (UINT8,            AcpiGbl_EnableNamespaceArena, FALSE);
+
+/*
+ * Optionally disable the index of device _HID/_CID values used by
+ * AcpiGetDevices. The index is built on first use and rebuilt after
+ * a table load or unload, or a Bus/Device Check notify, so that lookups
+ * by hardware ID do not evaluate _HID/_CID for every device each time.
+ * Default is TRUE, use the index.
+ */
+ACPI_INIT_GLOBAL (UINT8,            AcpiGbl_EnableDeviceIdIndex, TRUE);
+
+/*
+ * Optionally cache the normalized pathname of each namespace node that is
+ * evaluated or called as a method. The pathname is built once from the
+ * cached pathname of the parent and kept until the node is deleted, so that
+ * method execution does not rebuild and allocate it on every call. Callers
+ * that use a cached pathname must not outlive the node (table unload).
+ * Default is FALSE, build a new pathname each time.
+ */
+ACPI_INIT_GLOBAL (UINT8,            AcpiGbl_EnablePathnameCache, FALSE);
+
+/*
+ * Optionally disable the per-method cache of resolved names. Each control
+ * method remembers the node that each name in its AML resolved to, so that
+ * later executions skip decoding and looking up the name. The cache is
+ * invalidated when nodes are added to or deleted from the namespace (other
+ * than the temporary nodes of a running method), and freed with the method.
+ * Default is TRUE, cache names.
+ */
+ACPI_INIT_GLOBAL (UINT8,            AcpiGbl_EnableMethodCache, TRUE);
+
+/*
+ * Optionally disable memoization of side-effect-free control methods. At
+ * table load, methods that neither write named objects nor access
+ * operation regions, call other methods, or use Notify, Sleep, Stall or
+ * synchronization objects are marked pure. Their results are remembered
+ * per argument set, and a repeated evaluation returns a copy of the result
+ * until the namespace or the value of any named object changes. Default
+ * is TRUE, memoize pure methods.
+ */
+ACPI_INIT_GLOBAL (UINT8,            AcpiGbl_EnableMethodMemo, TRUE);
+
+/*
+ * Optionally compile hot control methods to native code. A method that has
+ * been evaluated ACPI_JIT_CALL_THRESHOLD times and only uses Integer
+ * arithmetic, logical operators, Locals, Args, If/Else, While and
+ * DerefOf (Index ()) of named Packages is translated to x86-64 code, which
+ * later evaluations call directly. Anything the code cannot handle (an
+ * uninitialized Local, a divide by zero, a Package element that is not an
+ * Integer) makes it give up and the method is executed by the interpreter
+ * from the start. Only available if ACPI_USE_NATIVE_JIT is defined.
+ * Default is FALSE, interpret all methods.
+ */
+ACPI_INIT_GLOBAL (UINT8,            AcpiGbl_EnableJit, FALSE);
+
+/*
+ * Optionally disable the per-invocation walk arena. While a method executes,
+ * the walk states of the methods it calls and the parse scope, control and
+ * result states are allocated from chunks owned by the invocation and
+ * recycled there, instead of going through the state cache and the heap
+ * one at a time. Default is TRUE, use the arena.
+ */
+ACPI_INIT_GLOBAL (UINT8,            AcpiGbl_EnableWalkArena, TRUE);
+
+/*
+ * Optionally disable heap-free intermediate integers. While a method
+ * executes, constants, loop counters and arithmetic/logical results are
+ * created in the walk arena of the method invocation and only copied to the
+ * heap when they are stored to a named object or returned from the top-level
+ * method. Has no effect when the walk arena is disabled. Default is TRUE,
+ * create intermediate integers in the arena.
+ */
+ACPI_INIT_GLOBAL (UINT8,            AcpiGbl_EnableImmediateIntegers, TRUE);
+
+/*
+ * Optionally disable copy-on-write Buffers and Packages. Storing or copying
+ * a Buffer or Package shares the buffer data or element array with the
+ * source object, and the data is only duplicated when one of the objects is
+ * written through Index, a BufferField or an in-place Store. When disabled,
+ * every store or copy duplicates the data immediately. Default is TRUE,
+ * share data copy-on-write.
+ */
+ACPI_INIT_GLOBAL (UINT8,            AcpiGbl_EnableCopyOnWrite, TRUE);
+
+/*
+ * Optionally allow control methods to execute in parallel. A method still
+ * holds the interpreter while it resolves names, calls other methods or
+ * touches any namespace object, but releases it for the operators that only
+ * read and write its own locals, arguments, constants and intermediate
+ * results (and for parsing the AML that follows them). Other methods can
+ * run during that time; AML Mutexes and Serialized methods still provide
+ * mutual exclusion. Default is FALSE, one method executes at a time.
+ */
+ACPI_INIT_GLOBAL (UINT8,            AcpiGbl_ParallelExecution, FALSE);
+
+/*
+ * GPE storm detection. A GPE that is dispatched more than
+ * AcpiGbl_GpeStormThreshold times within AcpiGbl_GpeStormWindow milliseconds
+ * is masked and its status is polled every AcpiGbl_GpePollInterval
+ * milliseconds instead. Once the GPE is found active in no more than half
+ * of the polls of a window, it is unmasked again. GPEs with a raw handler
+ * are not monitored. Masking a GPE changes the timing of its events, so
+ * the host must opt in; ACPI_GPE_STORM_SUGGESTED is a reasonable threshold.
+ * Default is zero, storm detection disabled.
+ */
+ACPI_INIT_GLOBAL (UINT32,           AcpiGbl_GpeStormThreshold, ACPI_GPE_STORM_THRESHOLD);
+ACPI_INIT_GLOBAL (UINT32,           AcpiGbl_GpeStormWindow, ACPI_GPE_STORM_WINDOW);
+ACPI_INIT_GLOBAL (UINT32,           AcpiGbl_GpePollInterval, ACPI_GPE_POLL_INTERVAL);
+
+/*
+ * Maximum number of memory mappings cached by each SystemMemory operation
+ * region. The least recently used mapping is unmapped to make room for a
+ * new one. Read when a region is first accessed.
+ */
+ACPI_INIT_GLOBAL (UINT32,           AcpiGbl_MemMappingCacheSize, ACPI_MEM_MAPPING_CACHE_SIZE);
+
 /*
  * Optionally ignore AE_NOT_FOUND errors from named reference package elements
  * during DSDT/SSDT table loading. This reduces error "noise" in platforms
@@ -578,6 +715,17 @@ ACPI_STATUS ACPI_INIT_FUNCTION
 AcpiLoadTables (
     void))
 
+ACPI_EXTERNAL_RETURN_STATUS (
+ACPI_STATUS ACPI_INIT_FUNCTION
+AcpiLoadTablesFromSnapshot (
+    void                    *Snapshot,
+    UINT32                  Length))
+
+ACPI_EXTERNAL_RETURN_STATUS (
+ACPI_STATUS
+AcpiGetNamespaceSnapshot (
+    ACPI_BUFFER             *RetBuffer))
+
 
 /*
  * ACPI table manipulation interfaces
@@ -643,6 +791,18 @@ AcpiWalkNamespace (
     void                    *Context,
     void                    **ReturnValue))
 
+ACPI_EXTERNAL_RETURN_STATUS (
+ACPI_STATUS
+AcpiWalkNamespaceParallel (
+    ACPI_OBJECT_TYPE        Type,
+    ACPI_HANDLE             StartObject,
+    UINT32                  MaxDepth,
+    UINT32                  NumWorkers,
+    ACPI_WALK_CALLBACK      DescendingCallback,
+    void                    **WorkerContexts,
+    ACPI_WALK_MERGE_HANDLER MergeHandler,
+    void                    *MergeContext))
+
 ACPI_EXTERNAL_RETURN_STATUS (
 ACPI_STATUS
 AcpiGetDevices (
@@ -714,6 +874,22 @@ AcpiEvaluateObjectTyped (
     ACPI_BUFFER             *ReturnBuffer,
     ACPI_OBJECT_TYPE        ReturnType))
 
+ACPI_EXTERNAL_RETURN_STATUS (
+ACPI_STATUS
+AcpiEvaluateObjects (
+    ACPI_EVALUATE_ITEM      *Items,
+    UINT32                  Count,
+    ACPI_BUFFER             *ReturnBuffer))
+
+ACPI_EXTERNAL_RETURN_STATUS (
+ACPI_STATUS
+AcpiEvaluateObjectAsync (
+    ACPI_HANDLE             Object,
+    ACPI_STRING             Pathname,
+    ACPI_OBJECT_LIST        *ParameterObjects,
+    ACPI_EVALUATE_CALLBACK  Callback,
+    void                    *Context))
+
 ACPI_EXTERNAL_RETURN_STATUS (
 ACPI_STATUS
 AcpiGetObjectInfo (
@@ -843,6 +1019,16 @@ AcpiInstallAddressSpaceHandlerNo_Reg(
     ACPI_ADR_SPACE_SETUP    Setup,
     void                    *Context))
 
+ACPI_EXTERNAL_RETURN_STATUS (
+ACPI_STATUS
+AcpiInstallAddressSpaceHandlerEx (
+    ACPI_HANDLE             Device,
+    ACPI_ADR_SPACE_TYPE     SpaceId,
+    ACPI_ADR_SPACE_HANDLER  Handler,
+    ACPI_ADR_SPACE_SETUP    Setup,
+    void                    *Context,
+    UINT32                  Flags))
+
 ACPI_EXTERNAL_RETURN_STATUS (
 ACPI_STATUS
 AcpiExecuteRegMethods (
@@ -1030,6 +1216,19 @@ AcpiGetGpeDevice (
     UINT32                  GpeIndex,
     ACPI_HANDLE             *GpeDevice))
 
+ACPI_HW_DEPENDENT_RETURN_STATUS (
+ACPI_STATUS
+AcpiGetGpeBlockStatistics (
+    UINT32                  GpeIndex,
+    ACPI_GPE_BLOCK_STATISTICS *Statistics))
+
+ACPI_HW_DEPENDENT_RETURN_STATUS (
+ACPI_STATUS
+AcpiGetGpeStormInfo (
+    ACPI_HANDLE             GpeDevice,
+    UINT32                  GpeNumber,
+    ACPI_GPE_STORM_INFO     *StormInfo))
+
 ACPI_HW_DEPENDENT_RETURN_STATUS (
 ACPI_STATUS
 AcpiInstallGpeBlock (
@@ -86,19 +86,20 @@ typedef struct acpi_walk_state
     UINT8                           ScopeDepth;
     UINT8                           PassNumber;         /* Parse pass during table load */
     BOOLEAN                         NamespaceOverride;  /* Override existing objects */
-    UINT8                           ResultSize;         /* Total elements for the result stack */
     UINT8                           ResultCount;        /* Current number of occupied elements of result stack */
     UINT8                           *Aml;
     UINT32                          ArgTypes;
     UINT32                          MethodBreakpoint;   /* For single stepping */
     UINT32                          UserBreakpoint;     /* User AML breakpoint */
     UINT32                          ParseFlags;
+    UINT32                          ResultBase;         /* Index of this walk's first result in ResultStack */
 
     ACPI_PARSE_STATE                ParserState;        /* Current state of parser */
     UINT32                          PrevArgTypes;
     UINT32                          ArgCount;           /* push for fixed or var args */
     UINT16                          MethodNestingDepth;
     UINT8                           MethodIsNested;
+    BOOLEAN                         MethodPathnameCached; /* MethodPathname is owned by the node */
 
     struct acpi_namespace_node      Arguments[ACPI_METHOD_NUM_ARGS];        /* Control method arguments */
     struct acpi_namespace_node      LocalVariables[ACPI_METHOD_NUM_LOCALS]; /* Control method locals */
@@ -119,12 +120,14 @@ typedef struct acpi_walk_state
     const ACPI_OPCODE_INFO          *OpInfo;            /* Info on current opcode */
     ACPI_PARSE_OBJECT               *Origin;            /* Start of walk [Obsolete] */
     union acpi_operand_object       *ResultObj;
-    ACPI_GENERIC_STATE              *Results;           /* Stack of accumulated results */
+    ACPI_VALUE_STACK                *ResultStack;       /* Stack of accumulated results */
+    ACPI_VALUE_STACK                PrivateResults;     /* Result stack of a walk without a thread */
     union acpi_operand_object       *ReturnDesc;        /* Return object, if any */
     ACPI_GENERIC_STATE              *ScopeInfo;         /* Stack of nested scopes */
     ACPI_PARSE_OBJECT               *PrevOp;            /* Last op that was processed */
     ACPI_PARSE_OBJECT               *NextOp;            /* next op to be processed */
     ACPI_THREAD_STATE               *Thread;
+    ACPI_WALK_ARENA                 *WalkArena;         /* Arena holding this walk state, if any */
     ACPI_PARSE_DOWNWARDS            DescendingCallback;
     ACPI_PARSE_UPWARDS              AscendingCallback;
 
@@ -160,10 +163,62 @@ typedef struct acpi_get_devices_info
     ACPI_WALK_CALLBACK              UserFunction;
     void                            *Context;
     char                            *Hid;
+    ACPI_NS_DEVICE_ID               *Handled;       /* Devices handled via the index */
+    UINT32                          HandledCount;
 
 } ACPI_GET_DEVICES_INFO;
 
 
+/* Info used by AcpiNsWalkNamespaceParallel */
+
+typedef struct acpi_ns_walk_task
+{
+    ACPI_NAMESPACE_NODE             *Node;
+    void                            *Result;        /* Per-task ReturnValue, merged in task order */
+    ACPI_STATUS                     Status;
+    UINT32                          Level;
+    BOOLEAN                         Subtree;        /* Walk below Node (worker task) */
+    BOOLEAN                         Started;
+
+} ACPI_NS_WALK_TASK;
+
+typedef struct acpi_ns_walk_worker
+{
+    struct acpi_ns_parallel_walk    *Walk;
+    void                            *Context;       /* Caller's per-worker context */
+    UINT32                          Head;           /* Owner takes queued tasks from Head */
+    UINT32                          Tail;           /* Thieves take queued tasks from Tail */
+    UINT32                          Steals;
+
+} ACPI_NS_WALK_WORKER;
+
+typedef struct acpi_ns_walk_frame
+{
+    ACPI_NS_WALK_WORKER             *Worker;
+    ACPI_NS_WALK_TASK               *Task;
+
+} ACPI_NS_WALK_FRAME;
+
+typedef struct acpi_ns_parallel_walk
+{
+    ACPI_NS_WALK_TASK               *Tasks;         /* All tasks, in namespace (pre-)order */
+    UINT32                          *Queue;         /* Subtree task indexes, split among workers */
+    ACPI_NS_WALK_WORKER             *Workers;
+    ACPI_WALK_CALLBACK              UserFunction;
+    ACPI_SPINLOCK                   Lock;           /* Protects worker Head/Tail */
+    ACPI_SEMAPHORE                  Done;           /* Signaled as each helper worker exits */
+    ACPI_OBJECT_TYPE                Type;
+    UINT32                          MaxDepth;
+    UINT32                          SplitDepth;     /* Nodes at this level become worker tasks */
+    UINT32                          NumTasks;
+    UINT32                          MaxTasks;
+    UINT32                          NumQueued;
+    UINT32                          NumWorkers;
+    BOOLEAN                         Abort;
+
+} ACPI_NS_PARALLEL_WALK;
+
+
 typedef union acpi_aml_operands
 {
     ACPI_OPERAND_OBJECT             *Operands[7];
@@ -215,7 +270,10 @@ typedef struct acpi_evaluate_info
     const ACPI_PREDEFINED_INFO      *Predefined;        /* Used if Node is a predefined name */
     ACPI_OPERAND_OBJECT             *ReturnObject;      /* Object returned from the evaluation */
     union acpi_operand_object       *ParentPackage;     /* Used if return object is a Package */
+    struct acpi_coroutine           *Coroutine;         /* Set for AcpiEvaluateObjectAsync */
 
+    UINT32                          MemoNsGeneration;   /* Namespace generation before execution */
+    UINT32                          MemoDataGeneration; /* Data generation before execution */
     UINT32                          ReturnFlags;        /* Used for return value analysis */
     UINT32                          ReturnBtype;        /* Bitmapped type of the returned object */
     UINT16                          ParamCount;         /* Count of the input argument list */
@@ -229,6 +287,8 @@ typedef struct acpi_evaluate_info
 /* Values for Flags above */
 
 #define ACPI_IGNORE_RETURN_VALUE    1
+#define ACPI_FULL_PATHNAME_CACHED   2
+#define ACPI_INTERPRETER_LOCKED     4   /* Caller has entered the interpreter */
 
 /* Defines for ReturnFlags field above */
 
@@ -236,6 +296,30 @@ typedef struct acpi_evaluate_info
 #define ACPI_OBJECT_WRAPPED         2
 
 
+/*
+ * A method evaluation run by the AcpiEvaluateObjectAsync scheduler. The
+ * evaluation suspends its walk at Sleep and is resumed on a worker thread
+ * once WakeTime has passed (nsasync.c).
+ */
+typedef void (*ACPI_ASYNC_DONE) (
+    struct acpi_coroutine           *Coroutine,
+    ACPI_STATUS                     Status);
+
+typedef struct acpi_coroutine
+{
+    struct acpi_coroutine           *Next;              /* Ready or sleeping list */
+    ACPI_EVALUATE_INFO              *Info;              /* The evaluation being run */
+    ACPI_THREAD_STATE               *Thread;            /* Walk states of a suspended method */
+    ACPI_PARSE_OBJECT               *Op;                /* Parse root of a suspended method */
+    UINT64                          WakeTime;           /* AcpiOsGetTimer value to resume at */
+    ACPI_ASYNC_DONE                 Done;               /* Internal completion routine */
+    ACPI_EVALUATE_CALLBACK          Callback;           /* Caller's completion callback */
+    void                            *Context;           /* Context for Callback */
+    BOOLEAN                         Started;            /* Evaluation has been entered */
+
+} ACPI_COROUTINE;
+
+
 /* Info used by AcpiNsInitializeDevices */
 
 typedef struct acpi_device_walk_info
@@ -270,6 +270,7 @@ AcpiTbPutTable (
  */
 ACPI_STATUS
 AcpiTbLoadNamespace (
-    void);
+    void                    *Snapshot,
+    UINT32                  SnapshotLength);
 
 #endif /* __ACTABLES_H__ */
@@ -752,6 +752,15 @@ typedef UINT32                          ACPI_OBJECT_TYPE;
 #define ACPI_WRITE                      1
 #define ACPI_IO_MASK                    1
 
+/*
+ * Block transfers: Value points to a buffer of ACPI_BLOCK_IO_COUNT (Function)
+ * consecutive datums of BitWidth bits each, starting at Address. Only sent
+ * to handlers installed with ACPI_ADR_HANDLER_BLOCK_IO.
+ */
+#define ACPI_BLOCK_IO                   0x100
+#define ACPI_BLOCK_IO_COUNT(f)          ((UINT32) (f) >> 16)
+#define ACPI_BLOCK_IO_MAX_COUNT         0xFFFF
+
 /*
  * Event Types: Fixed & General Purpose
  */
@@ -1056,6 +1065,23 @@ typedef struct acpi_buffer
 } ACPI_BUFFER;
 
 
+/*
+ * One object to be evaluated by AcpiEvaluateObjects. Handle, Pathname and
+ * Parameters are as for AcpiEvaluateObject. Status and ReturnObject are
+ * set for each item; ReturnObject points into the common return buffer
+ * and is NULL if the item returned nothing or failed.
+ */
+typedef struct acpi_evaluate_item
+{
+    ACPI_HANDLE                     Handle;
+    ACPI_STRING                     Pathname;
+    ACPI_OBJECT_LIST                *Parameters;
+    ACPI_STATUS                     Status;
+    ACPI_OBJECT                     *ReturnObject;
+
+} ACPI_EVALUATE_ITEM;
+
+
 /*
  * NameType for AcpiGetName
  */
@@ -1109,12 +1135,62 @@ typedef struct acpi_statistics
 {
     UINT32                          SciCount;
     UINT32                          GpeCount;
+    UINT32                          GpeStormCount;              /* GPEs switched to polling */
+    UINT32                          GpePolledCount;             /* GPE events found by polling */
+    UINT32                          GpeCoalescedCount;          /* GPE events during a method execution */
+    UINT32                          GpeRerunCount;              /* GPE method reruns for such events */
     UINT32                          FixedEventCount[ACPI_NUM_FIXED_EVENTS];
     UINT32                          MethodCount;
+    UINT32                          PathCacheHits;
+    UINT32                          PathCacheMisses;
+    UINT32                          MethodCacheHits;
+    UINT32                          MethodCacheMisses;
+    UINT32                          MethodMemoHits;
+    UINT32                          MethodMemoMisses;
+    UINT32                          JitMethodCount;             /* Methods compiled to native code */
+    UINT32                          JitExecutions;
+    UINT32                          JitBailouts;                /* Native code handed over to the interpreter */
+    UINT32                          MemMappingHits;             /* SystemMemory accesses within a cached mapping */
+    UINT32                          MemMappingMisses;
+    UINT32                          MemMappingMerges;           /* Adjacent mappings merged into a new one */
+    UINT32                          MemMappingEvictions;
+    UINT32                          FieldBlockTransfers;        /* Field reads/writes done with ACPI_BLOCK_IO */
+    UINT32                          NamespaceLockCount;         /* Exclusive acquisitions */
+    UINT32                          NamespaceLockWaits;
+    UINT32                          NamespaceSharedLockCount;   /* Shared acquisitions */
+    UINT32                          NamespaceSharedLockWaits;
 
 } ACPI_STATISTICS;
 
 
+/*
+ * GPE block counters returned by AcpiGetGpeBlockStatistics()
+ */
+typedef struct acpi_gpe_block_statistics
+{
+    ACPI_HANDLE                     GpeDevice;                  /* NULL for the FADT-defined GPE blocks */
+    UINT32                          BlockBaseIndex;             /* System GPE index of the first GPE */
+    UINT32                          BlockBaseNumber;            /* GPE number of the first GPE */
+    UINT32                          GpeCount;
+    UINT32                          DetectCount;                /* SCIs that examined the block */
+    UINT32                          RegisterReads;              /* Status and enable register reads */
+    UINT32                          DispatchCount;              /* Active GPEs dispatched */
+
+} ACPI_GPE_BLOCK_STATISTICS;
+
+
+/*
+ * GPE storm detection state returned by AcpiGetGpeStormInfo()
+ */
+typedef struct acpi_gpe_storm_info
+{
+    UINT32                          StormCount;                 /* Times the GPE was switched to polling */
+    UINT32                          PolledEvents;               /* Events dispatched by the poller */
+    BOOLEAN                         Polling;                    /* Masked and polled right now */
+
+} ACPI_GPE_STORM_INFO;
+
+
 /*
  * Types specific to the OS service interfaces
  */
@@ -1210,6 +1286,10 @@ ACPI_STATUS (*ACPI_ADR_SPACE_HANDLER) (
 
 #define ACPI_DEFAULT_HANDLER            NULL
 
+/* Flags for AcpiInstallAddressSpaceHandlerEx */
+
+#define ACPI_ADR_HANDLER_BLOCK_IO       0x01    /* Handler accepts ACPI_BLOCK_IO requests */
+
 /* Special Context data for GenericSerialBus/GeneralPurposeIo (ACPI 5.0) */
 
 typedef struct acpi_connection_info
@@ -1252,6 +1332,24 @@ ACPI_STATUS (*ACPI_WALK_CALLBACK) (
     void                            *Context,
     void                            **ReturnValue);
 
+typedef
+void (*ACPI_WALK_MERGE_HANDLER) (
+    ACPI_HANDLE                     Object,
+    UINT32                          NestingLevel,
+    void                            *Result,
+    void                            *Context);
+
+/*
+ * Completion callback for AcpiEvaluateObjectAsync. ReturnBuffer holds the
+ * external return object (Length is zero if there is none); the callee
+ * owns it and frees it with AcpiOsFree.
+ */
+typedef
+void (*ACPI_EVALUATE_CALLBACK) (
+    ACPI_STATUS                     Status,
+    ACPI_BUFFER                     *ReturnBuffer,
+    void                            *Context);
+
 typedef
 UINT32 (*ACPI_INTERFACE_HANDLER) (
     ACPI_STRING                     InterfaceName,
@@ -1360,7 +1458,7 @@ typedef struct acpi_mem_mapping
     ACPI_PHYSICAL_ADDRESS           PhysicalAddress;
     UINT8                           *LogicalAddress;
     ACPI_SIZE                       Length;
-    struct acpi_mem_mapping         *NextMm;
+    UINT64                          LastUse;            /* For LRU eviction */
 
 } ACPI_MEM_MAPPING;
 
@@ -1369,7 +1467,10 @@ typedef struct acpi_mem_space_context
     UINT32                          Length;
     ACPI_PHYSICAL_ADDRESS           Address;
     ACPI_MEM_MAPPING                *CurMm;
-    ACPI_MEM_MAPPING                *FirstMm;
+    ACPI_MEM_MAPPING                **Mappings;         /* Sorted by PhysicalAddress */
+    UINT32                          MappingCount;
+    UINT32                          MaxMappings;
+    UINT64                          UseCount;           /* LRU clock */
 
 } ACPI_MEM_SPACE_CONTEXT;
 
@@ -428,6 +428,14 @@ AcpiUtCopyIobjectToIobject (
     ACPI_OPERAND_OBJECT     **DestDesc,
     ACPI_WALK_STATE         *WalkState);
 
+ACPI_STATUS
+AcpiUtUnshareObject (
+    ACPI_OPERAND_OBJECT     *ObjDesc);
+
+BOOLEAN
+AcpiUtReleaseSharedData (
+    ACPI_OPERAND_OBJECT     *Object);
+
 
 /*
  * utcreate - Object creation
@@ -826,6 +834,49 @@ AcpiUtDeleteGenericState (
     ACPI_GENERIC_STATE      *State);
 
 
+/*
+ * utarena - Per-invocation walk arena
+ */
+ACPI_GENERIC_STATE *
+AcpiUtArenaCreateState (
+    ACPI_WALK_ARENA         *Arena);
+
+void
+AcpiUtArenaDeleteState (
+    ACPI_WALK_ARENA         *Arena,
+    ACPI_GENERIC_STATE      *State);
+
+ACPI_WALK_STATE *
+AcpiUtArenaCreateWalkState (
+    ACPI_WALK_ARENA         *Arena);
+
+void
+AcpiUtArenaDeleteWalkState (
+    ACPI_WALK_STATE         *WalkState);
+
+ACPI_OPERAND_OBJECT *
+AcpiUtArenaCreateInteger (
+    ACPI_WALK_ARENA         *Arena,
+    UINT64                  InitialValue);
+
+void
+AcpiUtArenaDeleteObject (
+    ACPI_OPERAND_OBJECT     *Object);
+
+ACPI_STATUS
+AcpiUtArenaPromoteObject (
+    ACPI_OPERAND_OBJECT     **ObjDescPtr);
+
+void *
+AcpiUtArenaAllocateArray (
+    ACPI_WALK_ARENA         *Arena,
+    ACPI_SIZE               Size);
+
+void
+AcpiUtArenaRelease (
+    ACPI_WALK_ARENA         *Arena);
+
+
 /*
  * utmath
  */
@@ -1024,6 +1075,14 @@ ACPI_STATUS
 AcpiUtReleaseMutex (
     ACPI_MUTEX_HANDLE       MutexId);
 
+ACPI_STATUS
+AcpiUtAcquireSharedMutex (
+    ACPI_MUTEX_HANDLE       MutexId);
+
+ACPI_STATUS
+AcpiUtReleaseSharedMutex (
+    ACPI_MUTEX_HANDLE       MutexId);
+
 
 /*
  * utalloc - memory allocation and object caching
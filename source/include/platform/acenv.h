@@ -123,6 +123,15 @@
 #define ACPI_USE_NATIVE_RSDP_POINTER
 #endif
 
+/* AcpiExec configuration. Native JIT on x86-64 System V hosts */
+
+#if (defined ACPI_EXEC_APP)     && \
+    (defined __x86_64__)        && \
+    (defined __GNUC__)          && \
+    !(defined _WIN32)
+#define ACPI_USE_NATIVE_JIT
+#endif
+
 /* AcpiDump configuration. Native mapping used if provided by the host */
 
 #ifdef ACPI_DUMP_APP
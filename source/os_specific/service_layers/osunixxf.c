@@ -60,6 +60,10 @@
 #include <pthread.h>
 #include <errno.h>
 
+#ifdef ACPI_USE_NATIVE_JIT
+#include <sys/mman.h>
+#endif
+
 #define _COMPONENT          ACPI_OS_SERVICES
         ACPI_MODULE_NAME    ("osunixxf")
 
@@ -71,6 +75,18 @@ AeTableOverride (
     ACPI_TABLE_HEADER       *ExistingTable,
     ACPI_TABLE_HEADER       **NewTable);
 
+BOOLEAN
+AeSimulatePortRead (
+    ACPI_IO_ADDRESS         Address,
+    UINT32                  *Value,
+    UINT32                  Width);
+
+BOOLEAN
+AeSimulatePortWrite (
+    ACPI_IO_ADDRESS         Address,
+    UINT32                  Value,
+    UINT32                  Width);
+
 typedef void* (*PTHREAD_CALLBACK) (void *);
 
 /* Buffer used by AcpiOsVprintf */
@@ -706,6 +722,72 @@ AcpiOsFree (
 }
 
 
+#ifdef ACPI_USE_NATIVE_JIT
+/******************************************************************************
+ *
+ * FUNCTION:    AcpiOsCreateExecutable
+ *
+ * PARAMETERS:  Code                - Machine code to install
+ *              Length              - Length of the code, in bytes
+ *
+ * RETURN:      Pointer to an executable copy of the code. Null on error.
+ *
+ * DESCRIPTION: Copy generated code to new pages, then make the pages
+ *              read-only and executable. The pages are never writable
+ *              and executable at the same time.
+ *
+ *****************************************************************************/
+
+void *
+AcpiOsCreateExecutable (
+    void                    *Code,
+    ACPI_SIZE               Length)
+{
+    void                    *Mem;
+
+
+    Mem = mmap (NULL, (size_t) Length, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (Mem == MAP_FAILED)
+    {
+        return (NULL);
+    }
+
+    memcpy (Mem, Code, (size_t) Length);
+    if (mprotect (Mem, (size_t) Length, PROT_READ | PROT_EXEC))
+    {
+        munmap (Mem, (size_t) Length);
+        return (NULL);
+    }
+
+    return (Mem);
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AcpiOsDeleteExecutable
+ *
+ * PARAMETERS:  Code                - Pointer from AcpiOsCreateExecutable
+ *              Length              - Length passed to AcpiOsCreateExecutable
+ *
+ * RETURN:      None.
+ *
+ * DESCRIPTION: Free the pages of generated code.
+ *
+ *****************************************************************************/
+
+void
+AcpiOsDeleteExecutable (
+    void                    *Code,
+    ACPI_SIZE               Length)
+{
+
+    munmap (Code, (size_t) Length);
+}
+#endif
+
+
 #ifdef ACPI_SINGLE_THREADED
 /******************************************************************************
  *
@@ -1279,6 +1361,13 @@ AcpiOsReadPort (
     UINT32                  Width)
 {
 
+#ifdef ACPI_EXEC_APP
+    if (AeSimulatePortRead (Address, Value, Width))
+    {
+        return (AE_OK);
+    }
+#endif
+
     switch (Width)
     {
     case 8:
@@ -1326,6 +1415,10 @@ AcpiOsWritePort (
     UINT32                  Width)
 {
 
+#ifdef ACPI_EXEC_APP
+    (void) AeSimulatePortWrite (Address, Value, Width);
+#endif
+
     return (AE_OK);
 }
 
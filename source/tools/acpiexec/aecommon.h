@@ -104,12 +104,19 @@ extern UINT8                AcpiGbl_UseHwReducedFadt;
 extern BOOLEAN              AcpiGbl_DisplayRegionAccess;
 extern BOOLEAN              AcpiGbl_DoInterfaceTests;
 extern BOOLEAN              AcpiGbl_LoadTestTables;
+extern BOOLEAN              AcpiGbl_AeSnapshotRoundTrip;
 extern FILE                 *AcpiGbl_NamespaceInitFile;
 extern ACPI_CONNECTION_INFO AeMyContext;
 
 extern UINT8                Ssdt2Code[];
 extern UINT8                Ssdt3Code[];
 extern UINT8                Ssdt4Code[];
+extern UINT8                JitSsdtCode[];
+extern UINT8                BlockIoSsdtCode[];
+extern UINT8                MemoSsdtCode[];
+extern UINT8                MemoSsdt2Code[];
+extern UINT8                ParallelSsdtCode[];
+extern UINT8                DeviceIdSsdtCode[];
 
 
 #define TEST_OUTPUT_LEVEL(lvl)          if ((lvl) & OutputLevel)
@@ -234,6 +241,27 @@ AeGlobalEventHandler (
     UINT32                  EventNumber,
     void                    *Context);
 
+ACPI_STATUS
+AeStartGpeStorm (
+    UINT32                  GpeNumber,
+    UINT32                  Milliseconds);
+
+void
+AeStopGpeStorm (
+    void);
+
+BOOLEAN
+AeSimulatePortRead (
+    ACPI_IO_ADDRESS         Address,
+    UINT32                  *Value,
+    UINT32                  Width);
+
+BOOLEAN
+AeSimulatePortWrite (
+    ACPI_IO_ADDRESS         Address,
+    UINT32                  Value,
+    UINT32                  Width);
+
 /* aeinitfile */
 
 int
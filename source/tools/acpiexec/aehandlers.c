@@ -42,6 +42,7 @@
  */
 
 #include "aecommon.h"
+#include "acevents.h"
 
 #define _COMPONENT          ACPI_TOOLS
         ACPI_MODULE_NAME    ("aehandlers")
@@ -360,6 +361,220 @@ AeGpeHandler (
 }
 
 
+/******************************************************************************
+ *
+ * GPE storm simulation
+ *
+ * While a storm is injected, the status registers of the GPE block that
+ * contains the stormed GPE read as zero, except for the bit of the stormed
+ * GPE, which reads as set until the storm ends. The enable register of that
+ * GPE is simulated as well, so that masking the GPE silences it. All other
+ * ports keep the default behavior of AcpiOsReadPort/AcpiOsWritePort.
+ *
+ *****************************************************************************/
+
+#if (!ACPI_REDUCED_HARDWARE)
+typedef struct ae_gpe_storm
+{
+    ACPI_IO_ADDRESS         StatusBase;         /* First status register of the block */
+    UINT32                  RegisterCount;
+    ACPI_IO_ADDRESS         StatusAddress;      /* Status register of the stormed GPE */
+    ACPI_IO_ADDRESS         EnableAddress;      /* Enable register of the stormed GPE */
+    UINT8                   Mask;               /* Bit of the stormed GPE */
+    UINT8                   Enable;             /* Simulated enable register */
+    UINT64                  EndTime;            /* AcpiOsGetTimer units */
+    BOOLEAN                 Active;
+
+} AE_GPE_STORM;
+
+static AE_GPE_STORM         AeGpeStorm;
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeStartGpeStorm
+ *
+ * PARAMETERS:  GpeNumber           - FADT-defined GPE to storm
+ *              Milliseconds        - Duration of the storm
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Make the status of a GPE read as set for a while, as if its
+ *              source kept firing. The GPE must be enabled.
+ *
+ *****************************************************************************/
+
+ACPI_STATUS
+AeStartGpeStorm (
+    UINT32                  GpeNumber,
+    UINT32                  Milliseconds)
+{
+    ACPI_GPE_EVENT_INFO     *GpeEventInfo;
+    ACPI_GPE_REGISTER_INFO  *GpeRegisterInfo;
+    ACPI_GPE_BLOCK_INFO     *GpeBlock;
+    ACPI_CPU_FLAGS          Flags;
+    ACPI_STATUS             Status = AE_OK;
+    UINT32                  i;
+
+
+    Flags = AcpiOsAcquireLock (AcpiGbl_GpeLock);
+
+    GpeEventInfo = AcpiEvGetGpeEventInfo (NULL, GpeNumber);
+    if (!GpeEventInfo || !GpeEventInfo->RegisterInfo ||
+        (GpeEventInfo->RegisterInfo->StatusAddress.SpaceId !=
+            ACPI_ADR_SPACE_SYSTEM_IO))
+    {
+        Status = AE_BAD_PARAMETER;
+        goto UnlockAndExit;
+    }
+
+    GpeRegisterInfo = GpeEventInfo->RegisterInfo;
+    for (i = 0; i < ACPI_MAX_GPE_BLOCKS; i++)
+    {
+        GpeBlock = AcpiGbl_GpeFadtBlocks[i];
+        if (GpeBlock &&
+            (GpeRegisterInfo >= GpeBlock->RegisterInfo) &&
+            (GpeRegisterInfo <
+                &GpeBlock->RegisterInfo[GpeBlock->RegisterCount]))
+        {
+            AeGpeStorm.StatusBase = (ACPI_IO_ADDRESS)
+                GpeBlock->RegisterInfo->StatusAddress.Address;
+            AeGpeStorm.RegisterCount = GpeBlock->RegisterCount;
+        }
+    }
+
+    AeGpeStorm.StatusAddress = (ACPI_IO_ADDRESS)
+        GpeRegisterInfo->StatusAddress.Address;
+    AeGpeStorm.EnableAddress = (ACPI_IO_ADDRESS)
+        GpeRegisterInfo->EnableAddress.Address;
+    AeGpeStorm.Mask = (UINT8) AcpiHwGetGpeRegisterBit (GpeEventInfo);
+    AeGpeStorm.Enable = GpeRegisterInfo->EnableMask;
+    AeGpeStorm.EndTime = AcpiOsGetTimer () +
+        ((UINT64) Milliseconds * ACPI_100NSEC_PER_MSEC);
+    AeGpeStorm.Active = TRUE;
+
+UnlockAndExit:
+    AcpiOsReleaseLock (AcpiGbl_GpeLock, Flags);
+    return (Status);
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeStopGpeStorm
+ *
+ * DESCRIPTION: Remove the GPE storm simulation from the I/O ports
+ *
+ *****************************************************************************/
+
+void
+AeStopGpeStorm (
+    void)
+{
+    ACPI_CPU_FLAGS          Flags;
+
+
+    Flags = AcpiOsAcquireLock (AcpiGbl_GpeLock);
+    AeGpeStorm.Active = FALSE;
+    AcpiOsReleaseLock (AcpiGbl_GpeLock, Flags);
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeSimulatePortRead, AeSimulatePortWrite
+ *
+ * PARAMETERS:  Address             - I/O port
+ *              Value               - Value read or written
+ *              Width               - Number of bits
+ *
+ * RETURN:      TRUE if the port is simulated and the access was handled
+ *
+ * DESCRIPTION: Upcalls from AcpiOsReadPort/AcpiOsWritePort. GPE registers are
+ *              always accessed with the GpeLock held.
+ *
+ *****************************************************************************/
+
+BOOLEAN
+AeSimulatePortRead (
+    ACPI_IO_ADDRESS         Address,
+    UINT32                  *Value,
+    UINT32                  Width)
+{
+
+    if (!AeGpeStorm.Active || (Width != 8))
+    {
+        return (FALSE);
+    }
+
+    if (Address == AeGpeStorm.EnableAddress)
+    {
+        *Value = AeGpeStorm.Enable;
+        return (TRUE);
+    }
+
+    if ((Address < AeGpeStorm.StatusBase) ||
+        (Address >= AeGpeStorm.StatusBase + AeGpeStorm.RegisterCount))
+    {
+        return (FALSE);
+    }
+
+    *Value = 0;
+    if ((Address == AeGpeStorm.StatusAddress) &&
+        (AcpiOsGetTimer () < AeGpeStorm.EndTime))
+    {
+        *Value = AeGpeStorm.Mask;
+    }
+
+    return (TRUE);
+}
+
+BOOLEAN
+AeSimulatePortWrite (
+    ACPI_IO_ADDRESS         Address,
+    UINT32                  Value,
+    UINT32                  Width)
+{
+
+    if (!AeGpeStorm.Active || (Width != 8))
+    {
+        return (FALSE);
+    }
+
+    if (Address == AeGpeStorm.EnableAddress)
+    {
+        AeGpeStorm.Enable = (UINT8) Value;
+        return (TRUE);
+    }
+
+    /* Writes to the status registers (GPE clears) are discarded */
+
+    return ((Address >= AeGpeStorm.StatusBase) &&
+        (Address < AeGpeStorm.StatusBase + AeGpeStorm.RegisterCount));
+}
+
+#else
+
+BOOLEAN
+AeSimulatePortRead (
+    ACPI_IO_ADDRESS         Address,
+    UINT32                  *Value,
+    UINT32                  Width)
+{
+    return (FALSE);
+}
+
+BOOLEAN
+AeSimulatePortWrite (
+    ACPI_IO_ADDRESS         Address,
+    UINT32                  Value,
+    UINT32                  Width)
+{
+    return (FALSE);
+}
+#endif /* !ACPI_REDUCED_HARDWARE */
+
+
 /******************************************************************************
  *
  * FUNCTION:    AeGlobalEventHandler
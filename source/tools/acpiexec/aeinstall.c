@@ -177,9 +177,11 @@ AeOverrideRegionHandlers (
     {
         /* Install handler at the root object */
 
-        Status = AcpiInstallAddressSpaceHandler (ACPI_ROOT_OBJECT,
+        Status = AcpiInstallAddressSpaceHandlerEx (ACPI_ROOT_OBJECT,
             DefaultSpaceIdList[i], AeRegionHandler, AeRegionInit,
-            &AeMyContext);
+            &AeMyContext,
+            (DefaultSpaceIdList[i] == ACPI_ADR_SPACE_SYSTEM_MEMORY) ?
+                ACPI_ADR_HANDLER_BLOCK_IO : 0);
 
         if (ACPI_FAILURE (Status))
         {
@@ -337,9 +339,9 @@ AeInstallPciHandler (
             ObjHandle));
     }
 
-    Status = AcpiInstallAddressSpaceHandler (ObjHandle,
+    Status = AcpiInstallAddressSpaceHandlerEx (ObjHandle,
         ACPI_ADR_SPACE_SYSTEM_MEMORY, AeRegionHandler, AeRegionInit,
-        &AeMyContext);
+        &AeMyContext, ACPI_ADR_HANDLER_BLOCK_IO);
     if (ACPI_FAILURE (Status))
     {
         ACPI_EXCEPTION ((AE_INFO, Status,
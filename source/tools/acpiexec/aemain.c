@@ -88,13 +88,14 @@ UINT8                       AcpiGbl_UseHwReducedFadt = FALSE;
 BOOLEAN                     AcpiGbl_DoInterfaceTests = FALSE;
 BOOLEAN                     AcpiGbl_LoadTestTables = FALSE;
 BOOLEAN                     AcpiGbl_AeLoadOnly = FALSE;
+BOOLEAN                     AcpiGbl_AeSnapshotRoundTrip = FALSE;
 static UINT8                AcpiGbl_ExecutionMode = AE_MODE_COMMAND_LOOP;
 static char                 BatchBuffer[AE_BUFFER_SIZE];    /* Batch command buffer */
 INIT_FILE_ENTRY             *AcpiGbl_InitEntries = NULL;
 UINT32                      AcpiGbl_InitFileLineCount = 0;
 
 #define ACPIEXEC_NAME               "AML Execution/Debug Utility"
-#define AE_SUPPORTED_OPTIONS        "?b:d:e:f^ghlm^rt^v^:x:"
+#define AE_SUPPORTED_OPTIONS        "?b:d:e:f^ghlm^rst^v^:x:"
 
 
 /* Stubs for the disassembler */
@@ -143,19 +144,29 @@ usage (
     printf ("\n");
 
     ACPI_OPTION ("-da",                 "Disable method abort on error");
+    ACPI_OPTION ("-dc",                 "Disable copy-on-write Buffers and Packages");
     ACPI_OPTION ("-df",                 "Disable Local fault handler");
     ACPI_OPTION ("-di",                 "Disable execution of STA/INI methods during init");
+    ACPI_OPTION ("-dm",                 "Disable control method name cache");
+    ACPI_OPTION ("-dn",                 "Disable heap-free intermediate integers");
     ACPI_OPTION ("-do",                 "Disable Operation Region address simulation");
+    ACPI_OPTION ("-dp",                 "Disable memoization of pure methods");
     ACPI_OPTION ("-dr",                 "Disable repair of method return values");
     ACPI_OPTION ("-ds",                 "Disable method auto-serialization");
     ACPI_OPTION ("-dt",                 "Disable allocation tracking (performance)");
+    ACPI_OPTION ("-dw",                 "Disable per-invocation walk arena");
     printf ("\n");
 
     ACPI_OPTION ("-ed",                 "Enable timer output for Debug Object");
     ACPI_OPTION ("-ef",                 "Enable display of final memory statistics");
+    ACPI_OPTION ("-eg",                 "Enable GPE storm detection");
     ACPI_OPTION ("-ei",                 "Enable additional tests for ACPICA interfaces");
+    ACPI_OPTION ("-ej",                 "Enable native JIT for hot control methods");
     ACPI_OPTION ("-el",                 "Enable loading of additional test tables");
+    ACPI_OPTION ("-em",                 "Enable parallel execution of control methods");
+    ACPI_OPTION ("-en",                 "Enable namespace node arena allocation");
     ACPI_OPTION ("-eo",                 "Enable object evaluation log");
+    ACPI_OPTION ("-ep",                 "Enable namespace pathname cache");
     ACPI_OPTION ("-es",                 "Enable Interpreter Slack Mode");
     ACPI_OPTION ("-et",                 "Enable debug semaphore timeout");
     printf ("\n");
@@ -166,6 +177,7 @@ usage (
 
     ACPI_OPTION ("-l",                  "Load tables and namespace only");
     ACPI_OPTION ("-r",                  "Use hardware-reduced FADT V5");
+    ACPI_OPTION ("-s",                  "Reload the namespace from a snapshot after loading tables");
     ACPI_OPTION ("-te",                 "Exit loop on timeout instead of aborting method");
     ACPI_OPTION ("-to <Seconds>",       "Set timeout period for AML while loops");
     printf ("\n");
@@ -227,6 +239,11 @@ AeDoOptions (
             AcpiGbl_IgnoreErrors = TRUE;
             break;
 
+        case 'c':
+
+            AcpiGbl_EnableCopyOnWrite = FALSE;
+            break;
+
         case 'f':
 
             AcpiGbl_UseLocalFaultHandler = FALSE;
@@ -237,11 +254,26 @@ AeDoOptions (
             AcpiGbl_DbOpt_NoIniMethods = TRUE;
             break;
 
+        case 'm':
+
+            AcpiGbl_EnableMethodCache = FALSE;
+            break;
+
+        case 'n':
+
+            AcpiGbl_EnableImmediateIntegers = FALSE;
+            break;
+
         case 'o':
 
             AcpiGbl_DbOpt_NoRegionSupport = TRUE;
             break;
 
+        case 'p':
+
+            AcpiGbl_EnableMethodMemo = FALSE;
+            break;
+
         case 'r':
 
             AcpiGbl_DisableAutoRepair = TRUE;
@@ -259,6 +291,11 @@ AeDoOptions (
             #endif
             break;
 
+        case 'w':
+
+            AcpiGbl_EnableWalkArena = FALSE;
+            break;
+
         default:
 
             printf ("Unknown option: -d%s\n", AcpiGbl_Optarg);
@@ -282,22 +319,47 @@ AeDoOptions (
             #endif
             break;
 
+        case 'g':
+
+            AcpiGbl_GpeStormThreshold = ACPI_GPE_STORM_SUGGESTED;
+            break;
+
         case 'i':
 
             AcpiGbl_DoInterfaceTests = TRUE;
             break;
 
+        case 'j':
+
+            AcpiGbl_EnableJit = TRUE;
+            break;
+
         case 'l':
 
             AcpiGbl_LoadTestTables = TRUE;
             break;
 
+        case 'm':
+
+            AcpiGbl_ParallelExecution = TRUE;
+            break;
+
+        case 'n':
+
+            AcpiGbl_EnableNamespaceArena = TRUE;
+            break;
+
         case 'o':
 
             AcpiDbgLevel |= ACPI_LV_EVALUATION;
             AcpiGbl_DbConsoleDebugLevel |= ACPI_LV_EVALUATION;
             break;
 
+        case 'p':
+
+            AcpiGbl_EnablePathnameCache = TRUE;
+            break;
+
         case 's':
 
             AcpiGbl_EnableInterpreterSlack = TRUE;
@@ -389,6 +451,11 @@ AeDoOptions (
         printf ("Using ACPI 5.0 Hardware Reduced Mode via version 5 FADT\n");
         break;
 
+    case 's':
+
+        AcpiGbl_AeSnapshotRoundTrip = TRUE;
+        break;
+
     case 't':
 
         switch (AcpiGbl_Optarg[0])
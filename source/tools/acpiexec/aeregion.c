@@ -121,6 +121,16 @@ AeRegionHandler (
 
     MyContext = ACPI_CAST_PTR (ACPI_CONNECTION_INFO, HandlerContext);
 
+    /*
+     * A block transfer (SystemMemory only) covers consecutive datums and is
+     * simulated as one wide access
+     */
+    if (Function & ACPI_BLOCK_IO)
+    {
+        BitWidth *= ACPI_BLOCK_IO_COUNT (Function);
+        Function &= ACPI_IO_MASK;
+    }
+
     /*
      * Find the region's address space and length before searching
      * the linked list.
@@ -601,10 +611,15 @@ DoFunction:
         {
         case ACPI_ADR_SPACE_SYSTEM_MEMORY:
 
+            /* Block transfer buffers can be shorter than 32 bits */
+
+            Value1 = 0;
+            memcpy (&Value1, Value, ACPI_MIN (ByteWidth, sizeof (Value1)));
+
             AcpiOsPrintf ("AcpiExec: SystemMemory "
                 "%s: Val %.8X Addr %.4X BitWidth %X [REGION: BaseAddr %.4X Len %.2X]\n",
                 (Function & ACPI_IO_MASK) ? "Write" : "Read ",
-                (UINT32) *Value, (UINT32) Address, BitWidth, (UINT32) BaseAddress, Length);
+                Value1, (UINT32) Address, BitWidth, (UINT32) BaseAddress, Length);
             break;
 
         case ACPI_ADR_SPACE_GSBUS:
@@ -55,6 +55,10 @@ AeInitializeTableHeader (
     char                    *Signature,
     UINT32                  Length);
 
+static ACPI_STATUS
+AeSnapshotRoundTrip (
+    void);
+
 void
 AeTableOverride (
     ACPI_TABLE_HEADER       *ExistingTable,
@@ -540,6 +544,74 @@ AeInstallTables (
 }
 
 
+/******************************************************************************
+ *
+ * FUNCTION:    AeSnapshotRoundTrip
+ *
+ * PARAMETERS:  None
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Test the namespace snapshot (-s option): save the namespace
+ *              just loaded, unload all tables, restore the namespace from
+ *              the snapshot and check that a new snapshot is identical.
+ *
+ *****************************************************************************/
+
+static ACPI_STATUS
+AeSnapshotRoundTrip (
+    void)
+{
+    ACPI_BUFFER             Snapshot = {ACPI_ALLOCATE_BUFFER, NULL};
+    ACPI_BUFFER             Restored = {ACPI_ALLOCATE_BUFFER, NULL};
+    ACPI_NS_SNAPSHOT_HEADER *Header;
+    ACPI_STATUS             Status;
+    UINT32                  i;
+
+
+    Status = AcpiGetNamespaceSnapshot (&Snapshot);
+    ACPI_CHECK_OK (AcpiGetNamespaceSnapshot, Status);
+    if (ACPI_FAILURE (Status))
+    {
+        return (Status);
+    }
+
+    /* Unload in reverse order, the DSDT cannot be unloaded via AcpiUnloadTable */
+
+    for (i = AcpiGbl_RootTableList.CurrentTableCount; i > 0; i--)
+    {
+        if (AcpiTbIsTableLoaded (i - 1))
+        {
+            Status = AcpiTbUnloadTable (i - 1);
+            ACPI_CHECK_OK (AcpiTbUnloadTable, Status);
+        }
+    }
+
+    Status = AcpiLoadTablesFromSnapshot (Snapshot.Pointer,
+        (UINT32) Snapshot.Length);
+    ACPI_CHECK_OK (AcpiLoadTablesFromSnapshot, Status);
+    if (ACPI_SUCCESS (Status))
+    {
+        Status = AcpiGetNamespaceSnapshot (&Restored);
+        ACPI_CHECK_OK (AcpiGetNamespaceSnapshot, Status);
+    }
+
+    if (ACPI_SUCCESS (Status))
+    {
+        Header = ACPI_CAST_PTR (ACPI_NS_SNAPSHOT_HEADER, Snapshot.Pointer);
+        printf ("Namespace snapshot round trip: %u bytes, %u nodes, %s\n",
+            Header->Length, Header->NodeCount,
+            (Restored.Length == Snapshot.Length &&
+             !memcmp (Restored.Pointer, Snapshot.Pointer, Snapshot.Length)) ?
+                "identical" : "MISMATCH");
+        AcpiOsFree (Restored.Pointer);
+    }
+
+    AcpiOsFree (Snapshot.Pointer);
+    return (Status);
+}
+
+
 /******************************************************************************
  *
  * FUNCTION:    AeLoadTables
@@ -562,6 +634,11 @@ AeLoadTables (
     Status = AcpiLoadTables ();
     ACPI_CHECK_OK (AcpiLoadTables, Status);
 
+    if (AcpiGbl_AeSnapshotRoundTrip)
+    {
+        (void) AeSnapshotRoundTrip ();
+    }
+
     /*
      * Test run-time control method installation. Do it twice to test code
      * for an existing name.
@@ -108,6 +108,118 @@ unsigned char Ssdt4Code[] =     /* Has method _T96 */
     0x39,0x36,0x05,0xA4,0x00                  /* 00000028    "96..."    */
 };
 
+unsigned char JitSsdtCode[] =   /* Has methods JTM1 and JTM2, for native JIT tests */
+{
+    0x53,0x53,0x44,0x54,0x74,0x00,0x00,0x00,  /* 00000000    "SSDTt..." */
+    0x02,0xB0,0x49,0x6E,0x74,0x65,0x6C,0x00,  /* 00000008    "..Intel." */
+    0x73,0x73,0x64,0x74,0x6A,0x69,0x74,0x20,  /* 00000010    "ssdtjit " */
+    0x01,0x00,0x00,0x00,0x49,0x4E,0x54,0x4C,  /* 00000018    "....INTL" */
+    0x31,0x03,0x23,0x20,0x08,0x4A,0x54,0x42,  /* 00000020    "1.# .JTB" */
+    0x30,0x12,0x0C,0x04,0x0A,0x03,0x0A,0x10,  /* 00000028    "0......." */
+    0x0B,0x00,0x20,0x0D,0x37,0x00,0x14,0x2A,  /* 00000030    ".. .7..*" */
+    0x4A,0x54,0x4D,0x31,0x01,0x70,0x00,0x60,  /* 00000038    "JTM1.p.`" */
+    0x70,0x00,0x61,0xA2,0x1B,0x95,0x61,0x68,  /* 00000040    "p.a...ah" */
+    0x78,0x77,0x61,0x0A,0x11,0x00,0x0A,0x03,  /* 00000048    "xwa....." */
+    0x62,0x63,0x72,0x60,0x72,0x63,0x79,0x62,  /* 00000050    "bcr`rcyb" */
+    0x0A,0x04,0x00,0x00,0x60,0x75,0x61,0xA4,  /* 00000058    "....`ua." */
+    0x60,0x14,0x12,0x4A,0x54,0x4D,0x32,0x01,  /* 00000060    "`..JTM2." */
+    0xA4,0x72,0x83,0x88,0x4A,0x54,0x42,0x30,  /* 00000068    ".r..JTB0" */
+    0x68,0x00,0x01,0x00                       /* 00000070    "h..."     */
+};
+
+unsigned char BlockIoSsdtCode[] = /* Has SystemMemory fields BKD0/BKB0, for block transfer tests */
+{
+    0x53,0x53,0x44,0x54,0x74,0x00,0x00,0x00,  /* 00000000    "SSDTt..." */
+    0x02,0x92,0x49,0x6E,0x74,0x65,0x6C,0x00,  /* 00000008    "..Intel." */
+    0x73,0x73,0x64,0x74,0x62,0x6C,0x6B,0x20,  /* 00000010    "ssdtblk " */
+    0x01,0x00,0x00,0x00,0x49,0x4E,0x54,0x4C,  /* 00000018    "....INTL" */
+    0x31,0x03,0x23,0x20,0x5B,0x80,0x42,0x4B,  /* 00000020    "1.# [.BK" */
+    0x52,0x47,0x00,0x0C,0x00,0x00,0x00,0x8C,  /* 00000028    "RG......" */
+    0x0B,0x00,0x01,0x5B,0x81,0x0C,0x42,0x4B,  /* 00000030    "...[..BK" */
+    0x52,0x47,0x03,0x42,0x4B,0x44,0x30,0x40,  /* 00000038    "RG.BKD0@" */
+    0x80,0x5B,0x81,0x0C,0x42,0x4B,0x52,0x47,  /* 00000040    ".[..BKRG" */
+    0x01,0x42,0x4B,0x42,0x30,0x40,0x80,0x14,  /* 00000048    ".BKB0@.." */
+    0x0C,0x42,0x4B,0x57,0x30,0x01,0x70,0x68,  /* 00000050    ".BKW0.ph" */
+    0x42,0x4B,0x44,0x30,0x14,0x0B,0x42,0x4B,  /* 00000058    "BKD0..BK" */
+    0x52,0x30,0x00,0xA4,0x42,0x4B,0x44,0x30,  /* 00000060    "R0..BKD0" */
+    0x14,0x0B,0x42,0x4B,0x52,0x31,0x00,0xA4,  /* 00000068    "..BKR1.." */
+    0x42,0x4B,0x42,0x30                       /* 00000070    "BKB0"     */
+};
+
+unsigned char MemoSsdtCode[] =  /* Pure methods MPU1 and \MSCP.MPU2, impure MSET and MIMP, for memo tests */
+{
+    0x53,0x53,0x44,0x54,0x77,0x00,0x00,0x00,  /* 00000000    "SSDTw..." */
+    0x02,0x34,0x49,0x6E,0x74,0x65,0x6C,0x00,  /* 00000008    ".4Intel." */
+    0x73,0x73,0x64,0x74,0x6D,0x65,0x6D,0x6F,  /* 00000010    "ssdtmemo" */
+    0x01,0x00,0x00,0x00,0x49,0x4E,0x54,0x4C,  /* 00000018    "....INTL" */
+    0x31,0x03,0x23,0x20,0x08,0x4D,0x44,0x41,  /* 00000020    "1.# .MDA" */
+    0x54,0x0A,0x05,0x08,0x4D,0x43,0x4E,0x54,  /* 00000028    "T...MCNT" */
+    0x00,0x08,0x4D,0x56,0x41,0x4C,0x01,0x14,  /* 00000030    "..MVAL.." */
+    0x0E,0x4D,0x50,0x55,0x31,0x01,0xA4,0x72,  /* 00000038    ".MPU1..r" */
+    0x4D,0x44,0x41,0x54,0x68,0x00,0x14,0x0C,  /* 00000040    "MDATh..." */
+    0x4D,0x53,0x45,0x54,0x01,0x70,0x68,0x4D,  /* 00000048    "MSET.phM" */
+    0x44,0x41,0x54,0x14,0x10,0x4D,0x49,0x4D,  /* 00000050    "DAT..MIM" */
+    0x50,0x00,0x75,0x4D,0x43,0x4E,0x54,0xA4,  /* 00000058    "P.uMCNT." */
+    0x4D,0x43,0x4E,0x54,0x5B,0x82,0x11,0x4D,  /* 00000060    "MCNT[..M" */
+    0x53,0x43,0x50,0x14,0x0B,0x4D,0x50,0x55,  /* 00000068    "SCP..MPU" */
+    0x32,0x00,0xA4,0x4D,0x56,0x41,0x4C        /* 00000070    "2..MVAL"  */
+};
+
+unsigned char MemoSsdt2Code[] = /* Adds \MSCP.MVAL, which hides \MVAL from MPU2 */
+{
+    0x53,0x53,0x44,0x54,0x32,0x00,0x00,0x00,  /* 00000000    "SSDT2..." */
+    0x02,0xC4,0x49,0x6E,0x74,0x65,0x6C,0x00,  /* 00000008    "..Intel." */
+    0x73,0x73,0x64,0x74,0x6D,0x65,0x6D,0x32,  /* 00000010    "ssdtmem2" */
+    0x01,0x00,0x00,0x00,0x49,0x4E,0x54,0x4C,  /* 00000018    "....INTL" */
+    0x31,0x03,0x23,0x20,0x10,0x0D,0x5C,0x4D,  /* 00000020    "1.# ..\M" */
+    0x53,0x43,0x50,0x08,0x4D,0x56,0x41,0x4C,  /* 00000028    "SCP.MVAL" */
+    0x0A,0x02                                 /* 00000030    ".."       */
+};
+
+unsigned char ParallelSsdtCode[] = /* Private PRV1, shared PSH1 updating PCNT/PSUM, for parallel execution tests */
+{
+    0x53,0x53,0x44,0x54,0xB5,0x00,0x00,0x00,  /* 00000000    "SSDT...." */
+    0x02,0x60,0x49,0x6E,0x74,0x65,0x6C,0x00,  /* 00000008    ".`Intel." */
+    0x73,0x73,0x64,0x74,0x70,0x61,0x72,0x61,  /* 00000010    "ssdtpara" */
+    0x01,0x00,0x00,0x00,0x49,0x4E,0x54,0x4C,  /* 00000018    "....INTL" */
+    0x31,0x03,0x23,0x20,0x08,0x50,0x43,0x4E,  /* 00000020    "1.# .PCN" */
+    0x54,0x00,0x08,0x50,0x53,0x55,0x4D,0x00,  /* 00000028    "T..PSUM." */
+    0x14,0x3D,0x50,0x52,0x56,0x31,0x01,0x70,  /* 00000030    ".=PRV1.p" */
+    0x68,0x60,0x70,0x00,0x61,0x70,0x0D,0x00,  /* 00000038    "h`p.ap.." */
+    0x63,0x70,0x0A,0x40,0x62,0xA2,0x22,0x62,  /* 00000040    "cp.@b."b" */
+    0x7B,0x72,0x77,0x60,0x0C,0x6D,0x4E,0xC6,  /* 00000048    "{rw`.mN." */
+    0x41,0x00,0x0B,0x39,0x30,0x00,0x0C,0xFF,  /* 00000050    "A..90..." */
+    0xFF,0xFF,0xFF,0x60,0x7F,0x61,0x60,0x61,  /* 00000058    "...`.a`a" */
+    0x73,0x63,0x0D,0x61,0x00,0x63,0x76,0x62,  /* 00000060    "sc.a.cvb" */
+    0xA4,0x72,0x61,0x87,0x63,0x00,0x14,0x33,  /* 00000068    ".ra.c..3" */
+    0x50,0x53,0x48,0x31,0x01,0x70,0x68,0x60,  /* 00000070    "PSH1.ph`" */
+    0x70,0x0A,0x20,0x62,0xA2,0x23,0x62,0x7B,  /* 00000078    "p. b.#b{" */
+    0x72,0x77,0x60,0x0C,0xCD,0x0D,0x01,0x00,  /* 00000080    "rw`....." */
+    0x00,0x01,0x00,0x0B,0xFF,0xFF,0x60,0x75,  /* 00000088    "......`u" */
+    0x50,0x43,0x4E,0x54,0x72,0x50,0x53,0x55,  /* 00000090    "PCNTrPSU" */
+    0x4D,0x60,0x50,0x53,0x55,0x4D,0x76,0x62,  /* 00000098    "M`PSUMvb" */
+    0xA4,0x60,0x14,0x12,0x50,0x52,0x53,0x54,  /* 000000A0    ".`..PRST" */
+    0x00,0x70,0x00,0x50,0x43,0x4E,0x54,0x70,  /* 000000A8    ".p.PCNTp" */
+    0x00,0x50,0x53,0x55,0x4D                  /* 000000B0    ".PSUM"    */
+};
+
+unsigned char DeviceIdSsdtCode[] =  /* Devices \AED0, \AED0.AED1 and \AED2 with _HID AEDV0001 */
+{
+    0x53,0x53,0x44,0x54,0x68,0x00,0x00,0x00,  /* 00000000    "SSDTh..." */
+    0x02,0x26,0x49,0x6E,0x74,0x65,0x6C,0x00,  /* 00000008    ".&Intel." */
+    0x73,0x73,0x64,0x74,0x64,0x65,0x76,0x78,  /* 00000010    "ssdtdevx" */
+    0x01,0x00,0x00,0x00,0x49,0x4E,0x54,0x4C,  /* 00000018    "....INTL" */
+    0x31,0x03,0x23,0x20,0x5B,0x82,0x2B,0x5C,  /* 00000020    "1.# [.+\" */
+    0x41,0x45,0x44,0x30,0x08,0x5F,0x48,0x49,  /* 00000028    "AED0._HI" */
+    0x44,0x0D,0x41,0x45,0x44,0x56,0x30,0x30,  /* 00000030    "D.AEDV00" */
+    0x30,0x31,0x00,0x5B,0x82,0x14,0x41,0x45,  /* 00000038    "01.[..AE" */
+    0x44,0x31,0x08,0x5F,0x48,0x49,0x44,0x0D,  /* 00000040    "D1._HID." */
+    0x41,0x45,0x44,0x56,0x30,0x30,0x30,0x31,  /* 00000048    "AEDV0001" */
+    0x00,0x5B,0x82,0x15,0x5C,0x41,0x45,0x44,  /* 00000050    ".[..\AED" */
+    0x32,0x08,0x5F,0x48,0x49,0x44,0x0D,0x41,  /* 00000058    "2._HID.A" */
+    0x45,0x44,0x56,0x30,0x30,0x30,0x31,0x00   /* 00000060    "EDV0001." */
+};
+
 /* "Hardware-Reduced" ACPI 5.0 FADT (No FACS, no ACPI hardware) */
 
 unsigned char HwReducedFadtCode[] =
@@ -413,6 +525,31 @@ DefinitionBlock ("ssdt4.aml", "SSDT", 2, "Intel", "ssdt4", 0x00000004)
     }
 }
 
+/* JIT SSDT */
+
+DefinitionBlock ("ssdtjit.aml", "SSDT", 2, "Intel", "ssdtjit", 0x00000001)
+{
+    Name (JTB0, Package () {3, 0x10, 0x2000, "7"})
+
+    Method (JTM1, 1, NotSerialized)
+    {
+        Store (Zero, Local0)
+        Store (Zero, Local1)
+        While (LLess (Local1, Arg0))
+        {
+            Divide (Multiply (Local1, 0x11), 3, Local2, Local3)
+            Add (Local0, Add (Local3, ShiftLeft (Local2, 4)), Local0)
+            Increment (Local1)
+        }
+        Return (Local0)
+    }
+
+    Method (JTM2, 1, NotSerialized)
+    {
+        Return (Add (DerefOf (Index (JTB0, Arg0)), 1))
+    }
+}
+
 /* Example ECDT */
 
 [000h 0000   4]                    Signature : "ECDT"    /* Embedded Controller Boot Resources Table */
@@ -42,10 +42,21 @@
  */
 
 #include "aecommon.h"
+#include "acevents.h"
 
 #define _COMPONENT          ACPI_TOOLS
         ACPI_MODULE_NAME    ("aetests")
 
+/* Completion of one AcpiEvaluateObjectAsync call in AeTestEvaluateAsync */
+
+typedef struct ae_async_result
+{
+    ACPI_SEMAPHORE          Done;
+    ACPI_STATUS             Status;
+    UINT64                  Value;
+
+} AE_ASYNC_RESULT;
+
 /* Local prototypes */
 
 static void
@@ -60,6 +71,107 @@ static void
 AeTestSleepData (
     void);
 
+static void
+AeTestParallelWalk (
+    void);
+
+static void
+AeTestDeviceIdIndex (
+    void);
+
+static void
+AeTestGpeBlockStatistics (
+    void);
+
+static void
+AeTestGpeStorm (
+    void);
+
+static void
+AeTestGpeCoalescing (
+    void);
+
+static void
+AeTestEvaluateObjects (
+    void);
+
+static void
+AeTestEvaluateAsync (
+    void);
+
+static void
+AeTestJit (
+    void);
+
+static void
+AeTestMemMappingCache (
+    void);
+
+static void
+AeTestBlockFieldIo (
+    void);
+
+static void
+AeTestMethodMemo (
+    void);
+
+static void
+AeTestPathnameCache (
+    void);
+
+static void
+AeTestParallelExecution (
+    void);
+
+static ACPI_STATUS
+AeEvaluateInteger (
+    char                    *Path,
+    UINT32                  ArgCount,
+    UINT64                  ArgValue,
+    UINT64                  *Value);
+
+static void
+AeCheckMemoResult (
+    char                    *Path,
+    UINT32                  ArgCount,
+    UINT64                  ArgValue,
+    UINT64                  Expected);
+
+static void
+AeAsyncCallback (
+    ACPI_STATUS             Status,
+    ACPI_BUFFER             *ReturnBuffer,
+    void                    *Context);
+
+#if (!ACPI_REDUCED_HARDWARE)
+static UINT32
+AeStormGpeHandler (
+    ACPI_HANDLE             GpeDevice,
+    UINT32                  GpeNumber,
+    void                    *Context);
+#endif
+
+static ACPI_STATUS
+AeParallelWalkCallback (
+    ACPI_HANDLE             ObjHandle,
+    UINT32                  NestingLevel,
+    void                    *Context,
+    void                    **ReturnValue);
+
+static ACPI_STATUS
+AeUnloadDeviceCallback (
+    ACPI_HANDLE             ObjHandle,
+    UINT32                  NestingLevel,
+    void                    *Context,
+    void                    **ReturnValue);
+
+static void
+AeParallelWalkMerge (
+    ACPI_HANDLE             ObjHandle,
+    UINT32                  NestingLevel,
+    void                    *Result,
+    void                    *Context);
+
 static void
 AeGlobalAddressRangeCheck(
     void);
@@ -147,6 +259,21 @@ AeMiscellaneousTests (
     AeTestPackageArgument ();
     AeMutexInterfaces ();
     AeTestSleepData ();
+    AeTestParallelWalk ();
+    AeTestDeviceIdIndex ();
+    AeTestGpeBlockStatistics ();
+    AeTestEvaluateObjects ();
+    AeTestEvaluateAsync ();
+
+    if (AcpiGbl_DoInterfaceTests)
+    {
+        AeTestJit ();
+        AeTestMemMappingCache ();
+        AeTestBlockFieldIo ();
+        AeTestMethodMemo ();
+        AeTestPathnameCache ();
+        AeTestParallelExecution ();
+    }
 
     /* Test _OSI install/remove */
 
@@ -351,6 +478,12 @@ AeMiscellaneousTests (
     Status = AcpiGetTimerDuration (0x1000, 0x2000, &Temp);
     ACPI_CHECK_OK (AcpiGetTimerDuration, Status);
 
+    if (AcpiGbl_DoInterfaceTests)
+    {
+        AeTestGpeStorm ();
+        AeTestGpeCoalescing ();
+    }
+
 
 #endif /* !ACPI_REDUCED_HARDWARE */
 }
@@ -492,17 +625,1356 @@ AeTestSleepData (
 
 /******************************************************************************
  *
- * FUNCTION:    AeLateTest
+ * FUNCTION:    AeParallelWalkCallback, AeParallelWalkMerge
  *
- * DESCRIPTION: Exercise tests that should be performed before shutdown.
+ * DESCRIPTION: Count nodes per worker (Context) and per task (ReturnValue),
+ *              then sum the per-task counts.
  *
  *****************************************************************************/
 
-void
-AeLateTest (
+static ACPI_STATUS
+AeParallelWalkCallback (
+    ACPI_HANDLE             ObjHandle,
+    UINT32                  NestingLevel,
+    void                    *Context,
+    void                    **ReturnValue)
+{
+    UINT32                  *WorkerCount = Context;
+
+
+    (*WorkerCount)++;
+    if (ReturnValue)
+    {
+        *ReturnValue = ACPI_ADD_PTR (void, *ReturnValue, 1);
+    }
+
+    return (AE_OK);
+}
+
+static void
+AeParallelWalkMerge (
+    ACPI_HANDLE             ObjHandle,
+    UINT32                  NestingLevel,
+    void                    *Result,
+    void                    *Context)
+{
+    UINT32                  *Total = Context;
+
+
+    *Total += (UINT32) ACPI_TO_INTEGER (Result);
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeTestParallelWalk
+ *
+ * DESCRIPTION: Check that AcpiWalkNamespaceParallel visits the same nodes as
+ *              AcpiWalkNamespace, exactly once each.
+ *
+ *****************************************************************************/
+
+static void
+AeTestParallelWalk (
     void)
 {
-    AeGlobalAddressRangeCheck();
+    UINT32                  WorkerCount[4] = {0, 0, 0, 0};
+    void                    *WorkerContexts[4];
+    UINT32                  SerialCount = 0;
+    UINT32                  MergedCount = 0;
+    UINT32                  WorkerTotal = 0;
+    ACPI_STATUS             Status;
+    UINT32                  i;
+
+
+    Status = AcpiWalkNamespace (ACPI_TYPE_ANY, ACPI_ROOT_OBJECT,
+        ACPI_UINT32_MAX, AeParallelWalkCallback, NULL, &SerialCount, NULL);
+    ACPI_CHECK_OK (AcpiWalkNamespace, Status);
+
+    for (i = 0; i < ACPI_ARRAY_LENGTH (WorkerContexts); i++)
+    {
+        WorkerContexts[i] = &WorkerCount[i];
+    }
+
+    Status = AcpiWalkNamespaceParallel (ACPI_TYPE_ANY, ACPI_ROOT_OBJECT,
+        ACPI_UINT32_MAX, ACPI_ARRAY_LENGTH (WorkerContexts),
+        AeParallelWalkCallback, WorkerContexts,
+        AeParallelWalkMerge, &MergedCount);
+    ACPI_CHECK_OK (AcpiWalkNamespaceParallel, Status);
+
+    for (i = 0; i < ACPI_ARRAY_LENGTH (WorkerCount); i++)
+    {
+        WorkerTotal += WorkerCount[i];
+    }
+
+    if ((MergedCount != SerialCount) || (WorkerTotal != SerialCount))
+    {
+        AcpiOsPrintf ("Parallel walk visited %u nodes (merged %u), "
+            "expected %u\n", WorkerTotal, MergedCount, SerialCount);
+    }
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeUnloadDeviceCallback
+ *
+ * DESCRIPTION: Count devices (Context) and unload the table of the first.
+ *
+ *****************************************************************************/
+
+static ACPI_STATUS
+AeUnloadDeviceCallback (
+    ACPI_HANDLE             ObjHandle,
+    UINT32                  NestingLevel,
+    void                    *Context,
+    void                    **ReturnValue)
+{
+    UINT32                  *Count = Context;
+    ACPI_STATUS             Status;
+
+
+    (*Count)++;
+    if (*Count == 1)
+    {
+        Status = AcpiUnloadParentTable (ObjHandle);
+        ACPI_CHECK_OK (AcpiUnloadParentTable, Status);
+    }
+
+    return (AE_OK);
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeTestDeviceIdIndex
+ *
+ * DESCRIPTION: Check that AcpiGetDevices finds the same devices with and
+ *              without the device ID index, and that a callback may unload
+ *              a table while the index is in use.
+ *
+ *****************************************************************************/
+
+static void
+AeTestDeviceIdIndex (
+    void)
+{
+    static char             *Ids[] = {"PNP0A03", "PNP0C0A", "ACPI0003", "PNP0C09"};
+    UINT32                  IndexedCount;
+    UINT32                  WalkCount;
+    UINT8                   SaveEnable;
+    ACPI_STATUS             Status;
+    UINT32                  i;
+
+
+    SaveEnable = AcpiGbl_EnableDeviceIdIndex;
+    for (i = 0; i < ACPI_ARRAY_LENGTH (Ids); i++)
+    {
+        IndexedCount = 0;
+        WalkCount = 0;
+
+        AcpiGbl_EnableDeviceIdIndex = TRUE;
+        Status = AcpiGetDevices (Ids[i], AeParallelWalkCallback,
+            &IndexedCount, NULL);
+        ACPI_CHECK_OK (AcpiGetDevices, Status);
+
+        AcpiGbl_EnableDeviceIdIndex = FALSE;
+        Status = AcpiGetDevices (Ids[i], AeParallelWalkCallback,
+            &WalkCount, NULL);
+        ACPI_CHECK_OK (AcpiGetDevices, Status);
+
+        if (IndexedCount != WalkCount)
+        {
+            AcpiOsPrintf ("AcpiGetDevices (%s) found %u devices with the "
+                "device ID index, %u without\n", Ids[i], IndexedCount, WalkCount);
+        }
+    }
+
+    /*
+     * The callback unloads the table of the first of its three devices.
+     * It must not deadlock, and must not be given the unloaded devices.
+     */
+    Status = AcpiLoadTable ((ACPI_TABLE_HEADER *) DeviceIdSsdtCode, NULL);
+    ACPI_CHECK_OK (AcpiLoadTable, Status);
+    if (ACPI_SUCCESS (Status))
+    {
+        IndexedCount = 0;
+        AcpiGbl_EnableDeviceIdIndex = TRUE;
+        Status = AcpiGetDevices ("AEDV0001", AeUnloadDeviceCallback,
+            &IndexedCount, NULL);
+        ACPI_CHECK_OK (AcpiGetDevices, Status);
+
+        if (IndexedCount != 1)
+        {
+            AcpiOsPrintf ("AcpiGetDevices (AEDV0001) found %u devices after "
+                "unloading their table, expected 1\n", IndexedCount);
+        }
+    }
+
+    AcpiGbl_EnableDeviceIdIndex = SaveEnable;
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeTestGpeBlockStatistics
+ *
+ * DESCRIPTION: Walk the GPE blocks with AcpiGetGpeBlockStatistics and check
+ *              that together they cover all GPEs.
+ *
+ *****************************************************************************/
+
+static void
+AeTestGpeBlockStatistics (
+    void)
+{
+#if (!ACPI_REDUCED_HARDWARE)
+    ACPI_GPE_BLOCK_STATISTICS   Statistics;
+    ACPI_STATUS                 Status;
+    UINT32                      Index = 0;
+
+
+    Status = AcpiGetGpeBlockStatistics (0, NULL);
+    ACPI_CHECK_STATUS (AcpiGetGpeBlockStatistics, Status, AE_BAD_PARAMETER);
+
+    while (Index < AcpiCurrentGpeCount)
+    {
+        Status = AcpiGetGpeBlockStatistics (Index, &Statistics);
+        ACPI_CHECK_OK (AcpiGetGpeBlockStatistics, Status);
+        if (ACPI_FAILURE (Status))
+        {
+            return;
+        }
+
+        if ((Statistics.BlockBaseIndex != Index) ||
+            (Statistics.RegisterReads & 1))
+        {
+            AcpiOsPrintf ("AcpiGetGpeBlockStatistics (%u) returned block "
+                "index %u, %u register reads\n", Index,
+                Statistics.BlockBaseIndex, Statistics.RegisterReads);
+        }
+
+        Index += Statistics.GpeCount;
+    }
+
+    Status = AcpiGetGpeBlockStatistics (Index, &Statistics);
+    ACPI_CHECK_STATUS (AcpiGetGpeBlockStatistics, Status, AE_NOT_EXIST);
+
+#endif /* !ACPI_REDUCED_HARDWARE */
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeTestGpeStorm
+ *
+ * DESCRIPTION: Inject a GPE storm. Check that the GPE is switched to polling
+ *              after AcpiGbl_GpeStormThreshold events, that the poller
+ *              dispatches it while the storm lasts, and that it is unmasked
+ *              once the storm is over.
+ *
+ *****************************************************************************/
+
+#define AE_STORM_GPE                0x1A
+#define AE_STORM_DURATION           300     /* Milliseconds */
+
+#if (!ACPI_REDUCED_HARDWARE)
+static UINT32
+AeStormGpeHandler (
+    ACPI_HANDLE             GpeDevice,
+    UINT32                  GpeNumber,
+    void                    *Context)
+{
+
+    (*ACPI_CAST_PTR (UINT32, Context))++;
+    return (ACPI_REENABLE_GPE);
+}
+#endif
+
+static void
+AeTestGpeStorm (
+    void)
+{
+#if (!ACPI_REDUCED_HARDWARE)
+    ACPI_GPE_STORM_INFO     StormInfo;
+    ACPI_STATUS             Status;
+    UINT32                  SavedThreshold = AcpiGbl_GpeStormThreshold;
+    UINT32                  SavedWindow = AcpiGbl_GpeStormWindow;
+    UINT32                  SavedInterval = AcpiGbl_GpePollInterval;
+    UINT32                  EventCount = 0;
+    UINT32                  i;
+
+
+    Status = AcpiInstallGpeHandler (NULL, AE_STORM_GPE,
+        ACPI_GPE_EDGE_TRIGGERED, AeStormGpeHandler, &EventCount);
+    ACPI_CHECK_OK (AcpiInstallGpeHandler, Status);
+
+    Status = AcpiEnableGpe (NULL, AE_STORM_GPE);
+    ACPI_CHECK_OK (AcpiEnableGpe, Status);
+
+    AcpiGbl_GpeStormThreshold = 20;
+    AcpiGbl_GpeStormWindow = 50;
+    AcpiGbl_GpePollInterval = 2;
+
+    Status = AeStartGpeStorm (AE_STORM_GPE, AE_STORM_DURATION);
+    ACPI_CHECK_OK (AeStartGpeStorm, Status);
+
+    /* One SCI per event, until the GPE is masked */
+
+    for (i = 0; i < 100; i++)
+    {
+        (void) AcpiEvGpeDetect (AcpiGbl_GpeXruptListHead);
+    }
+
+    Status = AcpiGetGpeStormInfo (NULL, AE_STORM_GPE, &StormInfo);
+    ACPI_CHECK_OK (AcpiGetGpeStormInfo, Status);
+
+    if (!StormInfo.Polling || (StormInfo.StormCount != 1))
+    {
+        AcpiOsPrintf ("GPE storm not detected: %u events, %u storms\n",
+            EventCount, StormInfo.StormCount);
+    }
+
+    /* Wait for the poller to give the GPE back to the SCI */
+
+    for (i = 0; StormInfo.Polling && (i < 10 * AE_STORM_DURATION); i += 10)
+    {
+        AcpiOsSleep (10);
+        (void) AcpiGetGpeStormInfo (NULL, AE_STORM_GPE, &StormInfo);
+    }
+
+    if (StormInfo.Polling || !StormInfo.PolledEvents)
+    {
+        AcpiOsPrintf ("GPE storm not recovered: %u polled events%s\n",
+            StormInfo.PolledEvents, StormInfo.Polling ? ", polling" : "");
+    }
+
+    AeStopGpeStorm ();
+
+    AcpiGbl_GpeStormThreshold = SavedThreshold;
+    AcpiGbl_GpeStormWindow = SavedWindow;
+    AcpiGbl_GpePollInterval = SavedInterval;
+
+    Status = AcpiDisableGpe (NULL, AE_STORM_GPE);
+    ACPI_CHECK_OK (AcpiDisableGpe, Status);
+
+    Status = AcpiRemoveGpeHandler (NULL, AE_STORM_GPE, AeStormGpeHandler);
+    ACPI_CHECK_OK (AcpiRemoveGpeHandler, Status);
+
+#endif /* !ACPI_REDUCED_HARDWARE */
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeTestGpeCoalescing
+ *
+ * DESCRIPTION: Dispatch an implicit-notify GPE three times in a row. The
+ *              first event queues the execution, the other two are folded
+ *              into a single rerun after it. The GPE is set up for implicit
+ *              notify of the root here, unless the tables give it a _Lxx or
+ *              _Exx method, which is coalesced the same way.
+ *
+ *****************************************************************************/
+
+#define AE_COALESCE_GPE             0x09
+
+static void
+AeTestGpeCoalescing (
+    void)
+{
+#if (!ACPI_REDUCED_HARDWARE)
+    ACPI_GPE_EVENT_INFO     *GpeEventInfo;
+    ACPI_CPU_FLAGS          Flags;
+    ACPI_STATUS             Status;
+    UINT32                  Coalesced;
+    UINT32                  Reruns;
+    UINT8                   MethodState;
+    UINT8                   DispatchType;
+    UINT32                  i;
+
+
+    /* Gives the GPE an implicit notify if it has no method */
+
+    Status = AcpiSetupGpeForWake (ACPI_ROOT_OBJECT, NULL, AE_COALESCE_GPE);
+    if (ACPI_FAILURE (Status) && (Status != AE_ALREADY_EXISTS))
+    {
+        AcpiOsPrintf ("GPE %02X coalescing not tested: "
+            "AcpiSetupGpeForWake returned %s\n", AE_COALESCE_GPE,
+            AcpiFormatException (Status));
+        return;
+    }
+
+    Flags = AcpiOsAcquireLock (AcpiGbl_GpeLock);
+
+    GpeEventInfo = AcpiEvGetGpeEventInfo (NULL, AE_COALESCE_GPE);
+    DispatchType = GpeEventInfo ?
+        ACPI_GPE_DISPATCH_TYPE (GpeEventInfo->Flags) : ACPI_GPE_DISPATCH_NONE;
+
+    if ((DispatchType != ACPI_GPE_DISPATCH_NOTIFY) &&
+        (DispatchType != ACPI_GPE_DISPATCH_METHOD))
+    {
+        AcpiOsReleaseLock (AcpiGbl_GpeLock, Flags);
+        AcpiOsPrintf ("GPE %02X coalescing not tested: "
+            "dispatch type %X\n", AE_COALESCE_GPE, DispatchType);
+        return;
+    }
+
+    Coalesced = GpeEventInfo->CoalescedCount;
+    Reruns = AcpiGpeRerunCount;
+
+    for (i = 0; i < 3; i++)
+    {
+        (void) AcpiEvGpeDispatch (NULL, GpeEventInfo, AE_COALESCE_GPE);
+    }
+
+    AcpiOsReleaseLock (AcpiGbl_GpeLock, Flags);
+
+    /* Wait for the execution and its rerun to complete */
+
+    MethodState = ACPI_GPE_METHOD_QUEUED;
+    for (i = 0; (MethodState != ACPI_GPE_METHOD_IDLE) && (i < 1000); i += 10)
+    {
+        AcpiOsSleep (10);
+
+        Flags = AcpiOsAcquireLock (AcpiGbl_GpeLock);
+        MethodState = GpeEventInfo->MethodState;
+        AcpiOsReleaseLock (AcpiGbl_GpeLock, Flags);
+    }
+
+    if ((MethodState != ACPI_GPE_METHOD_IDLE) ||
+        ((GpeEventInfo->CoalescedCount - Coalesced) != 2) ||
+        ((AcpiGpeRerunCount - Reruns) != 1))
+    {
+        AcpiOsPrintf ("GPE %02X not coalesced: state %u, "
+            "%u coalesced events, %u reruns\n", AE_COALESCE_GPE,
+            MethodState, GpeEventInfo->CoalescedCount - Coalesced,
+            AcpiGpeRerunCount - Reruns);
+    }
+
+#endif /* !ACPI_REDUCED_HARDWARE */
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeTestEvaluateObjects
+ *
+ * DESCRIPTION: Check that AcpiEvaluateObjects returns the same values as
+ *              separate calls to AcpiEvaluateObject, and that a short
+ *              caller buffer is reported with the required length.
+ *
+ *****************************************************************************/
+
+static void
+AeTestEvaluateObjects (
+    void)
+{
+    ACPI_EVALUATE_ITEM      Items[4];
+    ACPI_OBJECT_LIST        ArgList;
+    ACPI_OBJECT             Arg;
+    ACPI_BUFFER             ReturnBuf;
+    ACPI_BUFFER             SingleBuf;
+    ACPI_OBJECT             *Single;
+    char                    Buffer[8];
+    ACPI_STATUS             Status;
+    UINT32                  i;
+
+
+    Arg.Type = ACPI_TYPE_STRING;
+    Arg.String.Pointer = "Windows 2001";
+    Arg.String.Length = 12;
+    ArgList.Count = 1;
+    ArgList.Pointer = &Arg;
+
+    memset (Items, 0, sizeof (Items));
+    Items[0].Pathname = "\\_REV";
+    Items[1].Pathname = "\\_OSI";
+    Items[1].Parameters = &ArgList;
+    Items[2].Pathname = "\\_OS_";
+    Items[3].Pathname = "\\_XYZ";
+
+    ReturnBuf.Length = ACPI_ALLOCATE_BUFFER;
+    Status = AcpiEvaluateObjects (Items, ACPI_ARRAY_LENGTH (Items), &ReturnBuf);
+    ACPI_CHECK_OK (AcpiEvaluateObjects, Status);
+    ACPI_CHECK_STATUS (AcpiEvaluateObjects, Items[3].Status, AE_NOT_FOUND);
+
+    for (i = 0; i < 3; i++)
+    {
+        SingleBuf.Length = ACPI_ALLOCATE_BUFFER;
+        Status = AcpiEvaluateObject (NULL, Items[i].Pathname,
+            Items[i].Parameters, &SingleBuf);
+        ACPI_CHECK_OK (AcpiEvaluateObject, Status);
+        ACPI_CHECK_OK (AcpiEvaluateObjects, Items[i].Status);
+
+        Single = SingleBuf.Pointer;
+        if (!Items[i].ReturnObject ||
+            (Items[i].ReturnObject->Type != Single->Type) ||
+            ((Single->Type == ACPI_TYPE_INTEGER) &&
+                (Items[i].ReturnObject->Integer.Value !=
+                Single->Integer.Value)) ||
+            ((Single->Type == ACPI_TYPE_STRING) &&
+                strcmp (Items[i].ReturnObject->String.Pointer,
+                Single->String.Pointer)))
+        {
+            AcpiOsPrintf ("AcpiEvaluateObjects (%s) returned a different "
+                "value than AcpiEvaluateObject\n", Items[i].Pathname);
+        }
+
+        AcpiOsFree (SingleBuf.Pointer);
+    }
+
+    AcpiOsFree (ReturnBuf.Pointer);
+
+    /* Caller buffer too small, required length is returned */
+
+    ReturnBuf.Length = sizeof (Buffer);
+    ReturnBuf.Pointer = Buffer;
+    Status = AcpiEvaluateObjects (Items, 1, &ReturnBuf);
+    ACPI_CHECK_STATUS (AcpiEvaluateObjects, Status, AE_BUFFER_OVERFLOW);
+
+    if (ReturnBuf.Length != ACPI_ROUND_UP_TO_NATIVE_WORD (sizeof (ACPI_OBJECT)))
+    {
+        AcpiOsPrintf ("AcpiEvaluateObjects reported a required length "
+            "of %u\n", (UINT32) ReturnBuf.Length);
+    }
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeAsyncCallback
+ *
+ * DESCRIPTION: Completion callback for AeTestEvaluateAsync. Records the
+ *              status and integer result of one evaluation.
+ *
+ *****************************************************************************/
+
+static void
+AeAsyncCallback (
+    ACPI_STATUS             Status,
+    ACPI_BUFFER             *ReturnBuffer,
+    void                    *Context)
+{
+    AE_ASYNC_RESULT         *Result = Context;
+    ACPI_OBJECT             *Obj = ReturnBuffer->Pointer;
+
+
+    Result->Status = Status;
+    if (Obj && (Obj->Type == ACPI_TYPE_INTEGER))
+    {
+        Result->Value = Obj->Integer.Value;
+    }
+
+    AcpiOsFree (ReturnBuffer->Pointer);
+    (void) AcpiOsSignalSemaphore (Result->Done, 1);
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeTestEvaluateAsync
+ *
+ * DESCRIPTION: Check that AcpiEvaluateObjectAsync completes each evaluation
+ *              with the same status and value as AcpiEvaluateObject.
+ *
+ *****************************************************************************/
+
+static void
+AeTestEvaluateAsync (
+    void)
+{
+    static char             *Paths[] = {"\\_REV", "\\_OSI", "\\_XYZ"};
+    AE_ASYNC_RESULT         Results[3];
+    ACPI_OBJECT_LIST        ArgList;
+    ACPI_OBJECT             Arg;
+    ACPI_BUFFER             SingleBuf;
+    ACPI_OBJECT             *Single;
+    ACPI_STATUS             Status;
+    UINT32                  i;
+
+
+    Arg.Type = ACPI_TYPE_STRING;
+    Arg.String.Pointer = "Windows 2001";
+    Arg.String.Length = 12;
+    ArgList.Count = 1;
+    ArgList.Pointer = &Arg;
+
+    Status = AcpiEvaluateObjectAsync (NULL, "\\_REV", NULL, NULL, NULL);
+    ACPI_CHECK_STATUS (AcpiEvaluateObjectAsync, Status, AE_BAD_PARAMETER);
+
+    memset (Results, 0, sizeof (Results));
+    for (i = 0; i < ACPI_ARRAY_LENGTH (Paths); i++)
+    {
+        Status = AcpiOsCreateSemaphore (1, 0, &Results[i].Done);
+        ACPI_CHECK_OK (AcpiOsCreateSemaphore, Status);
+
+        Status = AcpiEvaluateObjectAsync (NULL, Paths[i],
+            (i == 1) ? &ArgList : NULL, AeAsyncCallback, &Results[i]);
+        ACPI_CHECK_OK (AcpiEvaluateObjectAsync, Status);
+    }
+
+    for (i = 0; i < ACPI_ARRAY_LENGTH (Paths); i++)
+    {
+        Status = AcpiOsWaitSemaphore (Results[i].Done, 1, 10000);
+        ACPI_CHECK_OK (AcpiOsWaitSemaphore, Status);
+        (void) AcpiOsDeleteSemaphore (Results[i].Done);
+
+        SingleBuf.Length = ACPI_ALLOCATE_BUFFER;
+        Status = AcpiEvaluateObject (NULL, Paths[i],
+            (i == 1) ? &ArgList : NULL, &SingleBuf);
+
+        Single = SingleBuf.Pointer;
+        if ((Results[i].Status != Status) ||
+            (ACPI_SUCCESS (Status) &&
+                (Results[i].Value != Single->Integer.Value)))
+        {
+            AcpiOsPrintf ("AcpiEvaluateObjectAsync (%s) completed with "
+                "%s 0x%8.8X%8.8X, expected %s\n", Paths[i],
+                AcpiFormatException (Results[i].Status),
+                ACPI_FORMAT_UINT64 (Results[i].Value),
+                AcpiFormatException (Status));
+        }
+
+        if (ACPI_SUCCESS (Status))
+        {
+            AcpiOsFree (SingleBuf.Pointer);
+        }
+    }
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeTestJit
+ *
+ * DESCRIPTION: Check that methods compiled to native code return the same
+ *              values as the interpreter, including evaluations where the
+ *              native code gives up (Package element that is a String).
+ *
+ *****************************************************************************/
+
+static void
+AeTestJit (
+    void)
+{
+    static char             *Paths[] = {"\\JTM1", "\\JTM2"};
+    ACPI_OBJECT_LIST        ArgList;
+    ACPI_OBJECT             Arg;
+    ACPI_BUFFER             ReturnBuf;
+    UINT64                  Expected;
+    UINT8                   SaveJit;
+    UINT8                   SaveMemo;
+    ACPI_STATUS             Status;
+    UINT32                  TableIndex;
+    UINT32                  i;
+    UINT32                  j;
+
+
+    Status = AcpiLoadTable ((ACPI_TABLE_HEADER *) JitSsdtCode, &TableIndex);
+    ACPI_CHECK_OK (AcpiLoadTable, Status);
+    if (ACPI_FAILURE (Status))
+    {
+        return;
+    }
+
+    /* Memoization would answer repeated evaluations without running them */
+
+    SaveJit = AcpiGbl_EnableJit;
+    SaveMemo = AcpiGbl_EnableMethodMemo;
+    AcpiGbl_EnableMethodMemo = FALSE;
+
+    Arg.Type = ACPI_TYPE_INTEGER;
+    ArgList.Count = 1;
+    ArgList.Pointer = &Arg;
+
+    for (i = 0; i < 2 * ACPI_JIT_CALL_THRESHOLD; i++)
+    {
+        for (j = 0; j < ACPI_ARRAY_LENGTH (Paths); j++)
+        {
+            Arg.Integer.Value = (j == 0) ? i : (i % 4);
+
+            AcpiGbl_EnableJit = FALSE;
+            ReturnBuf.Length = ACPI_ALLOCATE_BUFFER;
+            Status = AcpiEvaluateObjectTyped (NULL, Paths[j], &ArgList,
+                &ReturnBuf, ACPI_TYPE_INTEGER);
+            ACPI_CHECK_OK (AcpiEvaluateObjectTyped, Status);
+            if (ACPI_FAILURE (Status))
+            {
+                goto Cleanup;
+            }
+
+            Expected = ((ACPI_OBJECT *) ReturnBuf.Pointer)->Integer.Value;
+            AcpiOsFree (ReturnBuf.Pointer);
+
+            AcpiGbl_EnableJit = TRUE;
+            ReturnBuf.Length = ACPI_ALLOCATE_BUFFER;
+            Status = AcpiEvaluateObjectTyped (NULL, Paths[j], &ArgList,
+                &ReturnBuf, ACPI_TYPE_INTEGER);
+            ACPI_CHECK_OK (AcpiEvaluateObjectTyped, Status);
+            if (ACPI_FAILURE (Status))
+            {
+                goto Cleanup;
+            }
+
+            if (((ACPI_OBJECT *) ReturnBuf.Pointer)->Integer.Value != Expected)
+            {
+                AcpiOsPrintf ("%s (0x%X) returned 0x%8.8X%8.8X with native "
+                    "code, expected 0x%8.8X%8.8X\n", Paths[j],
+                    (UINT32) Arg.Integer.Value,
+                    ACPI_FORMAT_UINT64 (((ACPI_OBJECT *)
+                        ReturnBuf.Pointer)->Integer.Value),
+                    ACPI_FORMAT_UINT64 (Expected));
+            }
+
+            AcpiOsFree (ReturnBuf.Pointer);
+        }
+    }
+
+Cleanup:
+    AcpiGbl_EnableJit = SaveJit;
+    AcpiGbl_EnableMethodMemo = SaveMemo;
+
+    /* Frees the native code of the methods */
+
+    Status = AcpiUnloadTable (TableIndex);
+    ACPI_CHECK_OK (AcpiUnloadTable, Status);
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeLateTest
+ *
+ * DESCRIPTION: Exercise tests that should be performed before shutdown.
+ *
+ *****************************************************************************/
+
+void
+AeLateTest (
+    void)
+{
+    AeGlobalAddressRangeCheck();
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeTestMemMappingCache
+ *
+ * DESCRIPTION: Run scattered accesses through the SystemMemory handler with
+ *              a two-entry mapping cache, so that adjacent pages are merged
+ *              and old mappings are evicted, and check the data. Also
+ *              checks an ACPI_BLOCK_IO transfer. Relies on the identity
+ *              mapping of AcpiOsMapMemory in acpiexec.
+ *
+ *****************************************************************************/
+
+#define AE_MM_TEST_PAGES            16
+
+static void
+AeTestMemMappingCache (
+    void)
+{
+#ifndef ACPI_USE_NATIVE_MEMORY_MAPPING
+    static UINT32           Pages[] = {0, 1, 4, 8, 5, 12, 13, 2, 15, 0};
+    ACPI_MEM_SPACE_CONTEXT  MemInfo;
+    ACPI_STATUS             Status;
+    UINT8                   Block[64];
+    UINT8                   Readback[64];
+    UINT8                   *Buffer;
+    UINT8                   *Base;
+    UINT32                  CacheSize;
+    UINT32                  Merges;
+    UINT32                  Evictions;
+    UINT64                  Value;
+    UINT32                  Offset;
+    UINT32                  i;
+
+
+    Buffer = AcpiOsAllocateZeroed ((AE_MM_TEST_PAGES + 1) *
+        ACPI_DEFAULT_PAGE_SIZE);
+    if (!Buffer)
+    {
+        return;
+    }
+
+    Base = ACPI_CAST_PTR (UINT8,
+        ACPI_ROUND_UP (ACPI_TO_INTEGER (Buffer), ACPI_DEFAULT_PAGE_SIZE));
+
+    memset (&MemInfo, 0, sizeof (MemInfo));
+    MemInfo.Address = ACPI_TO_INTEGER (Base);
+    MemInfo.Length = AE_MM_TEST_PAGES * ACPI_DEFAULT_PAGE_SIZE;
+
+    CacheSize = AcpiGbl_MemMappingCacheSize;
+    AcpiGbl_MemMappingCacheSize = 2;
+    Merges = AcpiGbl_MemMappingMerges;
+    Evictions = AcpiGbl_MemMappingEvictions;
+
+    for (i = 0; i < ACPI_ARRAY_LENGTH (Pages); i++)
+    {
+        Offset = (Pages[i] * ACPI_DEFAULT_PAGE_SIZE) + (i * 8);
+        Value = ACPI_UINT64_MAX - i;
+
+        Status = AcpiExSystemMemorySpaceHandler (ACPI_WRITE,
+            MemInfo.Address + Offset, 64, &Value, NULL, &MemInfo);
+        ACPI_CHECK_OK (AcpiExSystemMemorySpaceHandler, Status);
+
+        Value = 0;
+        Status = AcpiExSystemMemorySpaceHandler (ACPI_READ,
+            MemInfo.Address + Offset, 64, &Value, NULL, &MemInfo);
+        ACPI_CHECK_OK (AcpiExSystemMemorySpaceHandler, Status);
+
+        if ((Value != ACPI_UINT64_MAX - i) ||
+            (*ACPI_CAST_PTR (UINT64, Base + Offset) != ACPI_UINT64_MAX - i))
+        {
+            AcpiOsPrintf ("SystemMemory access at offset %X returned "
+                "%8.8X%8.8X\n", Offset, ACPI_FORMAT_UINT64 (Value));
+        }
+    }
+
+    /* Block transfer of 16 DWords across a page boundary */
+
+    for (i = 0; i < sizeof (Block); i++)
+    {
+        Block[i] = (UINT8) (i + 0x40);
+    }
+
+    Offset = (4 * ACPI_DEFAULT_PAGE_SIZE) - 32;
+    Status = AcpiExSystemMemorySpaceHandler (
+        ACPI_WRITE | ACPI_BLOCK_IO | ((sizeof (Block) / 4) << 16),
+        MemInfo.Address + Offset, 32, ACPI_CAST_PTR (UINT64, Block),
+        NULL, &MemInfo);
+    ACPI_CHECK_OK (AcpiExSystemMemorySpaceHandler, Status);
+
+    memset (Readback, 0, sizeof (Readback));
+    Status = AcpiExSystemMemorySpaceHandler (
+        ACPI_READ | ACPI_BLOCK_IO | ((sizeof (Readback) / 4) << 16),
+        MemInfo.Address + Offset, 32, ACPI_CAST_PTR (UINT64, Readback),
+        NULL, &MemInfo);
+    ACPI_CHECK_OK (AcpiExSystemMemorySpaceHandler, Status);
+
+    if (memcmp (Base + Offset, Block, sizeof (Block)) ||
+        memcmp (Readback, Block, sizeof (Block)))
+    {
+        AcpiOsPrintf ("SystemMemory block transfer at offset %X failed\n",
+            Offset);
+    }
+
+    if (MemInfo.MappingCount > 2 ||
+        AcpiGbl_MemMappingMerges == Merges ||
+        AcpiGbl_MemMappingEvictions == Evictions)
+    {
+        AcpiOsPrintf ("SystemMemory mapping cache: %u mappings, "
+            "%u merges, %u evictions\n", MemInfo.MappingCount,
+            AcpiGbl_MemMappingMerges - Merges,
+            AcpiGbl_MemMappingEvictions - Evictions);
+    }
+
+    AcpiExDeleteMemMappings (&MemInfo);
+    AcpiGbl_MemMappingCacheSize = CacheSize;
+    AcpiOsFree (Buffer);
+#endif
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeTestBlockFieldIo
+ *
+ * DESCRIPTION: Write a 256-byte SystemMemory field and read it back through
+ *              a DWord and a Byte view of the same bytes. All three
+ *              accesses are whole-datum fields and must be done as block
+ *              transfers by AeRegionHandler.
+ *
+ *****************************************************************************/
+
+#define AE_BLOCK_FIELD_LENGTH       256
+
+static void
+AeTestBlockFieldIo (
+    void)
+{
+    static char             *Paths[] = {"\\BKR0", "\\BKR1"};
+    UINT8                   Data[AE_BLOCK_FIELD_LENGTH];
+    ACPI_OBJECT_LIST        ArgList;
+    ACPI_OBJECT             Arg;
+    ACPI_BUFFER             ReturnBuf;
+    ACPI_OBJECT             *Obj;
+    ACPI_STATUS             Status;
+    UINT32                  TableIndex;
+    UINT32                  Transfers;
+    UINT32                  i;
+
+
+    Status = AcpiLoadTable ((ACPI_TABLE_HEADER *) BlockIoSsdtCode,
+        &TableIndex);
+    ACPI_CHECK_OK (AcpiLoadTable, Status);
+    if (ACPI_FAILURE (Status))
+    {
+        return;
+    }
+
+    for (i = 0; i < AE_BLOCK_FIELD_LENGTH; i++)
+    {
+        Data[i] = (UINT8) ((i * 7) + 1);
+    }
+
+    Transfers = AcpiGbl_FieldBlockTransfers;
+
+    Arg.Type = ACPI_TYPE_BUFFER;
+    Arg.Buffer.Length = AE_BLOCK_FIELD_LENGTH;
+    Arg.Buffer.Pointer = Data;
+    ArgList.Count = 1;
+    ArgList.Pointer = &Arg;
+
+    Status = AcpiEvaluateObject (NULL, "\\BKW0", &ArgList, NULL);
+    ACPI_CHECK_OK (AcpiEvaluateObject, Status);
+    if (ACPI_FAILURE (Status))
+    {
+        goto Cleanup;
+    }
+
+    for (i = 0; i < ACPI_ARRAY_LENGTH (Paths); i++)
+    {
+        ReturnBuf.Length = ACPI_ALLOCATE_BUFFER;
+        Status = AcpiEvaluateObjectTyped (NULL, Paths[i], NULL,
+            &ReturnBuf, ACPI_TYPE_BUFFER);
+        ACPI_CHECK_OK (AcpiEvaluateObjectTyped, Status);
+        if (ACPI_FAILURE (Status))
+        {
+            goto Cleanup;
+        }
+
+        Obj = ReturnBuf.Pointer;
+        if ((Obj->Buffer.Length != AE_BLOCK_FIELD_LENGTH) ||
+            memcmp (Obj->Buffer.Pointer, Data, AE_BLOCK_FIELD_LENGTH))
+        {
+            AcpiOsPrintf ("%s returned wrong field data\n", Paths[i]);
+        }
+
+        AcpiOsFree (ReturnBuf.Pointer);
+    }
+
+    if ((AcpiGbl_FieldBlockTransfers - Transfers) != 3)
+    {
+        AcpiOsPrintf ("Expected 3 field block transfers, got %u\n",
+            AcpiGbl_FieldBlockTransfers - Transfers);
+    }
+
+Cleanup:
+    Status = AcpiUnloadTable (TableIndex);
+    ACPI_CHECK_OK (AcpiUnloadTable, Status);
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeEvaluateInteger
+ *
+ * PARAMETERS:  Path                - Object to evaluate
+ *              ArgCount            - 0 or 1
+ *              ArgValue            - Integer argument if ArgCount is 1
+ *              Value               - Where the Integer result is returned
+ *
+ * RETURN:      Status
+ *
+ * DESCRIPTION: Evaluate an object that returns an Integer.
+ *
+ *****************************************************************************/
+
+static ACPI_STATUS
+AeEvaluateInteger (
+    char                    *Path,
+    UINT32                  ArgCount,
+    UINT64                  ArgValue,
+    UINT64                  *Value)
+{
+    ACPI_OBJECT_LIST        ArgList;
+    ACPI_OBJECT             Arg;
+    ACPI_BUFFER             ReturnBuf;
+    ACPI_STATUS             Status;
+
+
+    Arg.Type = ACPI_TYPE_INTEGER;
+    Arg.Integer.Value = ArgValue;
+    ArgList.Count = ArgCount;
+    ArgList.Pointer = &Arg;
+
+    ReturnBuf.Length = ACPI_ALLOCATE_BUFFER;
+    Status = AcpiEvaluateObjectTyped (NULL, Path, &ArgList, &ReturnBuf,
+        ACPI_TYPE_INTEGER);
+    if (ACPI_SUCCESS (Status))
+    {
+        *Value = ((ACPI_OBJECT *) ReturnBuf.Pointer)->Integer.Value;
+        AcpiOsFree (ReturnBuf.Pointer);
+    }
+
+    return (Status);
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeCheckMemoResult
+ *
+ * PARAMETERS:  Path                - Method to evaluate
+ *              ArgCount            - 0 or 1
+ *              ArgValue            - Integer argument if ArgCount is 1
+ *              Expected            - Expected Integer result
+ *
+ * DESCRIPTION: Evaluate a method of MemoSsdtCode and check its result.
+ *
+ *****************************************************************************/
+
+static void
+AeCheckMemoResult (
+    char                    *Path,
+    UINT32                  ArgCount,
+    UINT64                  ArgValue,
+    UINT64                  Expected)
+{
+    ACPI_STATUS             Status;
+    UINT64                  Value;
+
+
+    Status = AeEvaluateInteger (Path, ArgCount, ArgValue, &Value);
+    ACPI_CHECK_OK (AeEvaluateInteger, Status);
+    if (ACPI_SUCCESS (Status) && (Value != Expected))
+    {
+        AcpiOsPrintf ("%s (0x%X) returned 0x%8.8X%8.8X, "
+            "expected 0x%8.8X%8.8X\n", Path, (UINT32) ArgValue,
+            ACPI_FORMAT_UINT64 (Value), ACPI_FORMAT_UINT64 (Expected));
+    }
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeTestMethodMemo
+ *
+ * DESCRIPTION: Check that remembered method results are only returned while
+ *              they are still correct: a new argument, a Store to a named
+ *              object and a table load or unload that changes what a name
+ *              resolves to must all run the method again. Methods that
+ *              store to named objects must never get a memo.
+ *
+ *****************************************************************************/
+
+static void
+AeTestMethodMemo (
+    void)
+{
+    static char             *ImpurePaths[] = {"\\MSET", "\\MIMP"};
+    ACPI_OBJECT_LIST        ArgList;
+    ACPI_OBJECT             Arg;
+    ACPI_OPERAND_OBJECT     *ObjDesc;
+    ACPI_HANDLE             Handle;
+    ACPI_STATUS             Status;
+    UINT8                   SaveMemo;
+    UINT32                  TableIndex;
+    UINT32                  Table2Index;
+    UINT32                  Hits;
+    UINT32                  i;
+
+
+    SaveMemo = AcpiGbl_EnableMethodMemo;
+    AcpiGbl_EnableMethodMemo = TRUE;
+
+    Status = AcpiLoadTable ((ACPI_TABLE_HEADER *) MemoSsdtCode, &TableIndex);
+    ACPI_CHECK_OK (AcpiLoadTable, Status);
+    if (ACPI_FAILURE (Status))
+    {
+        AcpiGbl_EnableMethodMemo = SaveMemo;
+        return;
+    }
+
+    /* Only the pure method gets a memo */
+
+    Status = AcpiGetHandle (NULL, "\\MPU1", &Handle);
+    ACPI_CHECK_OK (AcpiGetHandle, Status);
+    ObjDesc = AcpiNsGetAttachedObject (Handle);
+    if (!ObjDesc || !ObjDesc->Method.Memo)
+    {
+        AcpiOsPrintf ("\\MPU1 has no memo\n");
+    }
+
+    for (i = 0; i < ACPI_ARRAY_LENGTH (ImpurePaths); i++)
+    {
+        Status = AcpiGetHandle (NULL, ImpurePaths[i], &Handle);
+        ACPI_CHECK_OK (AcpiGetHandle, Status);
+        ObjDesc = AcpiNsGetAttachedObject (Handle);
+        if (ObjDesc && ObjDesc->Method.Memo)
+        {
+            AcpiOsPrintf ("%s has a memo\n", ImpurePaths[i]);
+        }
+    }
+
+    /* The second evaluation with the same argument is a hit */
+
+    Hits = AcpiGbl_MethodMemoHits;
+    AeCheckMemoResult ("\\MPU1", 1, 1, 6);
+    AeCheckMemoResult ("\\MPU1", 1, 1, 6);
+    if (AcpiGbl_MethodMemoHits - Hits != 1)
+    {
+        AcpiOsPrintf ("\\MPU1: %u memo hits, expected 1\n",
+            AcpiGbl_MethodMemoHits - Hits);
+    }
+
+    /* A new argument, then a Store to the named object the method reads */
+
+    AeCheckMemoResult ("\\MPU1", 1, 2, 7);
+    Arg.Type = ACPI_TYPE_INTEGER;
+    Arg.Integer.Value = 10;
+    ArgList.Count = 1;
+    ArgList.Pointer = &Arg;
+
+    Status = AcpiEvaluateObject (NULL, "\\MSET", &ArgList, NULL);
+    ACPI_CHECK_OK (AcpiEvaluateObject, Status);
+
+    AeCheckMemoResult ("\\MPU1", 1, 1, 11);
+    AeCheckMemoResult ("\\MPU1", 1, 2, 12);
+
+    /* An impure method runs every time */
+
+    AeCheckMemoResult ("\\MIMP", 0, 0, 1);
+    AeCheckMemoResult ("\\MIMP", 0, 0, 2);
+
+    /* Loading and unloading a table changes what MVAL resolves to */
+
+    AeCheckMemoResult ("\\MSCP.MPU2", 0, 0, 1);
+    AeCheckMemoResult ("\\MSCP.MPU2", 0, 0, 1);
+
+    Status = AcpiLoadTable ((ACPI_TABLE_HEADER *) MemoSsdt2Code,
+        &Table2Index);
+    ACPI_CHECK_OK (AcpiLoadTable, Status);
+    if (ACPI_SUCCESS (Status))
+    {
+        AeCheckMemoResult ("\\MSCP.MPU2", 0, 0, 2);
+
+        Status = AcpiUnloadTable (Table2Index);
+        ACPI_CHECK_OK (AcpiUnloadTable, Status);
+
+        AeCheckMemoResult ("\\MSCP.MPU2", 0, 0, 1);
+    }
+
+    Status = AcpiUnloadTable (TableIndex);
+    ACPI_CHECK_OK (AcpiUnloadTable, Status);
+
+    AcpiGbl_EnableMethodMemo = SaveMemo;
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeTestPathnameCache
+ *
+ * DESCRIPTION: Check that a cached node pathname held by an evaluation
+ *              stays valid when the table that owns the node is unloaded,
+ *              and that AcpiGetName returns the same string.
+ *
+ *****************************************************************************/
+
+static void
+AeTestPathnameCache (
+    void)
+{
+    ACPI_BUFFER             ReturnBuf;
+    ACPI_HANDLE             Handle;
+    ACPI_STATUS             Status;
+    UINT8                   SaveCache;
+    BOOLEAN                 Cached;
+    UINT32                  TableIndex;
+    char                    *Pathname;
+
+
+    SaveCache = AcpiGbl_EnablePathnameCache;
+    AcpiGbl_EnablePathnameCache = TRUE;
+
+    Status = AcpiLoadTable ((ACPI_TABLE_HEADER *) MemoSsdtCode, &TableIndex);
+    ACPI_CHECK_OK (AcpiLoadTable, Status);
+    if (ACPI_FAILURE (Status))
+    {
+        AcpiGbl_EnablePathnameCache = SaveCache;
+        return;
+    }
+
+    Status = AcpiGetHandle (NULL, "\\MSCP.MPU2", &Handle);
+    ACPI_CHECK_OK (AcpiGetHandle, Status);
+
+    Pathname = AcpiNsGetCachedPathname (Handle, &Cached);
+    if (!Pathname || !Cached)
+    {
+        AcpiOsPrintf ("\\MSCP.MPU2: pathname was not cached\n");
+        AcpiNsReleaseCachedPathname (Pathname, Cached);
+        (void) AcpiUnloadTable (TableIndex);
+        AcpiGbl_EnablePathnameCache = SaveCache;
+        return;
+    }
+
+    ReturnBuf.Length = ACPI_ALLOCATE_BUFFER;
+    Status = AcpiGetName (Handle, ACPI_FULL_PATHNAME_NO_TRAILING, &ReturnBuf);
+    ACPI_CHECK_OK (AcpiGetName, Status);
+    if (ACPI_SUCCESS (Status))
+    {
+        if (strcmp (ReturnBuf.Pointer, Pathname))
+        {
+            AcpiOsPrintf ("AcpiGetName returned %s, cached pathname is %s\n",
+                (char *) ReturnBuf.Pointer, Pathname);
+        }
+
+        AcpiOsFree (ReturnBuf.Pointer);
+    }
+
+    /* The node goes away, the reference keeps the string */
+
+    Status = AcpiUnloadTable (TableIndex);
+    ACPI_CHECK_OK (AcpiUnloadTable, Status);
+
+    if (strcmp (Pathname, "\\MSCP.MPU2"))
+    {
+        AcpiOsPrintf ("Cached pathname changed to %s by table unload\n",
+            Pathname);
+    }
+
+    AcpiNsReleaseCachedPathname (Pathname, Cached);
+    AcpiGbl_EnablePathnameCache = SaveCache;
+}
+
+
+/******************************************************************************
+ *
+ * FUNCTION:    AeTestParallelExecution
+ *
+ * DESCRIPTION: Stress AcpiGbl_ParallelExecution. The same evaluations are
+ *              run one at a time with the mode off, then all at once on the
+ *              AcpiEvaluateObjectAsync workers with the mode on, several
+ *              times. Each method must return the same value both ways,
+ *              and the named counters that PSH1 updates between private
+ *              operators must not lose an update.
+ *
+ *****************************************************************************/
+
+#define AE_PARALLEL_EVALUATIONS     16
+#define AE_PARALLEL_ROUNDS          8
+
+static void
+AeTestParallelExecution (
+    void)
+{
+    static char             *Paths[] = {"\\PRV1", "\\PSH1"};
+    static char             *Counters[] = {"\\PCNT", "\\PSUM"};
+    AE_ASYNC_RESULT         Results[AE_PARALLEL_EVALUATIONS];
+    UINT64                  Serial[AE_PARALLEL_EVALUATIONS];
+    UINT64                  SerialCounters[2];
+    UINT64                  Value;
+    ACPI_OBJECT_LIST        ArgList;
+    ACPI_OBJECT             Arg;
+    ACPI_STATUS             Status;
+    UINT8                   SaveParallel;
+    UINT8                   SaveJit;
+    UINT8                   SaveMemo;
+    UINT32                  TableIndex;
+    UINT32                  Round;
+    UINT32                  i;
+
+
+    /* Both would skip the interpreter for these methods */
+
+    SaveParallel = AcpiGbl_ParallelExecution;
+    SaveJit = AcpiGbl_EnableJit;
+    SaveMemo = AcpiGbl_EnableMethodMemo;
+    AcpiGbl_EnableJit = FALSE;
+    AcpiGbl_EnableMethodMemo = FALSE;
+
+    Status = AcpiLoadTable ((ACPI_TABLE_HEADER *) ParallelSsdtCode,
+        &TableIndex);
+    ACPI_CHECK_OK (AcpiLoadTable, Status);
+    if (ACPI_FAILURE (Status))
+    {
+        goto Exit;
+    }
+
+    /* Serial: one evaluation at a time, the interpreter is never yielded */
+
+    AcpiGbl_ParallelExecution = FALSE;
+    for (i = 0; i < AE_PARALLEL_EVALUATIONS; i++)
+    {
+        Serial[i] = 0;
+        Status = AeEvaluateInteger (Paths[i % 2], 1, i + 1, &Serial[i]);
+        ACPI_CHECK_OK (AeEvaluateInteger, Status);
+    }
+
+    for (i = 0; i < ACPI_ARRAY_LENGTH (Counters); i++)
+    {
+        SerialCounters[i] = 0;
+        Status = AeEvaluateInteger (Counters[i], 0, 0, &SerialCounters[i]);
+        ACPI_CHECK_OK (AeEvaluateInteger, Status);
+    }
+
+    /* Parallel: all evaluations at once on the async workers */
+
+    AcpiGbl_ParallelExecution = TRUE;
+    Arg.Type = ACPI_TYPE_INTEGER;
+    ArgList.Count = 1;
+    ArgList.Pointer = &Arg;
+
+    for (Round = 0; Round < AE_PARALLEL_ROUNDS; Round++)
+    {
+        Status = AcpiEvaluateObject (NULL, "\\PRST", NULL, NULL);
+        ACPI_CHECK_OK (AcpiEvaluateObject, Status);
+
+        memset (Results, 0, sizeof (Results));
+        for (i = 0; i < AE_PARALLEL_EVALUATIONS; i++)
+        {
+            Status = AcpiOsCreateSemaphore (1, 0, &Results[i].Done);
+            ACPI_CHECK_OK (AcpiOsCreateSemaphore, Status);
+
+            Arg.Integer.Value = i + 1;
+            Status = AcpiEvaluateObjectAsync (NULL, Paths[i % 2], &ArgList,
+                AeAsyncCallback, &Results[i]);
+            ACPI_CHECK_OK (AcpiEvaluateObjectAsync, Status);
+        }
+
+        for (i = 0; i < AE_PARALLEL_EVALUATIONS; i++)
+        {
+            Status = AcpiOsWaitSemaphore (Results[i].Done, 1, 10000);
+            ACPI_CHECK_OK (AcpiOsWaitSemaphore, Status);
+            (void) AcpiOsDeleteSemaphore (Results[i].Done);
+
+            if (ACPI_FAILURE (Results[i].Status) ||
+                (Results[i].Value != Serial[i]))
+            {
+                AcpiOsPrintf ("%s (0x%X) in parallel: %s 0x%8.8X%8.8X, "
+                    "serial 0x%8.8X%8.8X\n", Paths[i % 2], i + 1,
+                    AcpiFormatException (Results[i].Status),
+                    ACPI_FORMAT_UINT64 (Results[i].Value),
+                    ACPI_FORMAT_UINT64 (Serial[i]));
+            }
+        }
+
+        for (i = 0; i < ACPI_ARRAY_LENGTH (Counters); i++)
+        {
+            Value = 0;
+            Status = AeEvaluateInteger (Counters[i], 0, 0, &Value);
+            ACPI_CHECK_OK (AeEvaluateInteger, Status);
+            if (Value != SerialCounters[i])
+            {
+                AcpiOsPrintf ("%s after parallel round %u: 0x%8.8X%8.8X, "
+                    "serial 0x%8.8X%8.8X\n", Counters[i], Round,
+                    ACPI_FORMAT_UINT64 (Value),
+                    ACPI_FORMAT_UINT64 (SerialCounters[i]));
+            }
+        }
+    }
+
+    Status = AcpiUnloadTable (TableIndex);
+    ACPI_CHECK_OK (AcpiUnloadTable, Status);
+
+Exit:
+    AcpiGbl_ParallelExecution = SaveParallel;
+    AcpiGbl_EnableJit = SaveJit;
+    AcpiGbl_EnableMethodMemo = SaveMemo;
 }
 
 